@@ -23,17 +23,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "TinyGPSPlus.h"
 
-#include <ctype.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
-#define _GPRMCterm "GPRMC"
-#define _GPGGAterm "GPGGA"
-#define _GNRMCterm "GNRMC"
-#define _GNGGAterm "GNGGA"
+#define _GPS_TALKER(a, b) (((unsigned)(a) << 8) | (unsigned)(b))
 
 static double radians(double degrees) { return degrees * (M_PI / 180.0); }
 static double degrees(double radians) { return radians * (180.0 / M_PI); }
@@ -44,10 +39,13 @@ unsigned long millis() { return pdTICKS_TO_MS(xTaskGetTickCount()); }
 
 TinyGPSPlus::TinyGPSPlus()
     : parity(0), isChecksumTerm(false), curSentenceType(GPS_SENTENCE_OTHER),
-      curTermNumber(0), curTermOffset(0), sentenceHasFix(false), customElts(0),
-      customCandidates(0), encodedCharCount(0), sentencesWithFixCount(0),
-      failedChecksumCount(0), passedChecksumCount(0) {
+      curTermNumber(0), curTermOffset(0), sentenceHasFix(false), curSystem(-1),
+      gsvTotal(0), gsvNumber(0), gsvInView(0), gsaCount(0), gsaSystem(-1),
+      customPending(0), curSentenceHash(0), encodedCharCount(0),
+      sentencesWithFixCount(0), failedChecksumCount(0), passedChecksumCount(0) {
   term[0] = '\0';
+  curSentenceName[0] = '\0';
+  memset(customBuckets, 0, sizeof(customBuckets));
 }
 
 //
@@ -56,6 +54,110 @@ TinyGPSPlus::TinyGPSPlus()
 bool TinyGPSPlus::encode(char c) {
   ++encodedCharCount;
 
+  if (isDelimiter((uint8_t)c))
+    return encodeDelimiter(c);
+  encodeSpan((const uint8_t *)&c, 1);
+  return false;
+}
+
+unsigned TinyGPSPlus::encode(const uint8_t *buf, size_t len) {
+  encodedCharCount += len;
+
+  unsigned validSentences = 0;
+  const uint8_t *const end = buf + len;
+  while (buf < end) {
+    const uint8_t *delimiter = findDelimiter(buf, end);
+    encodeSpan(buf, delimiter - buf);
+    if (delimiter == end)
+      break;
+    if (encodeDelimiter((char)*delimiter))
+      ++validSentences;
+    buf = delimiter + 1;
+  }
+  return validSentences;
+}
+
+//
+// block parsing helpers
+//
+
+bool TinyGPSPlus::isDelimiter(uint8_t c) {
+  return c == ',' || c == '*' || c == '$' || c == '\r' || c == '\n';
+}
+
+// All delimiters are below '-', so a word without such bytes can be skipped
+// with three operations instead of comparing each byte against five values
+#define _GPS_DELIMITER_LIMIT 0x2D
+
+static inline bool hasByteBelowLimit(uint32_t word) {
+  return ((word - 0x01010101UL * _GPS_DELIMITER_LIMIT) & ~word &
+          0x80808080UL) != 0;
+}
+
+const uint8_t *TinyGPSPlus::findDelimiter(const uint8_t *p,
+                                          const uint8_t *end) {
+  // Bytes up to the first word boundary
+  while (p < end && ((uintptr_t)p & 3) != 0) {
+    if (isDelimiter(*p))
+      return p;
+    ++p;
+  }
+
+  while (end - p >= 4) {
+    uint32_t word;
+    memcpy(&word, __builtin_assume_aligned(p, 4), sizeof(word));
+    if (hasByteBelowLimit(word)) {
+      // Spaces and other low characters are possible, confirm byte by byte
+      for (int i = 0; i < 4; ++i)
+        if (isDelimiter(p[i]))
+          return p + i;
+    }
+    p += 4;
+  }
+
+  while (p < end && !isDelimiter(*p))
+    ++p;
+  return p;
+}
+
+static uint8_t xorBytes(const uint8_t *p, size_t len) {
+  uint8_t result = 0;
+  while (len > 0 && ((uintptr_t)p & 3) != 0) {
+    result ^= *p++;
+    --len;
+  }
+
+  uint32_t words = 0;
+  for (; len >= 4; len -= 4, p += 4) {
+    uint32_t word;
+    memcpy(&word, __builtin_assume_aligned(p, 4), sizeof(word));
+    words ^= word;
+  }
+  words ^= words >> 16;
+  words ^= words >> 8;
+  result ^= (uint8_t)words;
+
+  while (len-- > 0)
+    result ^= *p++;
+  return result;
+}
+
+// Ordinary characters of the current term, which may continue in the next block
+void TinyGPSPlus::encodeSpan(const uint8_t *p, size_t len) {
+  if (len == 0)
+    return;
+
+  if (curTermOffset < sizeof(term) - 1) {
+    size_t room = sizeof(term) - 1 - curTermOffset;
+    size_t count = len < room ? len : room;
+    memcpy(term + curTermOffset, p, count);
+    curTermOffset += count;
+  }
+  if (!isChecksumTerm)
+    parity ^= xorBytes(p, len);
+}
+
+bool TinyGPSPlus::encodeDelimiter(char c) {
   switch (c) {
   case ',': // term terminators
     parity ^= (uint8_t)c;
@@ -80,13 +182,6 @@ bool TinyGPSPlus::encode(char c) {
     isChecksumTerm = false;
     sentenceHasFix = false;
     return false;
-
-  default: // ordinary characters
-    if (curTermOffset < sizeof(term) - 1)
-      term[curTermOffset++] = c;
-    if (!isChecksumTerm)
-      parity ^= c;
-    return false;
   }
 
   return false;
@@ -104,38 +199,47 @@ int TinyGPSPlus::fromHex(char a) {
     return a - '0';
 }
 
+static inline bool isDigit(char c) { return (unsigned char)(c - '0') < 10; }
+
+// Accumulates the leading digits of a term and leaves `term` on the first
+// non-digit, so callers continue with the fraction without re-scanning
+static uint32_t parseDigits(const char *&term) {
+  uint32_t ret = 0;
+  while (isDigit(*term))
+    ret = 10 * ret + (uint32_t)(*term++ - '0');
+  return ret;
+}
+
+static uint32_t parseUnsigned(const char *term) { return parseDigits(term); }
+
 // static
 // Parse a (potentially negative) number with up to 2 decimal digits -xxxx.yy
 int32_t TinyGPSPlus::parseDecimal(const char *term) {
   bool negative = *term == '-';
   if (negative)
     ++term;
-  int32_t ret = 100 * (int32_t)atol(term);
-  while (isdigit(*term))
-    ++term;
-  if (*term == '.' && isdigit(term[1])) {
+  uint32_t ret = 100 * parseDigits(term);
+  if (*term == '.' && isDigit(term[1])) {
     ret += 10 * (term[1] - '0');
-    if (isdigit(term[2]))
+    if (isDigit(term[2]))
       ret += term[2] - '0';
   }
-  return negative ? -ret : ret;
+  return negative ? -(int32_t)ret : (int32_t)ret;
 }
 
 // static
 // Parse degrees in that funny NMEA format DDMM.MMMM
 void TinyGPSPlus::parseDegrees(const char *term, RawDegrees &deg) {
-  uint32_t leftOfDecimal = (uint32_t)atol(term);
+  uint32_t leftOfDecimal = parseDigits(term);
   uint16_t minutes = (uint16_t)(leftOfDecimal % 100);
   uint32_t multiplier = 10000000UL;
   uint32_t tenMillionthsOfMinutes = minutes * multiplier;
 
   deg.deg = (int16_t)(leftOfDecimal / 100);
 
-  while (isdigit(*term))
-    ++term;
-
+  // Digits past the 7th decimal of a minute are below a nano-degree
   if (*term == '.')
-    while (isdigit(*++term)) {
+    while (isDigit(*++term) && multiplier > 1) {
       multiplier /= 10;
       tenMillionthsOfMinutes += (*term - '0') * multiplier;
     }
@@ -147,6 +251,128 @@ void TinyGPSPlus::parseDegrees(const char *term, RawDegrees &deg) {
 #define COMBINE(sentence_type, term_number)                                    \
   (((unsigned)(sentence_type) << 5) | term_number)
 
+// Identifies the sentence from its five character address, e.g. "GNRMC". The
+// formatters we parse hash without collisions on their last two letters, so a
+// table lookup and one comparison replace a chain of strcmp calls.
+#define _GPS_SENTENCE_HASH(c1, c2) (((3 * (unsigned)(c1) + (c2)) >> 2) & 7)
+
+void TinyGPSPlus::parseSentenceType() {
+  static const struct {
+    char formatter[4];
+    uint8_t type;
+  } sentences[8] = {
+      {"VTG", GPS_SENTENCE_VTG}, {"", GPS_SENTENCE_OTHER},
+      {"RMC", GPS_SENTENCE_RMC}, {"GSV", GPS_SENTENCE_GSV},
+      {"GLL", GPS_SENTENCE_GLL}, {"GGA", GPS_SENTENCE_GGA},
+      {"GSA", GPS_SENTENCE_GSA}, {"", GPS_SENTENCE_OTHER},
+  };
+
+  curSentenceType = GPS_SENTENCE_OTHER;
+  curSystem = -1;
+  gsvTotal = gsvNumber = gsvInView = 0;
+  memset(gsvSats, 0, sizeof(gsvSats));
+  gsaCount = 0;
+  gsaSystem = -1;
+
+  if (curTermOffset != 5)
+    return;
+  unsigned hash = _GPS_SENTENCE_HASH(term[3], term[4]);
+  if (memcmp(term + 2, sentences[hash].formatter, 3) != 0)
+    return;
+  curSentenceType = sentences[hash].type;
+  // VTG carries no status field, only the NMEA 2.3 mode can mark it invalid
+  sentenceHasFix = curSentenceType == GPS_SENTENCE_VTG;
+
+  switch (_GPS_TALKER(term[0], term[1])) {
+  case _GPS_TALKER('G', 'P'):
+    curSystem = GPS_SYSTEM_GPS;
+    break;
+  case _GPS_TALKER('G', 'L'):
+    curSystem = GPS_SYSTEM_GLONASS;
+    break;
+  case _GPS_TALKER('G', 'A'):
+    curSystem = GPS_SYSTEM_GALILEO;
+    break;
+  case _GPS_TALKER('G', 'B'):
+  case _GPS_TALKER('B', 'D'):
+    curSystem = GPS_SYSTEM_BEIDOU;
+    break;
+  case _GPS_TALKER('G', 'Q'):
+  case _GPS_TALKER('Q', 'Z'):
+    curSystem = GPS_SYSTEM_QZSS;
+    break;
+  }
+}
+
+// Satellite IDs of the GSA (3-14) and GSV (4-19) repeating fields
+void TinyGPSPlus::setSatelliteTerm() {
+  if (curSentenceType == GPS_SENTENCE_GSA) {
+    if (curTermNumber >= 3 && curTermNumber < 3 + _GPS_MAX_ACTIVE_SATELLITES &&
+        gsaCount < _GPS_MAX_ACTIVE_SATELLITES)
+      gsaPrns[gsaCount++] = (uint16_t)parseUnsigned(term);
+    return;
+  }
+
+  if (curTermNumber < 4)
+    return;
+  unsigned index = (curTermNumber - 4) / 4;
+  if (index >= _GPS_SATELLITES_PER_GSV)
+    return; // NMEA 4.1 signal ID
+  TinyGPSSatellite &sat = gsvSats[index];
+  uint32_t value = parseUnsigned(term);
+  switch ((curTermNumber - 4) % 4) {
+  case 0:
+    sat.prn = (uint16_t)value;
+    break;
+  case 1:
+    sat.elevation = (uint8_t)value;
+    break;
+  case 2:
+    sat.azimuth = (uint16_t)value;
+    break;
+  case 3:
+    sat.snr = (uint8_t)value;
+    break;
+  }
+}
+
+// GN sentences mix systems, the extended satellite numbering tells them apart
+static int8_t systemFromPrn(uint16_t prn) {
+  if (prn >= 65 && prn <= 96)
+    return GPS_SYSTEM_GLONASS;
+  if (prn >= 193 && prn <= 199)
+    return GPS_SYSTEM_QZSS;
+  if ((prn >= 201 && prn <= 263) || (prn >= 401 && prn <= 437))
+    return GPS_SYSTEM_BEIDOU;
+  if (prn >= 301 && prn <= 336)
+    return GPS_SYSTEM_GALILEO;
+  return GPS_SYSTEM_GPS;
+}
+
+void TinyGPSPlus::commitSatellites() {
+  int8_t system = curSystem;
+
+  if (curSentenceType == GPS_SENTENCE_GSA) {
+    if (system < 0)
+      system = gsaSystem >= 0 ? gsaSystem
+                              : gsaCount > 0 ? systemFromPrn(gsaPrns[0]) : -1;
+    if (system >= 0)
+      constellations[system].setActive(gsaPrns, gsaCount);
+    return;
+  }
+
+  // The checksum follows the last data term; a trailing signal ID rounds away
+  uint8_t lastTerm = curTermNumber - 1;
+  uint8_t count = lastTerm > 3 ? (lastTerm - 3) / 4 : 0;
+  if (count > _GPS_SATELLITES_PER_GSV)
+    count = _GPS_SATELLITES_PER_GSV;
+  if (system < 0 && count > 0)
+    system = systemFromPrn(gsvSats[0].prn);
+  if (system >= 0)
+    constellations[system].addView(gsvTotal, gsvNumber, gsvInView, gsvSats,
+                                   count);
+}
+
 // Processes a just-completed term
 // Returns true if new sentence has just passed checksum test and is validated
 bool TinyGPSPlus::endOfTermHandler() {
@@ -159,7 +385,7 @@ bool TinyGPSPlus::endOfTermHandler() {
         ++sentencesWithFixCount;
 
       switch (curSentenceType) {
-      case GPS_SENTENCE_GPRMC:
+      case GPS_SENTENCE_RMC:
         date.commit();
         time.commit();
         if (sentenceHasFix) {
@@ -168,7 +394,7 @@ bool TinyGPSPlus::endOfTermHandler() {
           course.commit();
         }
         break;
-      case GPS_SENTENCE_GPGGA:
+      case GPS_SENTENCE_GGA:
         time.commit();
         if (sentenceHasFix) {
           location.commit();
@@ -177,14 +403,33 @@ bool TinyGPSPlus::endOfTermHandler() {
         satellites.commit();
         hdop.commit();
         break;
+      case GPS_SENTENCE_GSA:
+        fixMode.commit();
+        pdop.commit();
+        hdop.commit();
+        vdop.commit();
+        commitSatellites();
+        break;
+      case GPS_SENTENCE_GSV:
+        commitSatellites();
+        break;
+      case GPS_SENTENCE_VTG:
+        if (sentenceHasFix) {
+          speed.commit();
+          course.commit();
+        }
+        break;
+      case GPS_SENTENCE_GLL:
+        time.commit();
+        if (sentenceHasFix)
+          location.commit();
+        break;
       }
 
-      // Commit all custom listeners of this sentence type
-      for (TinyGPSCustom *p = customCandidates;
-           p != NULL &&
-           strcmp(p->sentenceName, customCandidates->sentenceName) == 0;
-           p = p->next)
+      // Commit all custom listeners set by this sentence
+      for (TinyGPSCustom *p = customPending; p != NULL; p = p->nextPending)
         p->commit();
+      customPending = NULL;
       return true;
     }
 
@@ -197,82 +442,111 @@ bool TinyGPSPlus::endOfTermHandler() {
 
   // the first term determines the sentence type
   if (curTermNumber == 0) {
-    if (!strcmp(term, _GPRMCterm) || !strcmp(term, _GNRMCterm))
-      curSentenceType = GPS_SENTENCE_GPRMC;
-    else if (!strcmp(term, _GPGGAterm) || !strcmp(term, _GNGGAterm))
-      curSentenceType = GPS_SENTENCE_GPGGA;
-    else
-      curSentenceType = GPS_SENTENCE_OTHER;
-
-    // Any custom candidates of this sentence type?
-    for (customCandidates = customElts;
-         customCandidates != NULL &&
-         strcmp(customCandidates->sentenceName, term) < 0;
-         customCandidates = customCandidates->next)
-      ;
-    if (customCandidates != NULL &&
-        strcmp(customCandidates->sentenceName, term) > 0)
-      customCandidates = NULL;
-
+    parseSentenceType();
+    curSentenceHash = hashSentenceName(term);
+    memcpy(curSentenceName, term, sizeof(curSentenceName));
+    customPending = NULL;
     return false;
   }
 
-  if (curSentenceType != GPS_SENTENCE_OTHER && term[0])
+  // COMBINE() leaves 5 bits for the term number
+  if (curSentenceType != GPS_SENTENCE_OTHER && term[0] && curTermNumber < 32)
     switch (COMBINE(curSentenceType, curTermNumber)) {
-    case COMBINE(GPS_SENTENCE_GPRMC, 1): // Time in both sentences
-    case COMBINE(GPS_SENTENCE_GPGGA, 1):
+    case COMBINE(GPS_SENTENCE_RMC, 1): // Time in both sentences
+    case COMBINE(GPS_SENTENCE_GGA, 1):
+    case COMBINE(GPS_SENTENCE_GLL, 5):
       time.setTime(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 2): // GPRMC validity
+    case COMBINE(GPS_SENTENCE_RMC, 2): // RMC validity
+    case COMBINE(GPS_SENTENCE_GLL, 6):
       sentenceHasFix = term[0] == 'A';
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 3): // Latitude
-    case COMBINE(GPS_SENTENCE_GPGGA, 2):
+    case COMBINE(GPS_SENTENCE_RMC, 3): // Latitude
+    case COMBINE(GPS_SENTENCE_GGA, 2):
+    case COMBINE(GPS_SENTENCE_GLL, 1):
       location.setLatitude(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 4): // N/S
-    case COMBINE(GPS_SENTENCE_GPGGA, 3):
+    case COMBINE(GPS_SENTENCE_RMC, 4): // N/S
+    case COMBINE(GPS_SENTENCE_GGA, 3):
+    case COMBINE(GPS_SENTENCE_GLL, 2):
       location.rawNewLatData.negative = term[0] == 'S';
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 5): // Longitude
-    case COMBINE(GPS_SENTENCE_GPGGA, 4):
+    case COMBINE(GPS_SENTENCE_RMC, 5): // Longitude
+    case COMBINE(GPS_SENTENCE_GGA, 4):
+    case COMBINE(GPS_SENTENCE_GLL, 3):
       location.setLongitude(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 6): // E/W
-    case COMBINE(GPS_SENTENCE_GPGGA, 5):
+    case COMBINE(GPS_SENTENCE_RMC, 6): // E/W
+    case COMBINE(GPS_SENTENCE_GGA, 5):
+    case COMBINE(GPS_SENTENCE_GLL, 4):
       location.rawNewLngData.negative = term[0] == 'W';
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 7): // Speed (GPRMC)
+    case COMBINE(GPS_SENTENCE_RMC, 7): // Speed (RMC)
+    case COMBINE(GPS_SENTENCE_VTG, 5):
       speed.set(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 8): // Course (GPRMC)
+    case COMBINE(GPS_SENTENCE_RMC, 8): // Course (RMC)
+    case COMBINE(GPS_SENTENCE_VTG, 1):
       course.set(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPRMC, 9): // Date (GPRMC)
+    case COMBINE(GPS_SENTENCE_RMC, 9): // Date (RMC)
       date.setDate(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPGGA, 6): // Fix data (GPGGA)
+    case COMBINE(GPS_SENTENCE_GGA, 6): // Fix data (GGA)
       sentenceHasFix = term[0] > '0';
       break;
-    case COMBINE(GPS_SENTENCE_GPGGA, 7): // Satellites used (GPGGA)
+    case COMBINE(GPS_SENTENCE_GGA, 7): // Satellites used (GGA)
       satellites.set(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPGGA, 8): // HDOP
+    case COMBINE(GPS_SENTENCE_GGA, 8): // HDOP
+    case COMBINE(GPS_SENTENCE_GSA, 16):
       hdop.set(term);
       break;
-    case COMBINE(GPS_SENTENCE_GPGGA, 9): // Altitude (GPGGA)
+    case COMBINE(GPS_SENTENCE_GGA, 9): // Altitude (GGA)
       altitude.set(term);
       break;
+    case COMBINE(GPS_SENTENCE_VTG, 9): // Mode indicator (VTG, NMEA 2.3)
+      sentenceHasFix = term[0] != 'N';
+      break;
+    case COMBINE(GPS_SENTENCE_GSA, 2): // Fix mode (GSA)
+      fixMode.set(term);
+      break;
+    case COMBINE(GPS_SENTENCE_GSA, 15): // PDOP
+      pdop.set(term);
+      break;
+    case COMBINE(GPS_SENTENCE_GSA, 17): // VDOP
+      vdop.set(term);
+      break;
+    case COMBINE(GPS_SENTENCE_GSA, 18): // System ID (GSA, NMEA 4.1)
+      gsaSystem = term[0] >= '1' && term[0] <= '5' ? term[0] - '1' : -1;
+      break;
+    case COMBINE(GPS_SENTENCE_GSV, 1): // Number of messages (GSV)
+      gsvTotal = (uint8_t)parseUnsigned(term);
+      break;
+    case COMBINE(GPS_SENTENCE_GSV, 2): // Message number (GSV)
+      gsvNumber = (uint8_t)parseUnsigned(term);
+      break;
+    case COMBINE(GPS_SENTENCE_GSV, 3): // Satellites in view (GSV)
+      gsvInView = (uint8_t)parseUnsigned(term);
+      break;
+    default:
+      if (curSentenceType == GPS_SENTENCE_GSA ||
+          curSentenceType == GPS_SENTENCE_GSV)
+        setSatelliteTerm();
+      break;
     }
 
-  // Set custom values as needed
-  for (TinyGPSCustom *p = customCandidates;
-       p != NULL &&
-       strcmp(p->sentenceName, customCandidates->sentenceName) == 0 &&
-       p->termNumber <= curTermNumber;
-       p = p->next)
-    if (p->termNumber == curTermNumber)
+  // Set custom values as needed, the name is only compared on a hash match
+  for (TinyGPSCustom *p =
+           customBuckets[customBucket(curSentenceHash, curTermNumber)];
+       p != NULL; p = p->next)
+    if (p->sentenceHash == curSentenceHash &&
+        p->termNumber == curTermNumber &&
+        strcmp(p->sentenceName, curSentenceName) == 0) {
       p->set(term);
+      p->nextPending = customPending;
+      customPending = p;
+    }
 
   return false;
 }
@@ -300,7 +574,7 @@ double TinyGPSPlus::distanceBetween(double lat1, double long1, double lat2,
   delta = sqrt(delta);
   double denom = (slat1 * slat2) + (clat1 * clat2 * cdlong);
   delta = atan2(delta, denom);
-  return delta * 6372795;
+  return delta * _GPS_EARTH_RADIUS;
 }
 
 double TinyGPSPlus::courseTo(double lat1, double long1, double lat2,
@@ -322,6 +596,165 @@ double TinyGPSPlus::courseTo(double lat1, double long1, double lat2,
   return degrees(a2);
 }
 
+// The batch functions below evaluate minimax polynomials fitted on exactly the
+// ranges they are called with, so there is no argument reduction and no
+// branch that the compiler cannot turn into a select. For the loops to
+// vectorise they need -fno-math-errno (an inline sqrtf) and
+// -fno-trapping-math (selects between float expressions), integer math is
+// kept to 32 bits. Against distanceBetween, distances up to 17500 km stay
+// within 1e-6 relative and courses within 1e-4 degrees, 1e-3 and 0.05 degrees
+// with 4 digits. Closer to the antipode single precision runs out.
+
+// 1e-7 degrees to radians, and to half of the angle in radians
+static const float RADIANS_E7 = (float)(M_PI / 180.0 / 1e7);
+static const float HALF_RADIANS_E7 = (float)(M_PI / 360.0 / 1e7);
+
+// |x| <= pi / 2
+static inline float sinHalfPi(float x) {
+  float u = x * x;
+#if _GPS_BATCH_DIGITS > 4
+  return x * (9.99999996e-1f +
+              u * (-1.66666580e-1f +
+                   u * (8.33305106e-3f +
+                        u * (-1.98090753e-4f + u * 2.60522498e-6f))));
+#else
+  return x * (9.99913039e-1f + u * (-1.66024896e-1f + u * 7.62864422e-3f));
+#endif
+}
+
+// |x| <= pi / 2
+static inline float cosHalfPi(float x) {
+  float u = x * x;
+#if _GPS_BATCH_DIGITS > 4
+  return 9.99999954e-1f +
+         u * (-4.99999054e-1f +
+              u * (4.16635847e-2f +
+                   u * (-1.38537043e-3f + u * 2.31539322e-5f)));
+#else
+  return 9.99993295e-1f +
+         u * (-4.99912440e-1f + u * (4.14877480e-2f + u * -1.27120947e-3f));
+#endif
+}
+
+// 0 <= t <= 1
+static inline float atanUnit(float t) {
+  float u = t * t;
+#if _GPS_BATCH_DIGITS > 4
+  return t * (9.99999911e-1f +
+              u * (-3.33320935e-1f +
+                   u * (1.99713742e-1f +
+                        u * (-1.40294139e-1f +
+                             u * (9.94274195e-2f +
+                                  u * (-5.99044578e-2f +
+                                       u * (2.45569334e-2f +
+                                            u * -4.78039992e-3f)))))));
+#else
+  return t * (9.99973213e-1f +
+              u * (-3.31803119e-1f +
+                   u * (1.85728584e-1f +
+                        u * (-9.27487835e-2f + u * 2.42750519e-2f))));
+#endif
+}
+
+static inline float atan2Fast(float y, float x) {
+  float ax = fabsf(x);
+  float ay = fabsf(y);
+  float big = ay > ax ? ay : ax;
+  float small = ay > ax ? ax : ay;
+  float r = atanUnit(small / (big > 0.0f ? big : 1.0f));
+  r = ay > ax ? (float)M_PI_2 - r : r;
+  r = x < 0.0f ? (float)M_PI - r : r;
+  return y < 0.0f ? -r : r;
+}
+
+// cos(lat) as sin(90 - |lat|), the complement is exact in integers so the
+// result keeps its relative precision towards the poles
+static inline float cosLatE7(int32_t lat) {
+  return sinHalfPi((float)(900000000 - (lat < 0 ? -lat : lat)) * RADIANS_E7);
+}
+
+// Half of the longitude difference in radians, the shorter way around. The
+// difference is taken as twice that of the halved longitudes plus that of the
+// low bits, which unlike the full one fits in 32 bits.
+static inline float halfLngDelta(int32_t from, int32_t to) {
+  int32_t half = (to >> 1) - (from >> 1);
+  int32_t odd = (to & 1) - (from & 1);
+  half = half > 900000000 || (half == 900000000 && odd > 0)
+             ? half - 1800000000
+             : half;
+  half = half < -900000000 || (half == -900000000 && odd < 0)
+             ? half + 1800000000
+             : half;
+  return (float)(2 * half + odd) * HALF_RADIANS_E7;
+}
+
+// Haversine, which unlike the spherical law of cosines stays exact for short
+// distances in single precision
+static inline float distanceE7(int32_t lat1, int32_t lng1, float cosLat1,
+                               int32_t lat2, int32_t lng2) {
+  float sinLat = sinHalfPi((float)(lat2 - lat1) * HALF_RADIANS_E7);
+  float sinLng = sinHalfPi(halfLngDelta(lng1, lng2));
+  float cosLat2 = cosLatE7(lat2);
+  float a = sinLat * sinLat + cosLat1 * cosLat2 * sinLng * sinLng;
+  a = a < 1.0f ? a : 1.0f;
+  return (2.0f * _GPS_EARTH_RADIUS) * atan2Fast(sqrtf(a), sqrtf(1.0f - a));
+}
+
+void TinyGPSPlus::distancesFrom(int32_t lat, int32_t lng, const int32_t *lats,
+                                const int32_t *lngs, size_t count,
+                                float *meters) {
+  const float cosLat = cosLatE7(lat);
+  for (size_t i = 0; i < count; ++i)
+    meters[i] = distanceE7(lat, lng, cosLat, lats[i], lngs[i]);
+}
+
+void TinyGPSPlus::coursesFrom(int32_t lat, int32_t lng, const int32_t *lats,
+                              const int32_t *lngs, size_t count,
+                              float *courses) {
+  // Same formula as courseTo with the angle differences written as half
+  // angles: cos(lat1) sin(lat2) - sin(lat1) cos(lat2) cos(dlng) becomes
+  // sin(dlat) + 2 sin(lat1) cos(lat2) sin^2(dlng / 2)
+  const float sinLat = sinHalfPi((float)lat * RADIANS_E7);
+  for (size_t i = 0; i < count; ++i) {
+    float halfLat = (float)(lats[i] - lat) * HALF_RADIANS_E7;
+    float halfLng = halfLngDelta(lng, lngs[i]);
+    float sinHalfLng = sinHalfPi(halfLng);
+    float cosLat2 = cosLatE7(lats[i]);
+    float y = sinHalfLng * cosHalfPi(halfLng) * cosLat2;
+    float x = sinHalfPi(halfLat) * cosHalfPi(halfLat) +
+              sinLat * cosLat2 * sinHalfLng * sinHalfLng;
+    float course = atan2Fast(y, x) * (float)(180.0 / M_PI);
+    courses[i] = course < 0.0f ? course + 360.0f : course;
+  }
+}
+
+void TinyGPSPlus::segmentDistances(const int32_t *lats, const int32_t *lngs,
+                                   size_t count, float *meters) {
+  for (size_t i = 1; i < count; ++i) {
+    const float cosLat = cosLatE7(lats[i - 1]);
+    meters[i - 1] =
+        distanceE7(lats[i - 1], lngs[i - 1], cosLat, lats[i], lngs[i]);
+  }
+}
+
+double TinyGPSPlus::pathLength(const int32_t *lats, const int32_t *lngs,
+                               size_t count) {
+  // Segments are computed in blocks and summed in double, a float sum would
+  // lose the short segments of a long track
+  enum { BLOCK = 32 };
+  float meters[BLOCK];
+  double length = 0.0;
+  for (size_t start = 0; start + 1 < count; start += BLOCK) {
+    size_t points = count - start < BLOCK + 1 ? count - start : BLOCK + 1;
+    segmentDistances(lats + start, lngs + start, points, meters);
+    float sum = 0.0f;
+    for (size_t i = 0; i + 1 < points; ++i)
+      sum += meters[i];
+    length += sum;
+  }
+  return length;
+}
+
 const char *TinyGPSPlus::cardinal(double course) {
   static const char *directions[] = {"N",  "NNE", "NE", "ENE", "E",  "ESE",
                                      "SE", "SSE", "S",  "SSW", "SW", "WSW",
@@ -345,18 +778,25 @@ void TinyGPSLocation::setLongitude(const char *term) {
   TinyGPSPlus::parseDegrees(term, rawNewLngData);
 }
 
-double TinyGPSLocation::lat() {
+static int64_t toNano(const RawDegrees &raw) {
+  int64_t ret = raw.deg * 1000000000LL + raw.billionths;
+  return raw.negative ? -ret : ret;
+}
+
+int64_t TinyGPSLocation::latNano() {
   updated = false;
-  double ret = rawLatData.deg + rawLatData.billionths / 1000000000.0;
-  return rawLatData.negative ? -ret : ret;
+  return toNano(rawLatData);
 }
 
-double TinyGPSLocation::lng() {
+int64_t TinyGPSLocation::lngNano() {
   updated = false;
-  double ret = rawLngData.deg + rawLngData.billionths / 1000000000.0;
-  return rawLngData.negative ? -ret : ret;
+  return toNano(rawLngData);
 }
 
+double TinyGPSLocation::lat() { return latNano() / 1000000000.0; }
+
+double TinyGPSLocation::lng() { return lngNano() / 1000000000.0; }
+
 void TinyGPSDate::commit() {
   date = newDate;
   lastCommitTime = millis();
@@ -373,7 +813,7 @@ void TinyGPSTime::setTime(const char *term) {
   newTime = (uint32_t)TinyGPSPlus::parseDecimal(term);
 }
 
-void TinyGPSDate::setDate(const char *term) { newDate = atol(term); }
+void TinyGPSDate::setDate(const char *term) { newDate = parseDigits(term); }
 
 uint16_t TinyGPSDate::year() {
   updated = false;
@@ -427,7 +867,55 @@ void TinyGPSInteger::commit() {
   valid = updated = true;
 }
 
-void TinyGPSInteger::set(const char *term) { newval = atol(term); }
+void TinyGPSInteger::set(const char *term) { newval = parseDigits(term); }
+
+void TinyGPSConstellation::addView(uint8_t total, uint8_t number,
+                                   uint8_t inView,
+                                   const TinyGPSSatellite *view,
+                                   uint8_t count) {
+  if (number == 0 || number > total)
+    return;
+  if (number == 1) {
+    newSatCount = 0;
+    nextMessage = 1;
+  } else if (number != nextMessage) {
+    // Lost part of the group, wait for the next first message
+    nextMessage = 0;
+    return;
+  }
+
+  newViewCount = inView;
+  for (uint8_t i = 0; i < count && newSatCount < _GPS_MAX_SATELLITES; ++i) {
+    newSats[newSatCount] = view[i];
+    newSats[newSatCount].active = isActive(view[i].prn);
+    ++newSatCount;
+  }
+  if (number < total) {
+    ++nextMessage;
+    return;
+  }
+
+  nextMessage = 0;
+  memcpy(sats, newSats, newSatCount * sizeof(sats[0]));
+  satCount = newSatCount;
+  viewCount = newViewCount;
+  lastCommitTime = millis();
+  valid = updated = true;
+}
+
+void TinyGPSConstellation::setActive(const uint16_t *prns, uint8_t count) {
+  memcpy(activePrns, prns, count * sizeof(activePrns[0]));
+  activeSatCount = count;
+  for (uint8_t i = 0; i < satCount; ++i)
+    sats[i].active = isActive(sats[i].prn);
+}
+
+bool TinyGPSConstellation::isActive(uint16_t prn) const {
+  for (uint8_t i = 0; i < activeSatCount; ++i)
+    if (activePrns[i] == prn)
+      return true;
+  return false;
+}
 
 TinyGPSCustom::TinyGPSCustom(TinyGPSPlus &gps, const char *_sentenceName,
                              int _termNumber) {
@@ -457,16 +945,26 @@ void TinyGPSCustom::set(const char *term) {
   strncpy(this->stagingBuffer, term, sizeof(this->stagingBuffer));
 }
 
+// FNV-1a
+uint32_t TinyGPSPlus::hashSentenceName(const char *name) {
+  uint32_t hash = 2166136261UL;
+  while (*name)
+    hash = (hash ^ (uint8_t)*name++) * 16777619UL;
+  return hash;
+}
+
+// Consecutive terms of one sentence land in consecutive buckets
+unsigned TinyGPSPlus::customBucket(uint32_t sentenceHash, int termNumber) {
+  return (sentenceHash + (unsigned)termNumber) & (_GPS_CUSTOM_BUCKETS - 1);
+}
+
 void TinyGPSPlus::insertCustom(TinyGPSCustom *pElt, const char *sentenceName,
                                int termNumber) {
-  TinyGPSCustom **ppelt;
-
-  for (ppelt = &this->customElts; *ppelt != NULL; ppelt = &(*ppelt)->next) {
-    int cmp = strcmp(sentenceName, (*ppelt)->sentenceName);
-    if (cmp < 0 || (cmp == 0 && termNumber < (*ppelt)->termNumber))
-      break;
-  }
+  pElt->sentenceHash = hashSentenceName(sentenceName);
+  pElt->nextPending = NULL;
 
-  pElt->next = *ppelt;
-  *ppelt = pElt;
+  TinyGPSCustom **bucket =
+      &customBuckets[customBucket(pElt->sentenceHash, termNumber)];
+  pElt->next = *bucket;
+  *bucket = pElt;
 }
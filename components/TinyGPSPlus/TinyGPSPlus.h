@@ -31,6 +31,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #endif
 #include <limits.h>
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define TWO_PI M_TWOPI
@@ -43,6 +44,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define _GPS_KM_PER_METER 0.001
 #define _GPS_FEET_PER_METER 3.2808399
 #define _GPS_MAX_FIELD_SIZE 15
+#define _GPS_MAX_SATELLITES 24 // per constellation, kept from GSV sentences
+#define _GPS_MAX_ACTIVE_SATELLITES 12 // satellite IDs in one GSA sentence
+#define _GPS_SATELLITES_PER_GSV 4
+#define _GPS_CUSTOM_BUCKETS 64 // power of two, TinyGPSCustom dispatch table
+#define _GPS_EARTH_RADIUS 6372795 // meters, sphere used for distances
+
+// Significant digits of the single precision batch distance and course
+// functions, 4 trades accuracy for fewer polynomial terms
+#ifndef _GPS_BATCH_DIGITS
+#define _GPS_BATCH_DIGITS 6
+#endif
 
 // Return milliseconds since device start
 unsigned long millis();
@@ -77,6 +89,9 @@ public:
   }
   double lat();
   double lng();
+  // Signed billionths of a degree, computed without any floating point
+  int64_t latNano();
+  int64_t lngNano();
 
   TinyGPSLocation() : valid(false), updated(false) {}
 
@@ -216,6 +231,61 @@ struct TinyGPSHDOP : TinyGPSDecimal {
   double hdop() { return value() / 100.0; }
 };
 
+// Satellite systems reported through the NMEA talker ID (GP, GL, GA, GB/BD, GQ)
+enum TinyGPSSystem {
+  GPS_SYSTEM_GPS,
+  GPS_SYSTEM_GLONASS,
+  GPS_SYSTEM_GALILEO,
+  GPS_SYSTEM_BEIDOU,
+  GPS_SYSTEM_QZSS,
+  GPS_SYSTEM_COUNT
+};
+
+struct TinyGPSSatellite {
+  uint16_t prn;
+  uint16_t azimuth; // degrees from true north
+  uint8_t elevation; // degrees
+  uint8_t snr;       // dB-Hz, 0 when not tracked
+  bool active;       // listed in the last GSA sentence of its system
+};
+
+// Satellites in view of one system, replaced once a full GSV group arrived
+struct TinyGPSConstellation {
+  friend class TinyGPSPlus;
+
+public:
+  bool isValid() const { return valid; }
+  bool isUpdated() const { return updated; }
+  uint32_t age() const {
+    return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX;
+  }
+  // as announced by the receiver, may exceed count()
+  uint8_t inView() const { return viewCount; }
+  uint8_t count() const { return satCount; }
+  const TinyGPSSatellite &satellite(uint8_t index) {
+    updated = false;
+    return sats[index];
+  }
+  uint8_t activeCount() const { return activeSatCount; }
+
+  TinyGPSConstellation()
+      : valid(false), updated(false), viewCount(0), satCount(0),
+        activeSatCount(0), newViewCount(0), newSatCount(0), nextMessage(0) {}
+
+private:
+  bool valid, updated;
+  uint32_t lastCommitTime;
+  uint8_t viewCount, satCount, activeSatCount;
+  uint8_t newViewCount, newSatCount, nextMessage;
+  TinyGPSSatellite sats[_GPS_MAX_SATELLITES];
+  TinyGPSSatellite newSats[_GPS_MAX_SATELLITES];
+  uint16_t activePrns[_GPS_MAX_ACTIVE_SATELLITES];
+  void addView(uint8_t total, uint8_t number, uint8_t inView,
+               const TinyGPSSatellite *view, uint8_t count);
+  void setActive(const uint16_t *prns, uint8_t count);
+  bool isActive(uint16_t prn) const;
+};
+
 class TinyGPSPlus;
 class TinyGPSCustom {
 public:
@@ -243,14 +313,19 @@ private:
   bool valid, updated;
   const char *sentenceName;
   int termNumber;
+  uint32_t sentenceHash;
   friend class TinyGPSPlus;
-  TinyGPSCustom *next;
+  TinyGPSCustom *next;        // same dispatch bucket
+  TinyGPSCustom *nextPending; // set in the current sentence
 };
 
 class TinyGPSPlus {
 public:
   TinyGPSPlus();
   bool encode(char c); // process one character received from GPS
+  // process a block of received characters, returns the number of sentences
+  // that passed their checksum
+  unsigned encode(const uint8_t *buf, size_t len);
   TinyGPSPlus &operator<<(char c) {
     encode(c);
     return *this;
@@ -264,6 +339,10 @@ public:
   TinyGPSAltitude altitude;
   TinyGPSInteger satellites;
   TinyGPSHDOP hdop;
+  // GSA: 1 no fix, 2 2D fix, 3 3D fix
+  TinyGPSInteger fixMode;
+  TinyGPSDecimal pdop, vdop;
+  TinyGPSConstellation constellations[GPS_SYSTEM_COUNT];
 
   static const char *libraryVersion() { return _GPS_VERSION; }
 
@@ -272,6 +351,19 @@ public:
   static double courseTo(double lat1, double long1, double lat2, double long2);
   static const char *cardinal(double course);
 
+  // Batch versions of distanceBetween and courseTo in single precision.
+  // Points are in 1e-7 degrees (latNano() / 100), positions are differenced
+  // as integers so short distances keep their precision.
+  static void distancesFrom(int32_t lat, int32_t lng, const int32_t *lats,
+                            const int32_t *lngs, size_t count, float *meters);
+  static void coursesFrom(int32_t lat, int32_t lng, const int32_t *lats,
+                          const int32_t *lngs, size_t count, float *courses);
+  // Length of each of the count - 1 segments of a polyline
+  static void segmentDistances(const int32_t *lats, const int32_t *lngs,
+                               size_t count, float *meters);
+  static double pathLength(const int32_t *lats, const int32_t *lngs,
+                           size_t count);
+
   static int32_t parseDecimal(const char *term);
   static void parseDegrees(const char *term, RawDegrees &deg);
 
@@ -281,7 +373,15 @@ public:
   uint32_t passedChecksum() const { return passedChecksumCount; }
 
 private:
-  enum { GPS_SENTENCE_GPGGA, GPS_SENTENCE_GPRMC, GPS_SENTENCE_OTHER };
+  enum {
+    GPS_SENTENCE_GGA,
+    GPS_SENTENCE_RMC,
+    GPS_SENTENCE_GSA,
+    GPS_SENTENCE_GSV,
+    GPS_SENTENCE_VTG,
+    GPS_SENTENCE_GLL,
+    GPS_SENTENCE_OTHER
+  };
 
   // parsing state variables
   uint8_t parity;
@@ -291,12 +391,24 @@ private:
   uint8_t curTermNumber;
   uint8_t curTermOffset;
   bool sentenceHasFix;
+  int8_t curSystem; // from the talker ID, -1 for GN and unknown talkers
+
+  // satellite data of the current sentence, kept until its checksum passes
+  uint8_t gsvTotal, gsvNumber, gsvInView;
+  TinyGPSSatellite gsvSats[_GPS_SATELLITES_PER_GSV];
+  uint16_t gsaPrns[_GPS_MAX_ACTIVE_SATELLITES];
+  uint8_t gsaCount;
+  int8_t gsaSystem; // NMEA 4.1 system ID field, -1 if absent
 
-  // custom element support
+  // custom element support, hashed by (sentence name, term number)
   friend class TinyGPSCustom;
-  TinyGPSCustom *customElts;
-  TinyGPSCustom *customCandidates;
+  TinyGPSCustom *customBuckets[_GPS_CUSTOM_BUCKETS];
+  TinyGPSCustom *customPending;
+  uint32_t curSentenceHash;
+  char curSentenceName[_GPS_MAX_FIELD_SIZE];
   void insertCustom(TinyGPSCustom *pElt, const char *sentenceName, int index);
+  static uint32_t hashSentenceName(const char *name);
+  static unsigned customBucket(uint32_t sentenceHash, int termNumber);
 
   // statistics
   uint32_t encodedCharCount;
@@ -307,6 +419,13 @@ private:
   // internal utilities
   int fromHex(char a);
   bool endOfTermHandler();
+  void parseSentenceType();
+  void setSatelliteTerm();
+  void commitSatellites();
+  static bool isDelimiter(uint8_t c);
+  static const uint8_t *findDelimiter(const uint8_t *p, const uint8_t *end);
+  void encodeSpan(const uint8_t *p, size_t len);
+  bool encodeDelimiter(char c);
 };
 
 #endif // def(__TinyGPSPlus_h)
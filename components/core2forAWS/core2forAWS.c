@@ -19,6 +19,8 @@
 #include "soc/dac_channel.h"
 
 static esp_adc_cal_characteristics_t *adc_characterization;
+static QueueHandle_t uart_event_queue;
+static bool uart_pattern_enabled;
 #define DEFAULT_VREF            1100
 #define ADC_CHANNEL             ADC1_CHANNEL_0
 #define ADC_WIDTH               ADC_WIDTH_BIT_12
@@ -478,7 +480,7 @@ esp_err_t Core2ForAWS_Port_PinMode(gpio_num_t pin, pin_mode_t mode){
         dac_output_enable(DAC_CHANNEL);
     }
     else if (mode == UART){
-        err = uart_driver_install(PORT_C_UART_NUM, UART_RX_BUF_SIZE, 0, 0, NULL, 0);
+        err = uart_driver_install(PORT_C_UART_NUM, UART_RX_BUF_SIZE, 0, UART_EVENT_QUEUE_SIZE, &uart_event_queue, 0);
         if(err != ESP_OK){
             ESP_LOGE(TAG, "UART driver installation failed for UART num %d. Error code: 0x%x.", PORT_C_UART_NUM, err);
             return err;
@@ -494,6 +496,8 @@ esp_err_t Core2ForAWS_Port_PinMode(gpio_num_t pin, pin_mode_t mode){
         dac_output_disable(DAC_CHANNEL);
         gpio_reset_pin(pin);
         uart_driver_delete(UART_NUM_2);
+        uart_event_queue = NULL;
+        uart_pattern_enabled = false;
         i2c_free_port(I2C_NUM_0);
     }
     return err;
@@ -571,20 +575,100 @@ int Core2ForAWS_Port_C_UART_Send(const char *message, size_t len){
 
 int Core2ForAWS_Port_C_UART_Receive(uint8_t *message_buffer){
     int rxBytes = 0;
-    int cached_buffer_length = 0;
+    size_t cached_buffer_length = 0;
 
-    esp_err_t err = uart_get_buffered_data_len(PORT_C_UART_NUM, (size_t*)&cached_buffer_length);
+    esp_err_t err = uart_get_buffered_data_len(PORT_C_UART_NUM, &cached_buffer_length);
     if (err != ESP_OK){
         ESP_LOGE(TAG, "Failed to get UART ring buffer length. Check if pins were set to UART and has been configured.");
         abort();
     }
 
     if (cached_buffer_length) {
-        rxBytes = uart_read_bytes(PORT_C_UART_NUM, message_buffer, (size_t)&cached_buffer_length, pdMS_TO_TICKS(20));
+        if (cached_buffer_length > UART_RX_BUF_SIZE) {
+            cached_buffer_length = UART_RX_BUF_SIZE;
+        }
+        rxBytes = uart_read_bytes(PORT_C_UART_NUM, message_buffer, cached_buffer_length, pdMS_TO_TICKS(20));
     }
     return rxBytes;
 }
 
+esp_err_t Core2ForAWS_Port_C_UART_EnablePatternDetect(char pattern_chr){
+    if (uart_event_queue == NULL) {
+        ESP_LOGE(TAG, "UART pattern detection requires Port C to be set to UART.");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* One character, no idle time required around it, so back to back sentences are separated. */
+    esp_err_t err = uart_enable_pattern_det_baud_intr(PORT_C_UART_NUM, pattern_chr, 1, 1, 0, 0);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enable UART pattern detection. Error code: 0x%x.", err);
+        return err;
+    }
+    err = uart_pattern_queue_reset(PORT_C_UART_NUM, UART_EVENT_QUEUE_SIZE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to allocate UART pattern queue. Error code: 0x%x.", err);
+        return err;
+    }
+    uart_pattern_enabled = true;
+    return ESP_OK;
+}
+
+/* Drops everything received so far, used after overflows. */
+static void uart_discard_input(void){
+    uart_flush_input(PORT_C_UART_NUM);
+    uart_pattern_queue_reset(PORT_C_UART_NUM, UART_EVENT_QUEUE_SIZE);
+    xQueueReset(uart_event_queue);
+}
+
+int Core2ForAWS_Port_C_UART_ReceivePattern(uint8_t *message_buffer, size_t buffer_size, TickType_t ticks_to_wait){
+    if (!uart_pattern_enabled) {
+        return -1;
+    }
+
+    TimeOut_t timeout;
+    vTaskSetTimeOutState(&timeout);
+    uart_event_t event;
+    while (xQueueReceive(uart_event_queue, &event, ticks_to_wait) == pdTRUE) {
+        switch (event.type) {
+            case UART_PATTERN_DET: {
+                const int position = uart_pattern_pop_pos(PORT_C_UART_NUM);
+                if (position < 0) {
+                    /* More patterns than the position queue holds, positions are no longer known */
+                    ESP_LOGW(TAG, "UART pattern queue overflow, dropping buffered data.");
+                    uart_discard_input();
+                    return 0;
+                }
+                size_t length = position + 1;
+                if (length <= buffer_size) {
+                    return uart_read_bytes(PORT_C_UART_NUM, message_buffer, length, 0);
+                }
+                ESP_LOGW(TAG, "UART frame of %u bytes exceeds the buffer, dropping it.", (unsigned)length);
+                while (length > 0) {
+                    const int read = uart_read_bytes(PORT_C_UART_NUM, message_buffer,
+                                                     length < buffer_size ? length : buffer_size, 0);
+                    if (read <= 0) {
+                        break;
+                    }
+                    length -= read;
+                }
+                return 0;
+            }
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                ESP_LOGW(TAG, "UART receive overflow, dropping buffered data.");
+                uart_discard_input();
+                return 0;
+            default:
+                /* Plain data events, the frame is not complete yet */
+                break;
+        }
+        if (xTaskCheckForTimeOut(&timeout, &ticks_to_wait) == pdTRUE) {
+            break;
+        }
+    }
+    return 0;
+}
+
 #endif
 /* ----------------------------------------------- End -----------------------------------------------*/
 /* ===================================================================================================*/
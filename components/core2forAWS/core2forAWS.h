@@ -206,6 +206,16 @@ extern "C" {
 #define UART_RX_BUF_SIZE 2048
 /* @[declare_uart_rx_buf_size] */
 
+/**
+ * @brief The number of UART events and detected patterns kept for the reader.
+ *
+ * This is the length of the UART driver event queue and of the queue
+ * of pattern positions used by Core2ForAWS_Port_C_UART_ReceivePattern().
+ */
+/* @[declare_uart_event_queue_size] */
+#define UART_EVENT_QUEUE_SIZE 20
+/* @[declare_uart_event_queue_size] */
+
 /**
  * @brief Modes supported by the BSP for the GPIO pins.
  *
@@ -1541,6 +1551,61 @@ int Core2ForAWS_Port_C_UART_Send(const char *message, size_t len);
 /* @[declare_core2foraws_port_c_uart_receive] */
 int Core2ForAWS_Port_C_UART_Receive(uint8_t *message_buffer);
 /* @[declare_core2foraws_port_c_uart_receive] */
+
+/**
+ * @brief Enables detection of a frame terminating character on UART2.
+ *
+ * After this call the UART driver records the ring buffer position of
+ * every received `pattern_chr` and posts an event for it, so that
+ * line based protocols such as NMEA can be read one complete frame
+ * at a time with Core2ForAWS_Port_C_UART_ReceivePattern() instead of
+ * polling Core2ForAWS_Port_C_UART_Receive().
+ *
+ * Must be called after Core2ForAWS_Port_C_UART_Begin().
+ *
+ * @param[in] pattern_chr The character that ends a frame, e.g. '\n'.
+ * @return [esp_err_t](https://docs.espressif.com/projects/esp-idf/en/release-v4.2/esp32/api-reference/system/esp_err.html#macros). 0 or `ESP_OK` if successful.
+ */
+/* @[declare_core2foraws_port_c_uart_enablepatterndetect] */
+esp_err_t Core2ForAWS_Port_C_UART_EnablePatternDetect(char pattern_chr);
+/* @[declare_core2foraws_port_c_uart_enablepatterndetect] */
+
+/**
+ * @brief Waits for the next complete frame on UART2 and reads it.
+ *
+ * Blocks on the UART driver event queue until a frame terminated by
+ * the character set with Core2ForAWS_Port_C_UART_EnablePatternDetect()
+ * has been received, then copies exactly that frame, including the
+ * terminating character, into `message_buffer`. Bytes of an unfinished
+ * frame stay in the driver ring buffer until their terminator arrives.
+ *
+ * Frames longer than `buffer_size` are dropped. When the hardware FIFO
+ * or the ring buffer overflowed, the buffered data is discarded and
+ * reading resumes with the next frame.
+ *
+ * **Example:**
+ * @code{c}
+ *  static void nmea_task(void *arg){
+ *      static uint8_t sentence[128];
+ *      Core2ForAWS_Port_C_UART_EnablePatternDetect('\n');
+ *      while (1) {
+ *          int length = Core2ForAWS_Port_C_UART_ReceivePattern(sentence, sizeof(sentence), portMAX_DELAY);
+ *          if (length > 0) {
+ *              ESP_LOGI(TAG, "Sentence: '%.*s'", length, sentence);
+ *          }
+ *      }
+ *  }
+ * @endcode
+ *
+ * @param[out] message_buffer The buffer receiving one frame.
+ * @param[in] buffer_size The size of `message_buffer`.
+ * @param[in] ticks_to_wait How long to wait for a frame.
+ * @return The length of the frame, 0 on timeout or after dropping data,
+ * -1 if pattern detection is not enabled.
+ */
+/* @[declare_core2foraws_port_c_uart_receivepattern] */
+int Core2ForAWS_Port_C_UART_ReceivePattern(uint8_t *message_buffer, size_t buffer_size, TickType_t ticks_to_wait);
+/* @[declare_core2foraws_port_c_uart_receivepattern] */
 #endif
 
 #ifdef __cplusplus
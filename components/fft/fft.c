@@ -45,6 +45,24 @@
 #define USE_SPLIT_RADIX 1
 #define LARGE_BASE_CASE 1
 
+static float *compute_twiddle_factors(int size)
+{
+  int k,m;
+
+  float *twiddle_factors = (float *)malloc(2 * size * sizeof(float));
+  if (twiddle_factors == NULL)
+    return NULL;
+
+  float two_pi_by_n = TWO_PI / size;
+
+  for (k = 0, m = 0 ; k < size ; k++, m+=2)
+  {
+    twiddle_factors[m] = cosf(two_pi_by_n * k);    // real
+    twiddle_factors[m+1] = sinf(two_pi_by_n * k);  // imag
+  }
+  return twiddle_factors;
+}
+
 fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, float *input, float *output)
 {
   /*
@@ -52,8 +70,6 @@ fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, flo
    *
    * If no input or output buffers are provided, they will be allocated.
    */
-  int k,m;
-
   fft_config_t *config = (fft_config_t *)malloc(sizeof(fft_config_t));
 
   // Check if the size is a power of two
@@ -67,15 +83,7 @@ fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, flo
   config->size = size;
 
   // Allocate and precompute twiddle factors
-  config->twiddle_factors = (float *)malloc(2 * config->size * sizeof(float));
-
-  float two_pi_by_n = TWO_PI / config->size;
-
-  for (k = 0, m = 0 ; k < config->size ; k++, m+=2)
-  {
-    config->twiddle_factors[m] = cosf(two_pi_by_n * k);    // real
-    config->twiddle_factors[m+1] = sinf(two_pi_by_n * k);  // imag
-  }
+  config->twiddle_factors = compute_twiddle_factors(config->size);
 
   // Allocate input buffer
   if (input != NULL)
@@ -136,6 +144,64 @@ void fft_execute(fft_config_t *config)
     ifft(config->input, config->output, config->twiddle_factors, config->size);
 }
 
+// Twiddle factors by log2 of the size, shared by all plans
+static float *plan_twiddle_factors[FFT_MAX_LOG2_SIZE + 1];
+static fft_plan_t plans[FFT_PLAN_CACHE_SIZE];
+static int plan_count = 0;
+
+const fft_plan_t *fft_plan_get(int size, fft_type_t type, fft_direction_t direction)
+{
+  int k, log2_size;
+
+  for (k = 0 ; k < plan_count ; k++)
+  {
+    if (plans[k].size == size && plans[k].type == type && plans[k].direction == direction)
+      return &plans[k];
+  }
+
+  // Powers of two from 8, the complex FFT inside a real one has no base case below 4
+  if (size < 8 || (size & (size-1)) != 0 || size > FFT_TWIDDLE_TABLE_SIZE)
+    return NULL;
+  if (plan_count == FFT_PLAN_CACHE_SIZE)
+    return NULL;
+
+  for (log2_size = 0 ; (1 << log2_size) < size ; log2_size++)
+    ;
+  if (plan_twiddle_factors[log2_size] == NULL)
+  {
+    float *twiddle_factors = (float *)malloc(2 * size * sizeof(float));
+    if (twiddle_factors == NULL)
+      return NULL;
+
+    int stride = 2 * (FFT_TWIDDLE_TABLE_SIZE / size);
+    for (k = 0 ; k < size ; k++)
+    {
+      twiddle_factors[2 * k] = fft_twiddle_table[k * stride];          // real
+      twiddle_factors[2 * k + 1] = fft_twiddle_table[k * stride + 1];  // imag
+    }
+    plan_twiddle_factors[log2_size] = twiddle_factors;
+  }
+
+  fft_plan_t *plan = &plans[plan_count++];
+  plan->size = size;
+  plan->type = type;
+  plan->direction = direction;
+  plan->twiddle_factors = plan_twiddle_factors[log2_size];
+  return plan;
+}
+
+void fft_plan_execute(const fft_plan_t *plan, float *input, float *output)
+{
+  if (plan->type == FFT_REAL && plan->direction == FFT_FORWARD)
+    rfft(input, output, plan->twiddle_factors, plan->size);
+  else if (plan->type == FFT_REAL && plan->direction == FFT_BACKWARD)
+    irfft(input, output, plan->twiddle_factors, plan->size);
+  else if (plan->type == FFT_COMPLEX && plan->direction == FFT_FORWARD)
+    fft(input, output, plan->twiddle_factors, plan->size);
+  else if (plan->type == FFT_COMPLEX && plan->direction == FFT_BACKWARD)
+    ifft(input, output, plan->twiddle_factors, plan->size);
+}
+
 void fft(float *input, float *output, float *twiddle_factors, int n)
 {
   /*
@@ -396,8 +462,18 @@ void split_radix_fft(float *x, float *y, int n, int stride, float *twiddle_facto
   int k;
 
 #if LARGE_BASE_CASE
-  // End condition, stop at n=2 to avoid one trivial recursion
-  if (n == 8)
+  // End condition, the generated kernels cover the last levels of the recursion
+  if (n == 32)
+  {
+    fft32(x, stride, y, 2);
+    return;
+  }
+  else if (n == 16)
+  {
+    fft16(x, stride, y, 2);
+    return;
+  }
+  else if (n == 8)
   {
     fft8(x, stride, y, 2);
     return;
@@ -37,6 +37,8 @@
 #ifndef __FFT_H__
 #define __FFT_H__
 
+#include <stdint.h>
+
 typedef enum
 {
   FFT_REAL,
@@ -66,6 +68,68 @@ typedef struct
 fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, float *input, float *output);
 void fft_destroy(fft_config_t *config);
 void fft_execute(fft_config_t *config);
+
+/*
+ * Cached plans for code that transforms frame after frame.
+ *
+ * A plan only holds the parameters and the twiddle factors. Those are copied
+ * once per size out of the generated fft_twiddle_table, so they are exact to
+ * the last bit and contiguous in RAM, and shared by all plans of that size.
+ * The caller owns the input and output buffers (size floats for real FFTs,
+ * 2 * size for complex ones), ideally declared with FFT_ALIGNED, so executing
+ * a plan never allocates. Plans live until the program ends.
+ *
+ * fft_plan_get() allocates on the first request for a (size, type, direction)
+ * and is not thread safe, get plans during initialization.
+ */
+
+#define FFT_MAX_LOG2_SIZE 12
+#define FFT_TWIDDLE_TABLE_SIZE (1 << FFT_MAX_LOG2_SIZE)
+#ifndef FFT_PLAN_CACHE_SIZE
+#define FFT_PLAN_CACHE_SIZE 8
+#endif
+#define FFT_ALIGNED __attribute__((aligned(16)))
+
+typedef struct
+{
+  int size;
+  fft_type_t type;
+  fft_direction_t direction;
+  float *twiddle_factors;  // shared with the other plans of the same size
+} fft_plan_t;
+
+// [cos, sin] of 2 pi k / FFT_TWIDDLE_TABLE_SIZE, generated by gen_fft_tables.py
+extern const float fft_twiddle_table[2 * FFT_TWIDDLE_TABLE_SIZE];
+
+// Returns NULL if size is not a power of two up to 2^FFT_MAX_LOG2_SIZE or out of memory
+const fft_plan_t *fft_plan_get(int size, fft_type_t type, fft_direction_t direction);
+// Like fft_execute(), backward transforms overwrite the input
+void fft_plan_execute(const fft_plan_t *plan, float *input, float *output);
+
+/*
+ * Fixed-point forward real FFT of 16 bit samples with block floating point
+ * scaling, for audio that only needs the magnitude spectrum. It works in the
+ * int16 samples and an int16 scratch buffer of the same size, without any
+ * float conversion. See fft_q15.c.
+ */
+
+typedef struct
+{
+  int size;
+  int16_t *twiddle_factors;  // Q15 [cos, sin] for the first size / 2 angles
+  uint16_t *bit_reverse;     // load order of the size / 2 complex values
+} fft_q15_plan_t;
+
+// Same sizes and cache rules as fft_plan_get()
+const fft_q15_plan_t *fft_q15_plan_get(int size);
+/*
+ * Writes |X[0]| .. |X[count-1]| of the size samples in input to magnitudes,
+ * count is at most size / 2 and work needs room for size values. Returns the
+ * block exponent: the true magnitude of X[k] is magnitudes[k] * 2^exponent.
+ */
+int fft_q15_magnitudes(const fft_q15_plan_t *plan, const int16_t *input, int16_t *work, int16_t *magnitudes,
+                       int count);
+
 void fft(float *input, float *output, float *twiddle_factors, int n);
 void ifft(float *input, float *output, float *twiddle_factors, int n);
 void rfft(float *x, float *y, float *twiddle_factors, int n);
@@ -73,6 +137,8 @@ void irfft(float *x, float *y, float *twiddle_factors, int n);
 void fft_primitive(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
 void split_radix_fft(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
 void ifft_primitive(float *input, float *output, int n, int stride, float *twiddle_factors, int tw_stride);
+void fft32(float *input, int stride_in, float *output, int stride_out);
+void fft16(float *input, int stride_in, float *output, int stride_out);
 void fft8(float *input, int stride_in, float *output, int stride_out);
 void fft4(float *input, int stride_in, float *output, int stride_out);
 
@@ -0,0 +1,248 @@
+/*
+  Fixed-point real FFT for 16 bit audio.
+
+  The samples are packed as the real and imaginary parts of a complex FFT of
+  half the size, like rfft() does, and transformed in place by an iterative
+  radix-2 DIT with Q15 twiddle factors. The block is kept in int16 with a
+  shared exponent: it is normalized to use the top bits once at load time, and
+  a stage scales its inputs down whenever the previous one left values that
+  its butterflies could overflow.
+*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "fft.h"
+
+/*
+ * Butterflies grow a component by at most 1 + sqrt(2), stay below 2^13 before each stage.
+ * The limits are checked on the rounded values the stages go on with, 16383 >> 1 rounds to
+ * 2^13 already.
+ */
+#define Q15_HEADROOM_LIMIT (1 << 13)
+
+static fft_q15_plan_t q15_plans[FFT_PLAN_CACHE_SIZE];
+static int q15_plan_count = 0;
+
+// Rounded, 1.0 saturates to 32767
+static int16_t to_q15(float value)
+{
+  float scaled = value * 32768.0f;
+  if (scaled >= INT16_MAX)
+    return INT16_MAX;
+  return (int16_t)(scaled + (scaled < 0 ? -0.5f : 0.5f));
+}
+
+const fft_q15_plan_t *fft_q15_plan_get(int size)
+{
+  int k, bits;
+
+  for (k = 0 ; k < q15_plan_count ; k++)
+  {
+    if (q15_plans[k].size == size)
+      return &q15_plans[k];
+  }
+
+  if (size < 8 || (size & (size-1)) != 0 || size > FFT_TWIDDLE_TABLE_SIZE)
+    return NULL;
+  if (q15_plan_count == FFT_PLAN_CACHE_SIZE)
+    return NULL;
+
+  int half = size / 2;
+  int16_t *twiddle_factors = (int16_t *)malloc(2 * half * sizeof(int16_t));
+  uint16_t *bit_reverse = (uint16_t *)malloc(half * sizeof(uint16_t));
+  if (twiddle_factors == NULL || bit_reverse == NULL)
+  {
+    free(twiddle_factors);
+    free(bit_reverse);
+    return NULL;
+  }
+
+  // Only the first half turn is ever used
+  int stride = 2 * (FFT_TWIDDLE_TABLE_SIZE / size);
+  for (k = 0 ; k < 2 * half ; k++)
+    twiddle_factors[k] = to_q15(fft_twiddle_table[k / 2 * stride + k % 2]);
+
+  for (bits = 0 ; (1 << bits) < half ; bits++)
+    ;
+  for (k = 0 ; k < half ; k++)
+  {
+    int j, reversed = 0;
+    for (j = 0 ; j < bits ; j++)
+      reversed |= ((k >> j) & 1) << (bits - 1 - j);
+    bit_reverse[k] = reversed;
+  }
+
+  fft_q15_plan_t *plan = &q15_plans[q15_plan_count++];
+  plan->size = size;
+  plan->twiddle_factors = twiddle_factors;
+  plan->bit_reverse = bit_reverse;
+  return plan;
+}
+
+static inline int q15_abs(int x)
+{
+  return x < 0 ? -x : x;
+}
+
+// Rounded (a * c + b * s) >> 15, the rotation part of a complex product with Q15 factors
+static inline int32_t q15_dot(int32_t a, int32_t c, int32_t b, int32_t s)
+{
+  return (a * c + b * s + (1 << 14)) >> 15;
+}
+
+/*
+ * Bit by bit square root without branches, the comparisons on the data mispredict otherwise.
+ * It starts at the highest even bit of x, which halves the steps for typical magnitudes.
+ */
+static uint32_t isqrt(uint32_t x)
+{
+  uint32_t root = 0, bit;
+
+  if (x == 0)
+    return 0;
+  for (bit = 1u << ((31 - __builtin_clz(x)) & ~1) ; bit != 0 ; bit >>= 2)
+  {
+    uint32_t trial = root + bit;
+    uint32_t mask = -(uint32_t)(x >= trial);
+    x -= trial & mask;
+    root = (root >> 1) + (bit & mask);
+  }
+  return root;
+}
+
+// Rounded x >> shift
+static inline int32_t q15_shift(int32_t x, int shift)
+{
+  return (x + ((1 << shift) >> 1)) >> shift;
+}
+
+int fft_q15_magnitudes(const fft_q15_plan_t *plan, const int16_t *input, int16_t *work, int16_t *magnitudes,
+                       int count)
+{
+  /*
+   * Parameters
+   * ----------
+   *  input (int16_t *)
+   *    plan->size samples
+   *  work (int16_t *)
+   *    plan->size values of scratch, the complex FFT of half the size runs in here
+   *  magnitudes (int16_t *)
+   *    count outputs, |X[0]| .. |X[count-1]|
+   *  count (int)
+   *    Number of bins wanted, up to plan->size / 2
+   *
+   * Returns the block exponent, |X[k]| = magnitudes[k] * 2^exponent
+   */
+  int n = plan->size / 2;
+  const int16_t *tw = plan->twiddle_factors;
+  const uint16_t *bit_reverse = plan->bit_reverse;
+  int k, len, exponent, peak = 0;
+
+  for (k = 0 ; k < plan->size ; k++)
+    peak |= q15_abs(input[k]);
+  if (peak == 0)
+  {
+    for (k = 0 ; k < count ; k++)
+      magnitudes[k] = 0;
+    return 0;
+  }
+
+  // Normalize the samples to round below 2^13, using at least 12 bits
+  int up = 0, down = 0;
+  while ((peak << up) < Q15_HEADROOM_LIMIT / 2)
+    up++;
+  while (q15_shift(peak, down) >= Q15_HEADROOM_LIMIT)
+    down++;
+  exponent = down - up;
+
+  // The first two stages only have the twiddle factors 1 and -i, they run as one radix-4
+  // pass while loading in bit reversed order. Four values below 2^13 add up to less than 2^15.
+  peak = 0;
+  for (k = 0 ; k < n ; k += 4)
+  {
+    int32_t ar[4], ai[4];
+    int m;
+    for (m = 0 ; m < 4 ; m++)
+    {
+      const int16_t *x = input + 2 * bit_reverse[k + m];
+      ar[m] = q15_shift(x[0] * (1 << up), down);
+      ai[m] = q15_shift(x[1] * (1 << up), down);
+    }
+    int32_t b0r = ar[0] + ar[1], b0i = ai[0] + ai[1];
+    int32_t b1r = ar[0] - ar[1], b1i = ai[0] - ai[1];
+    int32_t b2r = ar[2] + ar[3], b2i = ai[2] + ai[3];
+    // -i (a2 - a3)
+    int32_t b3r = ai[2] - ai[3], b3i = ar[3] - ar[2];
+
+    int16_t *y = work + 2 * k;
+    y[0] = b0r + b2r;
+    y[1] = b0i + b2i;
+    y[2] = b1r + b3r;
+    y[3] = b1i + b3i;
+    y[4] = b0r - b2r;
+    y[5] = b0i - b2i;
+    y[6] = b1r - b3r;
+    y[7] = b1i - b3i;
+    // At least the maximum and rounds to at least as much, the limits only need a bound
+    for (m = 0 ; m < 8 ; m++)
+      peak |= q15_abs(y[m]);
+  }
+
+  // Radix-2 stages, scaled down first whenever the block could overflow in them
+  for (len = 8 ; len <= n ; len *= 2)
+  {
+    int tw_stride = 4 * (n / len);
+    int scale = 0, start, j;
+    while (q15_shift(peak, scale) >= Q15_HEADROOM_LIMIT)
+      scale++;
+    exponent += scale;
+    peak = 0;
+
+    for (j = 0 ; j < len / 2 ; j++)
+    {
+      int32_t c = tw[j * tw_stride];
+      int32_t s = tw[j * tw_stride + 1];
+      for (start = 0 ; start < n ; start += len)
+      {
+        int16_t *a = work + 2 * (start + j);
+        int16_t *b = a + len;
+        int32_t ar = q15_shift(a[0], scale), ai = q15_shift(a[1], scale);
+        int32_t xr = q15_shift(b[0], scale), xi = q15_shift(b[1], scale);
+
+        // b * (c - i s)
+        int32_t br = q15_dot(xr, c, xi, s);
+        int32_t bi = q15_dot(xi, c, xr, -s);
+        a[0] = ar + br;
+        a[1] = ai + bi;
+        b[0] = ar - br;
+        b[1] = ai - bi;
+        peak |= q15_abs(a[0]) | q15_abs(a[1]) | q15_abs(b[0]) | q15_abs(b[1]);
+      }
+    }
+  }
+
+  // With components below 2^13, |Z| < 2^13.5 and |X| <= (|Z[k]| + |Z[n-k]|) stays below 2^15
+  int scale = 0;
+  while (q15_shift(peak, scale) >= Q15_HEADROOM_LIMIT)
+    scale++;
+  exponent += scale;
+
+  // Split the packed spectrum as in rfft()
+  if (count > 0)
+    magnitudes[0] = q15_abs(q15_shift(work[0], scale) + q15_shift(work[1], scale));
+  for (k = 1 ; k < count ; k++)
+  {
+    int32_t zr = q15_shift(work[2 * k], scale), zi = q15_shift(work[2 * k + 1], scale);
+    int32_t yr = q15_shift(work[2 * (n - k)], scale), yi = q15_shift(work[2 * (n - k) + 1], scale);
+    int32_t c = tw[2 * k], s = tw[2 * k + 1];
+
+    // even part (z + conj y) / 2, odd part -i (z - conj y) / 2
+    int32_t er = (zr + yr) >> 1, ei = (zi - yi) >> 1;
+    int32_t or_t = (zi + yi) >> 1, oi = (yr - zr) >> 1;
+
+    int32_t xr = er + q15_dot(or_t, c, oi, s);
+    int32_t xi = ei + q15_dot(oi, c, or_t, -s);
+    magnitudes[k] = isqrt((uint32_t)(xr * xr + xi * xi));
+  }
+  return exponent;
+}
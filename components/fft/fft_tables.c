@@ -0,0 +1,4727 @@
+/*
+  Generated by gen_fft_tables.py, do not edit.
+*/
+#include "fft.h"
+
+// [cos(2 pi k / 4096), sin(2 pi k / 4096)] for k = 0 .. 4095
+const float fft_twiddle_table[2 * FFT_TWIDDLE_TABLE_SIZE] =
+{
+  1.0f, 0.0f,
+  0.999998808f, 0.00153398013f,
+  0.999995291f, 0.00306795677f,
+  0.99998939f, 0.00460192608f,
+  0.999981165f, 0.00613588467f,
+  0.999970615f, 0.00766982883f,
+  0.999957621f, 0.00920375437f,
+  0.999942362f, 0.0107376594f,
+  0.999924719f, 0.0122715384f,
+  0.999904692f, 0.0138053885f,
+  0.99988234f, 0.015339206f,
+  0.999857664f, 0.0168729872f,
+  0.999830604f, 0.0184067301f,
+  0.999801159f, 0.0199404284f,
+  0.99976939f, 0.0214740802f,
+  0.999735296f, 0.0230076816f,
+  0.999698818f, 0.024541229f,
+  0.999660015f, 0.0260747187f,
+  0.999618828f, 0.027608145f,
+  0.999575317f, 0.029141508f,
+  0.999529421f, 0.030674804f,
+  0.999481201f, 0.0322080255f,
+  0.999430597f, 0.0337411724f,
+  0.999377668f, 0.0352742374f,
+  0.999322355f, 0.0368072242f,
+  0.999264777f, 0.0383401215f,
+  0.999204755f, 0.0398729257f,
+  0.999142408f, 0.0414056405f,
+  0.999077737f, 0.0429382585f,
+  0.999010682f, 0.0444707721f,
+  0.998941302f, 0.0460031815f,
+  0.998869538f, 0.0475354828f,
+  0.99879545f, 0.0490676761f,
+  0.998719037f, 0.0505997501f,
+  0.998640239f, 0.052131705f,
+  0.998559058f, 0.0536635369f,
+  0.998475552f, 0.0551952459f,
+  0.998389721f, 0.0567268208f,
+  0.998301566f, 0.0582582653f,
+  0.998211026f, 0.0597895719f,
+  0.998118103f, 0.061320737f,
+  0.998022854f, 0.0628517568f,
+  0.997925282f, 0.0643826276f,
+  0.997825325f, 0.0659133494f,
+  0.997723043f, 0.0674439222f,
+  0.997618437f, 0.068974331f,
+  0.997511446f, 0.070504576f,
+  0.997402132f, 0.0720346496f,
+  0.997290432f, 0.0735645667f,
+  0.997176409f, 0.0750942975f,
+  0.997060061f, 0.0766238645f,
+  0.996941328f, 0.0781532452f,
+  0.996820271f, 0.0796824396f,
+  0.996696889f, 0.0812114477f,
+  0.996571124f, 0.0827402622f,
+  0.996443033f, 0.0842688903f,
+  0.996312618f, 0.0857973099f,
+  0.996179819f, 0.0873255357f,
+  0.996044695f, 0.0888535529f,
+  0.995907247f, 0.0903813615f,
+  0.995767415f, 0.0919089541f,
+  0.995625257f, 0.093436338f,
+  0.995480776f, 0.0949634984f,
+  0.99533391f, 0.0964904279f,
+  0.99518472f, 0.0980171412f,
+  0.995033205f, 0.0995436162f,
+  0.994879305f, 0.10106986f,
+  0.994723141f, 0.102595866f,
+  0.994564593f, 0.104121633f,
+  0.99440366f, 0.105647154f,
+  0.994240463f, 0.107172422f,
+  0.994074881f, 0.108697444f,
+  0.993906975f, 0.110222206f,
+  0.993736744f, 0.111746714f,
+  0.993564129f, 0.113270953f,
+  0.993389189f, 0.114794925f,
+  0.993211925f, 0.116318628f,
+  0.993032336f, 0.117842063f,
+  0.992850423f, 0.119365215f,
+  0.992666125f, 0.120888084f,
+  0.992479563f, 0.122410677f,
+  0.992290616f, 0.123932973f,
+  0.992099285f, 0.125454977f,
+  0.991905689f, 0.126976699f,
+  0.991709769f, 0.128498107f,
+  0.991511464f, 0.130019218f,
+  0.991310835f, 0.13154003f,
+  0.991107941f, 0.13306053f,
+  0.990902662f, 0.134580702f,
+  0.990695f, 0.136100575f,
+  0.990485072f, 0.137620121f,
+  0.99027282f, 0.139139339f,
+  0.990058184f, 0.140658244f,
+  0.989841282f, 0.142176807f,
+  0.989621997f, 0.143695027f,
+  0.989400446f, 0.145212919f,
+  0.989176512f, 0.146730468f,
+  0.988950253f, 0.148247674f,
+  0.988721669f, 0.149764538f,
+  0.98849082f, 0.151281044f,
+  0.988257587f, 0.152797192f,
+  0.988022029f, 0.154312968f,
+  0.987784147f, 0.155828401f,
+  0.987543941f, 0.157343462f,
+  0.987301409f, 0.15885815f,
+  0.987056553f, 0.160372451f,
+  0.986809373f, 0.161886394f,
+  0.986559927f, 0.16339995f,
+  0.986308098f, 0.164913118f,
+  0.986053944f, 0.166425899f,
+  0.985797524f, 0.167938292f,
+  0.985538721f, 0.169450298f,
+  0.985277653f, 0.170961887f,
+  0.98501426f, 0.172473088f,
+  0.984748483f, 0.173983872f,
+  0.984480441f, 0.175494254f,
+  0.984210074f, 0.177004218f,
+  0.983937442f, 0.178513765f,
+  0.983662426f, 0.180022895f,
+  0.983385086f, 0.181531608f,
+  0.983105481f, 0.183039889f,
+  0.982823551f, 0.184547737f,
+  0.982539296f, 0.186055154f,
+  0.982252717f, 0.187562123f,
+  0.981963873f, 0.18906866f,
+  0.981672704f, 0.19057475f,
+  0.981379211f, 0.192080393f,
+  0.981083393f, 0.19358559f,
+  0.980785251f, 0.195090324f,
+  0.980484843f, 0.196594596f,
+  0.980182111f, 0.198098406f,
+  0.979877114f, 0.199601755f,
+  0.979569793f, 0.201104641f,
+  0.979260147f, 0.202607036f,
+  0.978948176f, 0.204108968f,
+  0.97863394f, 0.205610409f,
+  0.97831738f, 0.207111374f,
+  0.977998495f, 0.208611846f,
+  0.977677345f, 0.210111842f,
+  0.977353871f, 0.211611331f,
+  0.977028131f, 0.213110313f,
+  0.976700068f, 0.214608818f,
+  0.976369739f, 0.216106802f,
+  0.976037085f, 0.21760428f,
+  0.975702107f, 0.219101235f,
+  0.975364864f, 0.220597684f,
+  0.975025356f, 0.222093627f,
+  0.974683523f, 0.223589033f,
+  0.974339366f, 0.225083917f,
+  0.973992944f, 0.226578265f,
+  0.973644257f, 0.228072077f,
+  0.973293245f, 0.229565367f,
+  0.972939968f, 0.231058106f,
+  0.972584367f, 0.232550308f,
+  0.972226501f, 0.234041959f,
+  0.97186631f, 0.235533059f,
+  0.971503913f, 0.237023607f,
+  0.971139133f, 0.238513589f,
+  0.970772147f, 0.24000302f,
+  0.970402837f, 0.241491884f,
+  0.970031261f, 0.242980182f,
+  0.969657362f, 0.244467899f,
+  0.969281256f, 0.24595505f,
+  0.968902826f, 0.24744162f,
+  0.968522072f, 0.248927608f,
+  0.968139112f, 0.250413001f,
+  0.967753828f, 0.251897812f,
+  0.967366278f, 0.253382027f,
+  0.966976464f, 0.254865646f,
+  0.966584384f, 0.25634867f,
+  0.966189981f, 0.257831097f,
+  0.965793371f, 0.259312928f,
+  0.965394437f, 0.260794103f,
+  0.964993238f, 0.262274712f,
+  0.964589775f, 0.263754666f,
+  0.964184046f, 0.265234023f,
+  0.963776052f, 0.266712755f,
+  0.963365793f, 0.268190861f,
+  0.962953269f, 0.269668311f,
+  0.962538481f, 0.271145165f,
+  0.962121427f, 0.272621363f,
+  0.961702049f, 0.274096906f,
+  0.961280465f, 0.275571823f,
+  0.960856616f, 0.277046084f,
+  0.960430503f, 0.27851969f,
+  0.960002124f, 0.27999264f,
+  0.95957154f, 0.281464934f,
+  0.959138632f, 0.282936573f,
+  0.958703458f, 0.284407526f,
+  0.958266079f, 0.285877824f,
+  0.957826436f, 0.287347466f,
+  0.957384527f, 0.288816422f,
+  0.956940353f, 0.290284663f,
+  0.956493914f, 0.291752249f,
+  0.95604527f, 0.293219149f,
+  0.955594361f, 0.294685364f,
+  0.955141187f, 0.296150893f,
+  0.954685748f, 0.297615707f,
+  0.954228103f, 0.299079835f,
+  0.953768194f, 0.300543249f,
+  0.953306019f, 0.302005947f,
+  0.95284164f, 0.303467959f,
+  0.952374995f, 0.304929227f,
+  0.951906145f, 0.306389809f,
+  0.95143503f, 0.307849646f,
+  0.950961649f, 0.309308767f,
+  0.950486064f, 0.310767144f,
+  0.950008273f, 0.312224805f,
+  0.949528158f, 0.313681751f,
+  0.949045897f, 0.315137923f,
+  0.94856137f, 0.316593379f,
+  0.948074579f, 0.31804809f,
+  0.947585583f, 0.319502026f,
+  0.947094381f, 0.320955247f,
+  0.946600914f, 0.322407693f,
+  0.946105242f, 0.323859364f,
+  0.945607305f, 0.32531029f,
+  0.945107222f, 0.326760441f,
+  0.944604814f, 0.328209847f,
+  0.944100261f, 0.329658449f,
+  0.943593442f, 0.331106305f,
+  0.943084419f, 0.332553357f,
+  0.94257319f, 0.333999664f,
+  0.942059755f, 0.335445136f,
+  0.941544056f, 0.336889863f,
+  0.941026151f, 0.338333756f,
+  0.940506041f, 0.339776874f,
+  0.939983726f, 0.341219217f,
+  0.939459205f, 0.342660725f,
+  0.938932478f, 0.344101429f,
+  0.938403547f, 0.345541328f,
+  0.93787235f, 0.346980423f,
+  0.937339008f, 0.348418683f,
+  0.93680346f, 0.349856138f,
+  0.936265647f, 0.351292759f,
+  0.935725689f, 0.352728546f,
+  0.935183525f, 0.354163527f,
+  0.934639156f, 0.355597675f,
+  0.934092522f, 0.357030958f,
+  0.933543801f, 0.358463407f,
+  0.932992816f, 0.359895051f,
+  0.932439625f, 0.3613258f,
+  0.931884289f, 0.362755716f,
+  0.931326687f, 0.364184797f,
+  0.93076694f, 0.365612984f,
+  0.930205047f, 0.367040336f,
+  0.929640889f, 0.368466824f,
+  0.929074585f, 0.369892448f,
+  0.928506076f, 0.371317208f,
+  0.927935421f, 0.372741073f,
+  0.927362502f, 0.374164075f,
+  0.926787496f, 0.375586182f,
+  0.926210225f, 0.377007425f,
+  0.925630808f, 0.378427744f,
+  0.925049245f, 0.379847199f,
+  0.924465477f, 0.381265759f,
+  0.923879504f, 0.382683426f,
+  0.923291445f, 0.384100199f,
+  0.92270112f, 0.385516047f,
+  0.92210865f, 0.386931002f,
+  0.921514034f, 0.388345033f,
+  0.920917213f, 0.38975817f,
+  0.920318305f, 0.391170382f,
+  0.919717133f, 0.392581671f,
+  0.919113874f, 0.393992037f,
+  0.91850841f, 0.395401478f,
+  0.917900801f, 0.396809995f,
+  0.917290986f, 0.398217559f,
+  0.916679084f, 0.399624199f,
+  0.916064978f, 0.401029885f,
+  0.915448725f, 0.402434647f,
+  0.914830327f, 0.403838456f,
+  0.914209783f, 0.405241311f,
+  0.913587034f, 0.406643212f,
+  0.912962198f, 0.408044159f,
+  0.912335157f, 0.409444153f,
+  0.91170603f, 0.410843164f,
+  0.911074758f, 0.41224122f,
+  0.910441279f, 0.413638324f,
+  0.909805715f, 0.415034413f,
+  0.909168005f, 0.416429549f,
+  0.90852809f, 0.417823702f,
+  0.907886088f, 0.419216901f,
+  0.907242f, 0.420609087f,
+  0.906595707f, 0.422000259f,
+  0.905947268f, 0.423390478f,
+  0.905296743f, 0.424779683f,
+  0.904644072f, 0.426167876f,
+  0.903989315f, 0.427555084f,
+  0.903332353f, 0.42894128f,
+  0.902673304f, 0.430326492f,
+  0.902012169f, 0.43171066f,
+  0.901348829f, 0.433093816f,
+  0.900683403f, 0.434475958f,
+  0.900015891f, 0.435857087f,
+  0.899346232f, 0.437237173f,
+  0.898674488f, 0.438616246f,
+  0.898000598f, 0.439994276f,
+  0.897324562f, 0.441371262f,
+  0.8966465f, 0.442747235f,
+  0.895966232f, 0.444122136f,
+  0.895283937f, 0.445496023f,
+  0.894599497f, 0.446868837f,
+  0.893912971f, 0.448240608f,
+  0.893224299f, 0.449611336f,
+  0.892533541f, 0.450980991f,
+  0.891840696f, 0.452349573f,
+  0.891145766f, 0.453717113f,
+  0.890448749f, 0.455083579f,
+  0.889749587f, 0.456448972f,
+  0.889048338f, 0.457813293f,
+  0.888345063f, 0.45917654f,
+  0.887639642f, 0.460538715f,
+  0.886932135f, 0.461899787f,
+  0.886222541f, 0.463259786f,
+  0.885510862f, 0.464618683f,
+  0.884797096f, 0.465976506f,
+  0.884081244f, 0.467333198f,
+  0.883363366f, 0.468688816f,
+  0.882643342f, 0.470043331f,
+  0.881921291f, 0.471396744f,
+  0.881197095f, 0.472749025f,
+  0.880470872f, 0.474100202f,
+  0.879742622f, 0.475450277f,
+  0.879012227f, 0.47679922f,
+  0.878279805f, 0.47814706f,
+  0.877545297f, 0.479493767f,
+  0.876808703f, 0.480839342f,
+  0.876070082f, 0.482183784f,
+  0.875329375f, 0.483527064f,
+  0.874586642f, 0.484869242f,
+  0.873841822f, 0.486210287f,
+  0.873094976f, 0.487550169f,
+  0.872346044f, 0.48888889f,
+  0.871595085f, 0.490226477f,
+  0.87084204f, 0.491562903f,
+  0.870086968f, 0.492898196f,
+  0.86932987f, 0.494232297f,
+  0.868570685f, 0.495565265f,
+  0.867809474f, 0.496897042f,
+  0.867046237f, 0.498227656f,
+  0.866280973f, 0.499557108f,
+  0.865513623f, 0.500885367f,
+  0.864744246f, 0.502212465f,
+  0.863972843f, 0.50353837f,
+  0.863199413f, 0.504863083f,
+  0.862423956f, 0.506186664f,
+  0.861646473f, 0.507508993f,
+  0.860866964f, 0.50883013f,
+  0.860085368f, 0.510150075f,
+  0.859301805f, 0.511468828f,
+  0.858516216f, 0.512786388f,
+  0.857728601f, 0.514102757f,
+  0.856938958f, 0.515417874f,
+  0.856147349f, 0.516731799f,
+  0.855353653f, 0.518044531f,
+  0.854557991f, 0.519356012f,
+  0.853760302f, 0.520666242f,
+  0.852960587f, 0.521975279f,
+  0.852158904f, 0.523283124f,
+  0.851355195f, 0.524589658f,
+  0.850549459f, 0.525895f,
+  0.849741757f, 0.527199149f,
+  0.848932028f, 0.528501987f,
+  0.848120332f, 0.529803634f,
+  0.847306609f, 0.531104028f,
+  0.84649092f, 0.532403111f,
+  0.845673263f, 0.533701003f,
+  0.84485358f, 0.534997642f,
+  0.84403187f, 0.53629297f,
+  0.843208253f, 0.537587047f,
+  0.84238261f, 0.538879931f,
+  0.841554999f, 0.540171444f,
+  0.840725362f, 0.541461766f,
+  0.839893818f, 0.542750776f,
+  0.839060247f, 0.544038534f,
+  0.838224709f, 0.545324981f,
+  0.837387204f, 0.546610177f,
+  0.836547732f, 0.547894061f,
+  0.835706294f, 0.549176633f,
+  0.834862888f, 0.550457954f,
+  0.834017515f, 0.551737964f,
+  0.833170176f, 0.553016722f,
+  0.832320869f, 0.554294109f,
+  0.831469595f, 0.555570245f,
+  0.830616415f, 0.556845009f,
+  0.829761207f, 0.558118522f,
+  0.828904092f, 0.559390724f,
+  0.82804507f, 0.560661554f,
+  0.827184021f, 0.561931133f,
+  0.826321065f, 0.563199341f,
+  0.825456142f, 0.564466238f,
+  0.824589312f, 0.565731823f,
+  0.823720515f, 0.566996038f,
+  0.82284981f, 0.568258941f,
+  0.821977139f, 0.569520533f,
+  0.8211025f, 0.570780754f,
+  0.820225954f, 0.572039604f,
+  0.819347501f, 0.573297143f,
+  0.81846714f, 0.57455337f,
+  0.817584813f, 0.575808167f,
+  0.816700578f, 0.577061653f,
+  0.815814435f, 0.578313768f,
+  0.814926326f, 0.579564571f,
+  0.81403631f, 0.580813944f,
+  0.813144386f, 0.582062006f,
+  0.812250614f, 0.583308637f,
+  0.811354876f, 0.584553957f,
+  0.81045717f, 0.585797846f,
+  0.809557617f, 0.587040365f,
+  0.808656156f, 0.588281572f,
+  0.807752848f, 0.589521289f,
+  0.806847572f, 0.590759695f,
+  0.80594039f, 0.59199667f,
+  0.805031359f, 0.593232274f,
+  0.804120362f, 0.594466507f,
+  0.803207517f, 0.59569931f,
+  0.802292824f, 0.596930683f,
+  0.801376164f, 0.598160684f,
+  0.800457656f, 0.599389315f,
+  0.799537241f, 0.600616455f,
+  0.798614979f, 0.601842225f,
+  0.797690868f, 0.603066623f,
+  0.796764791f, 0.604289532f,
+  0.795836926f, 0.605511069f,
+  0.794907153f, 0.606731117f,
+  0.793975472f, 0.607949793f,
+  0.793041945f, 0.609167039f,
+  0.792106569f, 0.610382795f,
+  0.791169345f, 0.61159718f,
+  0.790230215f, 0.612810075f,
+  0.789289236f, 0.61402154f,
+  0.78834641f, 0.615231574f,
+  0.787401736f, 0.616440177f,
+  0.786455214f, 0.61764729f,
+  0.785506845f, 0.618852973f,
+  0.784556568f, 0.620057225f,
+  0.783604503f, 0.621259987f,
+  0.78265059f, 0.622461259f,
+  0.781694829f, 0.623661101f,
+  0.780737221f, 0.624859512f,
+  0.779777765f, 0.626056373f,
+  0.778816521f, 0.627251804f,
+  0.777853429f, 0.628445745f,
+  0.77688849f, 0.629638255f,
+  0.775921702f, 0.630829215f,
+  0.774953127f, 0.632018745f,
+  0.773982704f, 0.633206785f,
+  0.773010433f, 0.634393275f,
+  0.772036374f, 0.635578334f,
+  0.771060526f, 0.636761844f,
+  0.770082831f, 0.637943923f,
+  0.769103348f, 0.639124453f,
+  0.768122017f, 0.640303493f,
+  0.767138898f, 0.641481042f,
+  0.766153991f, 0.642657042f,
+  0.765167236f, 0.643831551f,
+  0.764178753f, 0.645004511f,
+  0.763188422f, 0.64617604f,
+  0.762196302f, 0.64734596f,
+  0.761202395f, 0.64851439f,
+  0.760206699f, 0.64968133f,
+  0.759209216f, 0.65084666f,
+  0.758209884f, 0.65201056f,
+  0.757208824f, 0.653172851f,
+  0.756205976f, 0.654333591f,
+  0.755201399f, 0.655492842f,
+  0.754194975f, 0.656650543f,
+  0.753186822f, 0.657806695f,
+  0.752176821f, 0.658961296f,
+  0.751165152f, 0.660114348f,
+  0.750151634f, 0.66126585f,
+  0.749136388f, 0.662415802f,
+  0.748119354f, 0.663564146f,
+  0.747100592f, 0.664710999f,
+  0.746080101f, 0.665856242f,
+  0.745057762f, 0.666999936f,
+  0.744033754f, 0.668142021f,
+  0.743007958f, 0.669282615f,
+  0.741980433f, 0.670421541f,
+  0.740951121f, 0.671558976f,
+  0.73992008f, 0.672694743f,
+  0.73888731f, 0.673829019f,
+  0.737852812f, 0.674961627f,
+  0.736816585f, 0.676092684f,
+  0.73577857f, 0.677222192f,
+  0.734738886f, 0.678350031f,
+  0.733697414f, 0.679476321f,
+  0.732654274f, 0.680601001f,
+  0.731609404f, 0.681724072f,
+  0.730562747f, 0.682845533f,
+  0.72951442f, 0.683965385f,
+  0.728464365f, 0.685083687f,
+  0.727412641f, 0.686200321f,
+  0.726359129f, 0.687315345f,
+  0.725303948f, 0.68842876f,
+  0.724247098f, 0.689540565f,
+  0.72318846f, 0.690650702f,
+  0.722128212f, 0.691759229f,
+  0.721066177f, 0.692866147f,
+  0.720002532f, 0.693971455f,
+  0.718937099f, 0.695075095f,
+  0.717870057f, 0.696177125f,
+  0.716801286f, 0.697277486f,
+  0.715730846f, 0.698376238f,
+  0.714658678f, 0.699473321f,
+  0.71358484f, 0.700568795f,
+  0.712509394f, 0.7016626f,
+  0.711432219f, 0.702754736f,
+  0.710353374f, 0.703845263f,
+  0.709272802f, 0.704934061f,
+  0.70819062f, 0.706021249f,
+  0.707106769f, 0.707106769f,
+  0.706021249f, 0.70819062f,
+  0.704934061f, 0.709272802f,
+  0.703845263f, 0.710353374f,
+  0.702754736f, 0.711432219f,
+  0.7016626f, 0.712509394f,
+  0.700568795f, 0.71358484f,
+  0.699473321f, 0.714658678f,
+  0.698376238f, 0.715730846f,
+  0.697277486f, 0.716801286f,
+  0.696177125f, 0.717870057f,
+  0.695075095f, 0.718937099f,
+  0.693971455f, 0.720002532f,
+  0.692866147f, 0.721066177f,
+  0.691759229f, 0.722128212f,
+  0.690650702f, 0.72318846f,
+  0.689540565f, 0.724247098f,
+  0.68842876f, 0.725303948f,
+  0.687315345f, 0.726359129f,
+  0.686200321f, 0.727412641f,
+  0.685083687f, 0.728464365f,
+  0.683965385f, 0.72951442f,
+  0.682845533f, 0.730562747f,
+  0.681724072f, 0.731609404f,
+  0.680601001f, 0.732654274f,
+  0.679476321f, 0.733697414f,
+  0.678350031f, 0.734738886f,
+  0.677222192f, 0.73577857f,
+  0.676092684f, 0.736816585f,
+  0.674961627f, 0.737852812f,
+  0.673829019f, 0.73888731f,
+  0.672694743f, 0.73992008f,
+  0.671558976f, 0.740951121f,
+  0.670421541f, 0.741980433f,
+  0.669282615f, 0.743007958f,
+  0.668142021f, 0.744033754f,
+  0.666999936f, 0.745057762f,
+  0.665856242f, 0.746080101f,
+  0.664710999f, 0.747100592f,
+  0.663564146f, 0.748119354f,
+  0.662415802f, 0.749136388f,
+  0.66126585f, 0.750151634f,
+  0.660114348f, 0.751165152f,
+  0.658961296f, 0.752176821f,
+  0.657806695f, 0.753186822f,
+  0.656650543f, 0.754194975f,
+  0.655492842f, 0.755201399f,
+  0.654333591f, 0.756205976f,
+  0.653172851f, 0.757208824f,
+  0.65201056f, 0.758209884f,
+  0.65084666f, 0.759209216f,
+  0.64968133f, 0.760206699f,
+  0.64851439f, 0.761202395f,
+  0.64734596f, 0.762196302f,
+  0.64617604f, 0.763188422f,
+  0.645004511f, 0.764178753f,
+  0.643831551f, 0.765167236f,
+  0.642657042f, 0.766153991f,
+  0.641481042f, 0.767138898f,
+  0.640303493f, 0.768122017f,
+  0.639124453f, 0.769103348f,
+  0.637943923f, 0.770082831f,
+  0.636761844f, 0.771060526f,
+  0.635578334f, 0.772036374f,
+  0.634393275f, 0.773010433f,
+  0.633206785f, 0.773982704f,
+  0.632018745f, 0.774953127f,
+  0.630829215f, 0.775921702f,
+  0.629638255f, 0.77688849f,
+  0.628445745f, 0.777853429f,
+  0.627251804f, 0.778816521f,
+  0.626056373f, 0.779777765f,
+  0.624859512f, 0.780737221f,
+  0.623661101f, 0.781694829f,
+  0.622461259f, 0.78265059f,
+  0.621259987f, 0.783604503f,
+  0.620057225f, 0.784556568f,
+  0.618852973f, 0.785506845f,
+  0.61764729f, 0.786455214f,
+  0.616440177f, 0.787401736f,
+  0.615231574f, 0.78834641f,
+  0.61402154f, 0.789289236f,
+  0.612810075f, 0.790230215f,
+  0.61159718f, 0.791169345f,
+  0.610382795f, 0.792106569f,
+  0.609167039f, 0.793041945f,
+  0.607949793f, 0.793975472f,
+  0.606731117f, 0.794907153f,
+  0.605511069f, 0.795836926f,
+  0.604289532f, 0.796764791f,
+  0.603066623f, 0.797690868f,
+  0.601842225f, 0.798614979f,
+  0.600616455f, 0.799537241f,
+  0.599389315f, 0.800457656f,
+  0.598160684f, 0.801376164f,
+  0.596930683f, 0.802292824f,
+  0.59569931f, 0.803207517f,
+  0.594466507f, 0.804120362f,
+  0.593232274f, 0.805031359f,
+  0.59199667f, 0.80594039f,
+  0.590759695f, 0.806847572f,
+  0.589521289f, 0.807752848f,
+  0.588281572f, 0.808656156f,
+  0.587040365f, 0.809557617f,
+  0.585797846f, 0.81045717f,
+  0.584553957f, 0.811354876f,
+  0.583308637f, 0.812250614f,
+  0.582062006f, 0.813144386f,
+  0.580813944f, 0.81403631f,
+  0.579564571f, 0.814926326f,
+  0.578313768f, 0.815814435f,
+  0.577061653f, 0.816700578f,
+  0.575808167f, 0.817584813f,
+  0.57455337f, 0.81846714f,
+  0.573297143f, 0.819347501f,
+  0.572039604f, 0.820225954f,
+  0.570780754f, 0.8211025f,
+  0.569520533f, 0.821977139f,
+  0.568258941f, 0.82284981f,
+  0.566996038f, 0.823720515f,
+  0.565731823f, 0.824589312f,
+  0.564466238f, 0.825456142f,
+  0.563199341f, 0.826321065f,
+  0.561931133f, 0.827184021f,
+  0.560661554f, 0.82804507f,
+  0.559390724f, 0.828904092f,
+  0.558118522f, 0.829761207f,
+  0.556845009f, 0.830616415f,
+  0.555570245f, 0.831469595f,
+  0.554294109f, 0.832320869f,
+  0.553016722f, 0.833170176f,
+  0.551737964f, 0.834017515f,
+  0.550457954f, 0.834862888f,
+  0.549176633f, 0.835706294f,
+  0.547894061f, 0.836547732f,
+  0.546610177f, 0.837387204f,
+  0.545324981f, 0.838224709f,
+  0.544038534f, 0.839060247f,
+  0.542750776f, 0.839893818f,
+  0.541461766f, 0.840725362f,
+  0.540171444f, 0.841554999f,
+  0.538879931f, 0.84238261f,
+  0.537587047f, 0.843208253f,
+  0.53629297f, 0.84403187f,
+  0.534997642f, 0.84485358f,
+  0.533701003f, 0.845673263f,
+  0.532403111f, 0.84649092f,
+  0.531104028f, 0.847306609f,
+  0.529803634f, 0.848120332f,
+  0.528501987f, 0.848932028f,
+  0.527199149f, 0.849741757f,
+  0.525895f, 0.850549459f,
+  0.524589658f, 0.851355195f,
+  0.523283124f, 0.852158904f,
+  0.521975279f, 0.852960587f,
+  0.520666242f, 0.853760302f,
+  0.519356012f, 0.854557991f,
+  0.518044531f, 0.855353653f,
+  0.516731799f, 0.856147349f,
+  0.515417874f, 0.856938958f,
+  0.514102757f, 0.857728601f,
+  0.512786388f, 0.858516216f,
+  0.511468828f, 0.859301805f,
+  0.510150075f, 0.860085368f,
+  0.50883013f, 0.860866964f,
+  0.507508993f, 0.861646473f,
+  0.506186664f, 0.862423956f,
+  0.504863083f, 0.863199413f,
+  0.50353837f, 0.863972843f,
+  0.502212465f, 0.864744246f,
+  0.500885367f, 0.865513623f,
+  0.499557108f, 0.866280973f,
+  0.498227656f, 0.867046237f,
+  0.496897042f, 0.867809474f,
+  0.495565265f, 0.868570685f,
+  0.494232297f, 0.86932987f,
+  0.492898196f, 0.870086968f,
+  0.491562903f, 0.87084204f,
+  0.490226477f, 0.871595085f,
+  0.48888889f, 0.872346044f,
+  0.487550169f, 0.873094976f,
+  0.486210287f, 0.873841822f,
+  0.484869242f, 0.874586642f,
+  0.483527064f, 0.875329375f,
+  0.482183784f, 0.876070082f,
+  0.480839342f, 0.876808703f,
+  0.479493767f, 0.877545297f,
+  0.47814706f, 0.878279805f,
+  0.47679922f, 0.879012227f,
+  0.475450277f, 0.879742622f,
+  0.474100202f, 0.880470872f,
+  0.472749025f, 0.881197095f,
+  0.471396744f, 0.881921291f,
+  0.470043331f, 0.882643342f,
+  0.468688816f, 0.883363366f,
+  0.467333198f, 0.884081244f,
+  0.465976506f, 0.884797096f,
+  0.464618683f, 0.885510862f,
+  0.463259786f, 0.886222541f,
+  0.461899787f, 0.886932135f,
+  0.460538715f, 0.887639642f,
+  0.45917654f, 0.888345063f,
+  0.457813293f, 0.889048338f,
+  0.456448972f, 0.889749587f,
+  0.455083579f, 0.890448749f,
+  0.453717113f, 0.891145766f,
+  0.452349573f, 0.891840696f,
+  0.450980991f, 0.892533541f,
+  0.449611336f, 0.893224299f,
+  0.448240608f, 0.893912971f,
+  0.446868837f, 0.894599497f,
+  0.445496023f, 0.895283937f,
+  0.444122136f, 0.895966232f,
+  0.442747235f, 0.8966465f,
+  0.441371262f, 0.897324562f,
+  0.439994276f, 0.898000598f,
+  0.438616246f, 0.898674488f,
+  0.437237173f, 0.899346232f,
+  0.435857087f, 0.900015891f,
+  0.434475958f, 0.900683403f,
+  0.433093816f, 0.901348829f,
+  0.43171066f, 0.902012169f,
+  0.430326492f, 0.902673304f,
+  0.42894128f, 0.903332353f,
+  0.427555084f, 0.903989315f,
+  0.426167876f, 0.904644072f,
+  0.424779683f, 0.905296743f,
+  0.423390478f, 0.905947268f,
+  0.422000259f, 0.906595707f,
+  0.420609087f, 0.907242f,
+  0.419216901f, 0.907886088f,
+  0.417823702f, 0.90852809f,
+  0.416429549f, 0.909168005f,
+  0.415034413f, 0.909805715f,
+  0.413638324f, 0.910441279f,
+  0.41224122f, 0.911074758f,
+  0.410843164f, 0.91170603f,
+  0.409444153f, 0.912335157f,
+  0.408044159f, 0.912962198f,
+  0.406643212f, 0.913587034f,
+  0.405241311f, 0.914209783f,
+  0.403838456f, 0.914830327f,
+  0.402434647f, 0.915448725f,
+  0.401029885f, 0.916064978f,
+  0.399624199f, 0.916679084f,
+  0.398217559f, 0.917290986f,
+  0.396809995f, 0.917900801f,
+  0.395401478f, 0.91850841f,
+  0.393992037f, 0.919113874f,
+  0.392581671f, 0.919717133f,
+  0.391170382f, 0.920318305f,
+  0.38975817f, 0.920917213f,
+  0.388345033f, 0.921514034f,
+  0.386931002f, 0.92210865f,
+  0.385516047f, 0.92270112f,
+  0.384100199f, 0.923291445f,
+  0.382683426f, 0.923879504f,
+  0.381265759f, 0.924465477f,
+  0.379847199f, 0.925049245f,
+  0.378427744f, 0.925630808f,
+  0.377007425f, 0.926210225f,
+  0.375586182f, 0.926787496f,
+  0.374164075f, 0.927362502f,
+  0.372741073f, 0.927935421f,
+  0.371317208f, 0.928506076f,
+  0.369892448f, 0.929074585f,
+  0.368466824f, 0.929640889f,
+  0.367040336f, 0.930205047f,
+  0.365612984f, 0.93076694f,
+  0.364184797f, 0.931326687f,
+  0.362755716f, 0.931884289f,
+  0.3613258f, 0.932439625f,
+  0.359895051f, 0.932992816f,
+  0.358463407f, 0.933543801f,
+  0.357030958f, 0.934092522f,
+  0.355597675f, 0.934639156f,
+  0.354163527f, 0.935183525f,
+  0.352728546f, 0.935725689f,
+  0.351292759f, 0.936265647f,
+  0.349856138f, 0.93680346f,
+  0.348418683f, 0.937339008f,
+  0.346980423f, 0.93787235f,
+  0.345541328f, 0.938403547f,
+  0.344101429f, 0.938932478f,
+  0.342660725f, 0.939459205f,
+  0.341219217f, 0.939983726f,
+  0.339776874f, 0.940506041f,
+  0.338333756f, 0.941026151f,
+  0.336889863f, 0.941544056f,
+  0.335445136f, 0.942059755f,
+  0.333999664f, 0.94257319f,
+  0.332553357f, 0.943084419f,
+  0.331106305f, 0.943593442f,
+  0.329658449f, 0.944100261f,
+  0.328209847f, 0.944604814f,
+  0.326760441f, 0.945107222f,
+  0.32531029f, 0.945607305f,
+  0.323859364f, 0.946105242f,
+  0.322407693f, 0.946600914f,
+  0.320955247f, 0.947094381f,
+  0.319502026f, 0.947585583f,
+  0.31804809f, 0.948074579f,
+  0.316593379f, 0.94856137f,
+  0.315137923f, 0.949045897f,
+  0.313681751f, 0.949528158f,
+  0.312224805f, 0.950008273f,
+  0.310767144f, 0.950486064f,
+  0.309308767f, 0.950961649f,
+  0.307849646f, 0.95143503f,
+  0.306389809f, 0.951906145f,
+  0.304929227f, 0.952374995f,
+  0.303467959f, 0.95284164f,
+  0.302005947f, 0.953306019f,
+  0.300543249f, 0.953768194f,
+  0.299079835f, 0.954228103f,
+  0.297615707f, 0.954685748f,
+  0.296150893f, 0.955141187f,
+  0.294685364f, 0.955594361f,
+  0.293219149f, 0.95604527f,
+  0.291752249f, 0.956493914f,
+  0.290284663f, 0.956940353f,
+  0.288816422f, 0.957384527f,
+  0.287347466f, 0.957826436f,
+  0.285877824f, 0.958266079f,
+  0.284407526f, 0.958703458f,
+  0.282936573f, 0.959138632f,
+  0.281464934f, 0.95957154f,
+  0.27999264f, 0.960002124f,
+  0.27851969f, 0.960430503f,
+  0.277046084f, 0.960856616f,
+  0.275571823f, 0.961280465f,
+  0.274096906f, 0.961702049f,
+  0.272621363f, 0.962121427f,
+  0.271145165f, 0.962538481f,
+  0.269668311f, 0.962953269f,
+  0.268190861f, 0.963365793f,
+  0.266712755f, 0.963776052f,
+  0.265234023f, 0.964184046f,
+  0.263754666f, 0.964589775f,
+  0.262274712f, 0.964993238f,
+  0.260794103f, 0.965394437f,
+  0.259312928f, 0.965793371f,
+  0.257831097f, 0.966189981f,
+  0.25634867f, 0.966584384f,
+  0.254865646f, 0.966976464f,
+  0.253382027f, 0.967366278f,
+  0.251897812f, 0.967753828f,
+  0.250413001f, 0.968139112f,
+  0.248927608f, 0.968522072f,
+  0.24744162f, 0.968902826f,
+  0.24595505f, 0.969281256f,
+  0.244467899f, 0.969657362f,
+  0.242980182f, 0.970031261f,
+  0.241491884f, 0.970402837f,
+  0.24000302f, 0.970772147f,
+  0.238513589f, 0.971139133f,
+  0.237023607f, 0.971503913f,
+  0.235533059f, 0.97186631f,
+  0.234041959f, 0.972226501f,
+  0.232550308f, 0.972584367f,
+  0.231058106f, 0.972939968f,
+  0.229565367f, 0.973293245f,
+  0.228072077f, 0.973644257f,
+  0.226578265f, 0.973992944f,
+  0.225083917f, 0.974339366f,
+  0.223589033f, 0.974683523f,
+  0.222093627f, 0.975025356f,
+  0.220597684f, 0.975364864f,
+  0.219101235f, 0.975702107f,
+  0.21760428f, 0.976037085f,
+  0.216106802f, 0.976369739f,
+  0.214608818f, 0.976700068f,
+  0.213110313f, 0.977028131f,
+  0.211611331f, 0.977353871f,
+  0.210111842f, 0.977677345f,
+  0.208611846f, 0.977998495f,
+  0.207111374f, 0.97831738f,
+  0.205610409f, 0.97863394f,
+  0.204108968f, 0.978948176f,
+  0.202607036f, 0.979260147f,
+  0.201104641f, 0.979569793f,
+  0.199601755f, 0.979877114f,
+  0.198098406f, 0.980182111f,
+  0.196594596f, 0.980484843f,
+  0.195090324f, 0.980785251f,
+  0.19358559f, 0.981083393f,
+  0.192080393f, 0.981379211f,
+  0.19057475f, 0.981672704f,
+  0.18906866f, 0.981963873f,
+  0.187562123f, 0.982252717f,
+  0.186055154f, 0.982539296f,
+  0.184547737f, 0.982823551f,
+  0.183039889f, 0.983105481f,
+  0.181531608f, 0.983385086f,
+  0.180022895f, 0.983662426f,
+  0.178513765f, 0.983937442f,
+  0.177004218f, 0.984210074f,
+  0.175494254f, 0.984480441f,
+  0.173983872f, 0.984748483f,
+  0.172473088f, 0.98501426f,
+  0.170961887f, 0.985277653f,
+  0.169450298f, 0.985538721f,
+  0.167938292f, 0.985797524f,
+  0.166425899f, 0.986053944f,
+  0.164913118f, 0.986308098f,
+  0.16339995f, 0.986559927f,
+  0.161886394f, 0.986809373f,
+  0.160372451f, 0.987056553f,
+  0.15885815f, 0.987301409f,
+  0.157343462f, 0.987543941f,
+  0.155828401f, 0.987784147f,
+  0.154312968f, 0.988022029f,
+  0.152797192f, 0.988257587f,
+  0.151281044f, 0.98849082f,
+  0.149764538f, 0.988721669f,
+  0.148247674f, 0.988950253f,
+  0.146730468f, 0.989176512f,
+  0.145212919f, 0.989400446f,
+  0.143695027f, 0.989621997f,
+  0.142176807f, 0.989841282f,
+  0.140658244f, 0.990058184f,
+  0.139139339f, 0.99027282f,
+  0.137620121f, 0.990485072f,
+  0.136100575f, 0.990695f,
+  0.134580702f, 0.990902662f,
+  0.13306053f, 0.991107941f,
+  0.13154003f, 0.991310835f,
+  0.130019218f, 0.991511464f,
+  0.128498107f, 0.991709769f,
+  0.126976699f, 0.991905689f,
+  0.125454977f, 0.992099285f,
+  0.123932973f, 0.992290616f,
+  0.122410677f, 0.992479563f,
+  0.120888084f, 0.992666125f,
+  0.119365215f, 0.992850423f,
+  0.117842063f, 0.993032336f,
+  0.116318628f, 0.993211925f,
+  0.114794925f, 0.993389189f,
+  0.113270953f, 0.993564129f,
+  0.111746714f, 0.993736744f,
+  0.110222206f, 0.993906975f,
+  0.108697444f, 0.994074881f,
+  0.107172422f, 0.994240463f,
+  0.105647154f, 0.99440366f,
+  0.104121633f, 0.994564593f,
+  0.102595866f, 0.994723141f,
+  0.10106986f, 0.994879305f,
+  0.0995436162f, 0.995033205f,
+  0.0980171412f, 0.99518472f,
+  0.0964904279f, 0.99533391f,
+  0.0949634984f, 0.995480776f,
+  0.093436338f, 0.995625257f,
+  0.0919089541f, 0.995767415f,
+  0.0903813615f, 0.995907247f,
+  0.0888535529f, 0.996044695f,
+  0.0873255357f, 0.996179819f,
+  0.0857973099f, 0.996312618f,
+  0.0842688903f, 0.996443033f,
+  0.0827402622f, 0.996571124f,
+  0.0812114477f, 0.996696889f,
+  0.0796824396f, 0.996820271f,
+  0.0781532452f, 0.996941328f,
+  0.0766238645f, 0.997060061f,
+  0.0750942975f, 0.997176409f,
+  0.0735645667f, 0.997290432f,
+  0.0720346496f, 0.997402132f,
+  0.070504576f, 0.997511446f,
+  0.068974331f, 0.997618437f,
+  0.0674439222f, 0.997723043f,
+  0.0659133494f, 0.997825325f,
+  0.0643826276f, 0.997925282f,
+  0.0628517568f, 0.998022854f,
+  0.061320737f, 0.998118103f,
+  0.0597895719f, 0.998211026f,
+  0.0582582653f, 0.998301566f,
+  0.0567268208f, 0.998389721f,
+  0.0551952459f, 0.998475552f,
+  0.0536635369f, 0.998559058f,
+  0.052131705f, 0.998640239f,
+  0.0505997501f, 0.998719037f,
+  0.0490676761f, 0.99879545f,
+  0.0475354828f, 0.998869538f,
+  0.0460031815f, 0.998941302f,
+  0.0444707721f, 0.999010682f,
+  0.0429382585f, 0.999077737f,
+  0.0414056405f, 0.999142408f,
+  0.0398729257f, 0.999204755f,
+  0.0383401215f, 0.999264777f,
+  0.0368072242f, 0.999322355f,
+  0.0352742374f, 0.999377668f,
+  0.0337411724f, 0.999430597f,
+  0.0322080255f, 0.999481201f,
+  0.030674804f, 0.999529421f,
+  0.029141508f, 0.999575317f,
+  0.027608145f, 0.999618828f,
+  0.0260747187f, 0.999660015f,
+  0.024541229f, 0.999698818f,
+  0.0230076816f, 0.999735296f,
+  0.0214740802f, 0.99976939f,
+  0.0199404284f, 0.999801159f,
+  0.0184067301f, 0.999830604f,
+  0.0168729872f, 0.999857664f,
+  0.015339206f, 0.99988234f,
+  0.0138053885f, 0.999904692f,
+  0.0122715384f, 0.999924719f,
+  0.0107376594f, 0.999942362f,
+  0.00920375437f, 0.999957621f,
+  0.00766982883f, 0.999970615f,
+  0.00613588467f, 0.999981165f,
+  0.00460192608f, 0.99998939f,
+  0.00306795677f, 0.999995291f,
+  0.00153398013f, 0.999998808f,
+  0.0f, 1.0f,
+  -0.00153398013f, 0.999998808f,
+  -0.00306795677f, 0.999995291f,
+  -0.00460192608f, 0.99998939f,
+  -0.00613588467f, 0.999981165f,
+  -0.00766982883f, 0.999970615f,
+  -0.00920375437f, 0.999957621f,
+  -0.0107376594f, 0.999942362f,
+  -0.0122715384f, 0.999924719f,
+  -0.0138053885f, 0.999904692f,
+  -0.015339206f, 0.99988234f,
+  -0.0168729872f, 0.999857664f,
+  -0.0184067301f, 0.999830604f,
+  -0.0199404284f, 0.999801159f,
+  -0.0214740802f, 0.99976939f,
+  -0.0230076816f, 0.999735296f,
+  -0.024541229f, 0.999698818f,
+  -0.0260747187f, 0.999660015f,
+  -0.027608145f, 0.999618828f,
+  -0.029141508f, 0.999575317f,
+  -0.030674804f, 0.999529421f,
+  -0.0322080255f, 0.999481201f,
+  -0.0337411724f, 0.999430597f,
+  -0.0352742374f, 0.999377668f,
+  -0.0368072242f, 0.999322355f,
+  -0.0383401215f, 0.999264777f,
+  -0.0398729257f, 0.999204755f,
+  -0.0414056405f, 0.999142408f,
+  -0.0429382585f, 0.999077737f,
+  -0.0444707721f, 0.999010682f,
+  -0.0460031815f, 0.998941302f,
+  -0.0475354828f, 0.998869538f,
+  -0.0490676761f, 0.99879545f,
+  -0.0505997501f, 0.998719037f,
+  -0.052131705f, 0.998640239f,
+  -0.0536635369f, 0.998559058f,
+  -0.0551952459f, 0.998475552f,
+  -0.0567268208f, 0.998389721f,
+  -0.0582582653f, 0.998301566f,
+  -0.0597895719f, 0.998211026f,
+  -0.061320737f, 0.998118103f,
+  -0.0628517568f, 0.998022854f,
+  -0.0643826276f, 0.997925282f,
+  -0.0659133494f, 0.997825325f,
+  -0.0674439222f, 0.997723043f,
+  -0.068974331f, 0.997618437f,
+  -0.070504576f, 0.997511446f,
+  -0.0720346496f, 0.997402132f,
+  -0.0735645667f, 0.997290432f,
+  -0.0750942975f, 0.997176409f,
+  -0.0766238645f, 0.997060061f,
+  -0.0781532452f, 0.996941328f,
+  -0.0796824396f, 0.996820271f,
+  -0.0812114477f, 0.996696889f,
+  -0.0827402622f, 0.996571124f,
+  -0.0842688903f, 0.996443033f,
+  -0.0857973099f, 0.996312618f,
+  -0.0873255357f, 0.996179819f,
+  -0.0888535529f, 0.996044695f,
+  -0.0903813615f, 0.995907247f,
+  -0.0919089541f, 0.995767415f,
+  -0.093436338f, 0.995625257f,
+  -0.0949634984f, 0.995480776f,
+  -0.0964904279f, 0.99533391f,
+  -0.0980171412f, 0.99518472f,
+  -0.0995436162f, 0.995033205f,
+  -0.10106986f, 0.994879305f,
+  -0.102595866f, 0.994723141f,
+  -0.104121633f, 0.994564593f,
+  -0.105647154f, 0.99440366f,
+  -0.107172422f, 0.994240463f,
+  -0.108697444f, 0.994074881f,
+  -0.110222206f, 0.993906975f,
+  -0.111746714f, 0.993736744f,
+  -0.113270953f, 0.993564129f,
+  -0.114794925f, 0.993389189f,
+  -0.116318628f, 0.993211925f,
+  -0.117842063f, 0.993032336f,
+  -0.119365215f, 0.992850423f,
+  -0.120888084f, 0.992666125f,
+  -0.122410677f, 0.992479563f,
+  -0.123932973f, 0.992290616f,
+  -0.125454977f, 0.992099285f,
+  -0.126976699f, 0.991905689f,
+  -0.128498107f, 0.991709769f,
+  -0.130019218f, 0.991511464f,
+  -0.13154003f, 0.991310835f,
+  -0.13306053f, 0.991107941f,
+  -0.134580702f, 0.990902662f,
+  -0.136100575f, 0.990695f,
+  -0.137620121f, 0.990485072f,
+  -0.139139339f, 0.99027282f,
+  -0.140658244f, 0.990058184f,
+  -0.142176807f, 0.989841282f,
+  -0.143695027f, 0.989621997f,
+  -0.145212919f, 0.989400446f,
+  -0.146730468f, 0.989176512f,
+  -0.148247674f, 0.988950253f,
+  -0.149764538f, 0.988721669f,
+  -0.151281044f, 0.98849082f,
+  -0.152797192f, 0.988257587f,
+  -0.154312968f, 0.988022029f,
+  -0.155828401f, 0.987784147f,
+  -0.157343462f, 0.987543941f,
+  -0.15885815f, 0.987301409f,
+  -0.160372451f, 0.987056553f,
+  -0.161886394f, 0.986809373f,
+  -0.16339995f, 0.986559927f,
+  -0.164913118f, 0.986308098f,
+  -0.166425899f, 0.986053944f,
+  -0.167938292f, 0.985797524f,
+  -0.169450298f, 0.985538721f,
+  -0.170961887f, 0.985277653f,
+  -0.172473088f, 0.98501426f,
+  -0.173983872f, 0.984748483f,
+  -0.175494254f, 0.984480441f,
+  -0.177004218f, 0.984210074f,
+  -0.178513765f, 0.983937442f,
+  -0.180022895f, 0.983662426f,
+  -0.181531608f, 0.983385086f,
+  -0.183039889f, 0.983105481f,
+  -0.184547737f, 0.982823551f,
+  -0.186055154f, 0.982539296f,
+  -0.187562123f, 0.982252717f,
+  -0.18906866f, 0.981963873f,
+  -0.19057475f, 0.981672704f,
+  -0.192080393f, 0.981379211f,
+  -0.19358559f, 0.981083393f,
+  -0.195090324f, 0.980785251f,
+  -0.196594596f, 0.980484843f,
+  -0.198098406f, 0.980182111f,
+  -0.199601755f, 0.979877114f,
+  -0.201104641f, 0.979569793f,
+  -0.202607036f, 0.979260147f,
+  -0.204108968f, 0.978948176f,
+  -0.205610409f, 0.97863394f,
+  -0.207111374f, 0.97831738f,
+  -0.208611846f, 0.977998495f,
+  -0.210111842f, 0.977677345f,
+  -0.211611331f, 0.977353871f,
+  -0.213110313f, 0.977028131f,
+  -0.214608818f, 0.976700068f,
+  -0.216106802f, 0.976369739f,
+  -0.21760428f, 0.976037085f,
+  -0.219101235f, 0.975702107f,
+  -0.220597684f, 0.975364864f,
+  -0.222093627f, 0.975025356f,
+  -0.223589033f, 0.974683523f,
+  -0.225083917f, 0.974339366f,
+  -0.226578265f, 0.973992944f,
+  -0.228072077f, 0.973644257f,
+  -0.229565367f, 0.973293245f,
+  -0.231058106f, 0.972939968f,
+  -0.232550308f, 0.972584367f,
+  -0.234041959f, 0.972226501f,
+  -0.235533059f, 0.97186631f,
+  -0.237023607f, 0.971503913f,
+  -0.238513589f, 0.971139133f,
+  -0.24000302f, 0.970772147f,
+  -0.241491884f, 0.970402837f,
+  -0.242980182f, 0.970031261f,
+  -0.244467899f, 0.969657362f,
+  -0.24595505f, 0.969281256f,
+  -0.24744162f, 0.968902826f,
+  -0.248927608f, 0.968522072f,
+  -0.250413001f, 0.968139112f,
+  -0.251897812f, 0.967753828f,
+  -0.253382027f, 0.967366278f,
+  -0.254865646f, 0.966976464f,
+  -0.25634867f, 0.966584384f,
+  -0.257831097f, 0.966189981f,
+  -0.259312928f, 0.965793371f,
+  -0.260794103f, 0.965394437f,
+  -0.262274712f, 0.964993238f,
+  -0.263754666f, 0.964589775f,
+  -0.265234023f, 0.964184046f,
+  -0.266712755f, 0.963776052f,
+  -0.268190861f, 0.963365793f,
+  -0.269668311f, 0.962953269f,
+  -0.271145165f, 0.962538481f,
+  -0.272621363f, 0.962121427f,
+  -0.274096906f, 0.961702049f,
+  -0.275571823f, 0.961280465f,
+  -0.277046084f, 0.960856616f,
+  -0.27851969f, 0.960430503f,
+  -0.27999264f, 0.960002124f,
+  -0.281464934f, 0.95957154f,
+  -0.282936573f, 0.959138632f,
+  -0.284407526f, 0.958703458f,
+  -0.285877824f, 0.958266079f,
+  -0.287347466f, 0.957826436f,
+  -0.288816422f, 0.957384527f,
+  -0.290284663f, 0.956940353f,
+  -0.291752249f, 0.956493914f,
+  -0.293219149f, 0.95604527f,
+  -0.294685364f, 0.955594361f,
+  -0.296150893f, 0.955141187f,
+  -0.297615707f, 0.954685748f,
+  -0.299079835f, 0.954228103f,
+  -0.300543249f, 0.953768194f,
+  -0.302005947f, 0.953306019f,
+  -0.303467959f, 0.95284164f,
+  -0.304929227f, 0.952374995f,
+  -0.306389809f, 0.951906145f,
+  -0.307849646f, 0.95143503f,
+  -0.309308767f, 0.950961649f,
+  -0.310767144f, 0.950486064f,
+  -0.312224805f, 0.950008273f,
+  -0.313681751f, 0.949528158f,
+  -0.315137923f, 0.949045897f,
+  -0.316593379f, 0.94856137f,
+  -0.31804809f, 0.948074579f,
+  -0.319502026f, 0.947585583f,
+  -0.320955247f, 0.947094381f,
+  -0.322407693f, 0.946600914f,
+  -0.323859364f, 0.946105242f,
+  -0.32531029f, 0.945607305f,
+  -0.326760441f, 0.945107222f,
+  -0.328209847f, 0.944604814f,
+  -0.329658449f, 0.944100261f,
+  -0.331106305f, 0.943593442f,
+  -0.332553357f, 0.943084419f,
+  -0.333999664f, 0.94257319f,
+  -0.335445136f, 0.942059755f,
+  -0.336889863f, 0.941544056f,
+  -0.338333756f, 0.941026151f,
+  -0.339776874f, 0.940506041f,
+  -0.341219217f, 0.939983726f,
+  -0.342660725f, 0.939459205f,
+  -0.344101429f, 0.938932478f,
+  -0.345541328f, 0.938403547f,
+  -0.346980423f, 0.93787235f,
+  -0.348418683f, 0.937339008f,
+  -0.349856138f, 0.93680346f,
+  -0.351292759f, 0.936265647f,
+  -0.352728546f, 0.935725689f,
+  -0.354163527f, 0.935183525f,
+  -0.355597675f, 0.934639156f,
+  -0.357030958f, 0.934092522f,
+  -0.358463407f, 0.933543801f,
+  -0.359895051f, 0.932992816f,
+  -0.3613258f, 0.932439625f,
+  -0.362755716f, 0.931884289f,
+  -0.364184797f, 0.931326687f,
+  -0.365612984f, 0.93076694f,
+  -0.367040336f, 0.930205047f,
+  -0.368466824f, 0.929640889f,
+  -0.369892448f, 0.929074585f,
+  -0.371317208f, 0.928506076f,
+  -0.372741073f, 0.927935421f,
+  -0.374164075f, 0.927362502f,
+  -0.375586182f, 0.926787496f,
+  -0.377007425f, 0.926210225f,
+  -0.378427744f, 0.925630808f,
+  -0.379847199f, 0.925049245f,
+  -0.381265759f, 0.924465477f,
+  -0.382683426f, 0.923879504f,
+  -0.384100199f, 0.923291445f,
+  -0.385516047f, 0.92270112f,
+  -0.386931002f, 0.92210865f,
+  -0.388345033f, 0.921514034f,
+  -0.38975817f, 0.920917213f,
+  -0.391170382f, 0.920318305f,
+  -0.392581671f, 0.919717133f,
+  -0.393992037f, 0.919113874f,
+  -0.395401478f, 0.91850841f,
+  -0.396809995f, 0.917900801f,
+  -0.398217559f, 0.917290986f,
+  -0.399624199f, 0.916679084f,
+  -0.401029885f, 0.916064978f,
+  -0.402434647f, 0.915448725f,
+  -0.403838456f, 0.914830327f,
+  -0.405241311f, 0.914209783f,
+  -0.406643212f, 0.913587034f,
+  -0.408044159f, 0.912962198f,
+  -0.409444153f, 0.912335157f,
+  -0.410843164f, 0.91170603f,
+  -0.41224122f, 0.911074758f,
+  -0.413638324f, 0.910441279f,
+  -0.415034413f, 0.909805715f,
+  -0.416429549f, 0.909168005f,
+  -0.417823702f, 0.90852809f,
+  -0.419216901f, 0.907886088f,
+  -0.420609087f, 0.907242f,
+  -0.422000259f, 0.906595707f,
+  -0.423390478f, 0.905947268f,
+  -0.424779683f, 0.905296743f,
+  -0.426167876f, 0.904644072f,
+  -0.427555084f, 0.903989315f,
+  -0.42894128f, 0.903332353f,
+  -0.430326492f, 0.902673304f,
+  -0.43171066f, 0.902012169f,
+  -0.433093816f, 0.901348829f,
+  -0.434475958f, 0.900683403f,
+  -0.435857087f, 0.900015891f,
+  -0.437237173f, 0.899346232f,
+  -0.438616246f, 0.898674488f,
+  -0.439994276f, 0.898000598f,
+  -0.441371262f, 0.897324562f,
+  -0.442747235f, 0.8966465f,
+  -0.444122136f, 0.895966232f,
+  -0.445496023f, 0.895283937f,
+  -0.446868837f, 0.894599497f,
+  -0.448240608f, 0.893912971f,
+  -0.449611336f, 0.893224299f,
+  -0.450980991f, 0.892533541f,
+  -0.452349573f, 0.891840696f,
+  -0.453717113f, 0.891145766f,
+  -0.455083579f, 0.890448749f,
+  -0.456448972f, 0.889749587f,
+  -0.457813293f, 0.889048338f,
+  -0.45917654f, 0.888345063f,
+  -0.460538715f, 0.887639642f,
+  -0.461899787f, 0.886932135f,
+  -0.463259786f, 0.886222541f,
+  -0.464618683f, 0.885510862f,
+  -0.465976506f, 0.884797096f,
+  -0.467333198f, 0.884081244f,
+  -0.468688816f, 0.883363366f,
+  -0.470043331f, 0.882643342f,
+  -0.471396744f, 0.881921291f,
+  -0.472749025f, 0.881197095f,
+  -0.474100202f, 0.880470872f,
+  -0.475450277f, 0.879742622f,
+  -0.47679922f, 0.879012227f,
+  -0.47814706f, 0.878279805f,
+  -0.479493767f, 0.877545297f,
+  -0.480839342f, 0.876808703f,
+  -0.482183784f, 0.876070082f,
+  -0.483527064f, 0.875329375f,
+  -0.484869242f, 0.874586642f,
+  -0.486210287f, 0.873841822f,
+  -0.487550169f, 0.873094976f,
+  -0.48888889f, 0.872346044f,
+  -0.490226477f, 0.871595085f,
+  -0.491562903f, 0.87084204f,
+  -0.492898196f, 0.870086968f,
+  -0.494232297f, 0.86932987f,
+  -0.495565265f, 0.868570685f,
+  -0.496897042f, 0.867809474f,
+  -0.498227656f, 0.867046237f,
+  -0.499557108f, 0.866280973f,
+  -0.500885367f, 0.865513623f,
+  -0.502212465f, 0.864744246f,
+  -0.50353837f, 0.863972843f,
+  -0.504863083f, 0.863199413f,
+  -0.506186664f, 0.862423956f,
+  -0.507508993f, 0.861646473f,
+  -0.50883013f, 0.860866964f,
+  -0.510150075f, 0.860085368f,
+  -0.511468828f, 0.859301805f,
+  -0.512786388f, 0.858516216f,
+  -0.514102757f, 0.857728601f,
+  -0.515417874f, 0.856938958f,
+  -0.516731799f, 0.856147349f,
+  -0.518044531f, 0.855353653f,
+  -0.519356012f, 0.854557991f,
+  -0.520666242f, 0.853760302f,
+  -0.521975279f, 0.852960587f,
+  -0.523283124f, 0.852158904f,
+  -0.524589658f, 0.851355195f,
+  -0.525895f, 0.850549459f,
+  -0.527199149f, 0.849741757f,
+  -0.528501987f, 0.848932028f,
+  -0.529803634f, 0.848120332f,
+  -0.531104028f, 0.847306609f,
+  -0.532403111f, 0.84649092f,
+  -0.533701003f, 0.845673263f,
+  -0.534997642f, 0.84485358f,
+  -0.53629297f, 0.84403187f,
+  -0.537587047f, 0.843208253f,
+  -0.538879931f, 0.84238261f,
+  -0.540171444f, 0.841554999f,
+  -0.541461766f, 0.840725362f,
+  -0.542750776f, 0.839893818f,
+  -0.544038534f, 0.839060247f,
+  -0.545324981f, 0.838224709f,
+  -0.546610177f, 0.837387204f,
+  -0.547894061f, 0.836547732f,
+  -0.549176633f, 0.835706294f,
+  -0.550457954f, 0.834862888f,
+  -0.551737964f, 0.834017515f,
+  -0.553016722f, 0.833170176f,
+  -0.554294109f, 0.832320869f,
+  -0.555570245f, 0.831469595f,
+  -0.556845009f, 0.830616415f,
+  -0.558118522f, 0.829761207f,
+  -0.559390724f, 0.828904092f,
+  -0.560661554f, 0.82804507f,
+  -0.561931133f, 0.827184021f,
+  -0.563199341f, 0.826321065f,
+  -0.564466238f, 0.825456142f,
+  -0.565731823f, 0.824589312f,
+  -0.566996038f, 0.823720515f,
+  -0.568258941f, 0.82284981f,
+  -0.569520533f, 0.821977139f,
+  -0.570780754f, 0.8211025f,
+  -0.572039604f, 0.820225954f,
+  -0.573297143f, 0.819347501f,
+  -0.57455337f, 0.81846714f,
+  -0.575808167f, 0.817584813f,
+  -0.577061653f, 0.816700578f,
+  -0.578313768f, 0.815814435f,
+  -0.579564571f, 0.814926326f,
+  -0.580813944f, 0.81403631f,
+  -0.582062006f, 0.813144386f,
+  -0.583308637f, 0.812250614f,
+  -0.584553957f, 0.811354876f,
+  -0.585797846f, 0.81045717f,
+  -0.587040365f, 0.809557617f,
+  -0.588281572f, 0.808656156f,
+  -0.589521289f, 0.807752848f,
+  -0.590759695f, 0.806847572f,
+  -0.59199667f, 0.80594039f,
+  -0.593232274f, 0.805031359f,
+  -0.594466507f, 0.804120362f,
+  -0.59569931f, 0.803207517f,
+  -0.596930683f, 0.802292824f,
+  -0.598160684f, 0.801376164f,
+  -0.599389315f, 0.800457656f,
+  -0.600616455f, 0.799537241f,
+  -0.601842225f, 0.798614979f,
+  -0.603066623f, 0.797690868f,
+  -0.604289532f, 0.796764791f,
+  -0.605511069f, 0.795836926f,
+  -0.606731117f, 0.794907153f,
+  -0.607949793f, 0.793975472f,
+  -0.609167039f, 0.793041945f,
+  -0.610382795f, 0.792106569f,
+  -0.61159718f, 0.791169345f,
+  -0.612810075f, 0.790230215f,
+  -0.61402154f, 0.789289236f,
+  -0.615231574f, 0.78834641f,
+  -0.616440177f, 0.787401736f,
+  -0.61764729f, 0.786455214f,
+  -0.618852973f, 0.785506845f,
+  -0.620057225f, 0.784556568f,
+  -0.621259987f, 0.783604503f,
+  -0.622461259f, 0.78265059f,
+  -0.623661101f, 0.781694829f,
+  -0.624859512f, 0.780737221f,
+  -0.626056373f, 0.779777765f,
+  -0.627251804f, 0.778816521f,
+  -0.628445745f, 0.777853429f,
+  -0.629638255f, 0.77688849f,
+  -0.630829215f, 0.775921702f,
+  -0.632018745f, 0.774953127f,
+  -0.633206785f, 0.773982704f,
+  -0.634393275f, 0.773010433f,
+  -0.635578334f, 0.772036374f,
+  -0.636761844f, 0.771060526f,
+  -0.637943923f, 0.770082831f,
+  -0.639124453f, 0.769103348f,
+  -0.640303493f, 0.768122017f,
+  -0.641481042f, 0.767138898f,
+  -0.642657042f, 0.766153991f,
+  -0.643831551f, 0.765167236f,
+  -0.645004511f, 0.764178753f,
+  -0.64617604f, 0.763188422f,
+  -0.64734596f, 0.762196302f,
+  -0.64851439f, 0.761202395f,
+  -0.64968133f, 0.760206699f,
+  -0.65084666f, 0.759209216f,
+  -0.65201056f, 0.758209884f,
+  -0.653172851f, 0.757208824f,
+  -0.654333591f, 0.756205976f,
+  -0.655492842f, 0.755201399f,
+  -0.656650543f, 0.754194975f,
+  -0.657806695f, 0.753186822f,
+  -0.658961296f, 0.752176821f,
+  -0.660114348f, 0.751165152f,
+  -0.66126585f, 0.750151634f,
+  -0.662415802f, 0.749136388f,
+  -0.663564146f, 0.748119354f,
+  -0.664710999f, 0.747100592f,
+  -0.665856242f, 0.746080101f,
+  -0.666999936f, 0.745057762f,
+  -0.668142021f, 0.744033754f,
+  -0.669282615f, 0.743007958f,
+  -0.670421541f, 0.741980433f,
+  -0.671558976f, 0.740951121f,
+  -0.672694743f, 0.73992008f,
+  -0.673829019f, 0.73888731f,
+  -0.674961627f, 0.737852812f,
+  -0.676092684f, 0.736816585f,
+  -0.677222192f, 0.73577857f,
+  -0.678350031f, 0.734738886f,
+  -0.679476321f, 0.733697414f,
+  -0.680601001f, 0.732654274f,
+  -0.681724072f, 0.731609404f,
+  -0.682845533f, 0.730562747f,
+  -0.683965385f, 0.72951442f,
+  -0.685083687f, 0.728464365f,
+  -0.686200321f, 0.727412641f,
+  -0.687315345f, 0.726359129f,
+  -0.68842876f, 0.725303948f,
+  -0.689540565f, 0.724247098f,
+  -0.690650702f, 0.72318846f,
+  -0.691759229f, 0.722128212f,
+  -0.692866147f, 0.721066177f,
+  -0.693971455f, 0.720002532f,
+  -0.695075095f, 0.718937099f,
+  -0.696177125f, 0.717870057f,
+  -0.697277486f, 0.716801286f,
+  -0.698376238f, 0.715730846f,
+  -0.699473321f, 0.714658678f,
+  -0.700568795f, 0.71358484f,
+  -0.7016626f, 0.712509394f,
+  -0.702754736f, 0.711432219f,
+  -0.703845263f, 0.710353374f,
+  -0.704934061f, 0.709272802f,
+  -0.706021249f, 0.70819062f,
+  -0.707106769f, 0.707106769f,
+  -0.70819062f, 0.706021249f,
+  -0.709272802f, 0.704934061f,
+  -0.710353374f, 0.703845263f,
+  -0.711432219f, 0.702754736f,
+  -0.712509394f, 0.7016626f,
+  -0.71358484f, 0.700568795f,
+  -0.714658678f, 0.699473321f,
+  -0.715730846f, 0.698376238f,
+  -0.716801286f, 0.697277486f,
+  -0.717870057f, 0.696177125f,
+  -0.718937099f, 0.695075095f,
+  -0.720002532f, 0.693971455f,
+  -0.721066177f, 0.692866147f,
+  -0.722128212f, 0.691759229f,
+  -0.72318846f, 0.690650702f,
+  -0.724247098f, 0.689540565f,
+  -0.725303948f, 0.68842876f,
+  -0.726359129f, 0.687315345f,
+  -0.727412641f, 0.686200321f,
+  -0.728464365f, 0.685083687f,
+  -0.72951442f, 0.683965385f,
+  -0.730562747f, 0.682845533f,
+  -0.731609404f, 0.681724072f,
+  -0.732654274f, 0.680601001f,
+  -0.733697414f, 0.679476321f,
+  -0.734738886f, 0.678350031f,
+  -0.73577857f, 0.677222192f,
+  -0.736816585f, 0.676092684f,
+  -0.737852812f, 0.674961627f,
+  -0.73888731f, 0.673829019f,
+  -0.73992008f, 0.672694743f,
+  -0.740951121f, 0.671558976f,
+  -0.741980433f, 0.670421541f,
+  -0.743007958f, 0.669282615f,
+  -0.744033754f, 0.668142021f,
+  -0.745057762f, 0.666999936f,
+  -0.746080101f, 0.665856242f,
+  -0.747100592f, 0.664710999f,
+  -0.748119354f, 0.663564146f,
+  -0.749136388f, 0.662415802f,
+  -0.750151634f, 0.66126585f,
+  -0.751165152f, 0.660114348f,
+  -0.752176821f, 0.658961296f,
+  -0.753186822f, 0.657806695f,
+  -0.754194975f, 0.656650543f,
+  -0.755201399f, 0.655492842f,
+  -0.756205976f, 0.654333591f,
+  -0.757208824f, 0.653172851f,
+  -0.758209884f, 0.65201056f,
+  -0.759209216f, 0.65084666f,
+  -0.760206699f, 0.64968133f,
+  -0.761202395f, 0.64851439f,
+  -0.762196302f, 0.64734596f,
+  -0.763188422f, 0.64617604f,
+  -0.764178753f, 0.645004511f,
+  -0.765167236f, 0.643831551f,
+  -0.766153991f, 0.642657042f,
+  -0.767138898f, 0.641481042f,
+  -0.768122017f, 0.640303493f,
+  -0.769103348f, 0.639124453f,
+  -0.770082831f, 0.637943923f,
+  -0.771060526f, 0.636761844f,
+  -0.772036374f, 0.635578334f,
+  -0.773010433f, 0.634393275f,
+  -0.773982704f, 0.633206785f,
+  -0.774953127f, 0.632018745f,
+  -0.775921702f, 0.630829215f,
+  -0.77688849f, 0.629638255f,
+  -0.777853429f, 0.628445745f,
+  -0.778816521f, 0.627251804f,
+  -0.779777765f, 0.626056373f,
+  -0.780737221f, 0.624859512f,
+  -0.781694829f, 0.623661101f,
+  -0.78265059f, 0.622461259f,
+  -0.783604503f, 0.621259987f,
+  -0.784556568f, 0.620057225f,
+  -0.785506845f, 0.618852973f,
+  -0.786455214f, 0.61764729f,
+  -0.787401736f, 0.616440177f,
+  -0.78834641f, 0.615231574f,
+  -0.789289236f, 0.61402154f,
+  -0.790230215f, 0.612810075f,
+  -0.791169345f, 0.61159718f,
+  -0.792106569f, 0.610382795f,
+  -0.793041945f, 0.609167039f,
+  -0.793975472f, 0.607949793f,
+  -0.794907153f, 0.606731117f,
+  -0.795836926f, 0.605511069f,
+  -0.796764791f, 0.604289532f,
+  -0.797690868f, 0.603066623f,
+  -0.798614979f, 0.601842225f,
+  -0.799537241f, 0.600616455f,
+  -0.800457656f, 0.599389315f,
+  -0.801376164f, 0.598160684f,
+  -0.802292824f, 0.596930683f,
+  -0.803207517f, 0.59569931f,
+  -0.804120362f, 0.594466507f,
+  -0.805031359f, 0.593232274f,
+  -0.80594039f, 0.59199667f,
+  -0.806847572f, 0.590759695f,
+  -0.807752848f, 0.589521289f,
+  -0.808656156f, 0.588281572f,
+  -0.809557617f, 0.587040365f,
+  -0.81045717f, 0.585797846f,
+  -0.811354876f, 0.584553957f,
+  -0.812250614f, 0.583308637f,
+  -0.813144386f, 0.582062006f,
+  -0.81403631f, 0.580813944f,
+  -0.814926326f, 0.579564571f,
+  -0.815814435f, 0.578313768f,
+  -0.816700578f, 0.577061653f,
+  -0.817584813f, 0.575808167f,
+  -0.81846714f, 0.57455337f,
+  -0.819347501f, 0.573297143f,
+  -0.820225954f, 0.572039604f,
+  -0.8211025f, 0.570780754f,
+  -0.821977139f, 0.569520533f,
+  -0.82284981f, 0.568258941f,
+  -0.823720515f, 0.566996038f,
+  -0.824589312f, 0.565731823f,
+  -0.825456142f, 0.564466238f,
+  -0.826321065f, 0.563199341f,
+  -0.827184021f, 0.561931133f,
+  -0.82804507f, 0.560661554f,
+  -0.828904092f, 0.559390724f,
+  -0.829761207f, 0.558118522f,
+  -0.830616415f, 0.556845009f,
+  -0.831469595f, 0.555570245f,
+  -0.832320869f, 0.554294109f,
+  -0.833170176f, 0.553016722f,
+  -0.834017515f, 0.551737964f,
+  -0.834862888f, 0.550457954f,
+  -0.835706294f, 0.549176633f,
+  -0.836547732f, 0.547894061f,
+  -0.837387204f, 0.546610177f,
+  -0.838224709f, 0.545324981f,
+  -0.839060247f, 0.544038534f,
+  -0.839893818f, 0.542750776f,
+  -0.840725362f, 0.541461766f,
+  -0.841554999f, 0.540171444f,
+  -0.84238261f, 0.538879931f,
+  -0.843208253f, 0.537587047f,
+  -0.84403187f, 0.53629297f,
+  -0.84485358f, 0.534997642f,
+  -0.845673263f, 0.533701003f,
+  -0.84649092f, 0.532403111f,
+  -0.847306609f, 0.531104028f,
+  -0.848120332f, 0.529803634f,
+  -0.848932028f, 0.528501987f,
+  -0.849741757f, 0.527199149f,
+  -0.850549459f, 0.525895f,
+  -0.851355195f, 0.524589658f,
+  -0.852158904f, 0.523283124f,
+  -0.852960587f, 0.521975279f,
+  -0.853760302f, 0.520666242f,
+  -0.854557991f, 0.519356012f,
+  -0.855353653f, 0.518044531f,
+  -0.856147349f, 0.516731799f,
+  -0.856938958f, 0.515417874f,
+  -0.857728601f, 0.514102757f,
+  -0.858516216f, 0.512786388f,
+  -0.859301805f, 0.511468828f,
+  -0.860085368f, 0.510150075f,
+  -0.860866964f, 0.50883013f,
+  -0.861646473f, 0.507508993f,
+  -0.862423956f, 0.506186664f,
+  -0.863199413f, 0.504863083f,
+  -0.863972843f, 0.50353837f,
+  -0.864744246f, 0.502212465f,
+  -0.865513623f, 0.500885367f,
+  -0.866280973f, 0.499557108f,
+  -0.867046237f, 0.498227656f,
+  -0.867809474f, 0.496897042f,
+  -0.868570685f, 0.495565265f,
+  -0.86932987f, 0.494232297f,
+  -0.870086968f, 0.492898196f,
+  -0.87084204f, 0.491562903f,
+  -0.871595085f, 0.490226477f,
+  -0.872346044f, 0.48888889f,
+  -0.873094976f, 0.487550169f,
+  -0.873841822f, 0.486210287f,
+  -0.874586642f, 0.484869242f,
+  -0.875329375f, 0.483527064f,
+  -0.876070082f, 0.482183784f,
+  -0.876808703f, 0.480839342f,
+  -0.877545297f, 0.479493767f,
+  -0.878279805f, 0.47814706f,
+  -0.879012227f, 0.47679922f,
+  -0.879742622f, 0.475450277f,
+  -0.880470872f, 0.474100202f,
+  -0.881197095f, 0.472749025f,
+  -0.881921291f, 0.471396744f,
+  -0.882643342f, 0.470043331f,
+  -0.883363366f, 0.468688816f,
+  -0.884081244f, 0.467333198f,
+  -0.884797096f, 0.465976506f,
+  -0.885510862f, 0.464618683f,
+  -0.886222541f, 0.463259786f,
+  -0.886932135f, 0.461899787f,
+  -0.887639642f, 0.460538715f,
+  -0.888345063f, 0.45917654f,
+  -0.889048338f, 0.457813293f,
+  -0.889749587f, 0.456448972f,
+  -0.890448749f, 0.455083579f,
+  -0.891145766f, 0.453717113f,
+  -0.891840696f, 0.452349573f,
+  -0.892533541f, 0.450980991f,
+  -0.893224299f, 0.449611336f,
+  -0.893912971f, 0.448240608f,
+  -0.894599497f, 0.446868837f,
+  -0.895283937f, 0.445496023f,
+  -0.895966232f, 0.444122136f,
+  -0.8966465f, 0.442747235f,
+  -0.897324562f, 0.441371262f,
+  -0.898000598f, 0.439994276f,
+  -0.898674488f, 0.438616246f,
+  -0.899346232f, 0.437237173f,
+  -0.900015891f, 0.435857087f,
+  -0.900683403f, 0.434475958f,
+  -0.901348829f, 0.433093816f,
+  -0.902012169f, 0.43171066f,
+  -0.902673304f, 0.430326492f,
+  -0.903332353f, 0.42894128f,
+  -0.903989315f, 0.427555084f,
+  -0.904644072f, 0.426167876f,
+  -0.905296743f, 0.424779683f,
+  -0.905947268f, 0.423390478f,
+  -0.906595707f, 0.422000259f,
+  -0.907242f, 0.420609087f,
+  -0.907886088f, 0.419216901f,
+  -0.90852809f, 0.417823702f,
+  -0.909168005f, 0.416429549f,
+  -0.909805715f, 0.415034413f,
+  -0.910441279f, 0.413638324f,
+  -0.911074758f, 0.41224122f,
+  -0.91170603f, 0.410843164f,
+  -0.912335157f, 0.409444153f,
+  -0.912962198f, 0.408044159f,
+  -0.913587034f, 0.406643212f,
+  -0.914209783f, 0.405241311f,
+  -0.914830327f, 0.403838456f,
+  -0.915448725f, 0.402434647f,
+  -0.916064978f, 0.401029885f,
+  -0.916679084f, 0.399624199f,
+  -0.917290986f, 0.398217559f,
+  -0.917900801f, 0.396809995f,
+  -0.91850841f, 0.395401478f,
+  -0.919113874f, 0.393992037f,
+  -0.919717133f, 0.392581671f,
+  -0.920318305f, 0.391170382f,
+  -0.920917213f, 0.38975817f,
+  -0.921514034f, 0.388345033f,
+  -0.92210865f, 0.386931002f,
+  -0.92270112f, 0.385516047f,
+  -0.923291445f, 0.384100199f,
+  -0.923879504f, 0.382683426f,
+  -0.924465477f, 0.381265759f,
+  -0.925049245f, 0.379847199f,
+  -0.925630808f, 0.378427744f,
+  -0.926210225f, 0.377007425f,
+  -0.926787496f, 0.375586182f,
+  -0.927362502f, 0.374164075f,
+  -0.927935421f, 0.372741073f,
+  -0.928506076f, 0.371317208f,
+  -0.929074585f, 0.369892448f,
+  -0.929640889f, 0.368466824f,
+  -0.930205047f, 0.367040336f,
+  -0.93076694f, 0.365612984f,
+  -0.931326687f, 0.364184797f,
+  -0.931884289f, 0.362755716f,
+  -0.932439625f, 0.3613258f,
+  -0.932992816f, 0.359895051f,
+  -0.933543801f, 0.358463407f,
+  -0.934092522f, 0.357030958f,
+  -0.934639156f, 0.355597675f,
+  -0.935183525f, 0.354163527f,
+  -0.935725689f, 0.352728546f,
+  -0.936265647f, 0.351292759f,
+  -0.93680346f, 0.349856138f,
+  -0.937339008f, 0.348418683f,
+  -0.93787235f, 0.346980423f,
+  -0.938403547f, 0.345541328f,
+  -0.938932478f, 0.344101429f,
+  -0.939459205f, 0.342660725f,
+  -0.939983726f, 0.341219217f,
+  -0.940506041f, 0.339776874f,
+  -0.941026151f, 0.338333756f,
+  -0.941544056f, 0.336889863f,
+  -0.942059755f, 0.335445136f,
+  -0.94257319f, 0.333999664f,
+  -0.943084419f, 0.332553357f,
+  -0.943593442f, 0.331106305f,
+  -0.944100261f, 0.329658449f,
+  -0.944604814f, 0.328209847f,
+  -0.945107222f, 0.326760441f,
+  -0.945607305f, 0.32531029f,
+  -0.946105242f, 0.323859364f,
+  -0.946600914f, 0.322407693f,
+  -0.947094381f, 0.320955247f,
+  -0.947585583f, 0.319502026f,
+  -0.948074579f, 0.31804809f,
+  -0.94856137f, 0.316593379f,
+  -0.949045897f, 0.315137923f,
+  -0.949528158f, 0.313681751f,
+  -0.950008273f, 0.312224805f,
+  -0.950486064f, 0.310767144f,
+  -0.950961649f, 0.309308767f,
+  -0.95143503f, 0.307849646f,
+  -0.951906145f, 0.306389809f,
+  -0.952374995f, 0.304929227f,
+  -0.95284164f, 0.303467959f,
+  -0.953306019f, 0.302005947f,
+  -0.953768194f, 0.300543249f,
+  -0.954228103f, 0.299079835f,
+  -0.954685748f, 0.297615707f,
+  -0.955141187f, 0.296150893f,
+  -0.955594361f, 0.294685364f,
+  -0.95604527f, 0.293219149f,
+  -0.956493914f, 0.291752249f,
+  -0.956940353f, 0.290284663f,
+  -0.957384527f, 0.288816422f,
+  -0.957826436f, 0.287347466f,
+  -0.958266079f, 0.285877824f,
+  -0.958703458f, 0.284407526f,
+  -0.959138632f, 0.282936573f,
+  -0.95957154f, 0.281464934f,
+  -0.960002124f, 0.27999264f,
+  -0.960430503f, 0.27851969f,
+  -0.960856616f, 0.277046084f,
+  -0.961280465f, 0.275571823f,
+  -0.961702049f, 0.274096906f,
+  -0.962121427f, 0.272621363f,
+  -0.962538481f, 0.271145165f,
+  -0.962953269f, 0.269668311f,
+  -0.963365793f, 0.268190861f,
+  -0.963776052f, 0.266712755f,
+  -0.964184046f, 0.265234023f,
+  -0.964589775f, 0.263754666f,
+  -0.964993238f, 0.262274712f,
+  -0.965394437f, 0.260794103f,
+  -0.965793371f, 0.259312928f,
+  -0.966189981f, 0.257831097f,
+  -0.966584384f, 0.25634867f,
+  -0.966976464f, 0.254865646f,
+  -0.967366278f, 0.253382027f,
+  -0.967753828f, 0.251897812f,
+  -0.968139112f, 0.250413001f,
+  -0.968522072f, 0.248927608f,
+  -0.968902826f, 0.24744162f,
+  -0.969281256f, 0.24595505f,
+  -0.969657362f, 0.244467899f,
+  -0.970031261f, 0.242980182f,
+  -0.970402837f, 0.241491884f,
+  -0.970772147f, 0.24000302f,
+  -0.971139133f, 0.238513589f,
+  -0.971503913f, 0.237023607f,
+  -0.97186631f, 0.235533059f,
+  -0.972226501f, 0.234041959f,
+  -0.972584367f, 0.232550308f,
+  -0.972939968f, 0.231058106f,
+  -0.973293245f, 0.229565367f,
+  -0.973644257f, 0.228072077f,
+  -0.973992944f, 0.226578265f,
+  -0.974339366f, 0.225083917f,
+  -0.974683523f, 0.223589033f,
+  -0.975025356f, 0.222093627f,
+  -0.975364864f, 0.220597684f,
+  -0.975702107f, 0.219101235f,
+  -0.976037085f, 0.21760428f,
+  -0.976369739f, 0.216106802f,
+  -0.976700068f, 0.214608818f,
+  -0.977028131f, 0.213110313f,
+  -0.977353871f, 0.211611331f,
+  -0.977677345f, 0.210111842f,
+  -0.977998495f, 0.208611846f,
+  -0.97831738f, 0.207111374f,
+  -0.97863394f, 0.205610409f,
+  -0.978948176f, 0.204108968f,
+  -0.979260147f, 0.202607036f,
+  -0.979569793f, 0.201104641f,
+  -0.979877114f, 0.199601755f,
+  -0.980182111f, 0.198098406f,
+  -0.980484843f, 0.196594596f,
+  -0.980785251f, 0.195090324f,
+  -0.981083393f, 0.19358559f,
+  -0.981379211f, 0.192080393f,
+  -0.981672704f, 0.19057475f,
+  -0.981963873f, 0.18906866f,
+  -0.982252717f, 0.187562123f,
+  -0.982539296f, 0.186055154f,
+  -0.982823551f, 0.184547737f,
+  -0.983105481f, 0.183039889f,
+  -0.983385086f, 0.181531608f,
+  -0.983662426f, 0.180022895f,
+  -0.983937442f, 0.178513765f,
+  -0.984210074f, 0.177004218f,
+  -0.984480441f, 0.175494254f,
+  -0.984748483f, 0.173983872f,
+  -0.98501426f, 0.172473088f,
+  -0.985277653f, 0.170961887f,
+  -0.985538721f, 0.169450298f,
+  -0.985797524f, 0.167938292f,
+  -0.986053944f, 0.166425899f,
+  -0.986308098f, 0.164913118f,
+  -0.986559927f, 0.16339995f,
+  -0.986809373f, 0.161886394f,
+  -0.987056553f, 0.160372451f,
+  -0.987301409f, 0.15885815f,
+  -0.987543941f, 0.157343462f,
+  -0.987784147f, 0.155828401f,
+  -0.988022029f, 0.154312968f,
+  -0.988257587f, 0.152797192f,
+  -0.98849082f, 0.151281044f,
+  -0.988721669f, 0.149764538f,
+  -0.988950253f, 0.148247674f,
+  -0.989176512f, 0.146730468f,
+  -0.989400446f, 0.145212919f,
+  -0.989621997f, 0.143695027f,
+  -0.989841282f, 0.142176807f,
+  -0.990058184f, 0.140658244f,
+  -0.99027282f, 0.139139339f,
+  -0.990485072f, 0.137620121f,
+  -0.990695f, 0.136100575f,
+  -0.990902662f, 0.134580702f,
+  -0.991107941f, 0.13306053f,
+  -0.991310835f, 0.13154003f,
+  -0.991511464f, 0.130019218f,
+  -0.991709769f, 0.128498107f,
+  -0.991905689f, 0.126976699f,
+  -0.992099285f, 0.125454977f,
+  -0.992290616f, 0.123932973f,
+  -0.992479563f, 0.122410677f,
+  -0.992666125f, 0.120888084f,
+  -0.992850423f, 0.119365215f,
+  -0.993032336f, 0.117842063f,
+  -0.993211925f, 0.116318628f,
+  -0.993389189f, 0.114794925f,
+  -0.993564129f, 0.113270953f,
+  -0.993736744f, 0.111746714f,
+  -0.993906975f, 0.110222206f,
+  -0.994074881f, 0.108697444f,
+  -0.994240463f, 0.107172422f,
+  -0.99440366f, 0.105647154f,
+  -0.994564593f, 0.104121633f,
+  -0.994723141f, 0.102595866f,
+  -0.994879305f, 0.10106986f,
+  -0.995033205f, 0.0995436162f,
+  -0.99518472f, 0.0980171412f,
+  -0.99533391f, 0.0964904279f,
+  -0.995480776f, 0.0949634984f,
+  -0.995625257f, 0.093436338f,
+  -0.995767415f, 0.0919089541f,
+  -0.995907247f, 0.0903813615f,
+  -0.996044695f, 0.0888535529f,
+  -0.996179819f, 0.0873255357f,
+  -0.996312618f, 0.0857973099f,
+  -0.996443033f, 0.0842688903f,
+  -0.996571124f, 0.0827402622f,
+  -0.996696889f, 0.0812114477f,
+  -0.996820271f, 0.0796824396f,
+  -0.996941328f, 0.0781532452f,
+  -0.997060061f, 0.0766238645f,
+  -0.997176409f, 0.0750942975f,
+  -0.997290432f, 0.0735645667f,
+  -0.997402132f, 0.0720346496f,
+  -0.997511446f, 0.070504576f,
+  -0.997618437f, 0.068974331f,
+  -0.997723043f, 0.0674439222f,
+  -0.997825325f, 0.0659133494f,
+  -0.997925282f, 0.0643826276f,
+  -0.998022854f, 0.0628517568f,
+  -0.998118103f, 0.061320737f,
+  -0.998211026f, 0.0597895719f,
+  -0.998301566f, 0.0582582653f,
+  -0.998389721f, 0.0567268208f,
+  -0.998475552f, 0.0551952459f,
+  -0.998559058f, 0.0536635369f,
+  -0.998640239f, 0.052131705f,
+  -0.998719037f, 0.0505997501f,
+  -0.99879545f, 0.0490676761f,
+  -0.998869538f, 0.0475354828f,
+  -0.998941302f, 0.0460031815f,
+  -0.999010682f, 0.0444707721f,
+  -0.999077737f, 0.0429382585f,
+  -0.999142408f, 0.0414056405f,
+  -0.999204755f, 0.0398729257f,
+  -0.999264777f, 0.0383401215f,
+  -0.999322355f, 0.0368072242f,
+  -0.999377668f, 0.0352742374f,
+  -0.999430597f, 0.0337411724f,
+  -0.999481201f, 0.0322080255f,
+  -0.999529421f, 0.030674804f,
+  -0.999575317f, 0.029141508f,
+  -0.999618828f, 0.027608145f,
+  -0.999660015f, 0.0260747187f,
+  -0.999698818f, 0.024541229f,
+  -0.999735296f, 0.0230076816f,
+  -0.99976939f, 0.0214740802f,
+  -0.999801159f, 0.0199404284f,
+  -0.999830604f, 0.0184067301f,
+  -0.999857664f, 0.0168729872f,
+  -0.99988234f, 0.015339206f,
+  -0.999904692f, 0.0138053885f,
+  -0.999924719f, 0.0122715384f,
+  -0.999942362f, 0.0107376594f,
+  -0.999957621f, 0.00920375437f,
+  -0.999970615f, 0.00766982883f,
+  -0.999981165f, 0.00613588467f,
+  -0.99998939f, 0.00460192608f,
+  -0.999995291f, 0.00306795677f,
+  -0.999998808f, 0.00153398013f,
+  -1.0f, 0.0f,
+  -0.999998808f, -0.00153398013f,
+  -0.999995291f, -0.00306795677f,
+  -0.99998939f, -0.00460192608f,
+  -0.999981165f, -0.00613588467f,
+  -0.999970615f, -0.00766982883f,
+  -0.999957621f, -0.00920375437f,
+  -0.999942362f, -0.0107376594f,
+  -0.999924719f, -0.0122715384f,
+  -0.999904692f, -0.0138053885f,
+  -0.99988234f, -0.015339206f,
+  -0.999857664f, -0.0168729872f,
+  -0.999830604f, -0.0184067301f,
+  -0.999801159f, -0.0199404284f,
+  -0.99976939f, -0.0214740802f,
+  -0.999735296f, -0.0230076816f,
+  -0.999698818f, -0.024541229f,
+  -0.999660015f, -0.0260747187f,
+  -0.999618828f, -0.027608145f,
+  -0.999575317f, -0.029141508f,
+  -0.999529421f, -0.030674804f,
+  -0.999481201f, -0.0322080255f,
+  -0.999430597f, -0.0337411724f,
+  -0.999377668f, -0.0352742374f,
+  -0.999322355f, -0.0368072242f,
+  -0.999264777f, -0.0383401215f,
+  -0.999204755f, -0.0398729257f,
+  -0.999142408f, -0.0414056405f,
+  -0.999077737f, -0.0429382585f,
+  -0.999010682f, -0.0444707721f,
+  -0.998941302f, -0.0460031815f,
+  -0.998869538f, -0.0475354828f,
+  -0.99879545f, -0.0490676761f,
+  -0.998719037f, -0.0505997501f,
+  -0.998640239f, -0.052131705f,
+  -0.998559058f, -0.0536635369f,
+  -0.998475552f, -0.0551952459f,
+  -0.998389721f, -0.0567268208f,
+  -0.998301566f, -0.0582582653f,
+  -0.998211026f, -0.0597895719f,
+  -0.998118103f, -0.061320737f,
+  -0.998022854f, -0.0628517568f,
+  -0.997925282f, -0.0643826276f,
+  -0.997825325f, -0.0659133494f,
+  -0.997723043f, -0.0674439222f,
+  -0.997618437f, -0.068974331f,
+  -0.997511446f, -0.070504576f,
+  -0.997402132f, -0.0720346496f,
+  -0.997290432f, -0.0735645667f,
+  -0.997176409f, -0.0750942975f,
+  -0.997060061f, -0.0766238645f,
+  -0.996941328f, -0.0781532452f,
+  -0.996820271f, -0.0796824396f,
+  -0.996696889f, -0.0812114477f,
+  -0.996571124f, -0.0827402622f,
+  -0.996443033f, -0.0842688903f,
+  -0.996312618f, -0.0857973099f,
+  -0.996179819f, -0.0873255357f,
+  -0.996044695f, -0.0888535529f,
+  -0.995907247f, -0.0903813615f,
+  -0.995767415f, -0.0919089541f,
+  -0.995625257f, -0.093436338f,
+  -0.995480776f, -0.0949634984f,
+  -0.99533391f, -0.0964904279f,
+  -0.99518472f, -0.0980171412f,
+  -0.995033205f, -0.0995436162f,
+  -0.994879305f, -0.10106986f,
+  -0.994723141f, -0.102595866f,
+  -0.994564593f, -0.104121633f,
+  -0.99440366f, -0.105647154f,
+  -0.994240463f, -0.107172422f,
+  -0.994074881f, -0.108697444f,
+  -0.993906975f, -0.110222206f,
+  -0.993736744f, -0.111746714f,
+  -0.993564129f, -0.113270953f,
+  -0.993389189f, -0.114794925f,
+  -0.993211925f, -0.116318628f,
+  -0.993032336f, -0.117842063f,
+  -0.992850423f, -0.119365215f,
+  -0.992666125f, -0.120888084f,
+  -0.992479563f, -0.122410677f,
+  -0.992290616f, -0.123932973f,
+  -0.992099285f, -0.125454977f,
+  -0.991905689f, -0.126976699f,
+  -0.991709769f, -0.128498107f,
+  -0.991511464f, -0.130019218f,
+  -0.991310835f, -0.13154003f,
+  -0.991107941f, -0.13306053f,
+  -0.990902662f, -0.134580702f,
+  -0.990695f, -0.136100575f,
+  -0.990485072f, -0.137620121f,
+  -0.99027282f, -0.139139339f,
+  -0.990058184f, -0.140658244f,
+  -0.989841282f, -0.142176807f,
+  -0.989621997f, -0.143695027f,
+  -0.989400446f, -0.145212919f,
+  -0.989176512f, -0.146730468f,
+  -0.988950253f, -0.148247674f,
+  -0.988721669f, -0.149764538f,
+  -0.98849082f, -0.151281044f,
+  -0.988257587f, -0.152797192f,
+  -0.988022029f, -0.154312968f,
+  -0.987784147f, -0.155828401f,
+  -0.987543941f, -0.157343462f,
+  -0.987301409f, -0.15885815f,
+  -0.987056553f, -0.160372451f,
+  -0.986809373f, -0.161886394f,
+  -0.986559927f, -0.16339995f,
+  -0.986308098f, -0.164913118f,
+  -0.986053944f, -0.166425899f,
+  -0.985797524f, -0.167938292f,
+  -0.985538721f, -0.169450298f,
+  -0.985277653f, -0.170961887f,
+  -0.98501426f, -0.172473088f,
+  -0.984748483f, -0.173983872f,
+  -0.984480441f, -0.175494254f,
+  -0.984210074f, -0.177004218f,
+  -0.983937442f, -0.178513765f,
+  -0.983662426f, -0.180022895f,
+  -0.983385086f, -0.181531608f,
+  -0.983105481f, -0.183039889f,
+  -0.982823551f, -0.184547737f,
+  -0.982539296f, -0.186055154f,
+  -0.982252717f, -0.187562123f,
+  -0.981963873f, -0.18906866f,
+  -0.981672704f, -0.19057475f,
+  -0.981379211f, -0.192080393f,
+  -0.981083393f, -0.19358559f,
+  -0.980785251f, -0.195090324f,
+  -0.980484843f, -0.196594596f,
+  -0.980182111f, -0.198098406f,
+  -0.979877114f, -0.199601755f,
+  -0.979569793f, -0.201104641f,
+  -0.979260147f, -0.202607036f,
+  -0.978948176f, -0.204108968f,
+  -0.97863394f, -0.205610409f,
+  -0.97831738f, -0.207111374f,
+  -0.977998495f, -0.208611846f,
+  -0.977677345f, -0.210111842f,
+  -0.977353871f, -0.211611331f,
+  -0.977028131f, -0.213110313f,
+  -0.976700068f, -0.214608818f,
+  -0.976369739f, -0.216106802f,
+  -0.976037085f, -0.21760428f,
+  -0.975702107f, -0.219101235f,
+  -0.975364864f, -0.220597684f,
+  -0.975025356f, -0.222093627f,
+  -0.974683523f, -0.223589033f,
+  -0.974339366f, -0.225083917f,
+  -0.973992944f, -0.226578265f,
+  -0.973644257f, -0.228072077f,
+  -0.973293245f, -0.229565367f,
+  -0.972939968f, -0.231058106f,
+  -0.972584367f, -0.232550308f,
+  -0.972226501f, -0.234041959f,
+  -0.97186631f, -0.235533059f,
+  -0.971503913f, -0.237023607f,
+  -0.971139133f, -0.238513589f,
+  -0.970772147f, -0.24000302f,
+  -0.970402837f, -0.241491884f,
+  -0.970031261f, -0.242980182f,
+  -0.969657362f, -0.244467899f,
+  -0.969281256f, -0.24595505f,
+  -0.968902826f, -0.24744162f,
+  -0.968522072f, -0.248927608f,
+  -0.968139112f, -0.250413001f,
+  -0.967753828f, -0.251897812f,
+  -0.967366278f, -0.253382027f,
+  -0.966976464f, -0.254865646f,
+  -0.966584384f, -0.25634867f,
+  -0.966189981f, -0.257831097f,
+  -0.965793371f, -0.259312928f,
+  -0.965394437f, -0.260794103f,
+  -0.964993238f, -0.262274712f,
+  -0.964589775f, -0.263754666f,
+  -0.964184046f, -0.265234023f,
+  -0.963776052f, -0.266712755f,
+  -0.963365793f, -0.268190861f,
+  -0.962953269f, -0.269668311f,
+  -0.962538481f, -0.271145165f,
+  -0.962121427f, -0.272621363f,
+  -0.961702049f, -0.274096906f,
+  -0.961280465f, -0.275571823f,
+  -0.960856616f, -0.277046084f,
+  -0.960430503f, -0.27851969f,
+  -0.960002124f, -0.27999264f,
+  -0.95957154f, -0.281464934f,
+  -0.959138632f, -0.282936573f,
+  -0.958703458f, -0.284407526f,
+  -0.958266079f, -0.285877824f,
+  -0.957826436f, -0.287347466f,
+  -0.957384527f, -0.288816422f,
+  -0.956940353f, -0.290284663f,
+  -0.956493914f, -0.291752249f,
+  -0.95604527f, -0.293219149f,
+  -0.955594361f, -0.294685364f,
+  -0.955141187f, -0.296150893f,
+  -0.954685748f, -0.297615707f,
+  -0.954228103f, -0.299079835f,
+  -0.953768194f, -0.300543249f,
+  -0.953306019f, -0.302005947f,
+  -0.95284164f, -0.303467959f,
+  -0.952374995f, -0.304929227f,
+  -0.951906145f, -0.306389809f,
+  -0.95143503f, -0.307849646f,
+  -0.950961649f, -0.309308767f,
+  -0.950486064f, -0.310767144f,
+  -0.950008273f, -0.312224805f,
+  -0.949528158f, -0.313681751f,
+  -0.949045897f, -0.315137923f,
+  -0.94856137f, -0.316593379f,
+  -0.948074579f, -0.31804809f,
+  -0.947585583f, -0.319502026f,
+  -0.947094381f, -0.320955247f,
+  -0.946600914f, -0.322407693f,
+  -0.946105242f, -0.323859364f,
+  -0.945607305f, -0.32531029f,
+  -0.945107222f, -0.326760441f,
+  -0.944604814f, -0.328209847f,
+  -0.944100261f, -0.329658449f,
+  -0.943593442f, -0.331106305f,
+  -0.943084419f, -0.332553357f,
+  -0.94257319f, -0.333999664f,
+  -0.942059755f, -0.335445136f,
+  -0.941544056f, -0.336889863f,
+  -0.941026151f, -0.338333756f,
+  -0.940506041f, -0.339776874f,
+  -0.939983726f, -0.341219217f,
+  -0.939459205f, -0.342660725f,
+  -0.938932478f, -0.344101429f,
+  -0.938403547f, -0.345541328f,
+  -0.93787235f, -0.346980423f,
+  -0.937339008f, -0.348418683f,
+  -0.93680346f, -0.349856138f,
+  -0.936265647f, -0.351292759f,
+  -0.935725689f, -0.352728546f,
+  -0.935183525f, -0.354163527f,
+  -0.934639156f, -0.355597675f,
+  -0.934092522f, -0.357030958f,
+  -0.933543801f, -0.358463407f,
+  -0.932992816f, -0.359895051f,
+  -0.932439625f, -0.3613258f,
+  -0.931884289f, -0.362755716f,
+  -0.931326687f, -0.364184797f,
+  -0.93076694f, -0.365612984f,
+  -0.930205047f, -0.367040336f,
+  -0.929640889f, -0.368466824f,
+  -0.929074585f, -0.369892448f,
+  -0.928506076f, -0.371317208f,
+  -0.927935421f, -0.372741073f,
+  -0.927362502f, -0.374164075f,
+  -0.926787496f, -0.375586182f,
+  -0.926210225f, -0.377007425f,
+  -0.925630808f, -0.378427744f,
+  -0.925049245f, -0.379847199f,
+  -0.924465477f, -0.381265759f,
+  -0.923879504f, -0.382683426f,
+  -0.923291445f, -0.384100199f,
+  -0.92270112f, -0.385516047f,
+  -0.92210865f, -0.386931002f,
+  -0.921514034f, -0.388345033f,
+  -0.920917213f, -0.38975817f,
+  -0.920318305f, -0.391170382f,
+  -0.919717133f, -0.392581671f,
+  -0.919113874f, -0.393992037f,
+  -0.91850841f, -0.395401478f,
+  -0.917900801f, -0.396809995f,
+  -0.917290986f, -0.398217559f,
+  -0.916679084f, -0.399624199f,
+  -0.916064978f, -0.401029885f,
+  -0.915448725f, -0.402434647f,
+  -0.914830327f, -0.403838456f,
+  -0.914209783f, -0.405241311f,
+  -0.913587034f, -0.406643212f,
+  -0.912962198f, -0.408044159f,
+  -0.912335157f, -0.409444153f,
+  -0.91170603f, -0.410843164f,
+  -0.911074758f, -0.41224122f,
+  -0.910441279f, -0.413638324f,
+  -0.909805715f, -0.415034413f,
+  -0.909168005f, -0.416429549f,
+  -0.90852809f, -0.417823702f,
+  -0.907886088f, -0.419216901f,
+  -0.907242f, -0.420609087f,
+  -0.906595707f, -0.422000259f,
+  -0.905947268f, -0.423390478f,
+  -0.905296743f, -0.424779683f,
+  -0.904644072f, -0.426167876f,
+  -0.903989315f, -0.427555084f,
+  -0.903332353f, -0.42894128f,
+  -0.902673304f, -0.430326492f,
+  -0.902012169f, -0.43171066f,
+  -0.901348829f, -0.433093816f,
+  -0.900683403f, -0.434475958f,
+  -0.900015891f, -0.435857087f,
+  -0.899346232f, -0.437237173f,
+  -0.898674488f, -0.438616246f,
+  -0.898000598f, -0.439994276f,
+  -0.897324562f, -0.441371262f,
+  -0.8966465f, -0.442747235f,
+  -0.895966232f, -0.444122136f,
+  -0.895283937f, -0.445496023f,
+  -0.894599497f, -0.446868837f,
+  -0.893912971f, -0.448240608f,
+  -0.893224299f, -0.449611336f,
+  -0.892533541f, -0.450980991f,
+  -0.891840696f, -0.452349573f,
+  -0.891145766f, -0.453717113f,
+  -0.890448749f, -0.455083579f,
+  -0.889749587f, -0.456448972f,
+  -0.889048338f, -0.457813293f,
+  -0.888345063f, -0.45917654f,
+  -0.887639642f, -0.460538715f,
+  -0.886932135f, -0.461899787f,
+  -0.886222541f, -0.463259786f,
+  -0.885510862f, -0.464618683f,
+  -0.884797096f, -0.465976506f,
+  -0.884081244f, -0.467333198f,
+  -0.883363366f, -0.468688816f,
+  -0.882643342f, -0.470043331f,
+  -0.881921291f, -0.471396744f,
+  -0.881197095f, -0.472749025f,
+  -0.880470872f, -0.474100202f,
+  -0.879742622f, -0.475450277f,
+  -0.879012227f, -0.47679922f,
+  -0.878279805f, -0.47814706f,
+  -0.877545297f, -0.479493767f,
+  -0.876808703f, -0.480839342f,
+  -0.876070082f, -0.482183784f,
+  -0.875329375f, -0.483527064f,
+  -0.874586642f, -0.484869242f,
+  -0.873841822f, -0.486210287f,
+  -0.873094976f, -0.487550169f,
+  -0.872346044f, -0.48888889f,
+  -0.871595085f, -0.490226477f,
+  -0.87084204f, -0.491562903f,
+  -0.870086968f, -0.492898196f,
+  -0.86932987f, -0.494232297f,
+  -0.868570685f, -0.495565265f,
+  -0.867809474f, -0.496897042f,
+  -0.867046237f, -0.498227656f,
+  -0.866280973f, -0.499557108f,
+  -0.865513623f, -0.500885367f,
+  -0.864744246f, -0.502212465f,
+  -0.863972843f, -0.50353837f,
+  -0.863199413f, -0.504863083f,
+  -0.862423956f, -0.506186664f,
+  -0.861646473f, -0.507508993f,
+  -0.860866964f, -0.50883013f,
+  -0.860085368f, -0.510150075f,
+  -0.859301805f, -0.511468828f,
+  -0.858516216f, -0.512786388f,
+  -0.857728601f, -0.514102757f,
+  -0.856938958f, -0.515417874f,
+  -0.856147349f, -0.516731799f,
+  -0.855353653f, -0.518044531f,
+  -0.854557991f, -0.519356012f,
+  -0.853760302f, -0.520666242f,
+  -0.852960587f, -0.521975279f,
+  -0.852158904f, -0.523283124f,
+  -0.851355195f, -0.524589658f,
+  -0.850549459f, -0.525895f,
+  -0.849741757f, -0.527199149f,
+  -0.848932028f, -0.528501987f,
+  -0.848120332f, -0.529803634f,
+  -0.847306609f, -0.531104028f,
+  -0.84649092f, -0.532403111f,
+  -0.845673263f, -0.533701003f,
+  -0.84485358f, -0.534997642f,
+  -0.84403187f, -0.53629297f,
+  -0.843208253f, -0.537587047f,
+  -0.84238261f, -0.538879931f,
+  -0.841554999f, -0.540171444f,
+  -0.840725362f, -0.541461766f,
+  -0.839893818f, -0.542750776f,
+  -0.839060247f, -0.544038534f,
+  -0.838224709f, -0.545324981f,
+  -0.837387204f, -0.546610177f,
+  -0.836547732f, -0.547894061f,
+  -0.835706294f, -0.549176633f,
+  -0.834862888f, -0.550457954f,
+  -0.834017515f, -0.551737964f,
+  -0.833170176f, -0.553016722f,
+  -0.832320869f, -0.554294109f,
+  -0.831469595f, -0.555570245f,
+  -0.830616415f, -0.556845009f,
+  -0.829761207f, -0.558118522f,
+  -0.828904092f, -0.559390724f,
+  -0.82804507f, -0.560661554f,
+  -0.827184021f, -0.561931133f,
+  -0.826321065f, -0.563199341f,
+  -0.825456142f, -0.564466238f,
+  -0.824589312f, -0.565731823f,
+  -0.823720515f, -0.566996038f,
+  -0.82284981f, -0.568258941f,
+  -0.821977139f, -0.569520533f,
+  -0.8211025f, -0.570780754f,
+  -0.820225954f, -0.572039604f,
+  -0.819347501f, -0.573297143f,
+  -0.81846714f, -0.57455337f,
+  -0.817584813f, -0.575808167f,
+  -0.816700578f, -0.577061653f,
+  -0.815814435f, -0.578313768f,
+  -0.814926326f, -0.579564571f,
+  -0.81403631f, -0.580813944f,
+  -0.813144386f, -0.582062006f,
+  -0.812250614f, -0.583308637f,
+  -0.811354876f, -0.584553957f,
+  -0.81045717f, -0.585797846f,
+  -0.809557617f, -0.587040365f,
+  -0.808656156f, -0.588281572f,
+  -0.807752848f, -0.589521289f,
+  -0.806847572f, -0.590759695f,
+  -0.80594039f, -0.59199667f,
+  -0.805031359f, -0.593232274f,
+  -0.804120362f, -0.594466507f,
+  -0.803207517f, -0.59569931f,
+  -0.802292824f, -0.596930683f,
+  -0.801376164f, -0.598160684f,
+  -0.800457656f, -0.599389315f,
+  -0.799537241f, -0.600616455f,
+  -0.798614979f, -0.601842225f,
+  -0.797690868f, -0.603066623f,
+  -0.796764791f, -0.604289532f,
+  -0.795836926f, -0.605511069f,
+  -0.794907153f, -0.606731117f,
+  -0.793975472f, -0.607949793f,
+  -0.793041945f, -0.609167039f,
+  -0.792106569f, -0.610382795f,
+  -0.791169345f, -0.61159718f,
+  -0.790230215f, -0.612810075f,
+  -0.789289236f, -0.61402154f,
+  -0.78834641f, -0.615231574f,
+  -0.787401736f, -0.616440177f,
+  -0.786455214f, -0.61764729f,
+  -0.785506845f, -0.618852973f,
+  -0.784556568f, -0.620057225f,
+  -0.783604503f, -0.621259987f,
+  -0.78265059f, -0.622461259f,
+  -0.781694829f, -0.623661101f,
+  -0.780737221f, -0.624859512f,
+  -0.779777765f, -0.626056373f,
+  -0.778816521f, -0.627251804f,
+  -0.777853429f, -0.628445745f,
+  -0.77688849f, -0.629638255f,
+  -0.775921702f, -0.630829215f,
+  -0.774953127f, -0.632018745f,
+  -0.773982704f, -0.633206785f,
+  -0.773010433f, -0.634393275f,
+  -0.772036374f, -0.635578334f,
+  -0.771060526f, -0.636761844f,
+  -0.770082831f, -0.637943923f,
+  -0.769103348f, -0.639124453f,
+  -0.768122017f, -0.640303493f,
+  -0.767138898f, -0.641481042f,
+  -0.766153991f, -0.642657042f,
+  -0.765167236f, -0.643831551f,
+  -0.764178753f, -0.645004511f,
+  -0.763188422f, -0.64617604f,
+  -0.762196302f, -0.64734596f,
+  -0.761202395f, -0.64851439f,
+  -0.760206699f, -0.64968133f,
+  -0.759209216f, -0.65084666f,
+  -0.758209884f, -0.65201056f,
+  -0.757208824f, -0.653172851f,
+  -0.756205976f, -0.654333591f,
+  -0.755201399f, -0.655492842f,
+  -0.754194975f, -0.656650543f,
+  -0.753186822f, -0.657806695f,
+  -0.752176821f, -0.658961296f,
+  -0.751165152f, -0.660114348f,
+  -0.750151634f, -0.66126585f,
+  -0.749136388f, -0.662415802f,
+  -0.748119354f, -0.663564146f,
+  -0.747100592f, -0.664710999f,
+  -0.746080101f, -0.665856242f,
+  -0.745057762f, -0.666999936f,
+  -0.744033754f, -0.668142021f,
+  -0.743007958f, -0.669282615f,
+  -0.741980433f, -0.670421541f,
+  -0.740951121f, -0.671558976f,
+  -0.73992008f, -0.672694743f,
+  -0.73888731f, -0.673829019f,
+  -0.737852812f, -0.674961627f,
+  -0.736816585f, -0.676092684f,
+  -0.73577857f, -0.677222192f,
+  -0.734738886f, -0.678350031f,
+  -0.733697414f, -0.679476321f,
+  -0.732654274f, -0.680601001f,
+  -0.731609404f, -0.681724072f,
+  -0.730562747f, -0.682845533f,
+  -0.72951442f, -0.683965385f,
+  -0.728464365f, -0.685083687f,
+  -0.727412641f, -0.686200321f,
+  -0.726359129f, -0.687315345f,
+  -0.725303948f, -0.68842876f,
+  -0.724247098f, -0.689540565f,
+  -0.72318846f, -0.690650702f,
+  -0.722128212f, -0.691759229f,
+  -0.721066177f, -0.692866147f,
+  -0.720002532f, -0.693971455f,
+  -0.718937099f, -0.695075095f,
+  -0.717870057f, -0.696177125f,
+  -0.716801286f, -0.697277486f,
+  -0.715730846f, -0.698376238f,
+  -0.714658678f, -0.699473321f,
+  -0.71358484f, -0.700568795f,
+  -0.712509394f, -0.7016626f,
+  -0.711432219f, -0.702754736f,
+  -0.710353374f, -0.703845263f,
+  -0.709272802f, -0.704934061f,
+  -0.70819062f, -0.706021249f,
+  -0.707106769f, -0.707106769f,
+  -0.706021249f, -0.70819062f,
+  -0.704934061f, -0.709272802f,
+  -0.703845263f, -0.710353374f,
+  -0.702754736f, -0.711432219f,
+  -0.7016626f, -0.712509394f,
+  -0.700568795f, -0.71358484f,
+  -0.699473321f, -0.714658678f,
+  -0.698376238f, -0.715730846f,
+  -0.697277486f, -0.716801286f,
+  -0.696177125f, -0.717870057f,
+  -0.695075095f, -0.718937099f,
+  -0.693971455f, -0.720002532f,
+  -0.692866147f, -0.721066177f,
+  -0.691759229f, -0.722128212f,
+  -0.690650702f, -0.72318846f,
+  -0.689540565f, -0.724247098f,
+  -0.68842876f, -0.725303948f,
+  -0.687315345f, -0.726359129f,
+  -0.686200321f, -0.727412641f,
+  -0.685083687f, -0.728464365f,
+  -0.683965385f, -0.72951442f,
+  -0.682845533f, -0.730562747f,
+  -0.681724072f, -0.731609404f,
+  -0.680601001f, -0.732654274f,
+  -0.679476321f, -0.733697414f,
+  -0.678350031f, -0.734738886f,
+  -0.677222192f, -0.73577857f,
+  -0.676092684f, -0.736816585f,
+  -0.674961627f, -0.737852812f,
+  -0.673829019f, -0.73888731f,
+  -0.672694743f, -0.73992008f,
+  -0.671558976f, -0.740951121f,
+  -0.670421541f, -0.741980433f,
+  -0.669282615f, -0.743007958f,
+  -0.668142021f, -0.744033754f,
+  -0.666999936f, -0.745057762f,
+  -0.665856242f, -0.746080101f,
+  -0.664710999f, -0.747100592f,
+  -0.663564146f, -0.748119354f,
+  -0.662415802f, -0.749136388f,
+  -0.66126585f, -0.750151634f,
+  -0.660114348f, -0.751165152f,
+  -0.658961296f, -0.752176821f,
+  -0.657806695f, -0.753186822f,
+  -0.656650543f, -0.754194975f,
+  -0.655492842f, -0.755201399f,
+  -0.654333591f, -0.756205976f,
+  -0.653172851f, -0.757208824f,
+  -0.65201056f, -0.758209884f,
+  -0.65084666f, -0.759209216f,
+  -0.64968133f, -0.760206699f,
+  -0.64851439f, -0.761202395f,
+  -0.64734596f, -0.762196302f,
+  -0.64617604f, -0.763188422f,
+  -0.645004511f, -0.764178753f,
+  -0.643831551f, -0.765167236f,
+  -0.642657042f, -0.766153991f,
+  -0.641481042f, -0.767138898f,
+  -0.640303493f, -0.768122017f,
+  -0.639124453f, -0.769103348f,
+  -0.637943923f, -0.770082831f,
+  -0.636761844f, -0.771060526f,
+  -0.635578334f, -0.772036374f,
+  -0.634393275f, -0.773010433f,
+  -0.633206785f, -0.773982704f,
+  -0.632018745f, -0.774953127f,
+  -0.630829215f, -0.775921702f,
+  -0.629638255f, -0.77688849f,
+  -0.628445745f, -0.777853429f,
+  -0.627251804f, -0.778816521f,
+  -0.626056373f, -0.779777765f,
+  -0.624859512f, -0.780737221f,
+  -0.623661101f, -0.781694829f,
+  -0.622461259f, -0.78265059f,
+  -0.621259987f, -0.783604503f,
+  -0.620057225f, -0.784556568f,
+  -0.618852973f, -0.785506845f,
+  -0.61764729f, -0.786455214f,
+  -0.616440177f, -0.787401736f,
+  -0.615231574f, -0.78834641f,
+  -0.61402154f, -0.789289236f,
+  -0.612810075f, -0.790230215f,
+  -0.61159718f, -0.791169345f,
+  -0.610382795f, -0.792106569f,
+  -0.609167039f, -0.793041945f,
+  -0.607949793f, -0.793975472f,
+  -0.606731117f, -0.794907153f,
+  -0.605511069f, -0.795836926f,
+  -0.604289532f, -0.796764791f,
+  -0.603066623f, -0.797690868f,
+  -0.601842225f, -0.798614979f,
+  -0.600616455f, -0.799537241f,
+  -0.599389315f, -0.800457656f,
+  -0.598160684f, -0.801376164f,
+  -0.596930683f, -0.802292824f,
+  -0.59569931f, -0.803207517f,
+  -0.594466507f, -0.804120362f,
+  -0.593232274f, -0.805031359f,
+  -0.59199667f, -0.80594039f,
+  -0.590759695f, -0.806847572f,
+  -0.589521289f, -0.807752848f,
+  -0.588281572f, -0.808656156f,
+  -0.587040365f, -0.809557617f,
+  -0.585797846f, -0.81045717f,
+  -0.584553957f, -0.811354876f,
+  -0.583308637f, -0.812250614f,
+  -0.582062006f, -0.813144386f,
+  -0.580813944f, -0.81403631f,
+  -0.579564571f, -0.814926326f,
+  -0.578313768f, -0.815814435f,
+  -0.577061653f, -0.816700578f,
+  -0.575808167f, -0.817584813f,
+  -0.57455337f, -0.81846714f,
+  -0.573297143f, -0.819347501f,
+  -0.572039604f, -0.820225954f,
+  -0.570780754f, -0.8211025f,
+  -0.569520533f, -0.821977139f,
+  -0.568258941f, -0.82284981f,
+  -0.566996038f, -0.823720515f,
+  -0.565731823f, -0.824589312f,
+  -0.564466238f, -0.825456142f,
+  -0.563199341f, -0.826321065f,
+  -0.561931133f, -0.827184021f,
+  -0.560661554f, -0.82804507f,
+  -0.559390724f, -0.828904092f,
+  -0.558118522f, -0.829761207f,
+  -0.556845009f, -0.830616415f,
+  -0.555570245f, -0.831469595f,
+  -0.554294109f, -0.832320869f,
+  -0.553016722f, -0.833170176f,
+  -0.551737964f, -0.834017515f,
+  -0.550457954f, -0.834862888f,
+  -0.549176633f, -0.835706294f,
+  -0.547894061f, -0.836547732f,
+  -0.546610177f, -0.837387204f,
+  -0.545324981f, -0.838224709f,
+  -0.544038534f, -0.839060247f,
+  -0.542750776f, -0.839893818f,
+  -0.541461766f, -0.840725362f,
+  -0.540171444f, -0.841554999f,
+  -0.538879931f, -0.84238261f,
+  -0.537587047f, -0.843208253f,
+  -0.53629297f, -0.84403187f,
+  -0.534997642f, -0.84485358f,
+  -0.533701003f, -0.845673263f,
+  -0.532403111f, -0.84649092f,
+  -0.531104028f, -0.847306609f,
+  -0.529803634f, -0.848120332f,
+  -0.528501987f, -0.848932028f,
+  -0.527199149f, -0.849741757f,
+  -0.525895f, -0.850549459f,
+  -0.524589658f, -0.851355195f,
+  -0.523283124f, -0.852158904f,
+  -0.521975279f, -0.852960587f,
+  -0.520666242f, -0.853760302f,
+  -0.519356012f, -0.854557991f,
+  -0.518044531f, -0.855353653f,
+  -0.516731799f, -0.856147349f,
+  -0.515417874f, -0.856938958f,
+  -0.514102757f, -0.857728601f,
+  -0.512786388f, -0.858516216f,
+  -0.511468828f, -0.859301805f,
+  -0.510150075f, -0.860085368f,
+  -0.50883013f, -0.860866964f,
+  -0.507508993f, -0.861646473f,
+  -0.506186664f, -0.862423956f,
+  -0.504863083f, -0.863199413f,
+  -0.50353837f, -0.863972843f,
+  -0.502212465f, -0.864744246f,
+  -0.500885367f, -0.865513623f,
+  -0.499557108f, -0.866280973f,
+  -0.498227656f, -0.867046237f,
+  -0.496897042f, -0.867809474f,
+  -0.495565265f, -0.868570685f,
+  -0.494232297f, -0.86932987f,
+  -0.492898196f, -0.870086968f,
+  -0.491562903f, -0.87084204f,
+  -0.490226477f, -0.871595085f,
+  -0.48888889f, -0.872346044f,
+  -0.487550169f, -0.873094976f,
+  -0.486210287f, -0.873841822f,
+  -0.484869242f, -0.874586642f,
+  -0.483527064f, -0.875329375f,
+  -0.482183784f, -0.876070082f,
+  -0.480839342f, -0.876808703f,
+  -0.479493767f, -0.877545297f,
+  -0.47814706f, -0.878279805f,
+  -0.47679922f, -0.879012227f,
+  -0.475450277f, -0.879742622f,
+  -0.474100202f, -0.880470872f,
+  -0.472749025f, -0.881197095f,
+  -0.471396744f, -0.881921291f,
+  -0.470043331f, -0.882643342f,
+  -0.468688816f, -0.883363366f,
+  -0.467333198f, -0.884081244f,
+  -0.465976506f, -0.884797096f,
+  -0.464618683f, -0.885510862f,
+  -0.463259786f, -0.886222541f,
+  -0.461899787f, -0.886932135f,
+  -0.460538715f, -0.887639642f,
+  -0.45917654f, -0.888345063f,
+  -0.457813293f, -0.889048338f,
+  -0.456448972f, -0.889749587f,
+  -0.455083579f, -0.890448749f,
+  -0.453717113f, -0.891145766f,
+  -0.452349573f, -0.891840696f,
+  -0.450980991f, -0.892533541f,
+  -0.449611336f, -0.893224299f,
+  -0.448240608f, -0.893912971f,
+  -0.446868837f, -0.894599497f,
+  -0.445496023f, -0.895283937f,
+  -0.444122136f, -0.895966232f,
+  -0.442747235f, -0.8966465f,
+  -0.441371262f, -0.897324562f,
+  -0.439994276f, -0.898000598f,
+  -0.438616246f, -0.898674488f,
+  -0.437237173f, -0.899346232f,
+  -0.435857087f, -0.900015891f,
+  -0.434475958f, -0.900683403f,
+  -0.433093816f, -0.901348829f,
+  -0.43171066f, -0.902012169f,
+  -0.430326492f, -0.902673304f,
+  -0.42894128f, -0.903332353f,
+  -0.427555084f, -0.903989315f,
+  -0.426167876f, -0.904644072f,
+  -0.424779683f, -0.905296743f,
+  -0.423390478f, -0.905947268f,
+  -0.422000259f, -0.906595707f,
+  -0.420609087f, -0.907242f,
+  -0.419216901f, -0.907886088f,
+  -0.417823702f, -0.90852809f,
+  -0.416429549f, -0.909168005f,
+  -0.415034413f, -0.909805715f,
+  -0.413638324f, -0.910441279f,
+  -0.41224122f, -0.911074758f,
+  -0.410843164f, -0.91170603f,
+  -0.409444153f, -0.912335157f,
+  -0.408044159f, -0.912962198f,
+  -0.406643212f, -0.913587034f,
+  -0.405241311f, -0.914209783f,
+  -0.403838456f, -0.914830327f,
+  -0.402434647f, -0.915448725f,
+  -0.401029885f, -0.916064978f,
+  -0.399624199f, -0.916679084f,
+  -0.398217559f, -0.917290986f,
+  -0.396809995f, -0.917900801f,
+  -0.395401478f, -0.91850841f,
+  -0.393992037f, -0.919113874f,
+  -0.392581671f, -0.919717133f,
+  -0.391170382f, -0.920318305f,
+  -0.38975817f, -0.920917213f,
+  -0.388345033f, -0.921514034f,
+  -0.386931002f, -0.92210865f,
+  -0.385516047f, -0.92270112f,
+  -0.384100199f, -0.923291445f,
+  -0.382683426f, -0.923879504f,
+  -0.381265759f, -0.924465477f,
+  -0.379847199f, -0.925049245f,
+  -0.378427744f, -0.925630808f,
+  -0.377007425f, -0.926210225f,
+  -0.375586182f, -0.926787496f,
+  -0.374164075f, -0.927362502f,
+  -0.372741073f, -0.927935421f,
+  -0.371317208f, -0.928506076f,
+  -0.369892448f, -0.929074585f,
+  -0.368466824f, -0.929640889f,
+  -0.367040336f, -0.930205047f,
+  -0.365612984f, -0.93076694f,
+  -0.364184797f, -0.931326687f,
+  -0.362755716f, -0.931884289f,
+  -0.3613258f, -0.932439625f,
+  -0.359895051f, -0.932992816f,
+  -0.358463407f, -0.933543801f,
+  -0.357030958f, -0.934092522f,
+  -0.355597675f, -0.934639156f,
+  -0.354163527f, -0.935183525f,
+  -0.352728546f, -0.935725689f,
+  -0.351292759f, -0.936265647f,
+  -0.349856138f, -0.93680346f,
+  -0.348418683f, -0.937339008f,
+  -0.346980423f, -0.93787235f,
+  -0.345541328f, -0.938403547f,
+  -0.344101429f, -0.938932478f,
+  -0.342660725f, -0.939459205f,
+  -0.341219217f, -0.939983726f,
+  -0.339776874f, -0.940506041f,
+  -0.338333756f, -0.941026151f,
+  -0.336889863f, -0.941544056f,
+  -0.335445136f, -0.942059755f,
+  -0.333999664f, -0.94257319f,
+  -0.332553357f, -0.943084419f,
+  -0.331106305f, -0.943593442f,
+  -0.329658449f, -0.944100261f,
+  -0.328209847f, -0.944604814f,
+  -0.326760441f, -0.945107222f,
+  -0.32531029f, -0.945607305f,
+  -0.323859364f, -0.946105242f,
+  -0.322407693f, -0.946600914f,
+  -0.320955247f, -0.947094381f,
+  -0.319502026f, -0.947585583f,
+  -0.31804809f, -0.948074579f,
+  -0.316593379f, -0.94856137f,
+  -0.315137923f, -0.949045897f,
+  -0.313681751f, -0.949528158f,
+  -0.312224805f, -0.950008273f,
+  -0.310767144f, -0.950486064f,
+  -0.309308767f, -0.950961649f,
+  -0.307849646f, -0.95143503f,
+  -0.306389809f, -0.951906145f,
+  -0.304929227f, -0.952374995f,
+  -0.303467959f, -0.95284164f,
+  -0.302005947f, -0.953306019f,
+  -0.300543249f, -0.953768194f,
+  -0.299079835f, -0.954228103f,
+  -0.297615707f, -0.954685748f,
+  -0.296150893f, -0.955141187f,
+  -0.294685364f, -0.955594361f,
+  -0.293219149f, -0.95604527f,
+  -0.291752249f, -0.956493914f,
+  -0.290284663f, -0.956940353f,
+  -0.288816422f, -0.957384527f,
+  -0.287347466f, -0.957826436f,
+  -0.285877824f, -0.958266079f,
+  -0.284407526f, -0.958703458f,
+  -0.282936573f, -0.959138632f,
+  -0.281464934f, -0.95957154f,
+  -0.27999264f, -0.960002124f,
+  -0.27851969f, -0.960430503f,
+  -0.277046084f, -0.960856616f,
+  -0.275571823f, -0.961280465f,
+  -0.274096906f, -0.961702049f,
+  -0.272621363f, -0.962121427f,
+  -0.271145165f, -0.962538481f,
+  -0.269668311f, -0.962953269f,
+  -0.268190861f, -0.963365793f,
+  -0.266712755f, -0.963776052f,
+  -0.265234023f, -0.964184046f,
+  -0.263754666f, -0.964589775f,
+  -0.262274712f, -0.964993238f,
+  -0.260794103f, -0.965394437f,
+  -0.259312928f, -0.965793371f,
+  -0.257831097f, -0.966189981f,
+  -0.25634867f, -0.966584384f,
+  -0.254865646f, -0.966976464f,
+  -0.253382027f, -0.967366278f,
+  -0.251897812f, -0.967753828f,
+  -0.250413001f, -0.968139112f,
+  -0.248927608f, -0.968522072f,
+  -0.24744162f, -0.968902826f,
+  -0.24595505f, -0.969281256f,
+  -0.244467899f, -0.969657362f,
+  -0.242980182f, -0.970031261f,
+  -0.241491884f, -0.970402837f,
+  -0.24000302f, -0.970772147f,
+  -0.238513589f, -0.971139133f,
+  -0.237023607f, -0.971503913f,
+  -0.235533059f, -0.97186631f,
+  -0.234041959f, -0.972226501f,
+  -0.232550308f, -0.972584367f,
+  -0.231058106f, -0.972939968f,
+  -0.229565367f, -0.973293245f,
+  -0.228072077f, -0.973644257f,
+  -0.226578265f, -0.973992944f,
+  -0.225083917f, -0.974339366f,
+  -0.223589033f, -0.974683523f,
+  -0.222093627f, -0.975025356f,
+  -0.220597684f, -0.975364864f,
+  -0.219101235f, -0.975702107f,
+  -0.21760428f, -0.976037085f,
+  -0.216106802f, -0.976369739f,
+  -0.214608818f, -0.976700068f,
+  -0.213110313f, -0.977028131f,
+  -0.211611331f, -0.977353871f,
+  -0.210111842f, -0.977677345f,
+  -0.208611846f, -0.977998495f,
+  -0.207111374f, -0.97831738f,
+  -0.205610409f, -0.97863394f,
+  -0.204108968f, -0.978948176f,
+  -0.202607036f, -0.979260147f,
+  -0.201104641f, -0.979569793f,
+  -0.199601755f, -0.979877114f,
+  -0.198098406f, -0.980182111f,
+  -0.196594596f, -0.980484843f,
+  -0.195090324f, -0.980785251f,
+  -0.19358559f, -0.981083393f,
+  -0.192080393f, -0.981379211f,
+  -0.19057475f, -0.981672704f,
+  -0.18906866f, -0.981963873f,
+  -0.187562123f, -0.982252717f,
+  -0.186055154f, -0.982539296f,
+  -0.184547737f, -0.982823551f,
+  -0.183039889f, -0.983105481f,
+  -0.181531608f, -0.983385086f,
+  -0.180022895f, -0.983662426f,
+  -0.178513765f, -0.983937442f,
+  -0.177004218f, -0.984210074f,
+  -0.175494254f, -0.984480441f,
+  -0.173983872f, -0.984748483f,
+  -0.172473088f, -0.98501426f,
+  -0.170961887f, -0.985277653f,
+  -0.169450298f, -0.985538721f,
+  -0.167938292f, -0.985797524f,
+  -0.166425899f, -0.986053944f,
+  -0.164913118f, -0.986308098f,
+  -0.16339995f, -0.986559927f,
+  -0.161886394f, -0.986809373f,
+  -0.160372451f, -0.987056553f,
+  -0.15885815f, -0.987301409f,
+  -0.157343462f, -0.987543941f,
+  -0.155828401f, -0.987784147f,
+  -0.154312968f, -0.988022029f,
+  -0.152797192f, -0.988257587f,
+  -0.151281044f, -0.98849082f,
+  -0.149764538f, -0.988721669f,
+  -0.148247674f, -0.988950253f,
+  -0.146730468f, -0.989176512f,
+  -0.145212919f, -0.989400446f,
+  -0.143695027f, -0.989621997f,
+  -0.142176807f, -0.989841282f,
+  -0.140658244f, -0.990058184f,
+  -0.139139339f, -0.99027282f,
+  -0.137620121f, -0.990485072f,
+  -0.136100575f, -0.990695f,
+  -0.134580702f, -0.990902662f,
+  -0.13306053f, -0.991107941f,
+  -0.13154003f, -0.991310835f,
+  -0.130019218f, -0.991511464f,
+  -0.128498107f, -0.991709769f,
+  -0.126976699f, -0.991905689f,
+  -0.125454977f, -0.992099285f,
+  -0.123932973f, -0.992290616f,
+  -0.122410677f, -0.992479563f,
+  -0.120888084f, -0.992666125f,
+  -0.119365215f, -0.992850423f,
+  -0.117842063f, -0.993032336f,
+  -0.116318628f, -0.993211925f,
+  -0.114794925f, -0.993389189f,
+  -0.113270953f, -0.993564129f,
+  -0.111746714f, -0.993736744f,
+  -0.110222206f, -0.993906975f,
+  -0.108697444f, -0.994074881f,
+  -0.107172422f, -0.994240463f,
+  -0.105647154f, -0.99440366f,
+  -0.104121633f, -0.994564593f,
+  -0.102595866f, -0.994723141f,
+  -0.10106986f, -0.994879305f,
+  -0.0995436162f, -0.995033205f,
+  -0.0980171412f, -0.99518472f,
+  -0.0964904279f, -0.99533391f,
+  -0.0949634984f, -0.995480776f,
+  -0.093436338f, -0.995625257f,
+  -0.0919089541f, -0.995767415f,
+  -0.0903813615f, -0.995907247f,
+  -0.0888535529f, -0.996044695f,
+  -0.0873255357f, -0.996179819f,
+  -0.0857973099f, -0.996312618f,
+  -0.0842688903f, -0.996443033f,
+  -0.0827402622f, -0.996571124f,
+  -0.0812114477f, -0.996696889f,
+  -0.0796824396f, -0.996820271f,
+  -0.0781532452f, -0.996941328f,
+  -0.0766238645f, -0.997060061f,
+  -0.0750942975f, -0.997176409f,
+  -0.0735645667f, -0.997290432f,
+  -0.0720346496f, -0.997402132f,
+  -0.070504576f, -0.997511446f,
+  -0.068974331f, -0.997618437f,
+  -0.0674439222f, -0.997723043f,
+  -0.0659133494f, -0.997825325f,
+  -0.0643826276f, -0.997925282f,
+  -0.0628517568f, -0.998022854f,
+  -0.061320737f, -0.998118103f,
+  -0.0597895719f, -0.998211026f,
+  -0.0582582653f, -0.998301566f,
+  -0.0567268208f, -0.998389721f,
+  -0.0551952459f, -0.998475552f,
+  -0.0536635369f, -0.998559058f,
+  -0.052131705f, -0.998640239f,
+  -0.0505997501f, -0.998719037f,
+  -0.0490676761f, -0.99879545f,
+  -0.0475354828f, -0.998869538f,
+  -0.0460031815f, -0.998941302f,
+  -0.0444707721f, -0.999010682f,
+  -0.0429382585f, -0.999077737f,
+  -0.0414056405f, -0.999142408f,
+  -0.0398729257f, -0.999204755f,
+  -0.0383401215f, -0.999264777f,
+  -0.0368072242f, -0.999322355f,
+  -0.0352742374f, -0.999377668f,
+  -0.0337411724f, -0.999430597f,
+  -0.0322080255f, -0.999481201f,
+  -0.030674804f, -0.999529421f,
+  -0.029141508f, -0.999575317f,
+  -0.027608145f, -0.999618828f,
+  -0.0260747187f, -0.999660015f,
+  -0.024541229f, -0.999698818f,
+  -0.0230076816f, -0.999735296f,
+  -0.0214740802f, -0.99976939f,
+  -0.0199404284f, -0.999801159f,
+  -0.0184067301f, -0.999830604f,
+  -0.0168729872f, -0.999857664f,
+  -0.015339206f, -0.99988234f,
+  -0.0138053885f, -0.999904692f,
+  -0.0122715384f, -0.999924719f,
+  -0.0107376594f, -0.999942362f,
+  -0.00920375437f, -0.999957621f,
+  -0.00766982883f, -0.999970615f,
+  -0.00613588467f, -0.999981165f,
+  -0.00460192608f, -0.99998939f,
+  -0.00306795677f, -0.999995291f,
+  -0.00153398013f, -0.999998808f,
+  0.0f, -1.0f,
+  0.00153398013f, -0.999998808f,
+  0.00306795677f, -0.999995291f,
+  0.00460192608f, -0.99998939f,
+  0.00613588467f, -0.999981165f,
+  0.00766982883f, -0.999970615f,
+  0.00920375437f, -0.999957621f,
+  0.0107376594f, -0.999942362f,
+  0.0122715384f, -0.999924719f,
+  0.0138053885f, -0.999904692f,
+  0.015339206f, -0.99988234f,
+  0.0168729872f, -0.999857664f,
+  0.0184067301f, -0.999830604f,
+  0.0199404284f, -0.999801159f,
+  0.0214740802f, -0.99976939f,
+  0.0230076816f, -0.999735296f,
+  0.024541229f, -0.999698818f,
+  0.0260747187f, -0.999660015f,
+  0.027608145f, -0.999618828f,
+  0.029141508f, -0.999575317f,
+  0.030674804f, -0.999529421f,
+  0.0322080255f, -0.999481201f,
+  0.0337411724f, -0.999430597f,
+  0.0352742374f, -0.999377668f,
+  0.0368072242f, -0.999322355f,
+  0.0383401215f, -0.999264777f,
+  0.0398729257f, -0.999204755f,
+  0.0414056405f, -0.999142408f,
+  0.0429382585f, -0.999077737f,
+  0.0444707721f, -0.999010682f,
+  0.0460031815f, -0.998941302f,
+  0.0475354828f, -0.998869538f,
+  0.0490676761f, -0.99879545f,
+  0.0505997501f, -0.998719037f,
+  0.052131705f, -0.998640239f,
+  0.0536635369f, -0.998559058f,
+  0.0551952459f, -0.998475552f,
+  0.0567268208f, -0.998389721f,
+  0.0582582653f, -0.998301566f,
+  0.0597895719f, -0.998211026f,
+  0.061320737f, -0.998118103f,
+  0.0628517568f, -0.998022854f,
+  0.0643826276f, -0.997925282f,
+  0.0659133494f, -0.997825325f,
+  0.0674439222f, -0.997723043f,
+  0.068974331f, -0.997618437f,
+  0.070504576f, -0.997511446f,
+  0.0720346496f, -0.997402132f,
+  0.0735645667f, -0.997290432f,
+  0.0750942975f, -0.997176409f,
+  0.0766238645f, -0.997060061f,
+  0.0781532452f, -0.996941328f,
+  0.0796824396f, -0.996820271f,
+  0.0812114477f, -0.996696889f,
+  0.0827402622f, -0.996571124f,
+  0.0842688903f, -0.996443033f,
+  0.0857973099f, -0.996312618f,
+  0.0873255357f, -0.996179819f,
+  0.0888535529f, -0.996044695f,
+  0.0903813615f, -0.995907247f,
+  0.0919089541f, -0.995767415f,
+  0.093436338f, -0.995625257f,
+  0.0949634984f, -0.995480776f,
+  0.0964904279f, -0.99533391f,
+  0.0980171412f, -0.99518472f,
+  0.0995436162f, -0.995033205f,
+  0.10106986f, -0.994879305f,
+  0.102595866f, -0.994723141f,
+  0.104121633f, -0.994564593f,
+  0.105647154f, -0.99440366f,
+  0.107172422f, -0.994240463f,
+  0.108697444f, -0.994074881f,
+  0.110222206f, -0.993906975f,
+  0.111746714f, -0.993736744f,
+  0.113270953f, -0.993564129f,
+  0.114794925f, -0.993389189f,
+  0.116318628f, -0.993211925f,
+  0.117842063f, -0.993032336f,
+  0.119365215f, -0.992850423f,
+  0.120888084f, -0.992666125f,
+  0.122410677f, -0.992479563f,
+  0.123932973f, -0.992290616f,
+  0.125454977f, -0.992099285f,
+  0.126976699f, -0.991905689f,
+  0.128498107f, -0.991709769f,
+  0.130019218f, -0.991511464f,
+  0.13154003f, -0.991310835f,
+  0.13306053f, -0.991107941f,
+  0.134580702f, -0.990902662f,
+  0.136100575f, -0.990695f,
+  0.137620121f, -0.990485072f,
+  0.139139339f, -0.99027282f,
+  0.140658244f, -0.990058184f,
+  0.142176807f, -0.989841282f,
+  0.143695027f, -0.989621997f,
+  0.145212919f, -0.989400446f,
+  0.146730468f, -0.989176512f,
+  0.148247674f, -0.988950253f,
+  0.149764538f, -0.988721669f,
+  0.151281044f, -0.98849082f,
+  0.152797192f, -0.988257587f,
+  0.154312968f, -0.988022029f,
+  0.155828401f, -0.987784147f,
+  0.157343462f, -0.987543941f,
+  0.15885815f, -0.987301409f,
+  0.160372451f, -0.987056553f,
+  0.161886394f, -0.986809373f,
+  0.16339995f, -0.986559927f,
+  0.164913118f, -0.986308098f,
+  0.166425899f, -0.986053944f,
+  0.167938292f, -0.985797524f,
+  0.169450298f, -0.985538721f,
+  0.170961887f, -0.985277653f,
+  0.172473088f, -0.98501426f,
+  0.173983872f, -0.984748483f,
+  0.175494254f, -0.984480441f,
+  0.177004218f, -0.984210074f,
+  0.178513765f, -0.983937442f,
+  0.180022895f, -0.983662426f,
+  0.181531608f, -0.983385086f,
+  0.183039889f, -0.983105481f,
+  0.184547737f, -0.982823551f,
+  0.186055154f, -0.982539296f,
+  0.187562123f, -0.982252717f,
+  0.18906866f, -0.981963873f,
+  0.19057475f, -0.981672704f,
+  0.192080393f, -0.981379211f,
+  0.19358559f, -0.981083393f,
+  0.195090324f, -0.980785251f,
+  0.196594596f, -0.980484843f,
+  0.198098406f, -0.980182111f,
+  0.199601755f, -0.979877114f,
+  0.201104641f, -0.979569793f,
+  0.202607036f, -0.979260147f,
+  0.204108968f, -0.978948176f,
+  0.205610409f, -0.97863394f,
+  0.207111374f, -0.97831738f,
+  0.208611846f, -0.977998495f,
+  0.210111842f, -0.977677345f,
+  0.211611331f, -0.977353871f,
+  0.213110313f, -0.977028131f,
+  0.214608818f, -0.976700068f,
+  0.216106802f, -0.976369739f,
+  0.21760428f, -0.976037085f,
+  0.219101235f, -0.975702107f,
+  0.220597684f, -0.975364864f,
+  0.222093627f, -0.975025356f,
+  0.223589033f, -0.974683523f,
+  0.225083917f, -0.974339366f,
+  0.226578265f, -0.973992944f,
+  0.228072077f, -0.973644257f,
+  0.229565367f, -0.973293245f,
+  0.231058106f, -0.972939968f,
+  0.232550308f, -0.972584367f,
+  0.234041959f, -0.972226501f,
+  0.235533059f, -0.97186631f,
+  0.237023607f, -0.971503913f,
+  0.238513589f, -0.971139133f,
+  0.24000302f, -0.970772147f,
+  0.241491884f, -0.970402837f,
+  0.242980182f, -0.970031261f,
+  0.244467899f, -0.969657362f,
+  0.24595505f, -0.969281256f,
+  0.24744162f, -0.968902826f,
+  0.248927608f, -0.968522072f,
+  0.250413001f, -0.968139112f,
+  0.251897812f, -0.967753828f,
+  0.253382027f, -0.967366278f,
+  0.254865646f, -0.966976464f,
+  0.25634867f, -0.966584384f,
+  0.257831097f, -0.966189981f,
+  0.259312928f, -0.965793371f,
+  0.260794103f, -0.965394437f,
+  0.262274712f, -0.964993238f,
+  0.263754666f, -0.964589775f,
+  0.265234023f, -0.964184046f,
+  0.266712755f, -0.963776052f,
+  0.268190861f, -0.963365793f,
+  0.269668311f, -0.962953269f,
+  0.271145165f, -0.962538481f,
+  0.272621363f, -0.962121427f,
+  0.274096906f, -0.961702049f,
+  0.275571823f, -0.961280465f,
+  0.277046084f, -0.960856616f,
+  0.27851969f, -0.960430503f,
+  0.27999264f, -0.960002124f,
+  0.281464934f, -0.95957154f,
+  0.282936573f, -0.959138632f,
+  0.284407526f, -0.958703458f,
+  0.285877824f, -0.958266079f,
+  0.287347466f, -0.957826436f,
+  0.288816422f, -0.957384527f,
+  0.290284663f, -0.956940353f,
+  0.291752249f, -0.956493914f,
+  0.293219149f, -0.95604527f,
+  0.294685364f, -0.955594361f,
+  0.296150893f, -0.955141187f,
+  0.297615707f, -0.954685748f,
+  0.299079835f, -0.954228103f,
+  0.300543249f, -0.953768194f,
+  0.302005947f, -0.953306019f,
+  0.303467959f, -0.95284164f,
+  0.304929227f, -0.952374995f,
+  0.306389809f, -0.951906145f,
+  0.307849646f, -0.95143503f,
+  0.309308767f, -0.950961649f,
+  0.310767144f, -0.950486064f,
+  0.312224805f, -0.950008273f,
+  0.313681751f, -0.949528158f,
+  0.315137923f, -0.949045897f,
+  0.316593379f, -0.94856137f,
+  0.31804809f, -0.948074579f,
+  0.319502026f, -0.947585583f,
+  0.320955247f, -0.947094381f,
+  0.322407693f, -0.946600914f,
+  0.323859364f, -0.946105242f,
+  0.32531029f, -0.945607305f,
+  0.326760441f, -0.945107222f,
+  0.328209847f, -0.944604814f,
+  0.329658449f, -0.944100261f,
+  0.331106305f, -0.943593442f,
+  0.332553357f, -0.943084419f,
+  0.333999664f, -0.94257319f,
+  0.335445136f, -0.942059755f,
+  0.336889863f, -0.941544056f,
+  0.338333756f, -0.941026151f,
+  0.339776874f, -0.940506041f,
+  0.341219217f, -0.939983726f,
+  0.342660725f, -0.939459205f,
+  0.344101429f, -0.938932478f,
+  0.345541328f, -0.938403547f,
+  0.346980423f, -0.93787235f,
+  0.348418683f, -0.937339008f,
+  0.349856138f, -0.93680346f,
+  0.351292759f, -0.936265647f,
+  0.352728546f, -0.935725689f,
+  0.354163527f, -0.935183525f,
+  0.355597675f, -0.934639156f,
+  0.357030958f, -0.934092522f,
+  0.358463407f, -0.933543801f,
+  0.359895051f, -0.932992816f,
+  0.3613258f, -0.932439625f,
+  0.362755716f, -0.931884289f,
+  0.364184797f, -0.931326687f,
+  0.365612984f, -0.93076694f,
+  0.367040336f, -0.930205047f,
+  0.368466824f, -0.929640889f,
+  0.369892448f, -0.929074585f,
+  0.371317208f, -0.928506076f,
+  0.372741073f, -0.927935421f,
+  0.374164075f, -0.927362502f,
+  0.375586182f, -0.926787496f,
+  0.377007425f, -0.926210225f,
+  0.378427744f, -0.925630808f,
+  0.379847199f, -0.925049245f,
+  0.381265759f, -0.924465477f,
+  0.382683426f, -0.923879504f,
+  0.384100199f, -0.923291445f,
+  0.385516047f, -0.92270112f,
+  0.386931002f, -0.92210865f,
+  0.388345033f, -0.921514034f,
+  0.38975817f, -0.920917213f,
+  0.391170382f, -0.920318305f,
+  0.392581671f, -0.919717133f,
+  0.393992037f, -0.919113874f,
+  0.395401478f, -0.91850841f,
+  0.396809995f, -0.917900801f,
+  0.398217559f, -0.917290986f,
+  0.399624199f, -0.916679084f,
+  0.401029885f, -0.916064978f,
+  0.402434647f, -0.915448725f,
+  0.403838456f, -0.914830327f,
+  0.405241311f, -0.914209783f,
+  0.406643212f, -0.913587034f,
+  0.408044159f, -0.912962198f,
+  0.409444153f, -0.912335157f,
+  0.410843164f, -0.91170603f,
+  0.41224122f, -0.911074758f,
+  0.413638324f, -0.910441279f,
+  0.415034413f, -0.909805715f,
+  0.416429549f, -0.909168005f,
+  0.417823702f, -0.90852809f,
+  0.419216901f, -0.907886088f,
+  0.420609087f, -0.907242f,
+  0.422000259f, -0.906595707f,
+  0.423390478f, -0.905947268f,
+  0.424779683f, -0.905296743f,
+  0.426167876f, -0.904644072f,
+  0.427555084f, -0.903989315f,
+  0.42894128f, -0.903332353f,
+  0.430326492f, -0.902673304f,
+  0.43171066f, -0.902012169f,
+  0.433093816f, -0.901348829f,
+  0.434475958f, -0.900683403f,
+  0.435857087f, -0.900015891f,
+  0.437237173f, -0.899346232f,
+  0.438616246f, -0.898674488f,
+  0.439994276f, -0.898000598f,
+  0.441371262f, -0.897324562f,
+  0.442747235f, -0.8966465f,
+  0.444122136f, -0.895966232f,
+  0.445496023f, -0.895283937f,
+  0.446868837f, -0.894599497f,
+  0.448240608f, -0.893912971f,
+  0.449611336f, -0.893224299f,
+  0.450980991f, -0.892533541f,
+  0.452349573f, -0.891840696f,
+  0.453717113f, -0.891145766f,
+  0.455083579f, -0.890448749f,
+  0.456448972f, -0.889749587f,
+  0.457813293f, -0.889048338f,
+  0.45917654f, -0.888345063f,
+  0.460538715f, -0.887639642f,
+  0.461899787f, -0.886932135f,
+  0.463259786f, -0.886222541f,
+  0.464618683f, -0.885510862f,
+  0.465976506f, -0.884797096f,
+  0.467333198f, -0.884081244f,
+  0.468688816f, -0.883363366f,
+  0.470043331f, -0.882643342f,
+  0.471396744f, -0.881921291f,
+  0.472749025f, -0.881197095f,
+  0.474100202f, -0.880470872f,
+  0.475450277f, -0.879742622f,
+  0.47679922f, -0.879012227f,
+  0.47814706f, -0.878279805f,
+  0.479493767f, -0.877545297f,
+  0.480839342f, -0.876808703f,
+  0.482183784f, -0.876070082f,
+  0.483527064f, -0.875329375f,
+  0.484869242f, -0.874586642f,
+  0.486210287f, -0.873841822f,
+  0.487550169f, -0.873094976f,
+  0.48888889f, -0.872346044f,
+  0.490226477f, -0.871595085f,
+  0.491562903f, -0.87084204f,
+  0.492898196f, -0.870086968f,
+  0.494232297f, -0.86932987f,
+  0.495565265f, -0.868570685f,
+  0.496897042f, -0.867809474f,
+  0.498227656f, -0.867046237f,
+  0.499557108f, -0.866280973f,
+  0.500885367f, -0.865513623f,
+  0.502212465f, -0.864744246f,
+  0.50353837f, -0.863972843f,
+  0.504863083f, -0.863199413f,
+  0.506186664f, -0.862423956f,
+  0.507508993f, -0.861646473f,
+  0.50883013f, -0.860866964f,
+  0.510150075f, -0.860085368f,
+  0.511468828f, -0.859301805f,
+  0.512786388f, -0.858516216f,
+  0.514102757f, -0.857728601f,
+  0.515417874f, -0.856938958f,
+  0.516731799f, -0.856147349f,
+  0.518044531f, -0.855353653f,
+  0.519356012f, -0.854557991f,
+  0.520666242f, -0.853760302f,
+  0.521975279f, -0.852960587f,
+  0.523283124f, -0.852158904f,
+  0.524589658f, -0.851355195f,
+  0.525895f, -0.850549459f,
+  0.527199149f, -0.849741757f,
+  0.528501987f, -0.848932028f,
+  0.529803634f, -0.848120332f,
+  0.531104028f, -0.847306609f,
+  0.532403111f, -0.84649092f,
+  0.533701003f, -0.845673263f,
+  0.534997642f, -0.84485358f,
+  0.53629297f, -0.84403187f,
+  0.537587047f, -0.843208253f,
+  0.538879931f, -0.84238261f,
+  0.540171444f, -0.841554999f,
+  0.541461766f, -0.840725362f,
+  0.542750776f, -0.839893818f,
+  0.544038534f, -0.839060247f,
+  0.545324981f, -0.838224709f,
+  0.546610177f, -0.837387204f,
+  0.547894061f, -0.836547732f,
+  0.549176633f, -0.835706294f,
+  0.550457954f, -0.834862888f,
+  0.551737964f, -0.834017515f,
+  0.553016722f, -0.833170176f,
+  0.554294109f, -0.832320869f,
+  0.555570245f, -0.831469595f,
+  0.556845009f, -0.830616415f,
+  0.558118522f, -0.829761207f,
+  0.559390724f, -0.828904092f,
+  0.560661554f, -0.82804507f,
+  0.561931133f, -0.827184021f,
+  0.563199341f, -0.826321065f,
+  0.564466238f, -0.825456142f,
+  0.565731823f, -0.824589312f,
+  0.566996038f, -0.823720515f,
+  0.568258941f, -0.82284981f,
+  0.569520533f, -0.821977139f,
+  0.570780754f, -0.8211025f,
+  0.572039604f, -0.820225954f,
+  0.573297143f, -0.819347501f,
+  0.57455337f, -0.81846714f,
+  0.575808167f, -0.817584813f,
+  0.577061653f, -0.816700578f,
+  0.578313768f, -0.815814435f,
+  0.579564571f, -0.814926326f,
+  0.580813944f, -0.81403631f,
+  0.582062006f, -0.813144386f,
+  0.583308637f, -0.812250614f,
+  0.584553957f, -0.811354876f,
+  0.585797846f, -0.81045717f,
+  0.587040365f, -0.809557617f,
+  0.588281572f, -0.808656156f,
+  0.589521289f, -0.807752848f,
+  0.590759695f, -0.806847572f,
+  0.59199667f, -0.80594039f,
+  0.593232274f, -0.805031359f,
+  0.594466507f, -0.804120362f,
+  0.59569931f, -0.803207517f,
+  0.596930683f, -0.802292824f,
+  0.598160684f, -0.801376164f,
+  0.599389315f, -0.800457656f,
+  0.600616455f, -0.799537241f,
+  0.601842225f, -0.798614979f,
+  0.603066623f, -0.797690868f,
+  0.604289532f, -0.796764791f,
+  0.605511069f, -0.795836926f,
+  0.606731117f, -0.794907153f,
+  0.607949793f, -0.793975472f,
+  0.609167039f, -0.793041945f,
+  0.610382795f, -0.792106569f,
+  0.61159718f, -0.791169345f,
+  0.612810075f, -0.790230215f,
+  0.61402154f, -0.789289236f,
+  0.615231574f, -0.78834641f,
+  0.616440177f, -0.787401736f,
+  0.61764729f, -0.786455214f,
+  0.618852973f, -0.785506845f,
+  0.620057225f, -0.784556568f,
+  0.621259987f, -0.783604503f,
+  0.622461259f, -0.78265059f,
+  0.623661101f, -0.781694829f,
+  0.624859512f, -0.780737221f,
+  0.626056373f, -0.779777765f,
+  0.627251804f, -0.778816521f,
+  0.628445745f, -0.777853429f,
+  0.629638255f, -0.77688849f,
+  0.630829215f, -0.775921702f,
+  0.632018745f, -0.774953127f,
+  0.633206785f, -0.773982704f,
+  0.634393275f, -0.773010433f,
+  0.635578334f, -0.772036374f,
+  0.636761844f, -0.771060526f,
+  0.637943923f, -0.770082831f,
+  0.639124453f, -0.769103348f,
+  0.640303493f, -0.768122017f,
+  0.641481042f, -0.767138898f,
+  0.642657042f, -0.766153991f,
+  0.643831551f, -0.765167236f,
+  0.645004511f, -0.764178753f,
+  0.64617604f, -0.763188422f,
+  0.64734596f, -0.762196302f,
+  0.64851439f, -0.761202395f,
+  0.64968133f, -0.760206699f,
+  0.65084666f, -0.759209216f,
+  0.65201056f, -0.758209884f,
+  0.653172851f, -0.757208824f,
+  0.654333591f, -0.756205976f,
+  0.655492842f, -0.755201399f,
+  0.656650543f, -0.754194975f,
+  0.657806695f, -0.753186822f,
+  0.658961296f, -0.752176821f,
+  0.660114348f, -0.751165152f,
+  0.66126585f, -0.750151634f,
+  0.662415802f, -0.749136388f,
+  0.663564146f, -0.748119354f,
+  0.664710999f, -0.747100592f,
+  0.665856242f, -0.746080101f,
+  0.666999936f, -0.745057762f,
+  0.668142021f, -0.744033754f,
+  0.669282615f, -0.743007958f,
+  0.670421541f, -0.741980433f,
+  0.671558976f, -0.740951121f,
+  0.672694743f, -0.73992008f,
+  0.673829019f, -0.73888731f,
+  0.674961627f, -0.737852812f,
+  0.676092684f, -0.736816585f,
+  0.677222192f, -0.73577857f,
+  0.678350031f, -0.734738886f,
+  0.679476321f, -0.733697414f,
+  0.680601001f, -0.732654274f,
+  0.681724072f, -0.731609404f,
+  0.682845533f, -0.730562747f,
+  0.683965385f, -0.72951442f,
+  0.685083687f, -0.728464365f,
+  0.686200321f, -0.727412641f,
+  0.687315345f, -0.726359129f,
+  0.68842876f, -0.725303948f,
+  0.689540565f, -0.724247098f,
+  0.690650702f, -0.72318846f,
+  0.691759229f, -0.722128212f,
+  0.692866147f, -0.721066177f,
+  0.693971455f, -0.720002532f,
+  0.695075095f, -0.718937099f,
+  0.696177125f, -0.717870057f,
+  0.697277486f, -0.716801286f,
+  0.698376238f, -0.715730846f,
+  0.699473321f, -0.714658678f,
+  0.700568795f, -0.71358484f,
+  0.7016626f, -0.712509394f,
+  0.702754736f, -0.711432219f,
+  0.703845263f, -0.710353374f,
+  0.704934061f, -0.709272802f,
+  0.706021249f, -0.70819062f,
+  0.707106769f, -0.707106769f,
+  0.70819062f, -0.706021249f,
+  0.709272802f, -0.704934061f,
+  0.710353374f, -0.703845263f,
+  0.711432219f, -0.702754736f,
+  0.712509394f, -0.7016626f,
+  0.71358484f, -0.700568795f,
+  0.714658678f, -0.699473321f,
+  0.715730846f, -0.698376238f,
+  0.716801286f, -0.697277486f,
+  0.717870057f, -0.696177125f,
+  0.718937099f, -0.695075095f,
+  0.720002532f, -0.693971455f,
+  0.721066177f, -0.692866147f,
+  0.722128212f, -0.691759229f,
+  0.72318846f, -0.690650702f,
+  0.724247098f, -0.689540565f,
+  0.725303948f, -0.68842876f,
+  0.726359129f, -0.687315345f,
+  0.727412641f, -0.686200321f,
+  0.728464365f, -0.685083687f,
+  0.72951442f, -0.683965385f,
+  0.730562747f, -0.682845533f,
+  0.731609404f, -0.681724072f,
+  0.732654274f, -0.680601001f,
+  0.733697414f, -0.679476321f,
+  0.734738886f, -0.678350031f,
+  0.73577857f, -0.677222192f,
+  0.736816585f, -0.676092684f,
+  0.737852812f, -0.674961627f,
+  0.73888731f, -0.673829019f,
+  0.73992008f, -0.672694743f,
+  0.740951121f, -0.671558976f,
+  0.741980433f, -0.670421541f,
+  0.743007958f, -0.669282615f,
+  0.744033754f, -0.668142021f,
+  0.745057762f, -0.666999936f,
+  0.746080101f, -0.665856242f,
+  0.747100592f, -0.664710999f,
+  0.748119354f, -0.663564146f,
+  0.749136388f, -0.662415802f,
+  0.750151634f, -0.66126585f,
+  0.751165152f, -0.660114348f,
+  0.752176821f, -0.658961296f,
+  0.753186822f, -0.657806695f,
+  0.754194975f, -0.656650543f,
+  0.755201399f, -0.655492842f,
+  0.756205976f, -0.654333591f,
+  0.757208824f, -0.653172851f,
+  0.758209884f, -0.65201056f,
+  0.759209216f, -0.65084666f,
+  0.760206699f, -0.64968133f,
+  0.761202395f, -0.64851439f,
+  0.762196302f, -0.64734596f,
+  0.763188422f, -0.64617604f,
+  0.764178753f, -0.645004511f,
+  0.765167236f, -0.643831551f,
+  0.766153991f, -0.642657042f,
+  0.767138898f, -0.641481042f,
+  0.768122017f, -0.640303493f,
+  0.769103348f, -0.639124453f,
+  0.770082831f, -0.637943923f,
+  0.771060526f, -0.636761844f,
+  0.772036374f, -0.635578334f,
+  0.773010433f, -0.634393275f,
+  0.773982704f, -0.633206785f,
+  0.774953127f, -0.632018745f,
+  0.775921702f, -0.630829215f,
+  0.77688849f, -0.629638255f,
+  0.777853429f, -0.628445745f,
+  0.778816521f, -0.627251804f,
+  0.779777765f, -0.626056373f,
+  0.780737221f, -0.624859512f,
+  0.781694829f, -0.623661101f,
+  0.78265059f, -0.622461259f,
+  0.783604503f, -0.621259987f,
+  0.784556568f, -0.620057225f,
+  0.785506845f, -0.618852973f,
+  0.786455214f, -0.61764729f,
+  0.787401736f, -0.616440177f,
+  0.78834641f, -0.615231574f,
+  0.789289236f, -0.61402154f,
+  0.790230215f, -0.612810075f,
+  0.791169345f, -0.61159718f,
+  0.792106569f, -0.610382795f,
+  0.793041945f, -0.609167039f,
+  0.793975472f, -0.607949793f,
+  0.794907153f, -0.606731117f,
+  0.795836926f, -0.605511069f,
+  0.796764791f, -0.604289532f,
+  0.797690868f, -0.603066623f,
+  0.798614979f, -0.601842225f,
+  0.799537241f, -0.600616455f,
+  0.800457656f, -0.599389315f,
+  0.801376164f, -0.598160684f,
+  0.802292824f, -0.596930683f,
+  0.803207517f, -0.59569931f,
+  0.804120362f, -0.594466507f,
+  0.805031359f, -0.593232274f,
+  0.80594039f, -0.59199667f,
+  0.806847572f, -0.590759695f,
+  0.807752848f, -0.589521289f,
+  0.808656156f, -0.588281572f,
+  0.809557617f, -0.587040365f,
+  0.81045717f, -0.585797846f,
+  0.811354876f, -0.584553957f,
+  0.812250614f, -0.583308637f,
+  0.813144386f, -0.582062006f,
+  0.81403631f, -0.580813944f,
+  0.814926326f, -0.579564571f,
+  0.815814435f, -0.578313768f,
+  0.816700578f, -0.577061653f,
+  0.817584813f, -0.575808167f,
+  0.81846714f, -0.57455337f,
+  0.819347501f, -0.573297143f,
+  0.820225954f, -0.572039604f,
+  0.8211025f, -0.570780754f,
+  0.821977139f, -0.569520533f,
+  0.82284981f, -0.568258941f,
+  0.823720515f, -0.566996038f,
+  0.824589312f, -0.565731823f,
+  0.825456142f, -0.564466238f,
+  0.826321065f, -0.563199341f,
+  0.827184021f, -0.561931133f,
+  0.82804507f, -0.560661554f,
+  0.828904092f, -0.559390724f,
+  0.829761207f, -0.558118522f,
+  0.830616415f, -0.556845009f,
+  0.831469595f, -0.555570245f,
+  0.832320869f, -0.554294109f,
+  0.833170176f, -0.553016722f,
+  0.834017515f, -0.551737964f,
+  0.834862888f, -0.550457954f,
+  0.835706294f, -0.549176633f,
+  0.836547732f, -0.547894061f,
+  0.837387204f, -0.546610177f,
+  0.838224709f, -0.545324981f,
+  0.839060247f, -0.544038534f,
+  0.839893818f, -0.542750776f,
+  0.840725362f, -0.541461766f,
+  0.841554999f, -0.540171444f,
+  0.84238261f, -0.538879931f,
+  0.843208253f, -0.537587047f,
+  0.84403187f, -0.53629297f,
+  0.84485358f, -0.534997642f,
+  0.845673263f, -0.533701003f,
+  0.84649092f, -0.532403111f,
+  0.847306609f, -0.531104028f,
+  0.848120332f, -0.529803634f,
+  0.848932028f, -0.528501987f,
+  0.849741757f, -0.527199149f,
+  0.850549459f, -0.525895f,
+  0.851355195f, -0.524589658f,
+  0.852158904f, -0.523283124f,
+  0.852960587f, -0.521975279f,
+  0.853760302f, -0.520666242f,
+  0.854557991f, -0.519356012f,
+  0.855353653f, -0.518044531f,
+  0.856147349f, -0.516731799f,
+  0.856938958f, -0.515417874f,
+  0.857728601f, -0.514102757f,
+  0.858516216f, -0.512786388f,
+  0.859301805f, -0.511468828f,
+  0.860085368f, -0.510150075f,
+  0.860866964f, -0.50883013f,
+  0.861646473f, -0.507508993f,
+  0.862423956f, -0.506186664f,
+  0.863199413f, -0.504863083f,
+  0.863972843f, -0.50353837f,
+  0.864744246f, -0.502212465f,
+  0.865513623f, -0.500885367f,
+  0.866280973f, -0.499557108f,
+  0.867046237f, -0.498227656f,
+  0.867809474f, -0.496897042f,
+  0.868570685f, -0.495565265f,
+  0.86932987f, -0.494232297f,
+  0.870086968f, -0.492898196f,
+  0.87084204f, -0.491562903f,
+  0.871595085f, -0.490226477f,
+  0.872346044f, -0.48888889f,
+  0.873094976f, -0.487550169f,
+  0.873841822f, -0.486210287f,
+  0.874586642f, -0.484869242f,
+  0.875329375f, -0.483527064f,
+  0.876070082f, -0.482183784f,
+  0.876808703f, -0.480839342f,
+  0.877545297f, -0.479493767f,
+  0.878279805f, -0.47814706f,
+  0.879012227f, -0.47679922f,
+  0.879742622f, -0.475450277f,
+  0.880470872f, -0.474100202f,
+  0.881197095f, -0.472749025f,
+  0.881921291f, -0.471396744f,
+  0.882643342f, -0.470043331f,
+  0.883363366f, -0.468688816f,
+  0.884081244f, -0.467333198f,
+  0.884797096f, -0.465976506f,
+  0.885510862f, -0.464618683f,
+  0.886222541f, -0.463259786f,
+  0.886932135f, -0.461899787f,
+  0.887639642f, -0.460538715f,
+  0.888345063f, -0.45917654f,
+  0.889048338f, -0.457813293f,
+  0.889749587f, -0.456448972f,
+  0.890448749f, -0.455083579f,
+  0.891145766f, -0.453717113f,
+  0.891840696f, -0.452349573f,
+  0.892533541f, -0.450980991f,
+  0.893224299f, -0.449611336f,
+  0.893912971f, -0.448240608f,
+  0.894599497f, -0.446868837f,
+  0.895283937f, -0.445496023f,
+  0.895966232f, -0.444122136f,
+  0.8966465f, -0.442747235f,
+  0.897324562f, -0.441371262f,
+  0.898000598f, -0.439994276f,
+  0.898674488f, -0.438616246f,
+  0.899346232f, -0.437237173f,
+  0.900015891f, -0.435857087f,
+  0.900683403f, -0.434475958f,
+  0.901348829f, -0.433093816f,
+  0.902012169f, -0.43171066f,
+  0.902673304f, -0.430326492f,
+  0.903332353f, -0.42894128f,
+  0.903989315f, -0.427555084f,
+  0.904644072f, -0.426167876f,
+  0.905296743f, -0.424779683f,
+  0.905947268f, -0.423390478f,
+  0.906595707f, -0.422000259f,
+  0.907242f, -0.420609087f,
+  0.907886088f, -0.419216901f,
+  0.90852809f, -0.417823702f,
+  0.909168005f, -0.416429549f,
+  0.909805715f, -0.415034413f,
+  0.910441279f, -0.413638324f,
+  0.911074758f, -0.41224122f,
+  0.91170603f, -0.410843164f,
+  0.912335157f, -0.409444153f,
+  0.912962198f, -0.408044159f,
+  0.913587034f, -0.406643212f,
+  0.914209783f, -0.405241311f,
+  0.914830327f, -0.403838456f,
+  0.915448725f, -0.402434647f,
+  0.916064978f, -0.401029885f,
+  0.916679084f, -0.399624199f,
+  0.917290986f, -0.398217559f,
+  0.917900801f, -0.396809995f,
+  0.91850841f, -0.395401478f,
+  0.919113874f, -0.393992037f,
+  0.919717133f, -0.392581671f,
+  0.920318305f, -0.391170382f,
+  0.920917213f, -0.38975817f,
+  0.921514034f, -0.388345033f,
+  0.92210865f, -0.386931002f,
+  0.92270112f, -0.385516047f,
+  0.923291445f, -0.384100199f,
+  0.923879504f, -0.382683426f,
+  0.924465477f, -0.381265759f,
+  0.925049245f, -0.379847199f,
+  0.925630808f, -0.378427744f,
+  0.926210225f, -0.377007425f,
+  0.926787496f, -0.375586182f,
+  0.927362502f, -0.374164075f,
+  0.927935421f, -0.372741073f,
+  0.928506076f, -0.371317208f,
+  0.929074585f, -0.369892448f,
+  0.929640889f, -0.368466824f,
+  0.930205047f, -0.367040336f,
+  0.93076694f, -0.365612984f,
+  0.931326687f, -0.364184797f,
+  0.931884289f, -0.362755716f,
+  0.932439625f, -0.3613258f,
+  0.932992816f, -0.359895051f,
+  0.933543801f, -0.358463407f,
+  0.934092522f, -0.357030958f,
+  0.934639156f, -0.355597675f,
+  0.935183525f, -0.354163527f,
+  0.935725689f, -0.352728546f,
+  0.936265647f, -0.351292759f,
+  0.93680346f, -0.349856138f,
+  0.937339008f, -0.348418683f,
+  0.93787235f, -0.346980423f,
+  0.938403547f, -0.345541328f,
+  0.938932478f, -0.344101429f,
+  0.939459205f, -0.342660725f,
+  0.939983726f, -0.341219217f,
+  0.940506041f, -0.339776874f,
+  0.941026151f, -0.338333756f,
+  0.941544056f, -0.336889863f,
+  0.942059755f, -0.335445136f,
+  0.94257319f, -0.333999664f,
+  0.943084419f, -0.332553357f,
+  0.943593442f, -0.331106305f,
+  0.944100261f, -0.329658449f,
+  0.944604814f, -0.328209847f,
+  0.945107222f, -0.326760441f,
+  0.945607305f, -0.32531029f,
+  0.946105242f, -0.323859364f,
+  0.946600914f, -0.322407693f,
+  0.947094381f, -0.320955247f,
+  0.947585583f, -0.319502026f,
+  0.948074579f, -0.31804809f,
+  0.94856137f, -0.316593379f,
+  0.949045897f, -0.315137923f,
+  0.949528158f, -0.313681751f,
+  0.950008273f, -0.312224805f,
+  0.950486064f, -0.310767144f,
+  0.950961649f, -0.309308767f,
+  0.95143503f, -0.307849646f,
+  0.951906145f, -0.306389809f,
+  0.952374995f, -0.304929227f,
+  0.95284164f, -0.303467959f,
+  0.953306019f, -0.302005947f,
+  0.953768194f, -0.300543249f,
+  0.954228103f, -0.299079835f,
+  0.954685748f, -0.297615707f,
+  0.955141187f, -0.296150893f,
+  0.955594361f, -0.294685364f,
+  0.95604527f, -0.293219149f,
+  0.956493914f, -0.291752249f,
+  0.956940353f, -0.290284663f,
+  0.957384527f, -0.288816422f,
+  0.957826436f, -0.287347466f,
+  0.958266079f, -0.285877824f,
+  0.958703458f, -0.284407526f,
+  0.959138632f, -0.282936573f,
+  0.95957154f, -0.281464934f,
+  0.960002124f, -0.27999264f,
+  0.960430503f, -0.27851969f,
+  0.960856616f, -0.277046084f,
+  0.961280465f, -0.275571823f,
+  0.961702049f, -0.274096906f,
+  0.962121427f, -0.272621363f,
+  0.962538481f, -0.271145165f,
+  0.962953269f, -0.269668311f,
+  0.963365793f, -0.268190861f,
+  0.963776052f, -0.266712755f,
+  0.964184046f, -0.265234023f,
+  0.964589775f, -0.263754666f,
+  0.964993238f, -0.262274712f,
+  0.965394437f, -0.260794103f,
+  0.965793371f, -0.259312928f,
+  0.966189981f, -0.257831097f,
+  0.966584384f, -0.25634867f,
+  0.966976464f, -0.254865646f,
+  0.967366278f, -0.253382027f,
+  0.967753828f, -0.251897812f,
+  0.968139112f, -0.250413001f,
+  0.968522072f, -0.248927608f,
+  0.968902826f, -0.24744162f,
+  0.969281256f, -0.24595505f,
+  0.969657362f, -0.244467899f,
+  0.970031261f, -0.242980182f,
+  0.970402837f, -0.241491884f,
+  0.970772147f, -0.24000302f,
+  0.971139133f, -0.238513589f,
+  0.971503913f, -0.237023607f,
+  0.97186631f, -0.235533059f,
+  0.972226501f, -0.234041959f,
+  0.972584367f, -0.232550308f,
+  0.972939968f, -0.231058106f,
+  0.973293245f, -0.229565367f,
+  0.973644257f, -0.228072077f,
+  0.973992944f, -0.226578265f,
+  0.974339366f, -0.225083917f,
+  0.974683523f, -0.223589033f,
+  0.975025356f, -0.222093627f,
+  0.975364864f, -0.220597684f,
+  0.975702107f, -0.219101235f,
+  0.976037085f, -0.21760428f,
+  0.976369739f, -0.216106802f,
+  0.976700068f, -0.214608818f,
+  0.977028131f, -0.213110313f,
+  0.977353871f, -0.211611331f,
+  0.977677345f, -0.210111842f,
+  0.977998495f, -0.208611846f,
+  0.97831738f, -0.207111374f,
+  0.97863394f, -0.205610409f,
+  0.978948176f, -0.204108968f,
+  0.979260147f, -0.202607036f,
+  0.979569793f, -0.201104641f,
+  0.979877114f, -0.199601755f,
+  0.980182111f, -0.198098406f,
+  0.980484843f, -0.196594596f,
+  0.980785251f, -0.195090324f,
+  0.981083393f, -0.19358559f,
+  0.981379211f, -0.192080393f,
+  0.981672704f, -0.19057475f,
+  0.981963873f, -0.18906866f,
+  0.982252717f, -0.187562123f,
+  0.982539296f, -0.186055154f,
+  0.982823551f, -0.184547737f,
+  0.983105481f, -0.183039889f,
+  0.983385086f, -0.181531608f,
+  0.983662426f, -0.180022895f,
+  0.983937442f, -0.178513765f,
+  0.984210074f, -0.177004218f,
+  0.984480441f, -0.175494254f,
+  0.984748483f, -0.173983872f,
+  0.98501426f, -0.172473088f,
+  0.985277653f, -0.170961887f,
+  0.985538721f, -0.169450298f,
+  0.985797524f, -0.167938292f,
+  0.986053944f, -0.166425899f,
+  0.986308098f, -0.164913118f,
+  0.986559927f, -0.16339995f,
+  0.986809373f, -0.161886394f,
+  0.987056553f, -0.160372451f,
+  0.987301409f, -0.15885815f,
+  0.987543941f, -0.157343462f,
+  0.987784147f, -0.155828401f,
+  0.988022029f, -0.154312968f,
+  0.988257587f, -0.152797192f,
+  0.98849082f, -0.151281044f,
+  0.988721669f, -0.149764538f,
+  0.988950253f, -0.148247674f,
+  0.989176512f, -0.146730468f,
+  0.989400446f, -0.145212919f,
+  0.989621997f, -0.143695027f,
+  0.989841282f, -0.142176807f,
+  0.990058184f, -0.140658244f,
+  0.99027282f, -0.139139339f,
+  0.990485072f, -0.137620121f,
+  0.990695f, -0.136100575f,
+  0.990902662f, -0.134580702f,
+  0.991107941f, -0.13306053f,
+  0.991310835f, -0.13154003f,
+  0.991511464f, -0.130019218f,
+  0.991709769f, -0.128498107f,
+  0.991905689f, -0.126976699f,
+  0.992099285f, -0.125454977f,
+  0.992290616f, -0.123932973f,
+  0.992479563f, -0.122410677f,
+  0.992666125f, -0.120888084f,
+  0.992850423f, -0.119365215f,
+  0.993032336f, -0.117842063f,
+  0.993211925f, -0.116318628f,
+  0.993389189f, -0.114794925f,
+  0.993564129f, -0.113270953f,
+  0.993736744f, -0.111746714f,
+  0.993906975f, -0.110222206f,
+  0.994074881f, -0.108697444f,
+  0.994240463f, -0.107172422f,
+  0.99440366f, -0.105647154f,
+  0.994564593f, -0.104121633f,
+  0.994723141f, -0.102595866f,
+  0.994879305f, -0.10106986f,
+  0.995033205f, -0.0995436162f,
+  0.99518472f, -0.0980171412f,
+  0.99533391f, -0.0964904279f,
+  0.995480776f, -0.0949634984f,
+  0.995625257f, -0.093436338f,
+  0.995767415f, -0.0919089541f,
+  0.995907247f, -0.0903813615f,
+  0.996044695f, -0.0888535529f,
+  0.996179819f, -0.0873255357f,
+  0.996312618f, -0.0857973099f,
+  0.996443033f, -0.0842688903f,
+  0.996571124f, -0.0827402622f,
+  0.996696889f, -0.0812114477f,
+  0.996820271f, -0.0796824396f,
+  0.996941328f, -0.0781532452f,
+  0.997060061f, -0.0766238645f,
+  0.997176409f, -0.0750942975f,
+  0.997290432f, -0.0735645667f,
+  0.997402132f, -0.0720346496f,
+  0.997511446f, -0.070504576f,
+  0.997618437f, -0.068974331f,
+  0.997723043f, -0.0674439222f,
+  0.997825325f, -0.0659133494f,
+  0.997925282f, -0.0643826276f,
+  0.998022854f, -0.0628517568f,
+  0.998118103f, -0.061320737f,
+  0.998211026f, -0.0597895719f,
+  0.998301566f, -0.0582582653f,
+  0.998389721f, -0.0567268208f,
+  0.998475552f, -0.0551952459f,
+  0.998559058f, -0.0536635369f,
+  0.998640239f, -0.052131705f,
+  0.998719037f, -0.0505997501f,
+  0.99879545f, -0.0490676761f,
+  0.998869538f, -0.0475354828f,
+  0.998941302f, -0.0460031815f,
+  0.999010682f, -0.0444707721f,
+  0.999077737f, -0.0429382585f,
+  0.999142408f, -0.0414056405f,
+  0.999204755f, -0.0398729257f,
+  0.999264777f, -0.0383401215f,
+  0.999322355f, -0.0368072242f,
+  0.999377668f, -0.0352742374f,
+  0.999430597f, -0.0337411724f,
+  0.999481201f, -0.0322080255f,
+  0.999529421f, -0.030674804f,
+  0.999575317f, -0.029141508f,
+  0.999618828f, -0.027608145f,
+  0.999660015f, -0.0260747187f,
+  0.999698818f, -0.024541229f,
+  0.999735296f, -0.0230076816f,
+  0.99976939f, -0.0214740802f,
+  0.999801159f, -0.0199404284f,
+  0.999830604f, -0.0184067301f,
+  0.999857664f, -0.0168729872f,
+  0.99988234f, -0.015339206f,
+  0.999904692f, -0.0138053885f,
+  0.999924719f, -0.0122715384f,
+  0.999942362f, -0.0107376594f,
+  0.999957621f, -0.00920375437f,
+  0.999970615f, -0.00766982883f,
+  0.999981165f, -0.00613588467f,
+  0.99998939f, -0.00460192608f,
+  0.999995291f, -0.00306795677f,
+  0.999998808f, -0.00153398013f,
+};
+
+void fft16(float *input, int stride_in, float *output, int stride_out)
+{
+  float t0 = input[0] + input[8*stride_in];
+  float t1 = input[1] + input[8*stride_in+1];
+  float t2 = input[0] - input[8*stride_in];
+  float t3 = input[1] - input[8*stride_in+1];
+  float t4 = input[4*stride_in] + input[12*stride_in];
+  float t5 = input[4*stride_in+1] + input[12*stride_in+1];
+  float t6 = input[4*stride_in] - input[12*stride_in];
+  float t7 = input[4*stride_in+1] - input[12*stride_in+1];
+  float t8 = t0 + t4;
+  float t9 = t1 + t5;
+  float t10 = t0 - t4;
+  float t11 = t1 - t5;
+  float t12 = t2 + t7;
+  float t13 = t3 - t6;
+  float t14 = t2 - t7;
+  float t15 = t3 + t6;
+  float t16 = input[2*stride_in] + input[10*stride_in];
+  float t17 = input[2*stride_in+1] + input[10*stride_in+1];
+  float t18 = input[2*stride_in] - input[10*stride_in];
+  float t19 = input[2*stride_in+1] - input[10*stride_in+1];
+  float t20 = input[6*stride_in] + input[14*stride_in];
+  float t21 = input[6*stride_in+1] + input[14*stride_in+1];
+  float t22 = input[6*stride_in] - input[14*stride_in];
+  float t23 = input[6*stride_in+1] - input[14*stride_in+1];
+  float t24 = t16 + t20;
+  float t25 = t17 + t21;
+  float t26 = t16 - t20;
+  float t27 = t17 - t21;
+  float t28 = t8 + t24;
+  float t29 = t9 + t25;
+  float t30 = t8 - t24;
+  float t31 = t9 - t25;
+  float t32 = t10 + t27;
+  float t33 = t11 - t26;
+  float t34 = t10 - t27;
+  float t35 = t11 + t26;
+  float t36 = (t18 + t19) * 0.707106769f;
+  float t37 = (t19 - t18) * 0.707106769f;
+  float t38 = (t23 - t22) * 0.707106769f;
+  float t39 = -(t22 + t23) * 0.707106769f;
+  float t40 = t36 + t38;
+  float t41 = t37 + t39;
+  float t42 = t36 - t38;
+  float t43 = t37 - t39;
+  float t44 = t12 + t40;
+  float t45 = t13 + t41;
+  float t46 = t12 - t40;
+  float t47 = t13 - t41;
+  float t48 = t14 + t43;
+  float t49 = t15 - t42;
+  float t50 = t14 - t43;
+  float t51 = t15 + t42;
+  float t52 = input[1*stride_in] + input[9*stride_in];
+  float t53 = input[1*stride_in+1] + input[9*stride_in+1];
+  float t54 = input[1*stride_in] - input[9*stride_in];
+  float t55 = input[1*stride_in+1] - input[9*stride_in+1];
+  float t56 = input[5*stride_in] + input[13*stride_in];
+  float t57 = input[5*stride_in+1] + input[13*stride_in+1];
+  float t58 = input[5*stride_in] - input[13*stride_in];
+  float t59 = input[5*stride_in+1] - input[13*stride_in+1];
+  float t60 = t52 + t56;
+  float t61 = t53 + t57;
+  float t62 = t52 - t56;
+  float t63 = t53 - t57;
+  float t64 = t54 + t59;
+  float t65 = t55 - t58;
+  float t66 = t54 - t59;
+  float t67 = t55 + t58;
+  float t68 = input[3*stride_in] + input[11*stride_in];
+  float t69 = input[3*stride_in+1] + input[11*stride_in+1];
+  float t70 = input[3*stride_in] - input[11*stride_in];
+  float t71 = input[3*stride_in+1] - input[11*stride_in+1];
+  float t72 = input[7*stride_in] + input[15*stride_in];
+  float t73 = input[7*stride_in+1] + input[15*stride_in+1];
+  float t74 = input[7*stride_in] - input[15*stride_in];
+  float t75 = input[7*stride_in+1] - input[15*stride_in+1];
+  float t76 = t68 + t72;
+  float t77 = t69 + t73;
+  float t78 = t68 - t72;
+  float t79 = t69 - t73;
+  float t80 = t70 + t75;
+  float t81 = t71 - t74;
+  float t82 = t70 - t75;
+  float t83 = t71 + t74;
+  float t84 = t60 + t76;
+  float t85 = t61 + t77;
+  float t86 = t60 - t76;
+  float t87 = t61 - t77;
+  float t88 = t28 + t84;
+  float t89 = t29 + t85;
+  float t90 = t28 - t84;
+  float t91 = t29 - t85;
+  float t92 = t30 + t87;
+  float t93 = t31 - t86;
+  float t94 = t30 - t87;
+  float t95 = t31 + t86;
+  float t96 = 0.923879504f * t64 + 0.382683426f * t65;
+  float t97 = 0.923879504f * t65 - 0.382683426f * t64;
+  float t98 = 0.382683426f * t80 + 0.923879504f * t81;
+  float t99 = 0.382683426f * t81 - 0.923879504f * t80;
+  float t100 = t96 + t98;
+  float t101 = t97 + t99;
+  float t102 = t96 - t98;
+  float t103 = t97 - t99;
+  float t104 = t44 + t100;
+  float t105 = t45 + t101;
+  float t106 = t44 - t100;
+  float t107 = t45 - t101;
+  float t108 = t46 + t103;
+  float t109 = t47 - t102;
+  float t110 = t46 - t103;
+  float t111 = t47 + t102;
+  float t112 = (t62 + t63) * 0.707106769f;
+  float t113 = (t63 - t62) * 0.707106769f;
+  float t114 = (t79 - t78) * 0.707106769f;
+  float t115 = -(t78 + t79) * 0.707106769f;
+  float t116 = t112 + t114;
+  float t117 = t113 + t115;
+  float t118 = t112 - t114;
+  float t119 = t113 - t115;
+  float t120 = t32 + t116;
+  float t121 = t33 + t117;
+  float t122 = t32 - t116;
+  float t123 = t33 - t117;
+  float t124 = t34 + t119;
+  float t125 = t35 - t118;
+  float t126 = t34 - t119;
+  float t127 = t35 + t118;
+  float t128 = 0.382683426f * t66 + 0.923879504f * t67;
+  float t129 = 0.382683426f * t67 - 0.923879504f * t66;
+  float t130 = -0.923879504f * t82 + -0.382683426f * t83;
+  float t131 = -0.923879504f * t83 - -0.382683426f * t82;
+  float t132 = t128 + t130;
+  float t133 = t129 + t131;
+  float t134 = t128 - t130;
+  float t135 = t129 - t131;
+  float t136 = t48 + t132;
+  float t137 = t49 + t133;
+  float t138 = t48 - t132;
+  float t139 = t49 - t133;
+  float t140 = t50 + t135;
+  float t141 = t51 - t134;
+  float t142 = t50 - t135;
+  float t143 = t51 + t134;
+
+  output[0] = t88;
+  output[0+1] = t89;
+  output[1*stride_out] = t104;
+  output[1*stride_out+1] = t105;
+  output[2*stride_out] = t120;
+  output[2*stride_out+1] = t121;
+  output[3*stride_out] = t136;
+  output[3*stride_out+1] = t137;
+  output[4*stride_out] = t92;
+  output[4*stride_out+1] = t93;
+  output[5*stride_out] = t108;
+  output[5*stride_out+1] = t109;
+  output[6*stride_out] = t124;
+  output[6*stride_out+1] = t125;
+  output[7*stride_out] = t140;
+  output[7*stride_out+1] = t141;
+  output[8*stride_out] = t90;
+  output[8*stride_out+1] = t91;
+  output[9*stride_out] = t106;
+  output[9*stride_out+1] = t107;
+  output[10*stride_out] = t122;
+  output[10*stride_out+1] = t123;
+  output[11*stride_out] = t138;
+  output[11*stride_out+1] = t139;
+  output[12*stride_out] = t94;
+  output[12*stride_out+1] = t95;
+  output[13*stride_out] = t110;
+  output[13*stride_out+1] = t111;
+  output[14*stride_out] = t126;
+  output[14*stride_out+1] = t127;
+  output[15*stride_out] = t142;
+  output[15*stride_out+1] = t143;
+}
+
+void fft32(float *input, int stride_in, float *output, int stride_out)
+{
+  float t0 = input[0] + input[16*stride_in];
+  float t1 = input[1] + input[16*stride_in+1];
+  float t2 = input[0] - input[16*stride_in];
+  float t3 = input[1] - input[16*stride_in+1];
+  float t4 = input[8*stride_in] + input[24*stride_in];
+  float t5 = input[8*stride_in+1] + input[24*stride_in+1];
+  float t6 = input[8*stride_in] - input[24*stride_in];
+  float t7 = input[8*stride_in+1] - input[24*stride_in+1];
+  float t8 = t0 + t4;
+  float t9 = t1 + t5;
+  float t10 = t0 - t4;
+  float t11 = t1 - t5;
+  float t12 = t2 + t7;
+  float t13 = t3 - t6;
+  float t14 = t2 - t7;
+  float t15 = t3 + t6;
+  float t16 = input[4*stride_in] + input[20*stride_in];
+  float t17 = input[4*stride_in+1] + input[20*stride_in+1];
+  float t18 = input[4*stride_in] - input[20*stride_in];
+  float t19 = input[4*stride_in+1] - input[20*stride_in+1];
+  float t20 = input[12*stride_in] + input[28*stride_in];
+  float t21 = input[12*stride_in+1] + input[28*stride_in+1];
+  float t22 = input[12*stride_in] - input[28*stride_in];
+  float t23 = input[12*stride_in+1] - input[28*stride_in+1];
+  float t24 = t16 + t20;
+  float t25 = t17 + t21;
+  float t26 = t16 - t20;
+  float t27 = t17 - t21;
+  float t28 = t8 + t24;
+  float t29 = t9 + t25;
+  float t30 = t8 - t24;
+  float t31 = t9 - t25;
+  float t32 = t10 + t27;
+  float t33 = t11 - t26;
+  float t34 = t10 - t27;
+  float t35 = t11 + t26;
+  float t36 = (t18 + t19) * 0.707106769f;
+  float t37 = (t19 - t18) * 0.707106769f;
+  float t38 = (t23 - t22) * 0.707106769f;
+  float t39 = -(t22 + t23) * 0.707106769f;
+  float t40 = t36 + t38;
+  float t41 = t37 + t39;
+  float t42 = t36 - t38;
+  float t43 = t37 - t39;
+  float t44 = t12 + t40;
+  float t45 = t13 + t41;
+  float t46 = t12 - t40;
+  float t47 = t13 - t41;
+  float t48 = t14 + t43;
+  float t49 = t15 - t42;
+  float t50 = t14 - t43;
+  float t51 = t15 + t42;
+  float t52 = input[2*stride_in] + input[18*stride_in];
+  float t53 = input[2*stride_in+1] + input[18*stride_in+1];
+  float t54 = input[2*stride_in] - input[18*stride_in];
+  float t55 = input[2*stride_in+1] - input[18*stride_in+1];
+  float t56 = input[10*stride_in] + input[26*stride_in];
+  float t57 = input[10*stride_in+1] + input[26*stride_in+1];
+  float t58 = input[10*stride_in] - input[26*stride_in];
+  float t59 = input[10*stride_in+1] - input[26*stride_in+1];
+  float t60 = t52 + t56;
+  float t61 = t53 + t57;
+  float t62 = t52 - t56;
+  float t63 = t53 - t57;
+  float t64 = t54 + t59;
+  float t65 = t55 - t58;
+  float t66 = t54 - t59;
+  float t67 = t55 + t58;
+  float t68 = input[6*stride_in] + input[22*stride_in];
+  float t69 = input[6*stride_in+1] + input[22*stride_in+1];
+  float t70 = input[6*stride_in] - input[22*stride_in];
+  float t71 = input[6*stride_in+1] - input[22*stride_in+1];
+  float t72 = input[14*stride_in] + input[30*stride_in];
+  float t73 = input[14*stride_in+1] + input[30*stride_in+1];
+  float t74 = input[14*stride_in] - input[30*stride_in];
+  float t75 = input[14*stride_in+1] - input[30*stride_in+1];
+  float t76 = t68 + t72;
+  float t77 = t69 + t73;
+  float t78 = t68 - t72;
+  float t79 = t69 - t73;
+  float t80 = t70 + t75;
+  float t81 = t71 - t74;
+  float t82 = t70 - t75;
+  float t83 = t71 + t74;
+  float t84 = t60 + t76;
+  float t85 = t61 + t77;
+  float t86 = t60 - t76;
+  float t87 = t61 - t77;
+  float t88 = t28 + t84;
+  float t89 = t29 + t85;
+  float t90 = t28 - t84;
+  float t91 = t29 - t85;
+  float t92 = t30 + t87;
+  float t93 = t31 - t86;
+  float t94 = t30 - t87;
+  float t95 = t31 + t86;
+  float t96 = 0.923879504f * t64 + 0.382683426f * t65;
+  float t97 = 0.923879504f * t65 - 0.382683426f * t64;
+  float t98 = 0.382683426f * t80 + 0.923879504f * t81;
+  float t99 = 0.382683426f * t81 - 0.923879504f * t80;
+  float t100 = t96 + t98;
+  float t101 = t97 + t99;
+  float t102 = t96 - t98;
+  float t103 = t97 - t99;
+  float t104 = t44 + t100;
+  float t105 = t45 + t101;
+  float t106 = t44 - t100;
+  float t107 = t45 - t101;
+  float t108 = t46 + t103;
+  float t109 = t47 - t102;
+  float t110 = t46 - t103;
+  float t111 = t47 + t102;
+  float t112 = (t62 + t63) * 0.707106769f;
+  float t113 = (t63 - t62) * 0.707106769f;
+  float t114 = (t79 - t78) * 0.707106769f;
+  float t115 = -(t78 + t79) * 0.707106769f;
+  float t116 = t112 + t114;
+  float t117 = t113 + t115;
+  float t118 = t112 - t114;
+  float t119 = t113 - t115;
+  float t120 = t32 + t116;
+  float t121 = t33 + t117;
+  float t122 = t32 - t116;
+  float t123 = t33 - t117;
+  float t124 = t34 + t119;
+  float t125 = t35 - t118;
+  float t126 = t34 - t119;
+  float t127 = t35 + t118;
+  float t128 = 0.382683426f * t66 + 0.923879504f * t67;
+  float t129 = 0.382683426f * t67 - 0.923879504f * t66;
+  float t130 = -0.923879504f * t82 + -0.382683426f * t83;
+  float t131 = -0.923879504f * t83 - -0.382683426f * t82;
+  float t132 = t128 + t130;
+  float t133 = t129 + t131;
+  float t134 = t128 - t130;
+  float t135 = t129 - t131;
+  float t136 = t48 + t132;
+  float t137 = t49 + t133;
+  float t138 = t48 - t132;
+  float t139 = t49 - t133;
+  float t140 = t50 + t135;
+  float t141 = t51 - t134;
+  float t142 = t50 - t135;
+  float t143 = t51 + t134;
+  float t144 = input[1*stride_in] + input[17*stride_in];
+  float t145 = input[1*stride_in+1] + input[17*stride_in+1];
+  float t146 = input[1*stride_in] - input[17*stride_in];
+  float t147 = input[1*stride_in+1] - input[17*stride_in+1];
+  float t148 = input[9*stride_in] + input[25*stride_in];
+  float t149 = input[9*stride_in+1] + input[25*stride_in+1];
+  float t150 = input[9*stride_in] - input[25*stride_in];
+  float t151 = input[9*stride_in+1] - input[25*stride_in+1];
+  float t152 = t144 + t148;
+  float t153 = t145 + t149;
+  float t154 = t144 - t148;
+  float t155 = t145 - t149;
+  float t156 = t146 + t151;
+  float t157 = t147 - t150;
+  float t158 = t146 - t151;
+  float t159 = t147 + t150;
+  float t160 = input[5*stride_in] + input[21*stride_in];
+  float t161 = input[5*stride_in+1] + input[21*stride_in+1];
+  float t162 = input[5*stride_in] - input[21*stride_in];
+  float t163 = input[5*stride_in+1] - input[21*stride_in+1];
+  float t164 = input[13*stride_in] + input[29*stride_in];
+  float t165 = input[13*stride_in+1] + input[29*stride_in+1];
+  float t166 = input[13*stride_in] - input[29*stride_in];
+  float t167 = input[13*stride_in+1] - input[29*stride_in+1];
+  float t168 = t160 + t164;
+  float t169 = t161 + t165;
+  float t170 = t160 - t164;
+  float t171 = t161 - t165;
+  float t172 = t152 + t168;
+  float t173 = t153 + t169;
+  float t174 = t152 - t168;
+  float t175 = t153 - t169;
+  float t176 = t154 + t171;
+  float t177 = t155 - t170;
+  float t178 = t154 - t171;
+  float t179 = t155 + t170;
+  float t180 = (t162 + t163) * 0.707106769f;
+  float t181 = (t163 - t162) * 0.707106769f;
+  float t182 = (t167 - t166) * 0.707106769f;
+  float t183 = -(t166 + t167) * 0.707106769f;
+  float t184 = t180 + t182;
+  float t185 = t181 + t183;
+  float t186 = t180 - t182;
+  float t187 = t181 - t183;
+  float t188 = t156 + t184;
+  float t189 = t157 + t185;
+  float t190 = t156 - t184;
+  float t191 = t157 - t185;
+  float t192 = t158 + t187;
+  float t193 = t159 - t186;
+  float t194 = t158 - t187;
+  float t195 = t159 + t186;
+  float t196 = input[3*stride_in] + input[19*stride_in];
+  float t197 = input[3*stride_in+1] + input[19*stride_in+1];
+  float t198 = input[3*stride_in] - input[19*stride_in];
+  float t199 = input[3*stride_in+1] - input[19*stride_in+1];
+  float t200 = input[11*stride_in] + input[27*stride_in];
+  float t201 = input[11*stride_in+1] + input[27*stride_in+1];
+  float t202 = input[11*stride_in] - input[27*stride_in];
+  float t203 = input[11*stride_in+1] - input[27*stride_in+1];
+  float t204 = t196 + t200;
+  float t205 = t197 + t201;
+  float t206 = t196 - t200;
+  float t207 = t197 - t201;
+  float t208 = t198 + t203;
+  float t209 = t199 - t202;
+  float t210 = t198 - t203;
+  float t211 = t199 + t202;
+  float t212 = input[7*stride_in] + input[23*stride_in];
+  float t213 = input[7*stride_in+1] + input[23*stride_in+1];
+  float t214 = input[7*stride_in] - input[23*stride_in];
+  float t215 = input[7*stride_in+1] - input[23*stride_in+1];
+  float t216 = input[15*stride_in] + input[31*stride_in];
+  float t217 = input[15*stride_in+1] + input[31*stride_in+1];
+  float t218 = input[15*stride_in] - input[31*stride_in];
+  float t219 = input[15*stride_in+1] - input[31*stride_in+1];
+  float t220 = t212 + t216;
+  float t221 = t213 + t217;
+  float t222 = t212 - t216;
+  float t223 = t213 - t217;
+  float t224 = t204 + t220;
+  float t225 = t205 + t221;
+  float t226 = t204 - t220;
+  float t227 = t205 - t221;
+  float t228 = t206 + t223;
+  float t229 = t207 - t222;
+  float t230 = t206 - t223;
+  float t231 = t207 + t222;
+  float t232 = (t214 + t215) * 0.707106769f;
+  float t233 = (t215 - t214) * 0.707106769f;
+  float t234 = (t219 - t218) * 0.707106769f;
+  float t235 = -(t218 + t219) * 0.707106769f;
+  float t236 = t232 + t234;
+  float t237 = t233 + t235;
+  float t238 = t232 - t234;
+  float t239 = t233 - t235;
+  float t240 = t208 + t236;
+  float t241 = t209 + t237;
+  float t242 = t208 - t236;
+  float t243 = t209 - t237;
+  float t244 = t210 + t239;
+  float t245 = t211 - t238;
+  float t246 = t210 - t239;
+  float t247 = t211 + t238;
+  float t248 = t172 + t224;
+  float t249 = t173 + t225;
+  float t250 = t172 - t224;
+  float t251 = t173 - t225;
+  float t252 = t88 + t248;
+  float t253 = t89 + t249;
+  float t254 = t88 - t248;
+  float t255 = t89 - t249;
+  float t256 = t90 + t251;
+  float t257 = t91 - t250;
+  float t258 = t90 - t251;
+  float t259 = t91 + t250;
+  float t260 = 0.980785251f * t188 + 0.195090324f * t189;
+  float t261 = 0.980785251f * t189 - 0.195090324f * t188;
+  float t262 = 0.831469595f * t240 + 0.555570245f * t241;
+  float t263 = 0.831469595f * t241 - 0.555570245f * t240;
+  float t264 = t260 + t262;
+  float t265 = t261 + t263;
+  float t266 = t260 - t262;
+  float t267 = t261 - t263;
+  float t268 = t104 + t264;
+  float t269 = t105 + t265;
+  float t270 = t104 - t264;
+  float t271 = t105 - t265;
+  float t272 = t106 + t267;
+  float t273 = t107 - t266;
+  float t274 = t106 - t267;
+  float t275 = t107 + t266;
+  float t276 = 0.923879504f * t176 + 0.382683426f * t177;
+  float t277 = 0.923879504f * t177 - 0.382683426f * t176;
+  float t278 = 0.382683426f * t228 + 0.923879504f * t229;
+  float t279 = 0.382683426f * t229 - 0.923879504f * t228;
+  float t280 = t276 + t278;
+  float t281 = t277 + t279;
+  float t282 = t276 - t278;
+  float t283 = t277 - t279;
+  float t284 = t120 + t280;
+  float t285 = t121 + t281;
+  float t286 = t120 - t280;
+  float t287 = t121 - t281;
+  float t288 = t122 + t283;
+  float t289 = t123 - t282;
+  float t290 = t122 - t283;
+  float t291 = t123 + t282;
+  float t292 = 0.831469595f * t192 + 0.555570245f * t193;
+  float t293 = 0.831469595f * t193 - 0.555570245f * t192;
+  float t294 = -0.195090324f * t244 + 0.980785251f * t245;
+  float t295 = -0.195090324f * t245 - 0.980785251f * t244;
+  float t296 = t292 + t294;
+  float t297 = t293 + t295;
+  float t298 = t292 - t294;
+  float t299 = t293 - t295;
+  float t300 = t136 + t296;
+  float t301 = t137 + t297;
+  float t302 = t136 - t296;
+  float t303 = t137 - t297;
+  float t304 = t138 + t299;
+  float t305 = t139 - t298;
+  float t306 = t138 - t299;
+  float t307 = t139 + t298;
+  float t308 = (t174 + t175) * 0.707106769f;
+  float t309 = (t175 - t174) * 0.707106769f;
+  float t310 = (t227 - t226) * 0.707106769f;
+  float t311 = -(t226 + t227) * 0.707106769f;
+  float t312 = t308 + t310;
+  float t313 = t309 + t311;
+  float t314 = t308 - t310;
+  float t315 = t309 - t311;
+  float t316 = t92 + t312;
+  float t317 = t93 + t313;
+  float t318 = t92 - t312;
+  float t319 = t93 - t313;
+  float t320 = t94 + t315;
+  float t321 = t95 - t314;
+  float t322 = t94 - t315;
+  float t323 = t95 + t314;
+  float t324 = 0.555570245f * t190 + 0.831469595f * t191;
+  float t325 = 0.555570245f * t191 - 0.831469595f * t190;
+  float t326 = -0.980785251f * t242 + 0.195090324f * t243;
+  float t327 = -0.980785251f * t243 - 0.195090324f * t242;
+  float t328 = t324 + t326;
+  float t329 = t325 + t327;
+  float t330 = t324 - t326;
+  float t331 = t325 - t327;
+  float t332 = t108 + t328;
+  float t333 = t109 + t329;
+  float t334 = t108 - t328;
+  float t335 = t109 - t329;
+  float t336 = t110 + t331;
+  float t337 = t111 - t330;
+  float t338 = t110 - t331;
+  float t339 = t111 + t330;
+  float t340 = 0.382683426f * t178 + 0.923879504f * t179;
+  float t341 = 0.382683426f * t179 - 0.923879504f * t178;
+  float t342 = -0.923879504f * t230 + -0.382683426f * t231;
+  float t343 = -0.923879504f * t231 - -0.382683426f * t230;
+  float t344 = t340 + t342;
+  float t345 = t341 + t343;
+  float t346 = t340 - t342;
+  float t347 = t341 - t343;
+  float t348 = t124 + t344;
+  float t349 = t125 + t345;
+  float t350 = t124 - t344;
+  float t351 = t125 - t345;
+  float t352 = t126 + t347;
+  float t353 = t127 - t346;
+  float t354 = t126 - t347;
+  float t355 = t127 + t346;
+  float t356 = 0.195090324f * t194 + 0.980785251f * t195;
+  float t357 = 0.195090324f * t195 - 0.980785251f * t194;
+  float t358 = -0.555570245f * t246 + -0.831469595f * t247;
+  float t359 = -0.555570245f * t247 - -0.831469595f * t246;
+  float t360 = t356 + t358;
+  float t361 = t357 + t359;
+  float t362 = t356 - t358;
+  float t363 = t357 - t359;
+  float t364 = t140 + t360;
+  float t365 = t141 + t361;
+  float t366 = t140 - t360;
+  float t367 = t141 - t361;
+  float t368 = t142 + t363;
+  float t369 = t143 - t362;
+  float t370 = t142 - t363;
+  float t371 = t143 + t362;
+
+  output[0] = t252;
+  output[0+1] = t253;
+  output[1*stride_out] = t268;
+  output[1*stride_out+1] = t269;
+  output[2*stride_out] = t284;
+  output[2*stride_out+1] = t285;
+  output[3*stride_out] = t300;
+  output[3*stride_out+1] = t301;
+  output[4*stride_out] = t316;
+  output[4*stride_out+1] = t317;
+  output[5*stride_out] = t332;
+  output[5*stride_out+1] = t333;
+  output[6*stride_out] = t348;
+  output[6*stride_out+1] = t349;
+  output[7*stride_out] = t364;
+  output[7*stride_out+1] = t365;
+  output[8*stride_out] = t256;
+  output[8*stride_out+1] = t257;
+  output[9*stride_out] = t272;
+  output[9*stride_out+1] = t273;
+  output[10*stride_out] = t288;
+  output[10*stride_out+1] = t289;
+  output[11*stride_out] = t304;
+  output[11*stride_out+1] = t305;
+  output[12*stride_out] = t320;
+  output[12*stride_out+1] = t321;
+  output[13*stride_out] = t336;
+  output[13*stride_out+1] = t337;
+  output[14*stride_out] = t352;
+  output[14*stride_out+1] = t353;
+  output[15*stride_out] = t368;
+  output[15*stride_out+1] = t369;
+  output[16*stride_out] = t254;
+  output[16*stride_out+1] = t255;
+  output[17*stride_out] = t270;
+  output[17*stride_out+1] = t271;
+  output[18*stride_out] = t286;
+  output[18*stride_out+1] = t287;
+  output[19*stride_out] = t302;
+  output[19*stride_out+1] = t303;
+  output[20*stride_out] = t318;
+  output[20*stride_out+1] = t319;
+  output[21*stride_out] = t334;
+  output[21*stride_out+1] = t335;
+  output[22*stride_out] = t350;
+  output[22*stride_out+1] = t351;
+  output[23*stride_out] = t366;
+  output[23*stride_out+1] = t367;
+  output[24*stride_out] = t258;
+  output[24*stride_out+1] = t259;
+  output[25*stride_out] = t274;
+  output[25*stride_out+1] = t275;
+  output[26*stride_out] = t290;
+  output[26*stride_out+1] = t291;
+  output[27*stride_out] = t306;
+  output[27*stride_out+1] = t307;
+  output[28*stride_out] = t322;
+  output[28*stride_out+1] = t323;
+  output[29*stride_out] = t338;
+  output[29*stride_out+1] = t339;
+  output[30*stride_out] = t354;
+  output[30*stride_out+1] = t355;
+  output[31*stride_out] = t370;
+  output[31*stride_out+1] = t371;
+}
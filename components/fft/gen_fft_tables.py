@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Generates fft_tables.c: the twiddle factor table shared by all cached plans and
+fully unrolled split-radix kernels for the small complex FFTs the recursion ends in.
+
+    python3 gen_fft_tables.py > fft_tables.c
+"""
+
+import math
+import struct
+
+TABLE_LOG2_SIZE = 12  # must match FFT_MAX_LOG2_SIZE in fft.h
+KERNEL_SIZES = (16, 32)
+
+
+def fmt_float(value):
+    if abs(value) < 1e-12:  # cos(pi / 2) and friends
+        value = 0.0
+    # Rounded to float here, as nine significant digits identify a float exactly but would
+    # round the double once more in the compiler and miss the nearest float near midpoints
+    value = struct.unpack("f", struct.pack("f", value))[0]
+    text = "%.9g" % value
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+class Kernel:
+    """Emits straight-line code for one DFT size, folding the constant twiddles."""
+
+    def __init__(self, n):
+        self.n = n
+        self.lines = []
+        self.temps = 0
+
+    def temp(self, expression):
+        name = "t%d" % self.temps
+        self.temps += 1
+        self.lines.append("  float %s = %s;" % (name, expression))
+        return name
+
+    def add(self, a, b):
+        return (self.temp("%s + %s" % (a[0], b[0])), self.temp("%s + %s" % (a[1], b[1])))
+
+    def sub(self, a, b):
+        return (self.temp("%s - %s" % (a[0], b[0])), self.temp("%s - %s" % (a[1], b[1])))
+
+    def twiddle(self, x, k, n):
+        """x * exp(-2 pi i k / n)"""
+        k %= n
+        if k == 0:
+            return x
+        if 4 * k == n:  # -i
+            return (x[1], self.temp("-%s" % x[0]))
+        if 8 * k == n:
+            h = fmt_float(math.sqrt(0.5))
+            return (self.temp("(%s + %s) * %s" % (x[0], x[1], h)),
+                    self.temp("(%s - %s) * %s" % (x[1], x[0], h)))
+        if 8 * k == 3 * n:
+            h = fmt_float(math.sqrt(0.5))
+            return (self.temp("(%s - %s) * %s" % (x[1], x[0], h)),
+                    self.temp("-(%s + %s) * %s" % (x[0], x[1], h)))
+        c = fmt_float(math.cos(2 * math.pi * k / n))
+        s = fmt_float(math.sin(2 * math.pi * k / n))
+        return (self.temp("%s * %s + %s * %s" % (c, x[0], s, x[1])),
+                self.temp("%s * %s - %s * %s" % (c, x[1], s, x[0])))
+
+    def dft(self, x):
+        """Split-radix decimation in time, same decomposition as split_radix_fft()"""
+        n = len(x)
+        if n == 1:
+            return list(x)
+        if n == 2:
+            return [self.add(x[0], x[1]), self.sub(x[0], x[1])]
+        u = self.dft(x[0::2])
+        z1 = self.dft(x[1::4])
+        z3 = self.dft(x[3::4])
+        y = [None] * n
+        for k in range(n // 4):
+            a = self.twiddle(z1[k], k, n)
+            b = self.twiddle(z3[k], 3 * k, n)
+            s = self.add(a, b)
+            d = self.sub(a, b)
+            y[k] = self.add(u[k], s)
+            y[k + n // 2] = self.sub(u[k], s)
+            # u -/+ i d
+            y[k + n // 4] = (self.temp("%s + %s" % (u[k + n // 4][0], d[1])),
+                             self.temp("%s - %s" % (u[k + n // 4][1], d[0])))
+            y[k + 3 * n // 4] = (self.temp("%s - %s" % (u[k + n // 4][0], d[1])),
+                                 self.temp("%s + %s" % (u[k + n // 4][1], d[0])))
+        return y
+
+    def emit(self):
+        x = [("input[%d*stride_in]" % i, "input[%d*stride_in+1]" % i) for i in range(self.n)]
+        x[0] = ("input[0]", "input[1]")
+        y = self.dft(x)
+        out = ["void fft%d(float *input, int stride_in, float *output, int stride_out)" % self.n, "{"]
+        out += self.lines
+        out.append("")
+        for k, (re, im) in enumerate(y):
+            index = "%d*stride_out" % k if k else "0"
+            out.append("  output[%s] = %s;" % (index, re))
+            out.append("  output[%s+1] = %s;" % (index, im))
+        out.append("}")
+        return "\n".join(out)
+
+
+def main():
+    size = 1 << TABLE_LOG2_SIZE
+    print("/*")
+    print("  Generated by gen_fft_tables.py, do not edit.")
+    print("*/")
+    print('#include "fft.h"')
+    print()
+    print("// [cos(2 pi k / %d), sin(2 pi k / %d)] for k = 0 .. %d" % (size, size, size - 1))
+    print("const float fft_twiddle_table[2 * FFT_TWIDDLE_TABLE_SIZE] =")
+    print("{")
+    for k in range(size):
+        angle = 2 * math.pi * k / size
+        print("  %s, %s," % (fmt_float(math.cos(angle)), fmt_float(math.sin(angle))))
+    print("};")
+    for n in KERNEL_SIZES:
+        print()
+        print(Kernel(n).emit())
+
+
+if __name__ == "__main__":
+    main()
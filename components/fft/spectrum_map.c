@@ -0,0 +1,122 @@
+/*
+  Spectrum to colour index mapping, see spectrum_map.h.
+*/
+#include <stdlib.h>
+#include <math.h>
+
+#include "spectrum_map.h"
+
+// 10 log10(2), dB per power of two
+#define DB_PER_LOG2 3.01029996f
+
+static float hz_to_mel(float hz)
+{
+  return 2595.0f * log10f(1.0f + hz / 700.0f);
+}
+
+static float mel_to_hz(float mel)
+{
+  return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+// Fractional bin at position 0 .. 1 of the row range
+static float band_edge(spectrum_bands_t bands, float bin_hz, int first_bin, int end_bin, float position)
+{
+  if (bands == SPECTRUM_BANDS_LINEAR)
+    return first_bin + position * (end_bin - first_bin);
+
+  float low = hz_to_mel(first_bin * bin_hz);
+  float high = hz_to_mel(end_bin * bin_hz);
+  return mel_to_hz(low + position * (high - low)) / bin_hz;
+}
+
+spectrum_map_t *spectrum_map_init(int rows, spectrum_bands_t bands, float bin_hz, int first_bin, int end_bin,
+                                  spectrum_scale_t scale, float low, float high)
+{
+  int k;
+
+  if (rows < 1 || first_bin < 0 || end_bin <= first_bin || end_bin > UINT16_MAX || bin_hz <= 0.0f
+      || high <= low)
+    return NULL;
+
+  spectrum_map_t *map = (spectrum_map_t *)calloc(1, sizeof(spectrum_map_t));
+  if (map == NULL)
+    return NULL;
+
+  map->rows = rows;
+  map->scale = scale;
+  map->bands = (uint16_t *)malloc(2 * rows * sizeof(uint16_t));
+  map->band_power = (float *)malloc(rows * sizeof(float));
+  if (map->bands == NULL || map->band_power == NULL)
+  {
+    spectrum_map_destroy(map);
+    return NULL;
+  }
+
+  for (k = 0 ; k < rows ; k++)
+  {
+    int first = (int)floorf(band_edge(bands, bin_hz, first_bin, end_bin, (float)k / rows));
+    int end = (int)floorf(band_edge(bands, bin_hz, first_bin, end_bin, (float)(k + 1) / rows));
+    if (first < first_bin)
+      first = first_bin;
+    if (first > end_bin - 1)
+      first = end_bin - 1;
+    if (end <= first)
+      end = first + 1;
+    map->bands[2 * k] = first;
+    map->bands[2 * k + 1] = end;
+  }
+
+  // Index 0 at low, 255 at high
+  if (scale == SPECTRUM_SCALE_LOG)
+  {
+    map->offset = low / DB_PER_LOG2;
+    map->gain = 255.0f * DB_PER_LOG2 / (high - low);
+  }
+  else
+  {
+    map->offset = low;
+    map->gain = 255.0f / (high - low);
+  }
+  return map;
+}
+
+void spectrum_map_destroy(spectrum_map_t *map)
+{
+  free(map->bands);
+  free(map->band_power);
+  free(map);
+}
+
+void spectrum_map_execute(spectrum_map_t *map, const float *power, uint8_t *indices)
+{
+  int k, bin;
+  float *band_power = map->band_power;
+
+  for (k = 0 ; k < map->rows ; k++)
+  {
+    float strongest = power[map->bands[2 * k]];
+    for (bin = map->bands[2 * k] + 1 ; bin < map->bands[2 * k + 1] ; bin++)
+      strongest = power[bin] > strongest ? power[bin] : strongest;
+    band_power[k] = strongest;
+  }
+
+  // Kept apart from the band loop, these have no data dependent control flow and vectorize
+  if (map->scale == SPECTRUM_SCALE_LOG)
+  {
+    for (k = 0 ; k < map->rows ; k++)
+      band_power[k] = spectrum_log2(band_power[k]);
+  }
+  else
+  {
+    for (k = 0 ; k < map->rows ; k++)
+      band_power[k] = sqrtf(band_power[k]);
+  }
+  for (k = 0 ; k < map->rows ; k++)
+  {
+    float index = (band_power[k] - map->offset) * map->gain;
+    index = index > 0.0f ? index : 0.0f;
+    index = index < 255.0f ? index : 255.0f;
+    indices[k] = (uint8_t)index;
+  }
+}
@@ -0,0 +1,66 @@
+/*
+  Maps a power spectrum to 8 bit colour indices for spectrogram displays.
+
+  The bins are first gathered into rows, one bin per row or bands evenly
+  spaced on the mel scale, each showing its strongest bin. The rows are then
+  scaled linearly in magnitude or logarithmically in dB and quantized, without
+  libm calls or data dependent branches in the log path.
+*/
+#ifndef __SPECTRUM_MAP_H__
+#define __SPECTRUM_MAP_H__
+
+#include <stdint.h>
+#include <string.h>
+
+typedef enum
+{
+  SPECTRUM_BANDS_LINEAR,
+  SPECTRUM_BANDS_MEL
+} spectrum_bands_t;
+
+typedef enum
+{
+  SPECTRUM_SCALE_LINEAR,  // sqrt(power)
+  SPECTRUM_SCALE_LOG  // 10 log10(power) dB
+} spectrum_scale_t;
+
+typedef struct
+{
+  int rows;
+  spectrum_scale_t scale;
+  float offset;  // index = (value - offset) * gain, value is sqrt(power) or log2(power)
+  float gain;
+  uint16_t *bands;  // first and end bin of each row
+  float *band_power;  // scratch, the strongest bin of each row
+} spectrum_map_t;
+
+/*
+ * Rows cover the bins first_bin .. end_bin - 1, bin_hz apart, the mel bands
+ * narrower than a bin repeat it. Index 0 is low and 255 is high, in
+ * magnitude for SPECTRUM_SCALE_LINEAR and in dB for SPECTRUM_SCALE_LOG.
+ * Returns NULL on bad arguments or out of memory.
+ */
+spectrum_map_t *spectrum_map_init(int rows, spectrum_bands_t bands, float bin_hz, int first_bin, int end_bin,
+                                  spectrum_scale_t scale, float low, float high);
+void spectrum_map_destroy(spectrum_map_t *map);
+// Writes map->rows indices, lowest frequency first
+void spectrum_map_execute(spectrum_map_t *map, const float *power, uint8_t *indices);
+
+/*
+ * log2(x) within 0.0009 (0.003 dB) for positive normal x, from the exponent
+ * bits and a cubic on the mantissa that is exact at powers of two. Zero and
+ * denormals come out around -127 instead of -inf.
+ */
+static inline float spectrum_log2(float x)
+{
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  float exponent = (float)((int32_t)(bits >> 23) - 127);
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  float t;
+  memcpy(&t, &bits, sizeof(t));
+  t -= 1.0f;
+  return exponent + t * (1.42286524f + t * (-0.582085231f + t * 0.159219989f));
+}
+
+#endif // __SPECTRUM_MAP_H__
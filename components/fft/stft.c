@@ -0,0 +1,155 @@
+/*
+  Streaming STFT with Welch averaging on top of the fixed-point FFT.
+
+  The samples go into a ring buffer of one frame. Whenever hop new samples
+  have arrived, the ring is unrolled into the frame buffer with the window
+  applied on the way, so there is no separate copy, and the power of the
+  frame is added to the column.
+*/
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "stft.h"
+
+// cos(2 pi k / size) from the shared table, k may be up to 2 size
+static float table_cos(int k, int size)
+{
+  return fft_twiddle_table[2 * ((k * (FFT_TWIDDLE_TABLE_SIZE / size)) % FFT_TWIDDLE_TABLE_SIZE)];
+}
+
+static int16_t *compute_window(stft_window_t type, int size)
+{
+  int k;
+  int16_t *window = (int16_t *)malloc(size * sizeof(int16_t));
+  if (window == NULL)
+    return NULL;
+
+  // Periodic windows, the ones whose overlapped copies add up evenly
+  for (k = 0 ; k < size ; k++)
+  {
+    float w;
+    if (type == STFT_WINDOW_BLACKMAN)
+      w = 0.42f - 0.5f * table_cos(k, size) + 0.08f * table_cos(2 * k, size);
+    else
+      w = 0.5f - 0.5f * table_cos(k, size);
+    if (w < 0.0f)  // the Blackman ends round to tiny negative values
+      w = 0.0f;
+    window[k] = (int16_t)(w * 32767.0f + 0.5f);
+  }
+  return window;
+}
+
+stft_t *stft_init(int size, int hop, stft_window_t window, int bins, int averages)
+{
+  int k;
+  const fft_q15_plan_t *plan = fft_q15_plan_get(size);
+
+  if (plan == NULL || hop < 1 || hop > size || bins < 1 || bins > size / 2 || averages < 1)
+    return NULL;
+
+  stft_t *stft = (stft_t *)calloc(1, sizeof(stft_t));
+  if (stft == NULL)
+    return NULL;
+
+  stft->size = size;
+  stft->hop = hop;
+  stft->bins = bins;
+  stft->averages = averages;
+  stft->plan = plan;
+  stft->window = compute_window(window, size);
+  stft->ring = (int16_t *)calloc(size, sizeof(int16_t));
+  stft->frame = (int16_t *)malloc(size * sizeof(int16_t));
+  stft->work = (int16_t *)malloc(size * sizeof(int16_t));
+  stft->magnitudes = (int16_t *)malloc(bins * sizeof(int16_t));
+  stft->power = (float *)calloc(bins, sizeof(float));
+  if (stft->window == NULL || stft->ring == NULL || stft->frame == NULL || stft->work == NULL
+      || stft->magnitudes == NULL || stft->power == NULL)
+  {
+    stft_destroy(stft);
+    return NULL;
+  }
+
+  // A sinusoid centred on a bin gets the window sum instead of size
+  float window_sum = 0.0f;
+  for (k = 0 ; k < size ; k++)
+    window_sum += stft->window[k] / 32768.0f;
+  stft->power_scale = (size / window_sum) * (size / window_sum) / averages;
+
+  // The first frame needs a full ring, the ones after it hop new samples
+  stft->pending = size;
+  return stft;
+}
+
+void stft_destroy(stft_t *stft)
+{
+  free(stft->window);
+  free(stft->ring);
+  free(stft->frame);
+  free(stft->work);
+  free(stft->magnitudes);
+  free(stft->power);
+  free(stft);
+}
+
+static void stft_frame(stft_t *stft)
+{
+  int k;
+  int size = stft->size;
+  int first = size - stft->head;
+  const int16_t *w = stft->window;
+
+  // Oldest sample first, it sits at the write position
+  for (k = 0 ; k < first ; k++)
+    stft->frame[k] = (stft->ring[stft->head + k] * w[k] + (1 << 14)) >> 15;
+  for (k = first ; k < size ; k++)
+    stft->frame[k] = (stft->ring[k - first] * w[k] + (1 << 14)) >> 15;
+
+  int exponent = fft_q15_magnitudes(stft->plan, stft->frame, stft->work, stft->magnitudes, stft->bins);
+  for (k = 0 ; k < stft->bins ; k++)
+  {
+    float m = stft->magnitudes[k];
+    stft->power[k] += ldexpf(m * m, 2 * exponent);
+  }
+  stft->averaged++;
+}
+
+int stft_write(stft_t *stft, const int16_t *samples, int count)
+{
+  int k;
+
+  if (stft->averaged == stft->averages)
+    return 0;
+
+  if (count > stft->pending)
+    count = stft->pending;
+  for (k = 0 ; k < count ; k++)
+  {
+    stft->ring[stft->head] = samples[k];
+    stft->head = (stft->head + 1) & (stft->size - 1);
+  }
+
+  stft->pending -= count;
+  if (stft->pending == 0)
+  {
+    stft_frame(stft);
+    stft->pending = stft->hop;
+  }
+  return count;
+}
+
+int stft_read(stft_t *stft, float *column)
+{
+  int k;
+
+  if (stft->averaged < stft->averages)
+    return 0;
+
+  for (k = 0 ; k < stft->bins ; k++)
+  {
+    column[k] = stft->power[k] * stft->power_scale;
+    stft->power[k] = 0.0f;
+  }
+  stft->averaged = 0;
+  return 1;
+}
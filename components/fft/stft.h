@@ -0,0 +1,71 @@
+/*
+  Short-time Fourier transform of a continuous stream of 16 bit samples.
+
+  Frames of `size` samples start every `hop` samples, are windowed and go
+  through the fixed-point FFT of fft_q15.c. The power spectra of `averages`
+  consecutive frames are averaged into one column, Welch's method when
+  averages > 1.
+
+      stft_t *stft = stft_init(512, 256, STFT_WINDOW_HANN, BINS, 2);
+
+      while (count > 0)
+      {
+        int used = stft_write(stft, samples, count);
+        samples += used;
+        count -= used;
+        if (stft_read(stft, column))
+          ... // BINS powers
+      }
+*/
+#ifndef __STFT_H__
+#define __STFT_H__
+
+#include <stdint.h>
+
+#include "fft.h"
+
+typedef enum
+{
+  STFT_WINDOW_HANN,
+  STFT_WINDOW_BLACKMAN
+} stft_window_t;
+
+typedef struct
+{
+  int size;  // frame length
+  int hop;  // samples from the start of one frame to the next, size / 2 for 50% overlap
+  int bins;  // |X[0]| .. |X[bins-1]| are computed
+  int averages;  // frames per column
+  const fft_q15_plan_t *plan;
+  int16_t *window;  // Q15
+  float power_scale;  // divides out the gain of the window and the averaging
+  int16_t *ring;  // the last size samples
+  int head;  // next write position in ring, also the oldest sample
+  int pending;  // samples missing until the next frame
+  int16_t *frame;  // windowed samples, input of the FFT
+  int16_t *work;
+  int16_t *magnitudes;
+  float *power;  // sum over the frames of the current column
+  int averaged;  // frames in power
+} stft_t;
+
+/*
+ * Returns NULL if size is not a supported FFT size, hop is not in 1 .. size,
+ * bins is not in 1 .. size / 2, averages is less than one or out of memory.
+ */
+stft_t *stft_init(int size, int hop, stft_window_t window, int bins, int averages);
+void stft_destroy(stft_t *stft);
+/*
+ * Appends up to count samples and returns how many were taken. It stops after
+ * the sample that completes a frame, and takes none while a complete column
+ * waits to be read.
+ */
+int stft_write(stft_t *stft, const int16_t *samples, int count);
+/*
+ * If a column is complete, writes its bins powers to column and returns 1,
+ * else returns 0. The powers are scaled so that a sinusoid of amplitude A
+ * centred on a bin reads (A size / 2)^2, like the unwindowed FFT.
+ */
+int stft_read(stft_t *stft, float *column);
+
+#endif // __STFT_H__
@@ -0,0 +1,240 @@
+#include "cbor.h"
+
+#include <string.h>
+
+enum
+{
+    MAJOR_UINT = 0 << 5,
+    MAJOR_NEGATIVE = 1 << 5,
+    MAJOR_TEXT = 3 << 5,
+    MAJOR_ARRAY = 4 << 5,
+    MAJOR_MAP = 5 << 5,
+    MAJOR_TAG = 6 << 5,
+    MAJOR_SIMPLE = 7 << 5,
+};
+
+enum
+{
+    SIMPLE_FALSE = MAJOR_SIMPLE | 20,
+    SIMPLE_TRUE = MAJOR_SIMPLE | 21,
+    SIMPLE_NULL = MAJOR_SIMPLE | 22,
+    SIMPLE_FLOAT32 = MAJOR_SIMPLE | 26,
+    SIMPLE_FLOAT64 = MAJOR_SIMPLE | 27,
+    SIMPLE_BREAK = MAJOR_SIMPLE | 31,
+    INDEFINITE = 31,
+};
+
+enum
+{
+    TAG_DECIMAL_FRACTION = 4,
+};
+
+void
+cbor_init(CborWriter* writer, uint8_t* buffer, size_t capacity, CborFlush flush, void* context)
+{
+    writer->data = buffer;
+    writer->capacity = capacity;
+    writer->length = 0;
+    writer->failed = false;
+    writer->flush = flush;
+    writer->context = context;
+}
+
+bool
+cbor_flush(CborWriter* writer)
+{
+    if (!writer->failed && writer->flush != NULL && writer->length > 0) {
+        writer->failed = !writer->flush(writer->context, writer->data, writer->length);
+        writer->length = 0;
+    }
+    return !writer->failed;
+}
+
+// Makes room for `length` bytes and returns where to put them, NULL on failure
+static uint8_t*
+reserve(CborWriter* writer, size_t length)
+{
+    if (writer->failed) {
+        return NULL;
+    }
+    if (writer->capacity - writer->length < length) {
+        if (!cbor_flush(writer) || writer->capacity - writer->length < length) {
+            writer->failed = true;
+            return NULL;
+        }
+    }
+    uint8_t* out = writer->data + writer->length;
+    writer->length += length;
+    return out;
+}
+
+static void
+write_bytes(CborWriter* writer, const uint8_t* data, size_t length)
+{
+    // Long strings are split across flushes instead of requiring a buffer that fits them
+    while (length > 0 && !writer->failed) {
+        size_t available = writer->capacity - writer->length;
+        if (available == 0) {
+            if (!cbor_flush(writer) || writer->capacity == writer->length) {
+                writer->failed = true;
+                return;
+            }
+            available = writer->capacity - writer->length;
+        }
+        const size_t part = length < available ? length : available;
+        memcpy(writer->data + writer->length, data, part);
+        writer->length += part;
+        data += part;
+        length -= part;
+    }
+}
+
+static void
+write_head(CborWriter* writer, uint8_t major, uint64_t value)
+{
+    uint8_t* out;
+    if (value < 24) {
+        if ((out = reserve(writer, 1)) != NULL) {
+            out[0] = major | (uint8_t)value;
+        }
+    } else if (value <= UINT8_MAX) {
+        if ((out = reserve(writer, 2)) != NULL) {
+            out[0] = major | 24;
+            out[1] = (uint8_t)value;
+        }
+    } else if (value <= UINT16_MAX) {
+        if ((out = reserve(writer, 3)) != NULL) {
+            out[0] = major | 25;
+            out[1] = (uint8_t)(value >> 8);
+            out[2] = (uint8_t)value;
+        }
+    } else if (value <= UINT32_MAX) {
+        if ((out = reserve(writer, 5)) != NULL) {
+            out[0] = major | 26;
+            for (int i = 0; i < 4; ++i) {
+                out[1 + i] = (uint8_t)(value >> (24 - 8 * i));
+            }
+        }
+    } else {
+        if ((out = reserve(writer, 9)) != NULL) {
+            out[0] = major | 27;
+            for (int i = 0; i < 8; ++i) {
+                out[1 + i] = (uint8_t)(value >> (56 - 8 * i));
+            }
+        }
+    }
+}
+
+static void
+write_byte(CborWriter* writer, uint8_t value)
+{
+    uint8_t* out = reserve(writer, 1);
+    if (out != NULL) {
+        out[0] = value;
+    }
+}
+
+void
+cbor_uint(CborWriter* writer, uint64_t value)
+{
+    write_head(writer, MAJOR_UINT, value);
+}
+
+void
+cbor_int(CborWriter* writer, int64_t value)
+{
+    if (value >= 0) {
+        write_head(writer, MAJOR_UINT, (uint64_t)value);
+    } else {
+        // -1 - n without overflowing for INT64_MIN
+        write_head(writer, MAJOR_NEGATIVE, ~(uint64_t)value);
+    }
+}
+
+void
+cbor_float(CborWriter* writer, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t* out = reserve(writer, 5);
+    if (out != NULL) {
+        out[0] = SIMPLE_FLOAT32;
+        out[1] = (uint8_t)(bits >> 24);
+        out[2] = (uint8_t)(bits >> 16);
+        out[3] = (uint8_t)(bits >> 8);
+        out[4] = (uint8_t)bits;
+    }
+}
+
+void
+cbor_double(CborWriter* writer, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t* out = reserve(writer, 9);
+    if (out != NULL) {
+        out[0] = SIMPLE_FLOAT64;
+        for (int i = 0; i < 8; ++i) {
+            out[1 + i] = (uint8_t)(bits >> (56 - 8 * i));
+        }
+    }
+}
+
+void
+cbor_decimal(CborWriter* writer, int64_t mantissa, int exponent)
+{
+    write_head(writer, MAJOR_TAG, TAG_DECIMAL_FRACTION);
+    write_head(writer, MAJOR_ARRAY, 2);
+    cbor_int(writer, exponent);
+    cbor_int(writer, mantissa);
+}
+
+void
+cbor_bool(CborWriter* writer, bool value)
+{
+    write_byte(writer, value ? SIMPLE_TRUE : SIMPLE_FALSE);
+}
+
+void
+cbor_null(CborWriter* writer)
+{
+    write_byte(writer, SIMPLE_NULL);
+}
+
+void
+cbor_text(CborWriter* writer, const char* text)
+{
+    const size_t length = strlen(text);
+    write_head(writer, MAJOR_TEXT, length);
+    write_bytes(writer, (const uint8_t*)text, length);
+}
+
+void
+cbor_array(CborWriter* writer, size_t count)
+{
+    write_head(writer, MAJOR_ARRAY, count);
+}
+
+void
+cbor_map(CborWriter* writer, size_t count)
+{
+    write_head(writer, MAJOR_MAP, count);
+}
+
+void
+cbor_array_begin(CborWriter* writer)
+{
+    write_byte(writer, MAJOR_ARRAY | INDEFINITE);
+}
+
+void
+cbor_map_begin(CborWriter* writer)
+{
+    write_byte(writer, MAJOR_MAP | INDEFINITE);
+}
+
+void
+cbor_break(CborWriter* writer)
+{
+    write_byte(writer, SIMPLE_BREAK);
+}
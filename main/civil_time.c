@@ -0,0 +1,102 @@
+#include "civil_time.h"
+
+#include <stdbool.h>
+
+#include "fmt.h"
+
+#define SECONDS_PER_DAY 86400
+#define DAYS_PER_4_YEARS 1461
+#define MIN_YEAR 1970
+#define MAX_YEAR 2106
+
+// Days before the first of each month in a common year
+static const uint16_t DAYS_BEFORE_MONTH[13] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365,
+};
+
+static bool
+is_leap_year(int32_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// `month` counts from 0 here, the 13th entry is the length of the year
+static uint32_t
+days_before_month(uint32_t month, bool leap)
+{
+    return DAYS_BEFORE_MONTH[month] + (leap && month >= 2);
+}
+
+// Leap days in the years from 1 up to and including `year`
+static int32_t
+leap_days_through(int32_t year)
+{
+    return year / 4 - year / 100 + year / 400;
+}
+
+int32_t
+days_from_civil(int32_t year, uint32_t month, uint32_t day)
+{
+    const int32_t leap_days = leap_days_through(year - 1) - leap_days_through(MIN_YEAR - 1);
+    return (year - MIN_YEAR) * 365 + leap_days + days_before_month(month - 1, is_leap_year(year)) + day - 1;
+}
+
+uint32_t
+civil_to_unix(const rtc_date_t* date)
+{
+    if (date->year < MIN_YEAR || date->year > MAX_YEAR || date->month < 1 || date->month > 12) {
+        return 0;
+    }
+    const uint32_t days = days_from_civil(date->year, date->month, date->day);
+    const uint32_t seconds = date->hour * 3600u + date->minute * 60u + date->second;
+    if (days > (UINT32_MAX - seconds) / SECONDS_PER_DAY) {
+        return 0;
+    }
+    return days * SECONDS_PER_DAY + seconds;
+}
+
+void
+civil_from_unix(uint32_t unix_time, rtc_date_t* date)
+{
+    const uint32_t days = unix_time / SECONDS_PER_DAY;
+    const uint32_t seconds = unix_time % SECONDS_PER_DAY;
+    date->hour = seconds / 3600;
+    date->minute = seconds / 60 % 60;
+    date->second = seconds % 60;
+
+    // Exact while every fourth year is a leap year, from 2101 on it can be one year early
+    int32_t year = MIN_YEAR + (days * 4 + 2) / DAYS_PER_4_YEARS;
+    uint32_t start = days_from_civil(year, 1, 1);
+    bool leap = is_leap_year(year);
+    if (days - start >= days_before_month(12, leap)) {
+        start += days_before_month(12, leap);
+        ++year;
+        leap = is_leap_year(year);
+    }
+    const uint32_t day_of_year = days - start;
+
+    // Months are 28 to 31 days long, so this guess is at most one month early
+    uint32_t month = day_of_year / 31;
+    if (day_of_year >= days_before_month(month + 1, leap)) {
+        ++month;
+    }
+    date->year = year;
+    date->month = month + 1;
+    date->day = day_of_year - days_before_month(month, leap) + 1;
+}
+
+char*
+civil_format(char* dst, char* end, const rtc_date_t* date)
+{
+    dst = fmt_uint(dst, end, date->day, 2);
+    dst = fmt_char(dst, end, '.');
+    dst = fmt_uint(dst, end, date->month, 2);
+    dst = fmt_char(dst, end, '.');
+    dst = fmt_uint(dst, end, date->year, 4);
+    dst = fmt_str(dst, end, ", ");
+    dst = fmt_uint(dst, end, date->hour, 2);
+    dst = fmt_char(dst, end, ':');
+    dst = fmt_uint(dst, end, date->minute, 2);
+    dst = fmt_char(dst, end, ':');
+    return fmt_uint(dst, end, date->second, 2);
+}
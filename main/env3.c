@@ -1,5 +1,9 @@
 #include "env3.h"
 #include "env3_sensors.h"
+#include "fmt.h"
+#include "scheduler.h"
+#include "sensor_history.h"
+#include "snapshot.h"
 #include "tof_vl53lox.h"
 
 #include "driver/i2c.h"
@@ -10,85 +14,165 @@ lv_obj_t* humidity_label = NULL;
 lv_obj_t* pressure_label = NULL;
 lv_obj_t* tof_label = NULL;
 
-static SensorInfo SENSOR_INFO = { .temperature = 0.0f, .humidity = 0.0f, .pressure = 0.0f };
-SemaphoreHandle_t SENSOR_INFO_MUTEX;
+SNAPSHOT_DEFINE(SENSOR_INFO, SensorInfo);
 
 SensorInfo
 get_sensor_info(void)
 {
-    xSemaphoreTake(SENSOR_INFO_MUTEX, portMAX_DELAY);
-    SensorInfo si = SENSOR_INFO;
-    xSemaphoreGive(SENSOR_INFO_MUTEX);
+    SensorInfo si;
+    snapshot_read(&SENSOR_INFO, &si);
     return si;
 }
 
+// "<prefix><value with one decimal><suffix>"
 static void
-env3_task(void* pvParameters)
+format_label(char* buffer, size_t size, const char* prefix, float value, const char* suffix)
 {
-    ESP_LOGI(TAG, "Start ENV III task");
+    char* const end = buffer + size;
+    char* pos = fmt_str(buffer, end, prefix);
+    pos = fmt_fixed(pos, end, value, 1);
+    fmt_str(pos, end, suffix);
+}
+
+static bool sensors_ready = false;
+static I2CDevice_t sht3x_peripheral;
+static I2CDevice_t qmp6988_slave;
+static I2CDevice_t tof_vl53lox;
+static uint16_t tof_reading = 0;
+
+static SHT3xRequest sht3x_request;
+static SHT3xDecimator sht3x_decimator;
+static SHT3xMeasurement sht3x_measurement;
+static bool sht3x_fetch_pending = false;
+
+static QMP6988Request qmp6988_request;
+static TofVl53loxRequest tof_request;
+static int pending_requests = 0;
+
+static char text_temp_buffer[32];
+static char text_humidity_buffer[32];
+static char text_pressure_buffer[32];
+static char text_tof_buffer[32];
+
+static void
+sht3x_fetched(void* context)
+{
+    sht3x_fetch_pending = false;
+    if (sht3x_request.is_valid) {
+        SHT3x_decimator_add(&sht3x_decimator, sht3x_request.measurement);
+    }
+}
+
+// Drains every periodic SHT3x result, env3_publish() averages them once per second
+static void
+sht3x_run(void* context)
+{
+    if (sht3x_fetch_pending) {
+        return;
+    }
+    sht3x_fetch_pending = true;
+    SHT3x_start_fetch(&sht3x_request, sht3x_peripheral, sht3x_fetched, NULL);
+}
+
+static SchedulerJob sht3x_job = { .name = "sht3x",
+                                  .run = sht3x_run,
+                                  .period_ms = 1000 / CONFIG_SHT3X_MEASUREMENTS_PER_SECOND };
+
+static void
+env3_init(void* context)
+{
+    ESP_LOGI(TAG, "Start ENV III job");
     esp_err_t err = Core2ForAWS_Port_PinMode(PORT_A_SDA_PIN, I2C);
     if (err != ESP_OK) {
         const char* I2C_SENSOR_FAILED = "I2C Sensor failed";
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
         lv_label_set_static_text(temperature_label, I2C_SENSOR_FAILED);
+        xSemaphoreGive(xGuiSemaphore);
         ESP_LOGE(TAG, "Failed to enable I2C port");
-        vTaskDelete(NULL);
         return;
     }
 
-    char text_temp_buffer[32];
-    char text_humidity_buffer[32];
-    char text_pressure_buffer[32];
-    char text_tof_buffer[32];
-
-    I2CDevice_t sht3x_peripheral =
-      Core2ForAWS_Port_A_I2C_Begin(SHT3x_DEVICE_ADDRESS, PORT_A_I2C_STANDARD_BAUD);
-    I2CDevice_t qmp6988_slave = QMP6988_deviceCheck();
-    I2CDevice_t tof_vl53lox = TofVl53lox_Init();
-
-    uint16_t tof_reading = 0;
-    while (true) {
-        const SHT3xMeasurement sht3x_measurement = SHT3x_get_measurement(sht3x_peripheral);
-        float pressure = QMP6988_calcPressure(qmp6988_slave);
-        if (pressure > 0.0f) {
-            pressure /= 100.0f; // hPa are the norm
-        }
-        const uint16_t tof_value = TofVl53lox_get_reading(tof_vl53lox);
-        if (tof_value > 0) {
-            tof_reading = tof_value;
-        }
-
-        xSemaphoreTake(SENSOR_INFO_MUTEX, portMAX_DELAY);
-        SENSOR_INFO.temperature = sht3x_measurement.temperature;
-        SENSOR_INFO.humidity = sht3x_measurement.humidity;
-        SENSOR_INFO.pressure = pressure;
-        xSemaphoreGive(SENSOR_INFO_MUTEX);
-
-        snprintf(
-          text_temp_buffer, sizeof(text_temp_buffer), "Temperature: %.1f°C", sht3x_measurement.temperature);
-        snprintf(
-          text_humidity_buffer, sizeof(text_humidity_buffer), "Humidity: %.1f%%", sht3x_measurement.humidity);
-        snprintf(text_pressure_buffer, sizeof(text_pressure_buffer), "Pressure: %.1f hPa", pressure);
-        snprintf(text_tof_buffer, sizeof(text_tof_buffer), "TOF distance: %u mm", tof_reading);
+    sht3x_peripheral = Core2ForAWS_Port_A_I2C_Begin(SHT3x_DEVICE_ADDRESS, PORT_A_I2C_STANDARD_BAUD);
+    if (SHT3x_start_periodic(sht3x_peripheral, CONFIG_SHT3X_MEASUREMENTS_PER_SECOND) == ESP_OK) {
+        scheduler_add(&sht3x_job, sht3x_job.period_ms);
+    }
+    qmp6988_slave = QMP6988_deviceCheck();
+    tof_vl53lox = TofVl53lox_Init();
+    sensors_ready = true;
+}
+
+static void
+env3_publish(void)
+{
+    // Keeps showing the previous reading if no periodic result arrived during the last second
+    SHT3x_decimator_take(&sht3x_decimator, &sht3x_measurement);
+    float pressure = qmp6988_request.pressure;
+    if (pressure > 0.0f) {
+        pressure /= 100.0f; // hPa are the norm
+    }
+    const uint16_t tof_value = tof_request.distance;
+    if (tof_value > 0) {
+        tof_reading = tof_value;
+    }
+
+    const SensorInfo sensor_info = { .temperature = sht3x_measurement.temperature,
+                                     .humidity = sht3x_measurement.humidity,
+                                     .pressure = pressure,
+                                     .tof_distance = tof_reading };
+    snapshot_publish(&SENSOR_INFO, &sensor_info);
+
+    const uint32_t now = sensor_history_now();
+    sensor_history_append(SENSOR_CHANNEL_TEMPERATURE, now, sensor_info.temperature);
+    sensor_history_append(SENSOR_CHANNEL_HUMIDITY, now, sensor_info.humidity);
+    sensor_history_append(SENSOR_CHANNEL_PRESSURE, now, sensor_info.pressure);
+    if (tof_value > 0) {
+        sensor_history_append(SENSOR_CHANNEL_TOF, now, tof_value);
+    }
 
-        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
-        lv_label_set_static_text(temperature_label, text_temp_buffer);
-        lv_label_set_static_text(humidity_label, text_humidity_buffer);
-        lv_label_set_static_text(pressure_label, text_pressure_buffer);
-        lv_label_set_static_text(tof_label, text_tof_buffer);
-        xSemaphoreGive(xGuiSemaphore);
+    format_label(
+      text_temp_buffer, sizeof(text_temp_buffer), "Temperature: ", sht3x_measurement.temperature, "°C");
+    format_label(
+      text_humidity_buffer, sizeof(text_humidity_buffer), "Humidity: ", sht3x_measurement.humidity, "%");
+    format_label(text_pressure_buffer, sizeof(text_pressure_buffer), "Pressure: ", pressure, " hPa");
+    char* const tof_end = text_tof_buffer + sizeof(text_tof_buffer);
+    char* pos = fmt_str(text_tof_buffer, tof_end, "TOF distance: ");
+    pos = fmt_uint(pos, tof_end, tof_reading, 1);
+    fmt_str(pos, tof_end, " mm");
 
-        vTaskDelay(pdMS_TO_TICKS(1000));
+    xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+    lv_label_set_static_text(temperature_label, text_temp_buffer);
+    lv_label_set_static_text(humidity_label, text_humidity_buffer);
+    lv_label_set_static_text(pressure_label, text_pressure_buffer);
+    lv_label_set_static_text(tof_label, text_tof_buffer);
+    xSemaphoreGive(xGuiSemaphore);
+}
+
+static void
+env3_request_done(void* context)
+{
+    if (--pending_requests == 0) {
+        env3_publish();
     }
+}
 
-    Core2ForAWS_Port_A_I2C_Close(qmp6988_slave);
-    Core2ForAWS_Port_A_I2C_Close(sht3x_peripheral);
-    vTaskDelete(NULL); // Should never get to here...
+// Both sensors convert in parallel, results are published once the slower one is read
+static void
+env3_run(void* context)
+{
+    if (!sensors_ready || pending_requests > 0) {
+        return;
+    }
+
+    pending_requests = 2;
+    QMP6988_start_read(&qmp6988_request, qmp6988_slave, env3_request_done, NULL);
+    TofVl53lox_start_reading(&tof_request, tof_vl53lox, env3_request_done, NULL);
 }
 
+static SchedulerJob env3_job = { .name = "env3", .init = env3_init, .run = env3_run, .period_ms = 1000 };
+
 void
 display_env3_tab(lv_obj_t* tv, lv_obj_t* core2forAWS_screen_obj)
 {
-    SENSOR_INFO_MUTEX = xSemaphoreCreateMutex();
     xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
 
     lv_obj_t* env3_tab = lv_tabview_add_tab(tv, ENV3_TAB_NAME); // Create a tab
@@ -156,6 +240,5 @@ display_env3_tab(lv_obj_t* tv, lv_obj_t* core2forAWS_screen_obj)
 
     xSemaphoreGive(xGuiSemaphore);
 
-    // Start the task
-    xTaskCreate(env3_task, "env3Task", 4096, NULL, 0, &env3_handle);
+    scheduler_add(&env3_job, 0);
 }
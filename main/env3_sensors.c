@@ -1,6 +1,11 @@
 #include "env3_sensors.h"
 
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "driver/i2c.h"
+#include "nvs.h"
 
 typedef unsigned char byte;
 
@@ -28,6 +33,7 @@ static const uint8_t QMP6988_RESET_REG = 0xE0; /* Device reset register */
 /* compensation calculation */
 #define QMP6988_CALIBRATION_DATA_START 0xA0 /* QMP6988 compensation coefficients */
 #define QMP6988_CALIBRATION_DATA_LENGTH 25
+#define QMP6988_NVS_NAMESPACE "qmp6988"
 
 #define SHIFT_RIGHT_4_POSITION 4
 #define SHIFT_LEFT_2_POSITION 2
@@ -118,25 +124,110 @@ typedef struct _qmp6988_data
     float altitude;
     qmp6988_cali_data_t qmp6988_cali;
     qmp6988_ik_data_t ik;
+    qmp6988_fk_data_t fk;
 } qmp6988_data_t;
 
 static qmp6988_data_t qmp6988;
 
+/*
+ * Conversion factors from the datasheet, every coefficient is A + S * OTP / 32767.
+ * Evaluated in double once, the per sample math then only needs single precision.
+ */
+static void
+QMP6988_setFloatCoefficients(const qmp6988_cali_data_t* cali, qmp6988_fk_data_t* fk)
+{
+    fk->a0 = cali->COE_a0 / 16.0;
+    fk->b00 = cali->COE_b00 / 16.0;
+
+    fk->a1 = -6.30E-03 + 4.30E-04 * cali->COE_a1 / 32767.0;
+    fk->a2 = -1.90E-11 + 1.20E-10 * cali->COE_a2 / 32767.0;
+    fk->bt1 = 1.00E-01 + 9.10E-02 * cali->COE_bt1 / 32767.0;
+    fk->bt2 = 1.20E-08 + 1.20E-06 * cali->COE_bt2 / 32767.0;
+    fk->bp1 = 3.30E-02 + 1.90E-02 * cali->COE_bp1 / 32767.0;
+    fk->b11 = 2.10E-07 + 1.40E-07 * cali->COE_b11 / 32767.0;
+    fk->bp2 = -6.30E-10 + 3.50E-10 * cali->COE_bp2 / 32767.0;
+    fk->b12 = 2.90E-13 + 7.60E-13 * cali->COE_b12 / 32767.0;
+    fk->b21 = 2.10E-15 + 1.20E-14 * cali->COE_b21 / 32767.0;
+    fk->bp3 = 1.30E-16 + 7.90E-17 * cali->COE_bp3 / 32767.0;
+}
+
+/*
+ * The calibration OTP never changes, so it is cached in NVS per bus address and warm boots read
+ * only a part of it. Every QMP6988 has the same chip ID, so the cached block is checked against
+ * OTP bytes 18 to 24 (a0, a1 and a2), which differ between units. A swapped ENV III unit fails
+ * the check and gets its own block read and cached.
+ */
+#define QMP6988_CALIBRATION_CHECK_OFFSET 18
+
+static void
+QMP6988_calibrationCacheKey(char* key, size_t size, uint8_t address)
+{
+    snprintf(key, size, "cali_%02x", address);
+}
+
+static bool
+QMP6988_loadCachedCalibration(uint8_t address, uint8_t* data)
+{
+    nvs_handle_t handle;
+    if (nvs_open(QMP6988_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    char key[16];
+    QMP6988_calibrationCacheKey(key, sizeof(key), address);
+    size_t length = QMP6988_CALIBRATION_DATA_LENGTH;
+    const esp_err_t err = nvs_get_blob(handle, key, data, &length);
+    nvs_close(handle);
+    return err == ESP_OK && length == QMP6988_CALIBRATION_DATA_LENGTH;
+}
+
+static void
+QMP6988_storeCachedCalibration(uint8_t address, const uint8_t* data)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(QMP6988_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to open calibration cache: %d", err);
+        return;
+    }
+    char key[16];
+    QMP6988_calibrationCacheKey(key, sizeof(key), address);
+    err = nvs_set_blob(handle, key, data, QMP6988_CALIBRATION_DATA_LENGTH);
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to store calibration cache: %d", err);
+    }
+    nvs_close(handle);
+}
+
+// True if the cached block belongs to the sensor on the bus
+static bool
+QMP6988_cachedCalibrationMatches(I2CDevice_t slave, const uint8_t* data)
+{
+    uint8_t check[QMP6988_CALIBRATION_DATA_LENGTH - QMP6988_CALIBRATION_CHECK_OFFSET];
+    const esp_err_t err = Core2ForAWS_Port_A_I2C_Read(
+      slave, QMP6988_CALIBRATION_DATA_START + QMP6988_CALIBRATION_CHECK_OFFSET, check, sizeof(check));
+    return err == ESP_OK && memcmp(check, &data[QMP6988_CALIBRATION_CHECK_OFFSET], sizeof(check)) == 0;
+}
+
 static int
-QMP6988_getCalibrationData(I2CDevice_t slave)
+QMP6988_getCalibrationData(I2CDevice_t slave, uint8_t address)
 {
-    esp_err_t err = 0;
-    // BITFIELDS temp_COE;
     uint8_t a_data_uint8_tr[QMP6988_CALIBRATION_DATA_LENGTH] = { 0 };
-    int len;
 
-    for (len = 0; len < QMP6988_CALIBRATION_DATA_LENGTH; len += 1) {
-        err =
-          Core2ForAWS_Port_A_I2C_Read(slave, QMP6988_CALIBRATION_DATA_START + len, &a_data_uint8_tr[len], 1);
+    if (QMP6988_loadCachedCalibration(address, a_data_uint8_tr) &&
+        QMP6988_cachedCalibrationMatches(slave, a_data_uint8_tr)) {
+        ESP_LOGI(TAG, "qmp6988 calibration loaded from cache");
+    } else {
+        // The register address auto-increments, so the whole OTP block comes in one transaction
+        const esp_err_t err = Core2ForAWS_Port_A_I2C_Read(
+          slave, QMP6988_CALIBRATION_DATA_START, a_data_uint8_tr, QMP6988_CALIBRATION_DATA_LENGTH);
         if (err) {
             ESP_LOGI(TAG, "qmp6988 read 0xA0 error!");
             return 0;
         }
+        QMP6988_storeCachedCalibration(address, a_data_uint8_tr);
     }
 
     qmp6988.qmp6988_cali.COE_a0 =
@@ -224,97 +315,37 @@ QMP6988_getCalibrationData(I2CDevice_t slave)
              qmp6988.ik.b21,
              qmp6988.ik.bp3);
     ESP_LOGI(TAG, "<----------- int calibration data -------------->\r\n");
-    return 1;
-}
-
-static void
-QMP6988_setpPowermode(I2CDevice_t slave, int power_mode)
-{
-    uint8_t data;
-
-    ESP_LOGI(TAG, "qmp_set_powermode %d \r\n", power_mode);
-
-    qmp6988.power_mode = power_mode;
-    esp_err_t err = Core2ForAWS_Port_A_I2C_Read(slave, QMP6988_CTRLMEAS_REG, &data, 1);
-    if (err) {
-        ESP_LOGI(TAG, "qmp6988 read 0xA0 error!");
-        return;
-    }
-
-    data = data & 0xfc;
-    if (power_mode == QMP6988_SLEEP_MODE) {
-        data |= 0x00;
-    } else if (power_mode == QMP6988_FORCED_MODE) {
-        data |= 0x01;
-    } else if (power_mode == QMP6988_NORMAL_MODE) {
-        data |= 0x03;
-    }
-
-    err = Core2ForAWS_Port_A_I2C_Write(slave, QMP6988_CTRLMEAS_REG, &data, 1);
-    if (err) {
-        ESP_LOGI(TAG, "qmp6988 write power mode failed: %d", err);
-        return;
-    }
-    ESP_LOGI(TAG, "qmp_set_powermode 0xf4=0x%x \r\n", data);
 
-    vTaskDelay(pdMS_TO_TICKS(20));
-}
-
-static void
-QMP6988_setFilter(I2CDevice_t slave, unsigned char filter)
-{
-    uint8_t data;
-
-    data = (filter & 0x03);
-    const esp_err_t err = Core2ForAWS_Port_A_I2C_Write(slave, QMP6988_CONFIG_REG, &data, 1);
-    if (err) {
-        ESP_LOGI(TAG, "QMP6988_setFilter failed: %d", err);
-        return;
-    }
-
-    vTaskDelay(pdMS_TO_TICKS(20));
+    QMP6988_setFloatCoefficients(&qmp6988.qmp6988_cali, &qmp6988.fk);
+    return 1;
 }
 
-static void
-QMP6988_setOversamplingP(I2CDevice_t slave, unsigned char oversampling_p)
+// Sets filter, oversampling and power mode with one write per register instead of read-modify-writes
+static esp_err_t
+QMP6988_configure(I2CDevice_t slave,
+                  uint8_t power_mode,
+                  uint8_t filter,
+                  uint8_t oversampling_p,
+                  uint8_t oversampling_t)
 {
-    uint8_t data;
-
-    esp_err_t err = Core2ForAWS_Port_A_I2C_Read(slave, QMP6988_CTRLMEAS_REG, &data, 1);
-    if (err) {
-        ESP_LOGI(TAG, "QMP6988_setOversamplingP read error: %d", err);
-        return;
-    }
-    data &= 0xe3;
-    data |= (oversampling_p << 2);
-    err = Core2ForAWS_Port_A_I2C_Write(slave, QMP6988_CTRLMEAS_REG, &data, 1);
+    uint8_t data = filter & QMP6988_CONFIG_REG_FILTER__MSK;
+    esp_err_t err = Core2ForAWS_Port_A_I2C_Write(slave, QMP6988_CONFIG_REG, &data, 1);
     if (err) {
-        ESP_LOGI(TAG, "QMP6988_setOversamplingP write error: %d", err);
-        return;
+        ESP_LOGI(TAG, "QMP6988 filter write failed: %d", err);
+        return err;
     }
 
-    vTaskDelay(pdMS_TO_TICKS(20));
-}
-
-static void
-QMP6988_setOversamplingT(I2CDevice_t slave, unsigned char oversampling_t)
-{
-    uint8_t data;
-
-    esp_err_t err = Core2ForAWS_Port_A_I2C_Read(slave, QMP6988_CTRLMEAS_REG, &data, 1);
-    if (err) {
-        ESP_LOGI(TAG, "QMP6988_setOversamplingT read error: %d", err);
-        return;
-    }
-    data &= 0x1f;
-    data |= (oversampling_t << 5);
+    data = ((oversampling_t << QMP6988_CTRLMEAS_REG_OSRST__POS) & QMP6988_CTRLMEAS_REG_OSRST__MSK) |
+           ((oversampling_p << QMP6988_CTRLMEAS_REG_OSRSP__POS) & QMP6988_CTRLMEAS_REG_OSRSP__MSK) |
+           ((power_mode << QMP6988_CTRLMEAS_REG_MODE__POS) & QMP6988_CTRLMEAS_REG_MODE__MSK);
     err = Core2ForAWS_Port_A_I2C_Write(slave, QMP6988_CTRLMEAS_REG, &data, 1);
     if (err) {
-        ESP_LOGI(TAG, "QMP6988_setOversamplingT write error: %d", err);
-        return;
+        ESP_LOGI(TAG, "QMP6988 measurement control write failed: %d", err);
+        return err;
     }
-
-    vTaskDelay(pdMS_TO_TICKS(20));
+    qmp6988.power_mode = power_mode;
+    ESP_LOGI(TAG, "qmp6988 configured 0xf4=0x%x", data);
+    return ESP_OK;
 }
 
 I2CDevice_t
@@ -355,11 +386,12 @@ QMP6988_deviceCheck()
                 return NULL;
             }
 
-            QMP6988_getCalibrationData(slave);
-            QMP6988_setpPowermode(slave, QMP6988_NORMAL_MODE);
-            QMP6988_setFilter(slave, QMP6988_FILTERCOEFF_4);
-            QMP6988_setOversamplingP(slave, QMP6988_OVERSAMPLING_8X);
-            QMP6988_setOversamplingT(slave, QMP6988_OVERSAMPLING_1X);
+            QMP6988_getCalibrationData(slave, slave_dev_list[i]);
+            QMP6988_configure(slave,
+                              QMP6988_NORMAL_MODE,
+                              QMP6988_FILTERCOEFF_4,
+                              QMP6988_OVERSAMPLING_8X,
+                              QMP6988_OVERSAMPLING_1X);
 
             return slave;
         } else {
@@ -426,13 +458,89 @@ QMP6988_getPressure02e(qmp6988_ik_data_t* ik, QMP6988_S32_t dp, QMP6988_S16_t tx
     return ret;
 }
 
+static QMP6988RawSample
+QMP6988_parseRaw(const uint8_t a_data_uint8_tr[6])
+{
+    QMP6988_U32_t P_read, T_read;
+
+    P_read = (QMP6988_U32_t)((((QMP6988_U32_t)(a_data_uint8_tr[0])) << SHIFT_LEFT_16_POSITION) |
+                             (((QMP6988_U16_t)(a_data_uint8_tr[1])) << SHIFT_LEFT_8_POSITION) |
+                             (a_data_uint8_tr[2]));
+    T_read = (QMP6988_U32_t)((((QMP6988_U32_t)(a_data_uint8_tr[3])) << SHIFT_LEFT_16_POSITION) |
+                             (((QMP6988_U16_t)(a_data_uint8_tr[4])) << SHIFT_LEFT_8_POSITION) |
+                             (a_data_uint8_tr[5]));
+
+    const QMP6988RawSample raw = { .pressure = (QMP6988_S32_t)(P_read - SUBTRACTOR),
+                                   .temperature = (QMP6988_S32_t)(T_read - SUBTRACTOR) };
+    return raw;
+}
+
+#ifdef CONFIG_QMP6988_COMPENSATION_INTEGER
+
+static void
+QMP6988_compensate(const qmp6988_data_t* data,
+                   const QMP6988RawSample* samples,
+                   float* pressures,
+                   float* temperatures,
+                   size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const QMP6988_S16_t T_int = QMP6988_convTx02e((qmp6988_ik_data_t*)&data->ik, samples[i].temperature);
+        const QMP6988_S32_t P_int =
+          QMP6988_getPressure02e((qmp6988_ik_data_t*)&data->ik, samples[i].pressure, T_int);
+        pressures[i] = (float)P_int / 16.0f;
+        if (temperatures != NULL) {
+            temperatures[i] = (float)T_int / 256.0f;
+        }
+    }
+}
+
+#else
+
+static void
+QMP6988_compensate(const qmp6988_data_t* data,
+                   const QMP6988RawSample* samples,
+                   float* pressures,
+                   float* temperatures,
+                   size_t count)
+{
+    // Local copies let the compiler keep the coefficients in FPU registers across the loop
+    const qmp6988_fk_data_t fk = data->fk;
+    for (size_t i = 0; i < count; ++i) {
+        const float dt = samples[i].temperature;
+        const float dp = samples[i].pressure;
+
+        // Tr in 1/256 °C, rounded down like the integer path
+        const float tr = floorf(fk.a0 + dt * (fk.a1 + dt * fk.a2));
+        const float dp2_factor = fk.bp2 + tr * fk.b21 + dp * fk.bp3;
+        const float dp_factor = fk.bp1 + tr * (fk.b11 + tr * fk.b12) + dp * dp2_factor;
+        pressures[i] = fk.b00 + tr * (fk.bt1 + tr * fk.bt2) + dp * dp_factor;
+        if (temperatures != NULL) {
+            temperatures[i] = tr / 256.0f;
+        }
+    }
+}
+
+#endif
+
+void
+QMP6988_compensateBatch(const QMP6988RawSample* samples, float* pressures, size_t count)
+{
+    QMP6988_compensate(&qmp6988, samples, pressures, NULL, count);
+}
+
+static float
+QMP6988_convert(const uint8_t a_data_uint8_tr[6])
+{
+    const QMP6988RawSample raw = QMP6988_parseRaw(a_data_uint8_tr);
+    QMP6988_compensate(&qmp6988, &raw, &qmp6988.pressure, &qmp6988.temperature, 1);
+    return qmp6988.pressure;
+}
+
 float
 QMP6988_calcPressure(I2CDevice_t slave)
 {
-    QMP6988_U32_t P_read, T_read;
-    QMP6988_S32_t P_raw, T_raw;
     uint8_t a_data_uint8_tr[6] = { 0 };
-    QMP6988_S32_t T_int, P_int;
 
     // press
     esp_err_t err = Core2ForAWS_Port_A_I2C_Read(slave, QMP6988_PRESSURE_MSB_REG, &a_data_uint8_tr[0], 6);
@@ -440,22 +548,39 @@ QMP6988_calcPressure(I2CDevice_t slave)
         ESP_LOGI(TAG, "QMP6988_calcPressure failed to read: %d", err);
         return 0.0f;
     }
-    P_read = (QMP6988_U32_t)((((QMP6988_U32_t)(a_data_uint8_tr[0])) << SHIFT_LEFT_16_POSITION) |
-                             (((QMP6988_U16_t)(a_data_uint8_tr[1])) << SHIFT_LEFT_8_POSITION) |
-                             (a_data_uint8_tr[2]));
-    P_raw = (QMP6988_S32_t)(P_read - SUBTRACTOR);
-
-    T_read = (QMP6988_U32_t)((((QMP6988_U32_t)(a_data_uint8_tr[3])) << SHIFT_LEFT_16_POSITION) |
-                             (((QMP6988_U16_t)(a_data_uint8_tr[4])) << SHIFT_LEFT_8_POSITION) |
-                             (a_data_uint8_tr[5]));
-    T_raw = (QMP6988_S32_t)(T_read - SUBTRACTOR);
+    return QMP6988_convert(a_data_uint8_tr);
+}
 
-    T_int = QMP6988_convTx02e(&(qmp6988.ik), T_raw);
-    P_int = QMP6988_getPressure02e(&(qmp6988.ik), P_raw, T_int);
-    qmp6988.temperature = (float)T_int / 256.0f;
-    qmp6988.pressure = (float)P_int / 16.0f;
+static void
+QMP6988_data_read(I2CTransaction* transaction)
+{
+    QMP6988Request* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGI(TAG, "QMP6988_calcPressure failed to read: %d", transaction->result);
+    } else {
+        request->pressure = QMP6988_convert(request->data);
+        request->is_valid = true;
+    }
+    request->done(request->context);
+}
 
-    return qmp6988.pressure;
+void
+QMP6988_start_read(QMP6988Request* request, I2CDevice_t slave, I2CRequestDone done, void* context)
+{
+    request->pressure = 0.0f;
+    request->is_valid = false;
+    request->done = done;
+    request->context = context;
+
+    I2CTransaction* transaction = &request->transaction;
+    transaction->device = slave;
+    transaction->register_address = QMP6988_PRESSURE_MSB_REG;
+    transaction->data = request->data;
+    transaction->length = sizeof(request->data);
+    transaction->is_read = true;
+    transaction->done = QMP6988_data_read;
+    transaction->context = request;
+    i2c_queue_submit(transaction, 0);
 }
 
 /**
@@ -463,15 +588,72 @@ QMP6988_calcPressure(I2CDevice_t slave)
  */
 const uint8_t SHT3x_DEVICE_ADDRESS = 0x44;
 
+// High repeatability single shot measurements take at most 15 ms
+#define SHT3x_MEASUREMENT_MS 20
+
+static byte SHT3x_MEASUREMENT_COMMAND[] = { 0x2C, 0x06 };
+static byte SHT3x_FETCH_COMMAND[] = { 0xE0, 0x00 };
+
+// CRC-8 with polynomial 0x31, see the SHT3x datasheet section 4.12
+static const uint8_t SHT3x_CRC_TABLE[256] = {
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA,
+    0x7D, 0x4C, 0x1F, 0x2E, 0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4,
+    0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D, 0x86, 0xB7, 0xE4, 0xD5,
+    0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F,
+    0xB8, 0x89, 0xDA, 0xEB, 0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA,
+    0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13, 0x7E, 0x4F, 0x1C, 0x2D,
+    0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51,
+    0xC6, 0xF7, 0xA4, 0x95, 0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F,
+    0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6, 0x7A, 0x4B, 0x18, 0x29,
+    0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3,
+    0x44, 0x75, 0x26, 0x17, 0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B,
+    0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2, 0xBF, 0x8E, 0xDD, 0xEC,
+    0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD,
+    0x3A, 0x0B, 0x58, 0x69, 0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93,
+    0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A, 0xC1, 0xF0, 0xA3, 0x92,
+    0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68,
+    0xFF, 0xCE, 0x9D, 0xAC,
+};
+
+// Checks the CRC (initial value 0xFF) of one 16-bit word followed by its checksum byte
+static bool
+SHT3x_checkWord(const byte word[3])
+{
+    return SHT3x_CRC_TABLE[SHT3x_CRC_TABLE[0xFF ^ word[0]] ^ word[1]] == word[2];
+}
+
+static bool
+SHT3x_checkData(const byte temp_data[6])
+{
+    return SHT3x_checkWord(&temp_data[0]) && SHT3x_checkWord(&temp_data[3]);
+}
+
+static SHT3xMeasurement
+SHT3x_convert(const byte temp_data[6])
+{
+    // Read 6 bytes of data and convert
+    // cTemp msb, cTemp lsb, cTemp crc, humidity msb, humidity lsb, humidity crc
+    SHT3xMeasurement sht3x_measurement;
+    sht3x_measurement.temperature = ((((temp_data[0] * 256.0) + temp_data[1]) * 175) / 65535.0) - 45;
+    sht3x_measurement.humidity = ((((temp_data[3] * 256.0) + temp_data[4]) * 100) / 65535.0);
+    /* ESP_LOGI(TAG, "READ from A for address 0x44 - DONE, temp: %.1f, humidity: %.1f", temperature,
+     * humidity); */
+    return sht3x_measurement;
+}
+
 SHT3xMeasurement
 SHT3x_get_measurement(I2CDevice_t sht3x_peripheral)
 {
-    static byte measurement_command[] = { 0x2C, 0x06 };
     byte temp_data[6] = {};
 
     SHT3xMeasurement sht3x_measurement = { .temperature = 0.0f, .humidity = 0.0f };
     esp_err_t err = Core2ForAWS_Port_A_I2C_Write(
-      sht3x_peripheral, I2C_NO_REG, &measurement_command[0], sizeof(measurement_command));
+      sht3x_peripheral, I2C_NO_REG, &SHT3x_MEASUREMENT_COMMAND[0], sizeof(SHT3x_MEASUREMENT_COMMAND));
     if (err) {
         ESP_LOGE(TAG, "Failed to write measurement command — %d", err);
         return sht3x_measurement;
@@ -482,12 +664,175 @@ SHT3x_get_measurement(I2CDevice_t sht3x_peripheral)
         ESP_LOGE(TAG, "Failed to read temperature data — %d", err);
         return sht3x_measurement;
     }
+    if (!SHT3x_checkData(temp_data)) {
+        ESP_LOGE(TAG, "Temperature data CRC mismatch");
+        return sht3x_measurement;
+    }
+    return SHT3x_convert(temp_data);
+}
 
-    // Read 6 bytes of data and convert
-    // cTemp msb, cTemp lsb, cTemp crc, humidity msb, humidity lsb, humidity crc
-    sht3x_measurement.temperature = ((((temp_data[0] * 256.0) + temp_data[1]) * 175) / 65535.0) - 45;
-    sht3x_measurement.humidity = ((((temp_data[3] * 256.0) + temp_data[4]) * 100) / 65535.0);
-    /* ESP_LOGI(TAG, "READ from A for address 0x44 - DONE, temp: %.1f, humidity: %.1f", temperature,
-     * humidity); */
-    return sht3x_measurement;
+static void
+SHT3x_data_read(I2CTransaction* transaction)
+{
+    SHT3xRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGE(TAG, "Failed to read temperature data — %d", transaction->result);
+    } else if (!SHT3x_checkData(request->data)) {
+        ESP_LOGE(TAG, "Temperature data CRC mismatch");
+    } else {
+        request->measurement = SHT3x_convert(request->data);
+        request->is_valid = true;
+    }
+    request->done(request->context);
+}
+
+static void
+SHT3x_command_written(I2CTransaction* transaction)
+{
+    SHT3xRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGE(TAG, "Failed to write measurement command — %d", transaction->result);
+        request->done(request->context);
+        return;
+    }
+
+    transaction->data = request->data;
+    transaction->length = sizeof(request->data);
+    transaction->is_read = true;
+    transaction->done = SHT3x_data_read;
+    i2c_queue_submit(transaction, SHT3x_MEASUREMENT_MS);
+}
+
+void
+SHT3x_start_measurement(SHT3xRequest* request,
+                        I2CDevice_t sht3x_peripheral,
+                        I2CRequestDone done,
+                        void* context)
+{
+    request->measurement.temperature = 0.0f;
+    request->measurement.humidity = 0.0f;
+    request->is_valid = false;
+    request->done = done;
+    request->context = context;
+
+    I2CTransaction* transaction = &request->transaction;
+    transaction->device = sht3x_peripheral;
+    transaction->register_address = I2C_NO_REG;
+    transaction->data = SHT3x_MEASUREMENT_COMMAND;
+    transaction->length = sizeof(SHT3x_MEASUREMENT_COMMAND);
+    transaction->is_read = false;
+    transaction->done = SHT3x_command_written;
+    transaction->context = request;
+    i2c_queue_submit(transaction, 0);
+}
+
+esp_err_t
+SHT3x_start_periodic(I2CDevice_t sht3x_peripheral, uint32_t measurements_per_second)
+{
+    // High repeatability variants of the periodic acquisition commands
+    byte command[2];
+    switch (measurements_per_second) {
+        case 1:
+            command[0] = 0x21;
+            command[1] = 0x30;
+            break;
+        case 2:
+            command[0] = 0x22;
+            command[1] = 0x36;
+            break;
+        case 4:
+            command[0] = 0x23;
+            command[1] = 0x34;
+            break;
+        case 10:
+            command[0] = 0x27;
+            command[1] = 0x37;
+            break;
+        default:
+            ESP_LOGE(TAG, "Unsupported SHT3x rate: %u mps", measurements_per_second);
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    const esp_err_t err =
+      Core2ForAWS_Port_A_I2C_Write(sht3x_peripheral, I2C_NO_REG, command, sizeof(command));
+    if (err) {
+        ESP_LOGE(TAG, "Failed to start periodic measurement — %d", err);
+    }
+    return err;
+}
+
+static void
+SHT3x_fetch_read(I2CTransaction* transaction)
+{
+    SHT3xRequest* request = transaction->context;
+    if (transaction->result) {
+        // The sensor NACKs the read when no new result was produced since the last fetch
+        ESP_LOGD(TAG, "No periodic SHT3x data — %d", transaction->result);
+    } else if (!SHT3x_checkData(request->data)) {
+        ESP_LOGW(TAG, "Periodic temperature data CRC mismatch");
+    } else {
+        request->measurement = SHT3x_convert(request->data);
+        request->is_valid = true;
+    }
+    request->done(request->context);
+}
+
+static void
+SHT3x_fetch_written(I2CTransaction* transaction)
+{
+    SHT3xRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGE(TAG, "Failed to write fetch command — %d", transaction->result);
+        request->done(request->context);
+        return;
+    }
+
+    transaction->data = request->data;
+    transaction->length = sizeof(request->data);
+    transaction->is_read = true;
+    transaction->done = SHT3x_fetch_read;
+    i2c_queue_submit(transaction, 0);
+}
+
+void
+SHT3x_start_fetch(SHT3xRequest* request,
+                  I2CDevice_t sht3x_peripheral,
+                  I2CRequestDone done,
+                  void* context)
+{
+    request->is_valid = false;
+    request->done = done;
+    request->context = context;
+
+    I2CTransaction* transaction = &request->transaction;
+    transaction->device = sht3x_peripheral;
+    transaction->register_address = I2C_NO_REG;
+    transaction->data = SHT3x_FETCH_COMMAND;
+    transaction->length = sizeof(SHT3x_FETCH_COMMAND);
+    transaction->is_read = false;
+    transaction->done = SHT3x_fetch_written;
+    transaction->context = request;
+    i2c_queue_submit(transaction, 0);
+}
+
+void
+SHT3x_decimator_add(SHT3xDecimator* decimator, SHT3xMeasurement measurement)
+{
+    decimator->temperature_sum += measurement.temperature;
+    decimator->humidity_sum += measurement.humidity;
+    ++decimator->count;
+}
+
+bool
+SHT3x_decimator_take(SHT3xDecimator* decimator, SHT3xMeasurement* mean)
+{
+    if (decimator->count == 0) {
+        return false;
+    }
+    mean->temperature = decimator->temperature_sum / decimator->count;
+    mean->humidity = decimator->humidity_sum / decimator->count;
+    decimator->temperature_sum = 0.0f;
+    decimator->humidity_sum = 0.0f;
+    decimator->count = 0;
+    return true;
 }
@@ -0,0 +1,175 @@
+#include "fmt.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+static const uint32_t POW10[FMT_MAX_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+static char*
+terminate(char* dst, char* end)
+{
+    if (dst < end) {
+        *dst = '\0';
+    }
+    return dst;
+}
+
+// Writes `count` characters from `digits` (least significant first) in reverse
+static char*
+put_reversed(char* dst, char* end, const char* digits, unsigned count)
+{
+    while (count > 0 && dst + 1 < end) {
+        *dst++ = digits[--count];
+    }
+    return terminate(dst, end);
+}
+
+static char*
+put_uint64(char* dst, char* end, uint64_t value, unsigned width)
+{
+    char digits[20];
+    unsigned count = 0;
+    // 32-bit divisions are much cheaper on the ESP32, only fall back when needed
+    while (value > UINT32_MAX) {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    }
+    uint32_t small = value;
+    do {
+        digits[count++] = '0' + small % 10;
+        small /= 10;
+    } while (small != 0);
+    while (count < width && count < sizeof(digits)) {
+        digits[count++] = '0';
+    }
+    return put_reversed(dst, end, digits, count);
+}
+
+// Writes digits / 10^decimals with exactly `decimals` places
+static char*
+put_scaled(char* dst, char* end, bool negative, uint64_t digits, unsigned decimals)
+{
+    if (negative) {
+        dst = fmt_char(dst, end, '-');
+    }
+    dst = put_uint64(dst, end, digits / POW10[decimals], 1);
+    if (decimals > 0) {
+        dst = fmt_char(dst, end, '.');
+        dst = put_uint64(dst, end, digits % POW10[decimals], decimals);
+    }
+    return dst;
+}
+
+// Exact a * b - product for product = a * b rounded (Dekker), with b below 2^52 / a. Needs every
+// operation rounded on its own, ESP32 doubles are soft-float and never fused.
+static double
+product_error(double a, double b, double product)
+{
+    const double split = 134217729.0; // 2^27 + 1
+    const double a_split = split * a;
+    const double a_high = a_split - (a_split - a);
+    const double a_low = a - a_high;
+    const double b_split = split * b;
+    const double b_high = b_split - (b_split - b);
+    const double b_low = b - b_high;
+    return ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low;
+}
+
+char*
+fmt_char(char* dst, char* end, char c)
+{
+    if (dst + 1 < end) {
+        *dst++ = c;
+    }
+    return terminate(dst, end);
+}
+
+char*
+fmt_str(char* dst, char* end, const char* text)
+{
+    while (*text != '\0' && dst + 1 < end) {
+        *dst++ = *text++;
+    }
+    return terminate(dst, end);
+}
+
+char*
+fmt_uint(char* dst, char* end, uint32_t value, unsigned width)
+{
+    return put_uint64(dst, end, value, width);
+}
+
+char*
+fmt_int(char* dst, char* end, int32_t value, unsigned width)
+{
+    if (value < 0) {
+        dst = fmt_char(dst, end, '-');
+        // printf counts the sign into the field width
+        return put_uint64(dst, end, -(int64_t)value, width > 0 ? width - 1 : 0);
+    }
+    return put_uint64(dst, end, value, width);
+}
+
+char*
+fmt_fixed(char* dst, char* end, double value, unsigned decimals)
+{
+    if (isnan(value)) {
+        return fmt_str(dst, end, "nan");
+    }
+    const bool negative = signbit(value);
+    if (negative) {
+        value = -value;
+    }
+    if (isinf(value)) {
+        return fmt_str(dst, end, negative ? "-inf" : "inf");
+    }
+    if (decimals > FMT_MAX_DECIMALS) {
+        decimals = FMT_MAX_DECIMALS;
+    }
+
+    const double scaled = value * POW10[decimals];
+    if (scaled >= 0x1p52) {
+        // Far outside anything the sensors produce, not worth a fast path
+        const int written = snprintf(dst, end - dst, "%s%.*f", negative ? "-" : "", decimals, value);
+        return dst + (written < end - dst ? written : end - dst - 1);
+    }
+
+    // The product is rounded, so it can land on a midpoint the exact value misses (-12.345 * 100 gives
+    // 1234.5). The distance to the midpoint is exact and only a zero needs the rounding error.
+    const double whole = floor(scaled);
+    double from_half = (scaled - whole) - 0.5;
+    if (from_half == 0.0) {
+        from_half = product_error(value, POW10[decimals], scaled);
+    }
+    uint64_t digits = (uint64_t)whole;
+    if (from_half > 0.0 || (from_half == 0.0 && (digits & 1) != 0)) {
+        ++digits;
+    }
+
+    return put_scaled(dst, end, negative, digits, decimals);
+}
+
+char*
+fmt_scaled(char* dst, char* end, int64_t value, unsigned decimals)
+{
+    if (decimals > FMT_MAX_DECIMALS) {
+        decimals = FMT_MAX_DECIMALS;
+    }
+    const bool negative = value < 0;
+    return put_scaled(dst, end, negative, negative ? -(uint64_t)value : (uint64_t)value, decimals);
+}
+
+char*
+fmt_ipv4(char* dst, char* end, uint32_t address)
+{
+    for (int i = 0; i < 4; ++i) {
+        if (i > 0) {
+            dst = fmt_char(dst, end, '.');
+        }
+        dst = put_uint64(dst, end, (address >> (8 * i)) & 0xff, 1);
+    }
+    return dst;
+}
@@ -0,0 +1,333 @@
+#include "geofence.h"
+
+#include <math.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char* TAG = "GEOFENCE";
+
+#define NO_ENTRY UINT16_MAX
+#define BUCKET_COUNT (1 << GEOFENCE_BUCKET_BITS)
+#define INSIDE_WORDS ((GEOFENCE_MAX_FENCES + 31) / 32)
+#define MAX_LATITUDE_E7 900000000
+#define MAX_LONGITUDE_E7 1800000000
+// Same sphere as TinyGPSPlus::distanceBetween(), 6372795 m
+#define METERS_PER_DEGREE 111226.3f
+#define MAX_RADIUS_M 1000000 // keeps squared radii in 64 bits, the flat earth model fails long before
+
+_Static_assert(GEOFENCE_MAX_FENCES < NO_ENTRY && GEOFENCE_MAX_ENTRIES < NO_ENTRY, "indices are 16 bits");
+
+typedef struct Fence
+{
+    uint32_t id;
+    GeofencePoint min; // bounding box
+    GeofencePoint max;
+    uint32_t first_vertex;    // center of a circle or the first polygon vertex
+    uint32_t vertex_count;    // 0 for circles
+    int64_t radius_e7;        // circles only
+    uint32_t longitude_scale; // cos(latitude) of a circle in Q16
+} Fence;
+
+typedef struct Entry
+{
+    uint16_t fence;
+    uint16_t next;
+} Entry;
+
+typedef struct Store
+{
+    Fence fences[GEOFENCE_MAX_FENCES];
+    GeofencePoint vertices[GEOFENCE_MAX_VERTICES];
+    Entry entries[GEOFENCE_MAX_ENTRIES];
+    uint16_t buckets[BUCKET_COUNT];
+    uint16_t wide[GEOFENCE_MAX_FENCES]; // fences too large for the grid
+    uint32_t inside[INSIDE_WORDS];      // one bit per fence, state after the last fix
+    uint32_t fence_count;
+    uint32_t vertex_count;
+    uint32_t entry_count;
+    uint32_t wide_count;
+} Store;
+
+static Store* STORE = NULL;
+static SemaphoreHandle_t MUTEX = NULL;
+static GeofenceHandler HANDLER = NULL;
+
+static void
+reset_store(void)
+{
+    STORE->fence_count = 0;
+    STORE->vertex_count = 0;
+    STORE->entry_count = 0;
+    STORE->wide_count = 0;
+    memset(STORE->buckets, 0xff, sizeof(STORE->buckets)); // every bucket starts as NO_ENTRY
+    memset(STORE->inside, 0, sizeof(STORE->inside));
+}
+
+bool
+geofence_init(GeofenceHandler handler)
+{
+    STORE = heap_caps_malloc(sizeof(Store), MALLOC_CAP_SPIRAM);
+    MUTEX = xSemaphoreCreateMutex();
+    if (STORE == NULL || MUTEX == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes for geofences", (unsigned)sizeof(Store));
+        return false;
+    }
+    HANDLER = handler;
+    reset_store();
+    return true;
+}
+
+static int32_t
+cell_of(int32_t coordinate_e7)
+{
+    return coordinate_e7 >> GEOFENCE_CELL_SHIFT; // arithmetic shift rounds towards minus infinity
+}
+
+static uint32_t
+bucket_of(int32_t latitude_cell, int32_t longitude_cell)
+{
+    const uint32_t hash = (uint32_t)latitude_cell * 0x9e3779b1u ^ (uint32_t)longitude_cell * 0x85ebca77u;
+    return hash >> (32 - GEOFENCE_BUCKET_BITS);
+}
+
+static bool
+valid_point(GeofencePoint point)
+{
+    return point.latitude_e7 >= -MAX_LATITUDE_E7 && point.latitude_e7 <= MAX_LATITUDE_E7 &&
+           point.longitude_e7 >= -MAX_LONGITUDE_E7 && point.longitude_e7 <= MAX_LONGITUDE_E7;
+}
+
+// Registers the last fence in every cell its bounding box touches
+static void
+index_fence(uint32_t index)
+{
+    const Fence* fence = &STORE->fences[index];
+    const int32_t lat_min = cell_of(fence->min.latitude_e7);
+    const int32_t lat_max = cell_of(fence->max.latitude_e7);
+    const int32_t lng_min = cell_of(fence->min.longitude_e7);
+    const int32_t lng_max = cell_of(fence->max.longitude_e7);
+    const int64_t cells = (int64_t)(lat_max - lat_min + 1) * (lng_max - lng_min + 1);
+    if (cells > GEOFENCE_MAX_FENCE_CELLS || STORE->entry_count + cells > GEOFENCE_MAX_ENTRIES) {
+        STORE->wide[STORE->wide_count++] = index;
+        return;
+    }
+
+    for (int32_t lat = lat_min; lat <= lat_max; ++lat) {
+        for (int32_t lng = lng_min; lng <= lng_max; ++lng) {
+            uint16_t* head = &STORE->buckets[bucket_of(lat, lng)];
+            if (*head != NO_ENTRY && STORE->entries[*head].fence == index) {
+                continue; // two cells of this fence share a bucket
+            }
+            Entry* entry = &STORE->entries[STORE->entry_count];
+            entry->fence = index;
+            entry->next = *head;
+            *head = STORE->entry_count++;
+        }
+    }
+}
+
+esp_err_t
+geofence_add_circle(uint32_t id, GeofencePoint center, uint32_t radius_m)
+{
+    if (STORE == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!valid_point(center) || radius_m == 0 || radius_m > MAX_RADIUS_M) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Locally flat earth, longitudes are scaled down to the length of a latitude degree
+    const float latitude = center.latitude_e7 * (float)(M_PI / 180.0 / 1e7);
+    const float scale = MAX(cosf(latitude), 1.0f / 65536);
+    const int64_t radius_e7 = (int64_t)(radius_m / METERS_PER_DEGREE * 1e7f);
+    const int64_t lng_radius_e7 = (int64_t)(radius_e7 / scale);
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(MUTEX, portMAX_DELAY);
+    if (STORE->fence_count == GEOFENCE_MAX_FENCES || STORE->vertex_count == GEOFENCE_MAX_VERTICES) {
+        err = ESP_ERR_NO_MEM;
+    } else {
+        const uint32_t index = STORE->fence_count++;
+        Fence* fence = &STORE->fences[index];
+        fence->id = id;
+        fence->min.latitude_e7 = MAX(center.latitude_e7 - radius_e7, -MAX_LATITUDE_E7);
+        fence->max.latitude_e7 = MIN(center.latitude_e7 + radius_e7, MAX_LATITUDE_E7);
+        fence->min.longitude_e7 = MAX(center.longitude_e7 - lng_radius_e7, -MAX_LONGITUDE_E7);
+        fence->max.longitude_e7 = MIN(center.longitude_e7 + lng_radius_e7, MAX_LONGITUDE_E7);
+        fence->first_vertex = STORE->vertex_count++;
+        fence->vertex_count = 0;
+        fence->radius_e7 = radius_e7;
+        fence->longitude_scale = (uint32_t)(scale * 65536);
+        STORE->vertices[fence->first_vertex] = center;
+        index_fence(index);
+    }
+    xSemaphoreGive(MUTEX);
+    return err;
+}
+
+esp_err_t
+geofence_add_polygon(uint32_t id, const GeofencePoint* vertices, size_t count)
+{
+    if (STORE == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (count < 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    GeofencePoint min = vertices[0];
+    GeofencePoint max = vertices[0];
+    for (size_t i = 0; i < count; ++i) {
+        if (!valid_point(vertices[i])) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        min.latitude_e7 = MIN(min.latitude_e7, vertices[i].latitude_e7);
+        min.longitude_e7 = MIN(min.longitude_e7, vertices[i].longitude_e7);
+        max.latitude_e7 = MAX(max.latitude_e7, vertices[i].latitude_e7);
+        max.longitude_e7 = MAX(max.longitude_e7, vertices[i].longitude_e7);
+    }
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(MUTEX, portMAX_DELAY);
+    if (STORE->fence_count == GEOFENCE_MAX_FENCES || count > GEOFENCE_MAX_VERTICES - STORE->vertex_count) {
+        err = ESP_ERR_NO_MEM;
+    } else {
+        const uint32_t index = STORE->fence_count++;
+        Fence* fence = &STORE->fences[index];
+        fence->id = id;
+        fence->min = min;
+        fence->max = max;
+        fence->first_vertex = STORE->vertex_count;
+        fence->vertex_count = count;
+        memcpy(&STORE->vertices[STORE->vertex_count], vertices, count * sizeof(GeofencePoint));
+        STORE->vertex_count += count;
+        index_fence(index);
+    }
+    xSemaphoreGive(MUTEX);
+    return err;
+}
+
+void
+geofence_clear(void)
+{
+    if (STORE == NULL) {
+        return;
+    }
+    xSemaphoreTake(MUTEX, portMAX_DELAY);
+    reset_store();
+    xSemaphoreGive(MUTEX);
+}
+
+// Crossing number along a ray towards increasing longitude. Products of coordinate differences
+// are at most 3.6e9 * 1.8e9 and fit into 64 bits.
+static bool
+polygon_contains(const GeofencePoint* vertices, uint32_t count, int32_t lat, int32_t lng)
+{
+    bool inside = false;
+    const GeofencePoint* previous = &vertices[count - 1];
+    for (uint32_t i = 0; i < count; ++i) {
+        const GeofencePoint* current = &vertices[i];
+        if ((current->latitude_e7 > lat) != (previous->latitude_e7 > lat)) {
+            const int64_t edge_lat = (int64_t)previous->latitude_e7 - current->latitude_e7;
+            const int64_t edge_lng = (int64_t)previous->longitude_e7 - current->longitude_e7;
+            const int64_t crossing = edge_lng * ((int64_t)lat - current->latitude_e7);
+            const int64_t point = ((int64_t)lng - current->longitude_e7) * edge_lat;
+            // point lies west of the edge crossing, the comparison flips with the edge direction
+            if (edge_lat > 0 ? point < crossing : point > crossing) {
+                inside = !inside;
+            }
+        }
+        previous = current;
+    }
+    return inside;
+}
+
+static bool
+fence_contains(const Fence* fence, int32_t lat, int32_t lng)
+{
+    if (lat < fence->min.latitude_e7 || lat > fence->max.latitude_e7 || lng < fence->min.longitude_e7 ||
+        lng > fence->max.longitude_e7) {
+        return false;
+    }
+    const GeofencePoint* vertices = &STORE->vertices[fence->first_vertex];
+    if (fence->vertex_count > 0) {
+        return polygon_contains(vertices, fence->vertex_count, lat, lng);
+    }
+    const int64_t dlat = (int64_t)lat - vertices->latitude_e7;
+    const int64_t dlng = ((int64_t)lng - vertices->longitude_e7) * fence->longitude_scale >> 16;
+    return dlat * dlat + dlng * dlng <= fence->radius_e7 * fence->radius_e7;
+}
+
+void
+geofence_update(const GpsPosition* position)
+{
+    if (STORE == NULL || !position->is_valid) {
+        return;
+    }
+    const int32_t lat = position->latitude_e7;
+    const int32_t lng = position->longitude_e7;
+
+    xSemaphoreTake(MUTEX, portMAX_DELAY);
+    uint32_t inside[INSIDE_WORDS] = { 0 };
+    for (uint16_t e = STORE->buckets[bucket_of(cell_of(lat), cell_of(lng))]; e != NO_ENTRY;
+         e = STORE->entries[e].next) {
+        const uint16_t index = STORE->entries[e].fence;
+        if (fence_contains(&STORE->fences[index], lat, lng)) {
+            inside[index / 32] |= 1u << (index % 32);
+        }
+    }
+    for (uint32_t i = 0; i < STORE->wide_count; ++i) {
+        const uint16_t index = STORE->wide[i];
+        if (fence_contains(&STORE->fences[index], lat, lng)) {
+            inside[index / 32] |= 1u << (index % 32);
+        }
+    }
+
+    // Only fences whose state differs from the previous fix raise events
+    const uint32_t words = (STORE->fence_count + 31) / 32;
+    for (uint32_t word = 0; word < words; ++word) {
+        uint32_t changed = inside[word] ^ STORE->inside[word];
+        STORE->inside[word] = inside[word];
+        while (changed != 0) {
+            const uint32_t bit = __builtin_ctz(changed);
+            changed &= changed - 1;
+            const Fence* fence = &STORE->fences[word * 32 + bit];
+            const GeofenceEvent event = (inside[word] >> bit) & 1 ? GEOFENCE_ENTER : GEOFENCE_EXIT;
+            if (HANDLER != NULL) {
+                HANDLER(fence->id, event, position);
+            }
+        }
+    }
+    xSemaphoreGive(MUTEX);
+}
+
+size_t
+geofence_count(void)
+{
+    return STORE != NULL ? __atomic_load_n(&STORE->fence_count, __ATOMIC_RELAXED) : 0;
+}
+
+size_t
+geofence_inside(uint32_t* ids, size_t max_ids)
+{
+    size_t count = 0;
+    if (STORE == NULL) {
+        return count;
+    }
+    xSemaphoreTake(MUTEX, portMAX_DELAY);
+    for (uint32_t index = 0; index < STORE->fence_count; ++index) {
+        if ((STORE->inside[index / 32] >> (index % 32)) & 1) {
+            if (count < max_ids) {
+                ids[count] = STORE->fences[index].id;
+            }
+            ++count;
+        }
+    }
+    xSemaphoreGive(MUTEX);
+    return count;
+}
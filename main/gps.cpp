@@ -3,7 +3,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
@@ -16,7 +15,17 @@
 #include "bm8563.h"
 #include "core2forAWS.h"
 
+#include "civil_time.h"
+#include "fmt.h"
+#include "geofence.h"
 #include "gps.h"
+#include "gps_track.h"
+#include "nav.h"
+#include "sensor_history.h"
+#include "snapshot.h"
+#if CONFIG_GPS_TRACK_LOG
+#include "track_log.h"
+#endif
 
 const char* GPS_TAB_NAME = "AT6558-GPS";
 static const char* TAG = GPS_TAB_NAME;
@@ -29,161 +38,270 @@ lv_obj_t* altitude_label = nullptr;
 lv_obj_t* satellites_label = nullptr;
 lv_obj_t* gps_time_label = nullptr;
 
-static GpsPosition GPS_POSITION = { .latitude = 0.0f,
-                                    .longitude = 0.0f,
-                                    .altitude = 0.0f,
-                                    .satellites = 0,
-                                    .unix_time = 0,
-                                    .is_valid = false };
-SemaphoreHandle_t GPS_POSITION_MUTEX;
+SNAPSHOT_DEFINE(GPS_POSITION, GpsPosition);
 
 GpsPosition
 get_latest_gps_position(void)
 {
-    xSemaphoreTake(GPS_POSITION_MUTEX, portMAX_DELAY);
-    GpsPosition gps_pos = GPS_POSITION;
-    xSemaphoreGive(GPS_POSITION_MUTEX);
+    GpsPosition gps_pos;
+    snapshot_read(&GPS_POSITION, &gps_pos);
     return gps_pos;
 }
 
+uint32_t
+read_latest_gps_position(GpsPosition* position)
+{
+    return snapshot_read(&GPS_POSITION, position);
+}
+
+// Integer division rounding to nearest, ties away from zero
+static int64_t
+divide_rounded(int64_t value, int64_t divisor)
+{
+    return (value < 0 ? value - divisor / 2 : value + divisor / 2) / divisor;
+}
+
 static void
-gps_task(void* pvParameters)
+format_label(char* buffer, size_t size, const char* prefix, int64_t value, unsigned decimals)
+{
+    char* const end = buffer + size;
+    fmt_scaled(fmt_str(buffer, end, prefix), end, value, decimals);
+}
+
+static void
+format_unknown(char* buffer, size_t size, const char* prefix)
+{
+    char* const end = buffer + size;
+    fmt_char(fmt_str(buffer, end, prefix), end, '?');
+}
+
+#define GPS_STACK_SIZE 4096
+// NMEA sentences are at most 82 characters, proprietary ones may be longer
+#define GPS_SENTENCE_SIZE 128
+#define RTC_SYNC_INTERVAL_MS (30 * 60 * 1000)
+
+static TinyGPSPlus gps;
+static uint8_t sentence[GPS_SENTENCE_SIZE];
+static uint32_t published_time = UINT32_MAX;
+static unsigned long last_time_from_gps_update = 0;
+static bool rtc_synced = false;
+
+static char text_lat_buffer[20];
+static char text_lng_buffer[20];
+static char text_alt_buffer[16];
+static char text_sat_buffer[24];
+static char text_date_buffer[36];
+
+#if CONFIG_GPS_TRACK_LOG
+#define SD_MOUNT_POINT "/sdcard"
+
+static sdmmc_card_t* sd_card = nullptr;
+static TrackLog track_log;
+static bool track_log_ready = false;
+
+// The SD card shares its SPI bus with the display, every access has to hold spi_mutex
+static void
+track_log_init(void)
 {
-    const esp_err_t err = Core2ForAWS_Port_PinMode(PORT_C_UART_RX_PIN, UART);
+    xSemaphoreTake(spi_mutex, portMAX_DELAY);
+    spi_poll();
+    esp_err_t err = Core2ForAWS_SDcard_Mount(SD_MOUNT_POINT, &sd_card);
+    if (err == ESP_OK) {
+        track_log_ready = track_log_open(&track_log, SD_MOUNT_POINT "/" CONFIG_GPS_TRACK_LOG_FILE);
+    } else {
+        ESP_LOGW(TAG, "No SD card, the track is not recorded");
+    }
+    xSemaphoreGive(spi_mutex);
+}
+
+static void
+track_log_record(const GpsPosition* position)
+{
+    if (!track_log_ready) {
+        return;
+    }
+    xSemaphoreTake(spi_mutex, portMAX_DELAY);
+    spi_poll();
+    if (!track_log_append(&track_log, position)) {
+        ESP_LOGE(TAG, "Failed to record the track, giving up");
+        track_log_close(&track_log);
+        track_log_ready = false;
+    }
+    xSemaphoreGive(spi_mutex);
+}
+#endif
+
+static bool
+gps_init(void)
+{
+    esp_err_t err = Core2ForAWS_Port_PinMode(PORT_C_UART_RX_PIN, UART);
+    if (err == ESP_OK) {
+        Core2ForAWS_Port_C_UART_Begin(9600);
+        err = Core2ForAWS_Port_C_UART_EnablePatternDetect('\n');
+    }
     if (err != ESP_OK) {
         const char* SENSOR_FAILED = "UART Sensor failed!";
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
         lv_label_set_static_text(latitude_label, SENSOR_FAILED);
+        xSemaphoreGive(xGuiSemaphore);
         ESP_LOGE(TAG, "Failed to enable UART port");
-        vTaskDelete(NULL); // Should never get to here...
-        return;
+        return false;
     }
 
-    TinyGPSPlus gps;
-    Core2ForAWS_Port_C_UART_Begin(9600);
-    int rxBytes;
-    uint8_t* data = reinterpret_cast<uint8_t*>(
-      heap_caps_malloc(UART_RX_BUF_SIZE,
-                       MALLOC_CAP_SPIRAM)); // Allocate space for message in external RAM
-
-    struct tm ttc;
-    ttc.tm_isdst = 0;
-
-    char text_lat_buffer[20];
-    char text_lng_buffer[20];
-    char text_alt_buffer[16];
-    char text_sat_buffer[16];
-    char text_date_buffer[36];
-    unsigned long last_time_from_gps_update = 0;
-    while (true) {
-        rxBytes = Core2ForAWS_Port_C_UART_Receive(data);
-        if (rxBytes > 0 && data[0] != '\0') {
-            // ESP_LOGI(TAG, "Read %d bytes from UART. Received: '%s'", rxBytes, data);
-            for (unsigned i = 0; i < rxBytes; ++i) {
-                gps.encode(data[i]);
-            }
+#if CONFIG_GPS_TRACK_LOG
+    track_log_init();
+#endif
+    return true;
+}
 
-            if (gps.location.isValid() && gps.altitude.isValid()) {
-                xSemaphoreTake(GPS_POSITION_MUTEX, portMAX_DELAY);
-                GPS_POSITION.latitude = gps.location.lat();
-                GPS_POSITION.longitude = gps.location.lng();
-                GPS_POSITION.altitude = gps.altitude.meters();
-                GPS_POSITION.satellites = gps.satellites.value();
-                GPS_POSITION.is_valid = true;
-                xSemaphoreGive(GPS_POSITION_MUTEX);
-            } else {
-                xSemaphoreTake(GPS_POSITION_MUTEX, portMAX_DELAY);
-                GPS_POSITION.latitude = 0.0f;
-                GPS_POSITION.longitude = 0.0f;
-                GPS_POSITION.altitude = 0.0f;
-                GPS_POSITION.satellites = 0;
-                GPS_POSITION.is_valid = false;
-                xSemaphoreGive(GPS_POSITION_MUTEX);
-            }
+static void
+geofence_event(uint32_t id, GeofenceEvent event, const GpsPosition* position)
+{
+    ESP_LOGI(TAG,
+             "%s geofence %u at %d, %d",
+             event == GEOFENCE_ENTER ? "Entered" : "Left",
+             id,
+             position->latitude_e7,
+             position->longitude_e7);
+}
 
-            if (gps.location.isValid()) {
-                snprintf(text_lat_buffer, sizeof(text_lat_buffer), "Latitude: %.6f", gps.location.lat());
-                snprintf(text_lng_buffer, sizeof(text_lng_buffer), "Longitude: %.6f", gps.location.lng());
-            } else {
-                snprintf(text_lat_buffer, sizeof(text_lat_buffer), "Latitude: ?");
-                snprintf(text_lng_buffer, sizeof(text_lng_buffer), "Longitude: ?");
-            }
-            if (gps.altitude.isValid()) {
-                snprintf(text_alt_buffer, sizeof(text_alt_buffer), "Altitude: %.1f", gps.altitude.meters());
-            } else {
-                snprintf(text_alt_buffer, sizeof(text_alt_buffer), "Altitude: ?");
-            }
-            if (gps.satellites.isValid()) {
-                snprintf(text_sat_buffer, sizeof(text_sat_buffer), "Satellites: %u", gps.satellites.value());
-            } else {
-                snprintf(text_sat_buffer, sizeof(text_sat_buffer), "Satellites: ?");
+// Publishes the fix and refreshes the tab, once per receiver epoch
+static void
+gps_publish(void)
+{
+    GpsPosition gps_position = { .latitude_e7 = 0,
+                                 .longitude_e7 = 0,
+                                 .altitude_cm = 0,
+                                 .satellites = 0,
+                                 .unix_time = 0,
+                                 .is_valid = false };
+    if (gps.location.isValid()) {
+        gps_position.latitude_e7 = divide_rounded(gps.location.latNano(), 100);
+        gps_position.longitude_e7 = divide_rounded(gps.location.lngNano(), 100);
+        format_label(text_lat_buffer,
+                     sizeof(text_lat_buffer),
+                     "Latitude: ",
+                     divide_rounded(gps_position.latitude_e7, 10),
+                     GPS_COORDINATE_DECIMALS - 1);
+        format_label(text_lng_buffer,
+                     sizeof(text_lng_buffer),
+                     "Longitude: ",
+                     divide_rounded(gps_position.longitude_e7, 10),
+                     GPS_COORDINATE_DECIMALS - 1);
+    } else {
+        format_unknown(text_lat_buffer, sizeof(text_lat_buffer), "Latitude: ");
+        format_unknown(text_lng_buffer, sizeof(text_lng_buffer), "Longitude: ");
+    }
+    if (gps.altitude.isValid()) {
+        // TinyGPSAltitude::value() is already in centimetres
+        gps_position.altitude_cm = gps.altitude.value();
+        format_label(text_alt_buffer,
+                     sizeof(text_alt_buffer),
+                     "Altitude: ",
+                     divide_rounded(gps_position.altitude_cm, 10),
+                     GPS_ALTITUDE_DECIMALS - 1);
+    } else {
+        format_unknown(text_alt_buffer, sizeof(text_alt_buffer), "Altitude: ");
+    }
+    if (gps.location.isValid() && gps.altitude.isValid()) {
+        gps_position.satellites = gps.satellites.value();
+        gps_position.is_valid = true;
+    }
+    if (gps.satellites.isValid()) {
+        // Used in the fix / in view over all constellations reported through GSV
+        uint32_t in_view = 0;
+        for (int i = 0; i < GPS_SYSTEM_COUNT; ++i) {
+            if (gps.constellations[i].isValid()) {
+                in_view += gps.constellations[i].inView();
             }
+        }
+        char* const end = text_sat_buffer + sizeof(text_sat_buffer);
+        char* pos = fmt_uint(fmt_str(text_sat_buffer, end, "Satellites: "), end, gps.satellites.value(), 1);
+        fmt_uint(fmt_char(pos, end, '/'), end, in_view, 1);
+    } else {
+        format_unknown(text_sat_buffer, sizeof(text_sat_buffer), "Satellites: ");
+    }
 
-            time_t conv_time = 0;
-            if (gps.time.isValid() && gps.date.isValid()) {
-                ttc.tm_year = gps.date.year() - 1900;
-                ttc.tm_mon = gps.date.month();
-                ttc.tm_mday = gps.date.day();
-                ttc.tm_hour = gps.time.hour();
-                ttc.tm_min = gps.time.minute();
-                ttc.tm_sec = gps.time.second();
-                conv_time = mktime(&ttc);
-
-                if (CONFIG_TIMEZONE_MIN != 0) {
-                    conv_time += CONFIG_TIMEZONE_MIN * 60;
-                    gmtime_r(&conv_time, &ttc);
-                }
-
-                const unsigned long now = millis();
-                if ((gps.satellites.isValid() && gps.satellites.value() > 4) &&
-                    (now < last_time_from_gps_update || now - last_time_from_gps_update < 30 * 60 * 1000)) {
-                    rtc_date_t datetime;
-                    datetime.year = ttc.tm_year + 1900;
-                    datetime.month = ttc.tm_mon;
-                    datetime.day = ttc.tm_mday;
-                    datetime.hour = ttc.tm_hour;
-                    datetime.minute = ttc.tm_min;
-                    datetime.second = ttc.tm_sec;
-                    BM8563_SetTime(&datetime);
-                    last_time_from_gps_update = now;
-                }
-                snprintf(text_date_buffer,
-                         sizeof(text_date_buffer),
-                         "Time: %02d.%02d.%04d, %02d:%02d:%02d",
-                         ttc.tm_mday,
-                         ttc.tm_mon,
-                         ttc.tm_year + 1900,
-                         ttc.tm_hour,
-                         ttc.tm_min,
-                         ttc.tm_sec);
-            } else {
-                snprintf(text_date_buffer, sizeof(text_date_buffer), "Time: ?");
-            }
-            xSemaphoreTake(GPS_POSITION_MUTEX, portMAX_DELAY);
-            GPS_POSITION.unix_time = conv_time;
-            xSemaphoreGive(GPS_POSITION_MUTEX);
+    uint32_t unix_time = 0;
+    if (gps.time.isValid() && gps.date.isValid()) {
+        rtc_date_t datetime;
+        datetime.year = gps.date.year();
+        datetime.month = gps.date.month();
+        datetime.day = gps.date.day();
+        datetime.hour = gps.time.hour();
+        datetime.minute = gps.time.minute();
+        datetime.second = gps.time.second();
+        unix_time = civil_to_unix(&datetime);
+
+        // The display and the RTC show local time
+        if (CONFIG_TIMEZONE_MIN != 0) {
+            civil_from_unix(unix_time + CONFIG_TIMEZONE_MIN * 60, &datetime);
+        }
 
-            xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        const unsigned long now = millis();
+        if (unix_time != 0 && (gps.satellites.isValid() && gps.satellites.value() > 4) &&
+            (!rtc_synced || now - last_time_from_gps_update >= RTC_SYNC_INTERVAL_MS)) {
+            BM8563_SetTime(&datetime);
+            last_time_from_gps_update = now;
+            rtc_synced = true;
+        }
+        char* const end = text_date_buffer + sizeof(text_date_buffer);
+        civil_format(fmt_str(text_date_buffer, end, "Time: "), end, &datetime);
+    } else {
+        format_unknown(text_date_buffer, sizeof(text_date_buffer), "Time: ");
+    }
+    gps_position.unix_time = unix_time;
+    snapshot_publish(&GPS_POSITION, &gps_position);
+    if (gps_position.is_valid) {
+        gps_track_append(sensor_history_now(), &gps_position);
+        geofence_update(&gps_position);
+#if CONFIG_GPS_TRACK_LOG
+        track_log_record(&gps_position);
+#endif
+    }
+
+    xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+
+    lv_label_set_static_text(latitude_label, text_lat_buffer);
+    lv_label_set_static_text(longitude_label, text_lng_buffer);
+    lv_label_set_static_text(altitude_label, text_alt_buffer);
+    lv_label_set_static_text(satellites_label, text_sat_buffer);
+    lv_label_set_static_text(gps_time_label, text_date_buffer);
+
+    xSemaphoreGive(xGuiSemaphore);
+}
 
-            lv_label_set_static_text(latitude_label, text_lat_buffer);
-            lv_label_set_static_text(longitude_label, text_lng_buffer);
-            lv_label_set_static_text(altitude_label, text_alt_buffer);
-            lv_label_set_static_text(satellites_label, text_sat_buffer);
-            lv_label_set_static_text(gps_time_label, text_date_buffer);
+static void
+gps_task(void* pvParameters)
+{
+    ESP_LOGI(TAG, "Start GPS task");
+    if (!gps_init()) {
+        vTaskDelete(NULL);
+        return;
+    }
 
-            xSemaphoreGive(xGuiSemaphore);
+    // The UART driver wakes us once per complete sentence, no polling and no partial reads
+    for (;;) {
+        const int length = Core2ForAWS_Port_C_UART_ReceivePattern(sentence, sizeof(sentence), portMAX_DELAY);
+        if (length <= 0) {
+            continue;
+        }
+        gps.encode(sentence, length);
+
+        // GGA, GLL and RMC of one epoch carry the same time, the first of them triggers the update
+        if (gps.time.isUpdated()) {
+            const uint32_t time = gps.time.value();
+            if (time != published_time) {
+                published_time = time;
+                gps_publish();
+            }
         }
-        vTaskDelay(pdMS_TO_TICKS(200)); // Read more frequently than transmit to ensure
-                                        // the messages are not erased from buffer.
     }
-    free(data);        // Free memory from external RAM
-    vTaskDelete(NULL); // Should never get to here...
 }
 
 extern "C" void
 display_gps_tab(lv_obj_t* tv, lv_obj_t* core2forAWS_screen_obj)
 {
-    GPS_POSITION_MUTEX = xSemaphoreCreateMutex();
-
     xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
     gps_tab = lv_tabview_add_tab(tv, GPS_TAB_NAME); // Create a tab
 
@@ -255,5 +373,10 @@ display_gps_tab(lv_obj_t* tv, lv_obj_t* core2forAWS_screen_obj)
 
     xSemaphoreGive(xGuiSemaphore);
 
-    xTaskCreate(gps_task, "gpsTask", 4096 * 3, NULL, 0, &gps_handle);
+    // Before the web server can add fences
+    geofence_init(geofence_event);
+    xTaskCreate(gps_task, "gpsTask", GPS_STACK_SIZE, NULL, 1, NULL);
+#if CONFIG_GPS_IMU_FUSION
+    nav_start();
+#endif
 }
@@ -0,0 +1,58 @@
+#include "gps_track.h"
+
+#include "esp_attr.h"
+
+#define GPS_TRACK_CAPACITY 3600 // one hour at 1 Hz
+#define EMPTY_POINT UINT32_MAX
+
+EXT_RAM_ATTR static GpsTrackPoint TRACK[GPS_TRACK_CAPACITY];
+static uint32_t TRACK_LENGTH = 0; // total number of appended points
+
+void
+gps_track_append(uint32_t time, const GpsPosition* position)
+{
+    const uint32_t length = TRACK_LENGTH;
+    if (length > 0 && TRACK[(length - 1) % GPS_TRACK_CAPACITY].time == time) {
+        return;
+    }
+
+    // Readers validate a point by reading its time before and after the position
+    GpsTrackPoint* point = &TRACK[length % GPS_TRACK_CAPACITY];
+    __atomic_store_n(&point->time, EMPTY_POINT, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    point->position = *position;
+    __atomic_store_n(&point->time, time, __ATOMIC_RELEASE);
+    __atomic_store_n(&TRACK_LENGTH, length + 1, __ATOMIC_RELEASE);
+}
+
+size_t
+gps_track_query(uint32_t from, uint32_t to, GpsTrackPoint* points, size_t max_points, uint32_t* cursor)
+{
+    const uint32_t length = __atomic_load_n(&TRACK_LENGTH, __ATOMIC_ACQUIRE);
+    uint32_t index = *cursor;
+    if (length > GPS_TRACK_CAPACITY && index < length - GPS_TRACK_CAPACITY) {
+        index = length - GPS_TRACK_CAPACITY;
+    }
+
+    size_t count = 0;
+    for (; index < length && count < max_points; ++index) {
+        const GpsTrackPoint* point = &TRACK[index % GPS_TRACK_CAPACITY];
+        const uint32_t time = __atomic_load_n(&point->time, __ATOMIC_ACQUIRE);
+        if (time == EMPTY_POINT || time < from) {
+            continue;
+        }
+        if (time > to) {
+            index = length;
+            break;
+        }
+        points[count].position = point->position;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&point->time, __ATOMIC_RELAXED) != time) {
+            continue; // overwritten while copying
+        }
+        points[count].time = time;
+        ++count;
+    }
+    *cursor = index;
+    return count;
+}
@@ -0,0 +1,66 @@
+#include "i2c_queue.h"
+#include "scheduler.h"
+
+#include "esp_timer.h"
+
+static I2CTransaction* pending = NULL; // sorted by ready time, earliest first
+
+static void i2c_queue_run(void* context);
+
+static SchedulerJob i2c_queue_job = { .name = "i2c", .run = i2c_queue_run };
+static bool job_added = false;
+
+static uint32_t
+delay_until(int64_t ready_us)
+{
+    const int64_t now = esp_timer_get_time();
+    return ready_us > now ? (ready_us - now + 999) / 1000 : 0;
+}
+
+static void
+i2c_queue_run(void* context)
+{
+    // Transactions completed here may submit follow-ups that are already due
+    while (pending != NULL && pending->ready_us <= esp_timer_get_time()) {
+        I2CTransaction* transaction = pending;
+        pending = transaction->next;
+
+        if (transaction->is_read) {
+            transaction->result = Core2ForAWS_Port_A_I2C_Read(
+              transaction->device, transaction->register_address, transaction->data, transaction->length);
+        } else {
+            transaction->result = Core2ForAWS_Port_A_I2C_Write(
+              transaction->device, transaction->register_address, transaction->data, transaction->length);
+        }
+        if (transaction->done != NULL) {
+            transaction->done(transaction);
+        }
+    }
+
+    if (pending != NULL) {
+        scheduler_reschedule(&i2c_queue_job, delay_until(pending->ready_us));
+    }
+}
+
+void
+i2c_queue_submit(I2CTransaction* transaction, uint32_t delay_ms)
+{
+    transaction->result = ESP_OK;
+    transaction->ready_us = esp_timer_get_time() + (int64_t)delay_ms * 1000;
+
+    I2CTransaction** link = &pending;
+    while (*link != NULL && (*link)->ready_us <= transaction->ready_us) {
+        link = &(*link)->next;
+    }
+    transaction->next = *link;
+    *link = transaction;
+
+    if (pending == transaction) {
+        if (!job_added) {
+            job_added = true;
+            scheduler_add(&i2c_queue_job, delay_ms);
+        } else {
+            scheduler_reschedule(&i2c_queue_job, delay_ms);
+        }
+    }
+}
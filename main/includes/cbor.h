@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Called when the writer buffer is full or on cbor_flush(), returns false to abort encoding
+    typedef bool (*CborFlush)(void* context, const uint8_t* data, size_t length);
+
+    /**
+     * Streaming CBOR (RFC 8949) encoder writing into a caller-owned buffer.
+     *
+     * Nothing is allocated. Without a flush callback the encoding has to fit into the
+     * buffer, otherwise `failed` is set and further items are ignored. With a callback
+     * the buffer is handed over whenever it fills up, so arbitrarily long indefinite
+     * arrays can be produced from a few hundred bytes.
+     */
+    typedef struct CborWriter
+    {
+        uint8_t* data;
+        size_t capacity;
+        size_t length;
+        bool failed;
+        CborFlush flush;
+        void* context;
+    } CborWriter;
+
+    void cbor_init(CborWriter* writer, uint8_t* buffer, size_t capacity, CborFlush flush, void* context);
+
+    void cbor_uint(CborWriter* writer, uint64_t value);
+    void cbor_int(CborWriter* writer, int64_t value);
+    void cbor_float(CborWriter* writer, float value);
+    void cbor_double(CborWriter* writer, double value);
+    // Exact mantissa * 10^exponent as a decimal fraction (tag 4), for scaled integer readings
+    void cbor_decimal(CborWriter* writer, int64_t mantissa, int exponent);
+    void cbor_bool(CborWriter* writer, bool value);
+    void cbor_null(CborWriter* writer);
+    void cbor_text(CborWriter* writer, const char* text);
+    void cbor_array(CborWriter* writer, size_t count);
+    void cbor_map(CborWriter* writer, size_t count);
+
+    // Indefinite length array or map, terminated with cbor_break()
+    void cbor_array_begin(CborWriter* writer);
+    void cbor_map_begin(CborWriter* writer);
+    void cbor_break(CborWriter* writer);
+
+    // Passes buffered bytes to the flush callback, returns false if encoding failed
+    bool cbor_flush(CborWriter* writer);
+
+#ifdef __cplusplus
+}
+#endif
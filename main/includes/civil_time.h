@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "bm8563.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Conversions between Unix time and the broken down date the BM8563 RTC keeps, in the
+     * proleptic Gregorian calendar without leap seconds or time zones. Unlike mktime() and
+     * gmtime_r() they do not look at TZ and need no locking or loops over years.
+     *
+     * Unix time is unsigned 32 bit, so the supported range is 1970-01-01 to 2106-02-07.
+     */
+
+    // Days from 1970-01-01 to the given date, month and day count from 1
+    int32_t days_from_civil(int32_t year, uint32_t month, uint32_t day);
+
+    // Returns 0 for dates outside the supported range
+    uint32_t civil_to_unix(const rtc_date_t* date);
+
+    void civil_from_unix(uint32_t unix_time, rtc_date_t* date);
+
+    // "DD.MM.YYYY, HH:MM:SS", chains like the fmt_* functions
+    char* civil_format(char* dst, char* end, const rtc_date_t* date);
+
+#ifdef __cplusplus
+}
+#endif
@@ -14,10 +14,10 @@ extern "C"
         float temperature;
         float humidity;
         float pressure;
+        uint16_t tof_distance;
     } SensorInfo;
 
     extern lv_obj_t* env3_tab;
-    TaskHandle_t env3_handle;
 
     void display_env3_tab(lv_obj_t*, lv_obj_t*);
 
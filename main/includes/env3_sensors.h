@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core2forAWS.h"
+#include "i2c_queue.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -21,6 +22,70 @@ extern "C"
 
     float QMP6988_calcPressure(I2CDevice_t slave);
 
+    // Raw readings with the 2^23 offset already removed
+    typedef struct QMP6988RawSample
+    {
+        int32_t pressure;
+        int32_t temperature;
+    } QMP6988RawSample;
+
+    // Compensates `count` samples to Pa with the engine selected in Kconfig, e.g. for oversampled averaging
+    void QMP6988_compensateBatch(const QMP6988RawSample* samples, float* pressures, size_t count);
+
+    typedef struct SHT3xRequest
+    {
+        I2CTransaction transaction;
+        uint8_t data[6];
+        SHT3xMeasurement measurement;
+        bool is_valid;
+        I2CRequestDone done;
+        void* context;
+    } SHT3xRequest;
+
+    // Queues a single shot measurement, `done` is called once `request` holds the result
+    void SHT3x_start_measurement(SHT3xRequest* request,
+                                 I2CDevice_t sht3x_peripheral,
+                                 I2CRequestDone done,
+                                 void* context);
+
+    // Switches to periodic acquisition at 1, 2, 4 or 10 measurements per second
+    esp_err_t SHT3x_start_periodic(I2CDevice_t sht3x_peripheral, uint32_t measurements_per_second);
+
+    /**
+     * Queues a FETCH DATA of the latest periodic result. `request->is_valid` stays false when
+     * there was no new result since the last fetch or the CRC did not match.
+     */
+    void SHT3x_start_fetch(SHT3xRequest* request,
+                           I2CDevice_t sht3x_peripheral,
+                           I2CRequestDone done,
+                           void* context);
+
+    // Averages periodic results down to the publishing rate
+    typedef struct SHT3xDecimator
+    {
+        float temperature_sum;
+        float humidity_sum;
+        uint32_t count;
+    } SHT3xDecimator;
+
+    void SHT3x_decimator_add(SHT3xDecimator* decimator, SHT3xMeasurement measurement);
+
+    // Mean of the results added since the previous call, false if there were none
+    bool SHT3x_decimator_take(SHT3xDecimator* decimator, SHT3xMeasurement* mean);
+
+    typedef struct QMP6988Request
+    {
+        I2CTransaction transaction;
+        uint8_t data[6];
+        float pressure; // Pa
+        bool is_valid;
+        I2CRequestDone done;
+        void* context;
+    } QMP6988Request;
+
+    // Queues a read of the latest conversion, the sensor runs in normal (continuous) mode
+    void QMP6988_start_read(QMP6988Request* request, I2CDevice_t slave, I2CRequestDone done, void* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Small replacements for the snprintf patterns used by the UI tasks.
+     *
+     * Every function writes at `dst`, never past `end` (one past the last usable byte),
+     * keeps the output NUL terminated and returns the position of that NUL, so calls
+     * can be chained to build a label piece by piece. Output that does not fit is cut off.
+     */
+
+    char* fmt_char(char* dst, char* end, char c);
+    char* fmt_str(char* dst, char* end, const char* text);
+
+    // Like "%0*u" / "%0*d", `width` 0 or 1 means no padding
+    char* fmt_uint(char* dst, char* end, uint32_t value, unsigned width);
+    char* fmt_int(char* dst, char* end, int32_t value, unsigned width);
+
+#define FMT_MAX_DECIMALS 9
+
+    // Like "%.*f", rounding the exact binary value half to even as printf does
+    char* fmt_fixed(char* dst, char* end, double value, unsigned decimals);
+
+    // Exact value / 10^decimals for quantities kept as scaled integers, e.g. 1e-7 degrees
+    char* fmt_scaled(char* dst, char* end, int64_t value, unsigned decimals);
+
+    // Dotted quad of an address stored like esp_ip4_addr (first octet in the lowest byte)
+    char* fmt_ipv4(char* dst, char* end, uint32_t address);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "gps.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Circular and polygonal geofences evaluated against every fix.
+     *
+     * Fences are registered in a hashed grid of GEOFENCE_CELL_SHIFT sized cells, each cell
+     * listing the fences whose bounding box overlaps it, so a fix only looks at the fences
+     * around it. Fences spanning more than GEOFENCE_MAX_FENCE_CELLS cells are kept in a
+     * separate list that is checked by bounding box on every fix. Containment is tested in
+     * integer 1e-7 degrees; fences must not cross the antimeridian.
+     */
+
+#ifndef GEOFENCE_MAX_FENCES
+#define GEOFENCE_MAX_FENCES 512
+#endif
+#ifndef GEOFENCE_MAX_VERTICES
+#define GEOFENCE_MAX_VERTICES 8192 // shared by all polygons
+#endif
+#ifndef GEOFENCE_MAX_ENTRIES
+#define GEOFENCE_MAX_ENTRIES 8192 // fence references in grid cells
+#endif
+#define GEOFENCE_BUCKET_BITS 10
+#define GEOFENCE_CELL_SHIFT 20 // cells of 2^20 * 1e-7 degrees, about 11.7 km of latitude
+#define GEOFENCE_MAX_FENCE_CELLS 64
+
+    typedef enum GeofenceEvent
+    {
+        GEOFENCE_ENTER,
+        GEOFENCE_EXIT,
+    } GeofenceEvent;
+
+    typedef struct GeofencePoint
+    {
+        int32_t latitude_e7;
+        int32_t longitude_e7;
+    } GeofencePoint;
+
+    // Called from geofence_update(), it must not add or remove fences
+    typedef void (*GeofenceHandler)(uint32_t id, GeofenceEvent event, const GpsPosition* position);
+
+    // Allocates the fence store (in PSRAM), returns false when out of memory
+    bool geofence_init(GeofenceHandler handler);
+
+    // Radius up to 1000 km, the circle is evaluated on a locally flat earth
+    esp_err_t geofence_add_circle(uint32_t id, GeofencePoint center, uint32_t radius_m);
+
+    // The polygon is closed implicitly, it needs at least three vertices
+    esp_err_t geofence_add_polygon(uint32_t id, const GeofencePoint* vertices, size_t count);
+
+    // Removes all fences, no exit events are raised for them
+    void geofence_clear(void);
+
+    // Evaluates a fix and raises enter and exit events, only gps_task may call this
+    void geofence_update(const GpsPosition* position);
+
+    size_t geofence_count(void);
+
+    // Copies the ids of the fences the last fix was inside of, returns how many there are
+    size_t geofence_inside(uint32_t* ids, size_t max_ids);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,11 +12,15 @@ extern "C"
 {
 #endif
 
+#define GPS_COORDINATE_DECIMALS 7
+#define GPS_ALTITUDE_DECIMALS 2
+
+    // Fixed point so that nothing between the NMEA parser and the web handlers needs floats
     typedef struct GpsPosition
     {
-        float latitude;
-        float longitude;
-        float altitude;
+        int32_t latitude_e7;  // 1e-7 degrees
+        int32_t longitude_e7; // 1e-7 degrees
+        int32_t altitude_cm;
         uint32_t satellites;
         uint32_t unix_time;
         bool is_valid;
@@ -25,10 +29,11 @@ extern "C"
     extern const char* GPS_TAB_NAME;
 
     extern lv_obj_t* gps_tab;
-    TaskHandle_t gps_handle;
 
     void display_gps_tab(lv_obj_t*, lv_obj_t*);
     GpsPosition get_latest_gps_position(void);
+    // Like get_latest_gps_position(), returns the number of receiver epochs published so far
+    uint32_t read_latest_gps_position(GpsPosition* position);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "gps.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GpsTrackPoint
+    {
+        uint32_t time; // seconds since boot, see sensor_history_now()
+        GpsPosition position;
+    } GpsTrackPoint;
+
+    // Keeps at most one fix per second, only gps_task may append
+    void gps_track_append(uint32_t time, const GpsPosition* position);
+
+    /**
+     * Copies up to `max_points` fixes recorded in [from, to], oldest first, starting at
+     * ring position `*cursor` (0 for the first call). The cursor is advanced so that callers
+     * can page through the whole track with a small buffer.
+     */
+    size_t gps_track_query(uint32_t from, uint32_t to, GpsTrackPoint* points, size_t max_points, uint32_t* cursor);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "core2forAWS.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    struct I2CTransaction;
+    typedef void (*I2CTransactionDone)(struct I2CTransaction* transaction);
+
+    // Completion callback of a driver request built from one or more transactions
+    typedef void (*I2CRequestDone)(void* context);
+
+    /**
+     * One Port A register read or write, owned by the driver that submits it.
+     *
+     * Drivers split a measurement into transactions that become ready at the time the sensor
+     * needs for its conversion, so waits of different sensors overlap instead of blocking the
+     * scheduler one after another.
+     */
+    typedef struct I2CTransaction
+    {
+        I2CDevice_t device;
+        uint32_t register_address; // or I2C_NO_REG
+        uint8_t* data;
+        uint16_t length;
+        bool is_read;
+        I2CTransactionDone done; // runs in the scheduler task, may submit the next transaction
+        void* context;
+
+        // Managed by the queue
+        esp_err_t result;
+        int64_t ready_us;
+        struct I2CTransaction* next;
+    } I2CTransaction;
+
+    /**
+     * Runs `transaction` on the bus no earlier than `delay_ms` from now. Transactions are
+     * executed in order of their ready time, must not be resubmitted before `done` is called
+     * and may only be submitted from scheduler jobs.
+     */
+    void i2c_queue_submit(I2CTransaction* transaction, uint32_t delay_ms);
+
+#ifdef __cplusplus
+}
+#endif
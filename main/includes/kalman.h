@@ -0,0 +1,177 @@
+#pragma once
+
+#include <math.h>
+
+/**
+ * Fixed-size matrices and a linear Kalman filter for C++ modules.
+ *
+ * All dimensions are template parameters, so every product is a fully unrolled loop over
+ * stack arrays with no allocation and no run-time size checks.
+ */
+
+template<int R, int C>
+struct Matrix
+{
+    float m[R][C];
+
+    static Matrix zero()
+    {
+        Matrix result;
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                result.m[r][c] = 0.0f;
+            }
+        }
+        return result;
+    }
+
+    static Matrix identity()
+    {
+        Matrix result = zero();
+        for (int i = 0; i < (R < C ? R : C); ++i) {
+            result.m[i][i] = 1.0f;
+        }
+        return result;
+    }
+
+    float& operator()(int r, int c) { return m[r][c]; }
+    float operator()(int r, int c) const { return m[r][c]; }
+
+    Matrix<C, R> transposed() const
+    {
+        Matrix<C, R> result;
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                result.m[c][r] = m[r][c];
+            }
+        }
+        return result;
+    }
+
+    Matrix& operator+=(const Matrix& other)
+    {
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                m[r][c] += other.m[r][c];
+            }
+        }
+        return *this;
+    }
+
+    Matrix& operator-=(const Matrix& other)
+    {
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                m[r][c] -= other.m[r][c];
+            }
+        }
+        return *this;
+    }
+};
+
+template<int R, int C>
+Matrix<R, C>
+operator+(Matrix<R, C> a, const Matrix<R, C>& b)
+{
+    return a += b;
+}
+
+template<int R, int C>
+Matrix<R, C>
+operator-(Matrix<R, C> a, const Matrix<R, C>& b)
+{
+    return a -= b;
+}
+
+template<int R, int K, int C>
+Matrix<R, C>
+operator*(const Matrix<R, K>& a, const Matrix<K, C>& b)
+{
+    Matrix<R, C> result;
+    for (int r = 0; r < R; ++r) {
+        for (int c = 0; c < C; ++c) {
+            float sum = 0.0f;
+            for (int k = 0; k < K; ++k) {
+                sum += a.m[r][k] * b.m[k][c];
+            }
+            result.m[r][c] = sum;
+        }
+    }
+    return result;
+}
+
+// Gauss-Jordan elimination with partial pivoting, returns false for singular matrices
+template<int N>
+bool
+invert(Matrix<N, N> a, Matrix<N, N>* inverse)
+{
+    Matrix<N, N> result = Matrix<N, N>::identity();
+    for (int column = 0; column < N; ++column) {
+        int pivot = column;
+        for (int r = column + 1; r < N; ++r) {
+            if (fabsf(a.m[r][column]) > fabsf(a.m[pivot][column])) {
+                pivot = r;
+            }
+        }
+        if (a.m[pivot][column] == 0.0f) {
+            return false;
+        }
+        for (int c = 0; c < N; ++c) {
+            float swap = a.m[column][c];
+            a.m[column][c] = a.m[pivot][c];
+            a.m[pivot][c] = swap;
+            swap = result.m[column][c];
+            result.m[column][c] = result.m[pivot][c];
+            result.m[pivot][c] = swap;
+        }
+
+        const float scale = 1.0f / a.m[column][column];
+        for (int c = 0; c < N; ++c) {
+            a.m[column][c] *= scale;
+            result.m[column][c] *= scale;
+        }
+        for (int r = 0; r < N; ++r) {
+            const float factor = a.m[r][column];
+            if (r == column || factor == 0.0f) {
+                continue;
+            }
+            for (int c = 0; c < N; ++c) {
+                a.m[r][c] -= factor * a.m[column][c];
+                result.m[r][c] -= factor * result.m[column][c];
+            }
+        }
+    }
+    *inverse = result;
+    return true;
+}
+
+template<int N>
+struct KalmanFilter
+{
+    Matrix<N, 1> x; // state
+    Matrix<N, N> P; // state covariance
+
+    // x = F x + u, P = F P F' + Q
+    void predict(const Matrix<N, N>& F, const Matrix<N, 1>& u, const Matrix<N, N>& Q)
+    {
+        x = F * x + u;
+        P = F * P * F.transposed() + Q;
+    }
+
+    // Corrects the state with measurement z = H x + v, v ~ N(0, R)
+    template<int M>
+    bool update(const Matrix<M, N>& H, const Matrix<M, M>& R, const Matrix<M, 1>& z)
+    {
+        const Matrix<N, M> PHt = P * H.transposed();
+        Matrix<M, M> S_inverse;
+        if (!invert(H * PHt + R, &S_inverse)) {
+            return false;
+        }
+        const Matrix<N, M> K = PHt * S_inverse;
+        x += K * (z - H * x);
+        // Joseph form, keeps P symmetric and positive definite in single precision
+        const Matrix<N, N> I_KH = Matrix<N, N>::identity() - K * H;
+        P = I_KH * P * I_KH.transposed() + K * R * K.transposed();
+        return true;
+    }
+};
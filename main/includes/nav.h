@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct NavState
+    {
+        int32_t latitude_e7;
+        int32_t longitude_e7;
+        int32_t altitude_cm;
+        float velocity_north; // m/s
+        float velocity_east;
+        float velocity_up;
+        float position_sigma; // horizontal standard deviation in meters
+        bool is_stationary;
+        bool is_valid; // false until the first fix and when fixes stop coming in
+    } NavState;
+
+    /**
+     * Starts the estimator job. It runs at 50 Hz, predicting with the MPU6886
+     * accelerometer and correcting with every new fix from read_latest_gps_position().
+     */
+    void nav_start(void);
+
+    NavState get_latest_nav_state(void);
+
+#ifdef __cplusplus
+}
+#endif
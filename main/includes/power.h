@@ -27,8 +27,17 @@
 
 #define POWER_TAB_NAME "AXP192-POWER"
 
+typedef struct PowerInfo
+{
+    float battery_voltage;
+    float battery_current;
+    uint32_t pir_sensor;
+} PowerInfo;
+
 extern lv_obj_t* power_tab;
-TaskHandle_t pir_sensor_handle;
 
 void
 display_power_tab(lv_obj_t* tv);
+
+PowerInfo
+get_power_info(void);
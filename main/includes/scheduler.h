@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef void (*SchedulerCallback)(void* context);
+
+    /**
+     * A periodic job run by the single scheduler task. Jobs are owned by the caller (usually a
+     * static in the module that registers it) and must not block for long, since every other
+     * job waits for them.
+     */
+    typedef struct SchedulerJob
+    {
+        const char* name;
+        SchedulerCallback init; // optional, runs once in the scheduler task before the first run
+        SchedulerCallback run;
+        void* context;
+        uint32_t period_ms; // 0 runs the job only once
+
+        // Managed by the scheduler
+        int64_t deadline_us;
+        struct SchedulerJob* next;
+        bool queued;
+        uint32_t runs;
+        uint32_t max_jitter_us;
+        uint32_t max_runtime_us;
+        uint64_t total_runtime_us;
+    } SchedulerJob;
+
+    // Creates the scheduler task, jobs may be added before or after
+    void scheduler_start(void);
+
+    // Queues `job` to run for the first time after `delay_ms`, may be called from any task
+    void scheduler_add(SchedulerJob* job, uint32_t delay_ms);
+
+    // Moves an already added job to run after `delay_ms`, also re-arms jobs with a period of 0
+    void scheduler_reschedule(SchedulerJob* job, uint32_t delay_ms);
+
+    // Logs run count, worst jitter and CPU share of every queued job, may be called from any task
+    void scheduler_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef enum SensorChannel
+    {
+        SENSOR_CHANNEL_TEMPERATURE,
+        SENSOR_CHANNEL_HUMIDITY,
+        SENSOR_CHANNEL_PRESSURE,
+        SENSOR_CHANNEL_TOF,
+        SENSOR_CHANNEL_PIR,
+        SENSOR_CHANNEL_BATTERY_VOLTAGE,
+        SENSOR_CHANNEL_BATTERY_CURRENT,
+        SENSOR_CHANNEL_COUNT
+    } SensorChannel;
+
+    // Downsampling tiers, each slot holds the mean of all samples within its period
+    typedef enum SensorHistoryTier
+    {
+        SENSOR_HISTORY_SECONDS,
+        SENSOR_HISTORY_MINUTES,
+        SENSOR_HISTORY_HOURS,
+        SENSOR_HISTORY_TIER_COUNT
+    } SensorHistoryTier;
+
+    typedef struct SensorHistoryPoint
+    {
+        uint32_t time; // seconds since boot, aligned to the tier period
+        float value;
+    } SensorHistoryPoint;
+
+    // Allocates the whole store once (in PSRAM), returns false when out of memory
+    bool sensor_history_init(void);
+
+    // Seconds since boot, the time base of the store
+    uint32_t sensor_history_now(void);
+
+    // Only one task may append to a given channel
+    void sensor_history_append(SensorChannel channel, uint32_t time, float value);
+
+    uint32_t sensor_history_tier_period(SensorHistoryTier tier);
+
+    // Coarsest tier whose period still fits into `step` seconds
+    SensorHistoryTier sensor_history_tier_for_step(uint32_t step);
+
+    /**
+     * Picks the tier for `step`, rounds `step` up to a multiple of its period (down only where
+     * that would overflow) and aligns `from`, skipping the part of the range that is already
+     * older than the tier capacity. `to` is clamped to now, so [from, to] never spans more than
+     * the tier capacity.
+     */
+    SensorHistoryTier sensor_history_normalize_range(uint32_t* from, uint32_t* to, uint32_t* step);
+
+    bool sensor_history_get(SensorChannel channel, SensorHistoryTier tier, uint32_t time, float* value);
+
+    /**
+     * Collects up to `max_points` samples in [from, to] spaced by `step` seconds (rounded up
+     * to a multiple of the tier period). Returns number of points written and stores in `next` the time
+     * to continue from, so callers can page through long ranges with a small buffer.
+     */
+    size_t sensor_history_query(SensorChannel channel,
+                                uint32_t from,
+                                uint32_t to,
+                                uint32_t step,
+                                SensorHistoryPoint* points,
+                                size_t max_points,
+                                uint32_t* next);
+
+#ifdef __cplusplus
+}
+#endif
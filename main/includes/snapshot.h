@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Double-buffered value publisher for one writer and any number of readers.
+     *
+     * The writer fills the buffer that is *not* currently published and then
+     * bumps the sequence number, so readers never wait on a lock and never see
+     * a half-written value. The sequence is also bumped before the write, so a
+     * reader can tell when the writer has started on its buffer again. It only
+     * retries when a full publish completed and the next one began while it was
+     * copying, which cannot happen repeatedly at sensor rates.
+     */
+    typedef struct Snapshot
+    {
+        uint32_t sequence;
+        size_t size;
+        uint8_t* buffers; // 2 * size bytes
+    } Snapshot;
+
+#define SNAPSHOT_DEFINE(name, type)                                                                          \
+    static type name##_buffers[2];                                                                           \
+    static Snapshot name = { .sequence = 0, .size = sizeof(type), .buffers = (uint8_t*)name##_buffers }
+
+    // Only one task may publish to a given snapshot
+    void snapshot_publish(Snapshot* snapshot, const void* value);
+
+    // Copies the latest published value into `value`, returns the number of publishes it is from
+    uint32_t snapshot_read(const Snapshot* snapshot, void* value);
+
+    // Number of completed publishes
+    uint32_t snapshot_sequence(const Snapshot* snapshot);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core2forAWS.h"
+#include "i2c_queue.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -11,6 +12,22 @@ extern "C"
 
     uint16_t TofVl53lox_get_reading(I2CDevice_t device);
 
+    typedef struct TofVl53loxRequest
+    {
+        I2CTransaction transaction;
+        uint8_t data[12];
+        uint8_t polls;
+        uint16_t distance; // 0 if there is no valid reading
+        I2CRequestDone done;
+        void* context;
+    } TofVl53loxRequest;
+
+    // Queues a single ranging and polls for its end without blocking the scheduler
+    void TofVl53lox_start_reading(TofVl53loxRequest* request,
+                                  I2CDevice_t device,
+                                  I2CRequestDone done,
+                                  void* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "gps.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Append-only GPS track log made of fixed size blocks.
+     *
+     * Every block starts with a TrackLogBlockHeader followed by its points. A point is stored
+     * as zigzag varint deltas to the previous point of the same block (the first one against
+     * zero), so a typical 1 Hz fix takes 5-8 bytes instead of sizeof(GpsPosition). Blocks
+     * decode on their own: a damaged block only loses its own points, and the time range in
+     * each header allows a binary search over the blocks to seek by time.
+     *
+     * Blocks are only ever written whole, and never over the last complete copy of their
+     * points. The block being filled is written alternately to its own slot and to the spare
+     * slot after it, so a write torn by a power loss leaves the previous copy readable. Once full
+     * it stays in its own slot and the spare starts the next block. Of two copies of a block
+     * the readers keep the longer one.
+     */
+
+#define TRACK_LOG_BLOCK_SIZE 4096
+#define TRACK_LOG_MAGIC 0x314b5254 // "TRK1"
+#define TRACK_LOG_FLUSH_POINTS 60  // write the open block about once per minute at 1 Hz
+
+    typedef struct TrackLogBlockHeader
+    {
+        uint32_t magic;
+        uint32_t crc;        // CRC-32 over everything after this field up to the end of the points
+        uint32_t first_time; // unix time of the first and the last point
+        uint32_t last_time;
+        uint16_t count;  // points in the block
+        uint16_t length; // bytes of point data following the header
+    } TrackLogBlockHeader;
+
+#define TRACK_LOG_DATA_SIZE (TRACK_LOG_BLOCK_SIZE - sizeof(TrackLogBlockHeader))
+
+    typedef struct TrackLogEncoder
+    {
+        uint8_t block[TRACK_LOG_BLOCK_SIZE]; // header and points, written to storage as is
+        uint16_t length;
+        uint16_t count;
+        GpsPosition previous;
+    } TrackLogEncoder;
+
+    void track_log_encoder_reset(TrackLogEncoder* encoder);
+
+    // Returns false when the point does not fit anymore, the block has to be written and reset first
+    bool track_log_encoder_add(TrackLogEncoder* encoder, const GpsPosition* position);
+
+    // Fills in the header and pads the unused rest, after this `block` can be written
+    void track_log_encoder_finish(TrackLogEncoder* encoder);
+
+    typedef struct TrackLogDecoder
+    {
+        const uint8_t* data;
+        const uint8_t* end;
+        uint16_t remaining;
+        GpsPosition previous;
+    } TrackLogDecoder;
+
+    // Returns false for blocks that are empty, were never written completely or are damaged
+    bool track_log_decoder_init(TrackLogDecoder* decoder, const uint8_t* block);
+
+    bool track_log_decoder_next(TrackLogDecoder* decoder, GpsPosition* position);
+
+    typedef struct TrackLog
+    {
+        FILE* file;
+        uint32_t block_index; // own slot of the block being filled, the spare one follows
+        int8_t latest_slot;   // 0 or 1 for the slot with its last copy, -1 before the first
+        uint16_t unflushed;   // points added since it was last written
+        TrackLogEncoder encoder;
+    } TrackLog;
+
+    // Opens or creates the log, a partially filled last block is continued from its longest copy
+    bool track_log_open(TrackLog* log, const char* path);
+
+    // Only valid fixes are recorded, storage is written when a block fills up or is due a flush
+    bool track_log_append(TrackLog* log, const GpsPosition* position);
+
+    bool track_log_flush(TrackLog* log);
+
+    void track_log_close(TrackLog* log);
+
+    typedef struct TrackLogReader
+    {
+        FILE* file;
+        uint32_t block_count;
+        uint32_t block_index; // next block to load
+        uint32_t from;        // points before this time are skipped
+        uint8_t block[TRACK_LOG_BLOCK_SIZE];
+        TrackLogDecoder decoder;
+    } TrackLogReader;
+
+    bool track_log_reader_open(TrackLogReader* reader, const char* path);
+
+    // Moves to the first point at or after `time`, reading only O(log blocks) headers
+    void track_log_reader_seek(TrackLogReader* reader, uint32_t time);
+
+    // Returns false at the end of the log, damaged blocks are skipped
+    bool track_log_reader_next(TrackLogReader* reader, GpsPosition* position);
+
+    void track_log_reader_close(TrackLogReader* reader);
+
+#ifdef __cplusplus
+}
+#endif
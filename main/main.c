@@ -59,6 +59,7 @@
 /* #include "mic.h" */
 /* #include "mpu.h" */
 #include "power.h"
+#include "sensor_history.h"
 #include "tasks.h"
 /* #include "touch.h" */
 #include "web.h"
@@ -97,6 +98,8 @@ app_main(void)
     Core2ForAWS_Init();
     Core2ForAWS_Display_SetBrightness(50); // Last since the display first needs time to finish initializing.
 
+    sensor_history_init();
+
     ui_start();
 }
 
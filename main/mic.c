@@ -23,9 +23,6 @@
  * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
-#include <math.h>
-#include <string.h>
-
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "freertos/semphr.h"
@@ -35,22 +32,20 @@
 
 #include "core2forAWS.h"
 
-#include "fft.h"
+#include "spectrum_map.h"
+#include "stft.h"
 #include "mic.h"
 
 static const char* TAG = MICROPHONE_TAB_NAME;
 #define CANVAS_WIDTH 240
 #define CANVAS_HEIGHT 60
-
-static long
-map(long x, long in_min, long in_max, long out_min, long out_max)
-{
-    long divisor = (in_max - in_min);
-    if (divisor == 0) {
-        return -1;
-    }
-    return (x - in_min) * (out_max - out_min) / divisor + out_min;
-}
+#define MIC_FFT_SIZE 512
+#define MIC_FFT_HOP (MIC_FFT_SIZE / 2)
+#define MIC_SAMPLE_RATE 44100 // as set up by Microphone_Init()
+// Mel rows up to ~8 kHz, shown from 48 dB (the faintest level the linear display showed) to 108 dB
+#define MIC_FFT_BINS 96
+#define MIC_DB_LOW 48.0f
+#define MIC_DB_HIGH 108.0f
 
 void
 display_microphone_tab(lv_obj_t* tv)
@@ -104,34 +99,47 @@ microphoneTask(void* pvParameters)
 {
     vTaskSuspend(NULL);
 
-    static int8_t i2s_readraw_buff[1024];
+    static int16_t i2s_samples[MIC_FFT_HOP];
+    static float fft_power[MIC_FFT_BINS];
+    static uint8_t fft_rows[CANVAS_HEIGHT];
+    static uint8_t fft_dis_buff[CANVAS_HEIGHT];
     size_t bytesread;
-    int16_t* buffptr;
-    double data = 0;
-    uint8_t* fft_dis_buff = NULL;
     Microphone_Init();
     QueueHandle_t queue = (QueueHandle_t)pvParameters;
+    // Half overlapping Hann frames, averaging two per column keeps one column per MIC_FFT_SIZE samples
+    stft_t* stft = stft_init(MIC_FFT_SIZE, MIC_FFT_HOP, STFT_WINDOW_HANN, MIC_FFT_BINS, 2);
+    // DC is left out
+    spectrum_map_t* rows = spectrum_map_init(CANVAS_HEIGHT,
+                                             SPECTRUM_BANDS_MEL,
+                                             (float)MIC_SAMPLE_RATE / MIC_FFT_SIZE,
+                                             1,
+                                             MIC_FFT_BINS,
+                                             SPECTRUM_SCALE_LOG,
+                                             MIC_DB_LOW,
+                                             MIC_DB_HIGH);
+    if (stft == NULL || rows == NULL) {
+        ESP_LOGE(TAG, "Failed to set up the spectrogram");
+        vTaskDelete(NULL);
+    }
 
     for (;;) {
-        fft_dis_buff =
-          (uint8_t*)heap_caps_malloc(CANVAS_HEIGHT * sizeof(uint8_t), MALLOC_CAP_DEFAULT | MALLOC_CAP_SPIRAM);
-        memset(fft_dis_buff, 0, CANVAS_HEIGHT);
-        fft_config_t* real_fft_plan = fft_init(512, FFT_REAL, FFT_FORWARD, NULL, NULL);
-        i2s_read(I2S_NUM_0, (char*)i2s_readraw_buff, 1024, &bytesread, pdMS_TO_TICKS(100));
-        buffptr = (int16_t*)i2s_readraw_buff;
-        for (uint16_t count_n = 0; count_n < real_fft_plan->size; count_n++) {
-            real_fft_plan->input[count_n] = (float)map(buffptr[count_n], INT16_MIN, INT16_MAX, -1000, 1000);
-        }
-        fft_execute(real_fft_plan);
-
-        for (uint16_t count_n = 1; count_n < CANVAS_HEIGHT; count_n++) {
-            data = sqrt(real_fft_plan->output[2 * count_n] * real_fft_plan->output[2 * count_n] +
-                        real_fft_plan->output[2 * count_n + 1] * real_fft_plan->output[2 * count_n + 1]);
-            fft_dis_buff[CANVAS_HEIGHT - count_n] = map(data, 0, 2000, 0, 256);
-        }
-        fft_destroy(real_fft_plan);
-        if (xQueueSend(queue, &fft_dis_buff, 0) != pdPASS) {
-            free(fft_dis_buff);
+        i2s_read(I2S_NUM_0, (char*)i2s_samples, sizeof(i2s_samples), &bytesread, pdMS_TO_TICKS(100));
+        const int16_t* samples = i2s_samples;
+        int count = bytesread / sizeof(int16_t);
+        while (count > 0) {
+            const int used = stft_write(stft, samples, count);
+            samples += used;
+            count -= used;
+            if (!stft_read(stft, fft_power)) {
+                continue;
+            }
+            spectrum_map_execute(rows, fft_power, fft_rows);
+            // Low frequencies at the bottom of the canvas
+            for (uint16_t count_n = 0; count_n < CANVAS_HEIGHT; count_n++) {
+                fft_dis_buff[CANVAS_HEIGHT - 1 - count_n] = fft_rows[count_n];
+            }
+            // The queue copies the column, a full queue just drops it
+            xQueueSend(queue, fft_dis_buff, 0);
         }
     }
     vTaskDelete(NULL); // Should never get to here...
@@ -140,14 +148,13 @@ microphoneTask(void* pvParameters)
 void
 fft_show_task(void* pvParameters)
 {
-    QueueHandle_t mic_queue = xQueueCreate(2, sizeof(uint8_t*));
+    QueueHandle_t mic_queue = xQueueCreate(2, CANVAS_HEIGHT);
     xTaskCreatePinnedToCore(microphoneTask, "microphoneTask", 4096 * 2, (void*)mic_queue, 1, &mic_handle, 1);
 
     vTaskSuspend(NULL);
     static uint16_t position_data = 0;
     uint16_t color_position;
-    uint8_t* fft_dis_buff =
-      heap_caps_malloc(sizeof(uint8_t) * CANVAS_HEIGHT, MALLOC_CAP_DEFAULT | MALLOC_CAP_SPIRAM);
+    static uint8_t fft_dis_buff[CANVAS_HEIGHT];
 
     xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
     lv_obj_t* canvas = lv_canvas_create((lv_obj_t*)pvParameters, NULL);
@@ -162,7 +169,7 @@ fft_show_task(void* pvParameters)
 
     for (;;) {
         if (mic_queue != NULL) {
-            xQueueReceive(mic_queue, &fft_dis_buff, 0);
+            xQueueReceive(mic_queue, fft_dis_buff, 0);
             for (uint16_t count_y = 0; count_y < CANVAS_HEIGHT; count_y++) {
                 color_position = fft_dis_buff[count_y];
                 xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
@@ -0,0 +1,275 @@
+#include <math.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "core2forAWS.h"
+
+#include "gps.h"
+#include "kalman.h"
+#include "nav.h"
+#include "scheduler.h"
+#include "snapshot.h"
+
+#if CONFIG_GPS_IMU_FUSION
+
+static const char* TAG = "NAV";
+
+/**
+ * Position and velocity in a local north/east/up frame around `origin`, fused from GPS fixes
+ * and the MPU6886 accelerometer.
+ *
+ * Without a magnetometer the horizontal axes of the device cannot be related to north, so the
+ * accelerometer contributes what does not depend on heading:
+ * - vertical acceleration, the reading projected onto a slowly tracked gravity vector, drives
+ *   the up axis as a control input
+ * - the remaining (horizontal) acceleration scales the process noise, so the filter smooths
+ *   hard while cruising and follows fixes quickly in manoeuvres
+ * - a device at rest adds zero velocity measurements, which stops the estimate wandering with
+ *   the GPS noise. Cruising at constant velocity looks the same to an accelerometer, so this
+ *   only applies once the fixes have brought the estimated speed and its uncertainty down.
+ */
+
+#define NAV_RATE_HZ 50
+#define NAV_FIX_TIMEOUT_US (5 * 1000 * 1000)
+#define STANDARD_GRAVITY 9.80665f
+// Same sphere as TinyGPSPlus::distanceBetween()
+#define METERS_PER_E7 (6372795.0 * M_PI / 180.0 / 1e7)
+#define RECENTER_DISTANCE 10000.0f // meters, keeps the local frame flat
+
+#define GPS_HORIZONTAL_SIGMA 3.0f  // meters
+#define GPS_VERTICAL_SIGMA 6.0f    // meters
+#define STATIONARY_VELOCITY_SIGMA 0.05f // m/s
+#define HORIZONTAL_ACCEL_SIGMA 0.2f // m/s^2 at rest
+// Times the measured horizontal acceleration, whose direction is unknown
+#define HORIZONTAL_ACCEL_GAIN 1.0f
+#define VERTICAL_ACCEL_SIGMA 0.1f   // m/s^2, noise of the vertical control input
+#define VERTICAL_INPUT_MAX_MOTION 0.05f // g, above it the vertical control input is left out
+#define GRAVITY_TIME_CONSTANT 10.0f      // seconds
+#define GRAVITY_TIME_CONSTANT_AT_REST 1.0f
+#define MOTION_SMOOTHING 0.1f
+#define STATIONARY_DEVIATION 0.02f // g
+#define STATIONARY_SPEED 1.0f      // m/s
+
+enum
+{
+    NORTH,
+    EAST,
+    UP,
+    VELOCITY_NORTH,
+    VELOCITY_EAST,
+    VELOCITY_UP,
+    STATE_SIZE
+};
+
+SNAPSHOT_DEFINE(NAV_STATE, NavState);
+
+static KalmanFilter<STATE_SIZE> filter;
+static bool initialized = false;
+static int64_t last_run_us = 0;
+static int64_t last_fix_us = 0;
+// Of the GPS snapshot, the receiver may report several fixes a second and the time only once it has the date
+static uint32_t last_fix_sequence = 0;
+
+// Origin of the local frame
+static int32_t origin_latitude_e7;
+static int32_t origin_longitude_e7;
+static int32_t origin_altitude_cm;
+static float meters_per_longitude_e7;
+
+static float gravity[3]; // low-passed accelerometer, in g
+static bool gravity_valid = false;
+static float motion = 1.0f; // low-passed deviation from gravity, in g
+static bool stationary = false;
+
+NavState
+get_latest_nav_state(void)
+{
+    NavState state;
+    snapshot_read(&NAV_STATE, &state);
+    return state;
+}
+
+static void
+set_origin(int32_t latitude_e7, int32_t longitude_e7, int32_t altitude_cm)
+{
+    origin_latitude_e7 = latitude_e7;
+    origin_longitude_e7 = longitude_e7;
+    origin_altitude_cm = altitude_cm;
+    meters_per_longitude_e7 = METERS_PER_E7 * cos(latitude_e7 * (M_PI / 180.0 / 1e7));
+}
+
+static void
+reset(const GpsPosition* fix)
+{
+    set_origin(fix->latitude_e7, fix->longitude_e7, fix->altitude_cm);
+    filter.x = Matrix<STATE_SIZE, 1>::zero();
+    filter.P = Matrix<STATE_SIZE, STATE_SIZE>::zero();
+    filter.P(NORTH, NORTH) = filter.P(EAST, EAST) = GPS_HORIZONTAL_SIGMA * GPS_HORIZONTAL_SIGMA;
+    filter.P(UP, UP) = GPS_VERTICAL_SIGMA * GPS_VERTICAL_SIGMA;
+    for (int i = VELOCITY_NORTH; i <= VELOCITY_UP; ++i) {
+        filter.P(i, i) = 1600.0f; // anything up to highway speeds
+    }
+    initialized = true;
+    ESP_LOGI(TAG, "Estimator started at %d, %d", fix->latitude_e7, fix->longitude_e7);
+}
+
+// Moves the origin under the current estimate once it drifted far from it
+static void
+recenter(void)
+{
+    const float north = filter.x(NORTH, 0);
+    const float east = filter.x(EAST, 0);
+    if (north * north + east * east < RECENTER_DISTANCE * RECENTER_DISTANCE) {
+        return;
+    }
+    set_origin(origin_latitude_e7 + (int32_t)lround(north / METERS_PER_E7),
+               origin_longitude_e7 + (int32_t)lround(east / meters_per_longitude_e7),
+               origin_altitude_cm);
+    filter.x(NORTH, 0) = 0.0f;
+    filter.x(EAST, 0) = 0.0f;
+}
+
+static void
+correct_with_fix(const GpsPosition* fix)
+{
+    Matrix<3, STATE_SIZE> H = Matrix<3, STATE_SIZE>::zero();
+    H(0, NORTH) = H(1, EAST) = H(2, UP) = 1.0f;
+    Matrix<3, 3> R = Matrix<3, 3>::zero();
+    R(0, 0) = R(1, 1) = GPS_HORIZONTAL_SIGMA * GPS_HORIZONTAL_SIGMA;
+    R(2, 2) = GPS_VERTICAL_SIGMA * GPS_VERTICAL_SIGMA;
+    Matrix<3, 1> z;
+    z(0, 0) = (float)(((int64_t)fix->latitude_e7 - origin_latitude_e7) * METERS_PER_E7);
+    z(1, 0) = ((int64_t)fix->longitude_e7 - origin_longitude_e7) * meters_per_longitude_e7;
+    z(2, 0) = (fix->altitude_cm - origin_altitude_cm) * 0.01f;
+    filter.update(H, R, z);
+    recenter();
+}
+
+static void
+correct_stationary(void)
+{
+    Matrix<3, STATE_SIZE> H = Matrix<3, STATE_SIZE>::zero();
+    H(0, VELOCITY_NORTH) = H(1, VELOCITY_EAST) = H(2, VELOCITY_UP) = 1.0f;
+    Matrix<3, 3> R = Matrix<3, 3>::identity();
+    for (int i = 0; i < 3; ++i) {
+        R(i, i) = STATIONARY_VELOCITY_SIGMA * STATIONARY_VELOCITY_SIGMA;
+    }
+    filter.update(H, R, Matrix<3, 1>::zero());
+}
+
+// Constant velocity model, `up_accel` in m/s^2 is applied as a control input
+static void
+predict(float dt, float horizontal_accel, float up_accel)
+{
+    Matrix<STATE_SIZE, STATE_SIZE> F = Matrix<STATE_SIZE, STATE_SIZE>::identity();
+    F(NORTH, VELOCITY_NORTH) = F(EAST, VELOCITY_EAST) = F(UP, VELOCITY_UP) = dt;
+
+    Matrix<STATE_SIZE, 1> u = Matrix<STATE_SIZE, 1>::zero();
+    u(UP, 0) = 0.5f * dt * dt * up_accel;
+    u(VELOCITY_UP, 0) = dt * up_accel;
+
+    // Continuous white acceleration noise per axis, the sigmas are what the velocity may drift
+    // within a second. As discrete noise per step it would shrink with the rate of the job.
+    const float horizontal_sigma = HORIZONTAL_ACCEL_SIGMA + HORIZONTAL_ACCEL_GAIN * horizontal_accel;
+    const float sigmas[3] = { horizontal_sigma, horizontal_sigma, VERTICAL_ACCEL_SIGMA };
+    Matrix<STATE_SIZE, STATE_SIZE> Q = Matrix<STATE_SIZE, STATE_SIZE>::zero();
+    for (int axis = 0; axis < 3; ++axis) {
+        const float q = sigmas[axis] * sigmas[axis];
+        Q(axis, axis) = dt * dt * dt / 3.0f * q;
+        Q(axis, axis + 3) = Q(axis + 3, axis) = 0.5f * dt * dt * q;
+        Q(axis + 3, axis + 3) = dt * q;
+    }
+    filter.predict(F, u, Q);
+}
+
+static void
+publish(bool is_valid)
+{
+    NavState state;
+    state.latitude_e7 = origin_latitude_e7 + (int32_t)lround(filter.x(NORTH, 0) / METERS_PER_E7);
+    state.longitude_e7 = origin_longitude_e7 + (int32_t)lround(filter.x(EAST, 0) / meters_per_longitude_e7);
+    state.altitude_cm = origin_altitude_cm + (int32_t)lround(filter.x(UP, 0) * 100.0f);
+    state.velocity_north = filter.x(VELOCITY_NORTH, 0);
+    state.velocity_east = filter.x(VELOCITY_EAST, 0);
+    state.velocity_up = filter.x(VELOCITY_UP, 0);
+    state.position_sigma = sqrtf(0.5f * (filter.P(NORTH, NORTH) + filter.P(EAST, EAST)));
+    state.is_stationary = stationary;
+    state.is_valid = is_valid;
+    snapshot_publish(&NAV_STATE, &state);
+}
+
+static void
+nav_run(void* context)
+{
+    const int64_t now = esp_timer_get_time();
+    const float dt = fminf(fmaxf((now - last_run_us) * 1e-6f, 0.001f), 0.2f);
+    last_run_us = now;
+
+    // Gravity is what remains of the accelerometer reading when averaged. It is tracked slowly
+    // while moving, otherwise accelerating out of rest would be taken for a tilt within a second
+    // and look stationary again.
+    float accel[3];
+    MPU6886_GetAccelData(&accel[0], &accel[1], &accel[2]);
+    const float gain = dt / (stationary ? GRAVITY_TIME_CONSTANT_AT_REST : GRAVITY_TIME_CONSTANT);
+    for (int i = 0; i < 3; ++i) {
+        gravity[i] = gravity_valid ? gravity[i] + gain * (accel[i] - gravity[i]) : accel[i];
+    }
+    gravity_valid = true;
+    const float gravity_norm =
+      sqrtf(gravity[0] * gravity[0] + gravity[1] * gravity[1] + gravity[2] * gravity[2]);
+    float linear[3];
+    float up = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        linear[i] = accel[i] - gravity[i];
+        up += linear[i] * gravity[i] / gravity_norm;
+    }
+    const float linear_norm = sqrtf(linear[0] * linear[0] + linear[1] * linear[1] + linear[2] * linear[2]);
+    const float horizontal = sqrtf(fmaxf(linear_norm * linear_norm - up * up, 0.0f));
+    motion += MOTION_SMOOTHING * (linear_norm - motion);
+
+    stationary = motion < STATIONARY_DEVIATION;
+    if (initialized) {
+        // Gravity lags behind the attitude of a device that is turned or handled, and the
+        // projection onto it is then mostly tilt and horizontal acceleration. Until it caught up
+        // the vertical axis is left to the fixes.
+        const float up_accel = motion < VERTICAL_INPUT_MAX_MOTION ? up * STANDARD_GRAVITY : 0.0f;
+        predict(dt, horizontal * STANDARD_GRAVITY, up_accel);
+        // Counting the variance in, as right after a reset the speed is zero only for lack of fixes
+        const float north = filter.x(VELOCITY_NORTH, 0);
+        const float east = filter.x(VELOCITY_EAST, 0);
+        const float speed_squared = north * north + filter.P(VELOCITY_NORTH, VELOCITY_NORTH) + east * east +
+                                    filter.P(VELOCITY_EAST, VELOCITY_EAST);
+        stationary = stationary && speed_squared < STATIONARY_SPEED * STATIONARY_SPEED;
+        if (stationary) {
+            correct_stationary();
+        }
+    }
+
+    GpsPosition fix;
+    const uint32_t fix_sequence = read_latest_gps_position(&fix);
+    if (fix.is_valid && fix_sequence != last_fix_sequence) {
+        last_fix_sequence = fix_sequence;
+        if (!initialized || now - last_fix_us > NAV_FIX_TIMEOUT_US) {
+            reset(&fix);
+        } else {
+            correct_with_fix(&fix);
+        }
+        last_fix_us = now;
+    }
+
+    if (initialized) {
+        publish(now - last_fix_us <= NAV_FIX_TIMEOUT_US);
+    }
+}
+
+static SchedulerJob nav_job = { .name = "nav", .run = nav_run, .period_ms = 1000 / NAV_RATE_HZ };
+
+void
+nav_start(void)
+{
+    last_run_us = esp_timer_get_time();
+    scheduler_add(&nav_job, 0);
+}
+
+#endif
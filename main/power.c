@@ -34,7 +34,11 @@
 
 #include "core2forAWS.h"
 
+#include "fmt.h"
 #include "power.h"
+#include "scheduler.h"
+#include "sensor_history.h"
+#include "snapshot.h"
 
 static const char* TAG = POWER_TAB_NAME;
 lv_obj_t* brightness_label = NULL;
@@ -45,6 +49,16 @@ lv_obj_t* pir_sensor_label = NULL;
 const uint8_t lowest_brightness = 30;
 uint8_t the_brightness = 50;
 
+SNAPSHOT_DEFINE(POWER_INFO, PowerInfo);
+
+PowerInfo
+get_power_info(void)
+{
+    PowerInfo pi;
+    snapshot_read(&POWER_INFO, &pi);
+    return pi;
+}
+
 // Caller *must* hold the GUI semaphore
 static void
 brightness_updater(uint8_t brightness)
@@ -64,49 +78,76 @@ brightness_slider_event_cb(lv_obj_t* slider, lv_event_t event)
     }
 }
 
+static bool pir_sensor_ready = false;
+static char pir_sensor_text[32];
+static char battery_text[32];
+
 static void
-pir_sensor_task(void* pvParameters)
+pir_sensor_init(void* context)
 {
-    ESP_LOGI(TAG, "Start ENV III task");
+    ESP_LOGI(TAG, "Start PIR sensor job");
     esp_err_t err = Core2ForAWS_Port_PinMode(GPIO_NUM_36, ADC);
     if (err != ESP_OK) {
         const char* PIR_SENSOR_FAILED = "PIR sensor failed";
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
         lv_label_set_static_text(pir_sensor_label, PIR_SENSOR_FAILED);
+        xSemaphoreGive(xGuiSemaphore);
         ESP_LOGE(TAG, "Failed to enable ADC port");
-        vTaskDelete(NULL);
         return;
     }
+    pir_sensor_ready = true;
+}
 
-    char pir_sensor_text[32];
-    char battery_text[32];
-
-    while (true) {
-        const uint32_t adc_sensor_value = Core2ForAWS_Port_B_ADC_ReadRaw();
-        const float bat_V = Core2ForAWS_PMU_GetBatVolt();
-        const float bat_A = Core2ForAWS_PMU_GetBatCurrent();
-
-        snprintf(battery_text, sizeof(battery_text), "Battery status: %.2fV, %.1fmA", bat_V, bat_A);
-        snprintf(pir_sensor_text, sizeof(pir_sensor_text), "PIR sensor: %u", adc_sensor_value);
+static void
+pir_sensor_run(void* context)
+{
+    if (!pir_sensor_ready) {
+        return;
+    }
 
-        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
-        lv_label_set_static_text(pir_sensor_label, pir_sensor_text);
-        if (adc_sensor_value < 100 && bat_V < 4.0 && bat_A < 0.0f) {
-            lv_slider_set_value(brightness_slider, lowest_brightness, LV_ANIM_OFF);
-            brightness_updater(lowest_brightness);
-        } else {
-            lv_slider_set_value(brightness_slider, the_brightness, LV_ANIM_OFF);
-            brightness_updater(the_brightness);
-        }
-
-        lv_label_set_static_text(battery_label, battery_text);
-        xSemaphoreGive(xGuiSemaphore);
+    const uint32_t adc_sensor_value = Core2ForAWS_Port_B_ADC_ReadRaw();
+    const float bat_V = Core2ForAWS_PMU_GetBatVolt();
+    const float bat_A = Core2ForAWS_PMU_GetBatCurrent();
+
+    const PowerInfo power_info = { .battery_voltage = bat_V,
+                                   .battery_current = bat_A,
+                                   .pir_sensor = adc_sensor_value };
+    snapshot_publish(&POWER_INFO, &power_info);
+
+    const uint32_t now = sensor_history_now();
+    sensor_history_append(SENSOR_CHANNEL_PIR, now, adc_sensor_value);
+    sensor_history_append(SENSOR_CHANNEL_BATTERY_VOLTAGE, now, bat_V);
+    sensor_history_append(SENSOR_CHANNEL_BATTERY_CURRENT, now, bat_A);
+
+    char* const battery_end = battery_text + sizeof(battery_text);
+    char* pos = fmt_str(battery_text, battery_end, "Battery status: ");
+    pos = fmt_fixed(pos, battery_end, bat_V, 2);
+    pos = fmt_str(pos, battery_end, "V, ");
+    pos = fmt_fixed(pos, battery_end, bat_A, 1);
+    fmt_str(pos, battery_end, "mA");
+    char* const pir_end = pir_sensor_text + sizeof(pir_sensor_text);
+    pos = fmt_str(pir_sensor_text, pir_end, "PIR sensor: ");
+    fmt_uint(pos, pir_end, adc_sensor_value, 1);
 
-        vTaskDelay(pdMS_TO_TICKS(1000));
+    xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+    lv_label_set_static_text(pir_sensor_label, pir_sensor_text);
+    if (adc_sensor_value < 100 && bat_V < 4.0 && bat_A < 0.0f) {
+        lv_slider_set_value(brightness_slider, lowest_brightness, LV_ANIM_OFF);
+        brightness_updater(lowest_brightness);
+    } else {
+        lv_slider_set_value(brightness_slider, the_brightness, LV_ANIM_OFF);
+        brightness_updater(the_brightness);
     }
 
-    vTaskDelete(NULL); // Should never get to here...
+    lv_label_set_static_text(battery_label, battery_text);
+    xSemaphoreGive(xGuiSemaphore);
 }
 
+static SchedulerJob pir_sensor_job = { .name = "pir",
+                                       .init = pir_sensor_init,
+                                       .run = pir_sensor_run,
+                                       .period_ms = 1000 };
+
 void
 display_power_tab(lv_obj_t* tv)
 {
@@ -179,5 +220,5 @@ display_power_tab(lv_obj_t* tv)
 
     xSemaphoreGive(xGuiSemaphore);
 
-    xTaskCreate(pir_sensor_task, "PirTask", 4096, NULL, 0, &pir_sensor_handle);
+    scheduler_add(&pir_sensor_job, 0);
 }
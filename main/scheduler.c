@@ -0,0 +1,213 @@
+#include "scheduler.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char* TAG = "Scheduler";
+
+#define SCHEDULER_STACK_SIZE (4096 * 3)
+#define STATS_PERIOD_MS (60 * 1000)
+#define STATS_MAX_JOBS 16
+
+static TaskHandle_t scheduler_handle;
+static portMUX_TYPE jobs_lock = portMUX_INITIALIZER_UNLOCKED;
+// Sorted by deadline, earliest first. This stands in for a timer wheel: with the dozen jobs of the
+// firmware, the next deadline is the head and an insert walks a few entries. A wheel would add a slot
+// array and a tick resolution, and its own periodic wakeups to turn it over.
+static SchedulerJob* jobs = NULL;
+static int64_t started_us;
+
+// Must be called with jobs_lock held
+static void
+insert_job(SchedulerJob* job)
+{
+    SchedulerJob** link = &jobs;
+    while (*link != NULL && (*link)->deadline_us <= job->deadline_us) {
+        link = &(*link)->next;
+    }
+    job->next = *link;
+    job->queued = true;
+    *link = job;
+}
+
+// Must be called with jobs_lock held
+static void
+remove_job(SchedulerJob* job)
+{
+    for (SchedulerJob** link = &jobs; *link != NULL; link = &(*link)->next) {
+        if (*link == job) {
+            *link = job->next;
+            break;
+        }
+    }
+    job->queued = false;
+}
+
+static void
+queue_job(SchedulerJob* job, uint32_t delay_ms)
+{
+    portENTER_CRITICAL(&jobs_lock);
+    if (job->queued) {
+        remove_job(job);
+    }
+    job->deadline_us = esp_timer_get_time() + (int64_t)delay_ms * 1000;
+    insert_job(job);
+    const bool is_first = jobs == job;
+    portEXIT_CRITICAL(&jobs_lock);
+
+    // The scheduler may be sleeping until a later deadline
+    if (is_first && scheduler_handle != NULL && xTaskGetCurrentTaskHandle() != scheduler_handle) {
+        xTaskNotifyGive(scheduler_handle);
+    }
+}
+
+void
+scheduler_add(SchedulerJob* job, uint32_t delay_ms)
+{
+    job->runs = 0;
+    job->max_jitter_us = 0;
+    job->max_runtime_us = 0;
+    job->total_runtime_us = 0;
+    // `queued` is left alone, queue_job() has to unlink a job that is added again while queued
+    queue_job(job, delay_ms);
+}
+
+void
+scheduler_reschedule(SchedulerJob* job, uint32_t delay_ms)
+{
+    queue_job(job, delay_ms);
+}
+
+static void
+run_job(SchedulerJob* job, int64_t now)
+{
+    if (job->runs == 0 && job->init != NULL) {
+        job->init(job->context);
+    }
+
+    const uint32_t jitter = now - job->deadline_us;
+    if (jitter > job->max_jitter_us) {
+        job->max_jitter_us = jitter;
+    }
+    job->run(job->context);
+    const uint32_t runtime = esp_timer_get_time() - now;
+    if (runtime > job->max_runtime_us) {
+        job->max_runtime_us = runtime;
+    }
+    job->total_runtime_us += runtime;
+    ++job->runs;
+}
+
+static void
+scheduler_task(void* pvParameters)
+{
+    ESP_LOGI(TAG, "Start scheduler task");
+    while (true) {
+        portENTER_CRITICAL(&jobs_lock);
+        SchedulerJob* job = jobs;
+        int64_t now = esp_timer_get_time();
+        const bool is_due = job != NULL && job->deadline_us <= now;
+        if (is_due) {
+            remove_job(job);
+        }
+        portEXIT_CRITICAL(&jobs_lock);
+
+        if (!is_due) {
+            TickType_t wait = portMAX_DELAY;
+            if (job != NULL) {
+                const int64_t tick_us = portTICK_PERIOD_MS * 1000;
+                wait = (job->deadline_us - now + tick_us - 1) / tick_us;
+            }
+            ulTaskNotifyTake(pdTRUE, wait);
+            continue;
+        }
+
+        run_job(job, now);
+        if (job->period_ms == 0) {
+            continue;
+        }
+
+        // The job may have been rescheduled while running, by itself or by another task, which
+        // queued it already. The check has to be under the same lock as the insert.
+        now = esp_timer_get_time();
+        portENTER_CRITICAL(&jobs_lock);
+        if (!job->queued) {
+            // Keep the phase, but skip periods that were missed instead of running them back to back
+            const int64_t period_us = (int64_t)job->period_ms * 1000;
+            job->deadline_us += period_us;
+            if (job->deadline_us <= now) {
+                job->deadline_us += ((now - job->deadline_us) / period_us + 1) * period_us;
+            }
+            insert_job(job);
+        }
+        portEXIT_CRITICAL(&jobs_lock);
+    }
+}
+
+void
+scheduler_log_stats(void)
+{
+    // Copied under the lock and logged after it, logging is far too slow for a critical section
+    struct
+    {
+        const char* name;
+        uint32_t runs;
+        uint32_t max_jitter_us;
+        uint32_t max_runtime_us;
+        uint64_t total_runtime_us;
+    } stats[STATS_MAX_JOBS];
+    size_t count = 0;
+    size_t skipped = 0;
+
+    portENTER_CRITICAL(&jobs_lock);
+    for (const SchedulerJob* job = jobs; job != NULL; job = job->next) {
+        if (count == STATS_MAX_JOBS) {
+            ++skipped;
+            continue;
+        }
+        stats[count].name = job->name;
+        stats[count].runs = job->runs;
+        stats[count].max_jitter_us = job->max_jitter_us;
+        stats[count].max_runtime_us = job->max_runtime_us;
+        stats[count].total_runtime_us = job->total_runtime_us;
+        ++count;
+    }
+    portEXIT_CRITICAL(&jobs_lock);
+
+    const int64_t elapsed_us = esp_timer_get_time() - started_us;
+    if (elapsed_us <= 0) {
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        ESP_LOGD(TAG,
+                 "%-12s runs %u, max jitter %u us, max runtime %u us, cpu %u.%02u%%",
+                 stats[i].name,
+                 stats[i].runs,
+                 stats[i].max_jitter_us,
+                 stats[i].max_runtime_us,
+                 (unsigned)(stats[i].total_runtime_us * 100 / elapsed_us),
+                 (unsigned)(stats[i].total_runtime_us * 10000 / elapsed_us % 100));
+    }
+    if (skipped > 0) {
+        ESP_LOGD(TAG, "%u more jobs", (unsigned)skipped);
+    }
+}
+
+static void
+stats_run(void* context)
+{
+    scheduler_log_stats();
+}
+
+static SchedulerJob stats_job = { .name = "stats", .run = stats_run, .period_ms = STATS_PERIOD_MS };
+
+void
+scheduler_start(void)
+{
+    started_us = esp_timer_get_time();
+    xTaskCreate(scheduler_task, "schedulerTask", SCHEDULER_STACK_SIZE, NULL, 0, &scheduler_handle);
+    scheduler_add(&stats_job, STATS_PERIOD_MS);
+}
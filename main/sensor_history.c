@@ -0,0 +1,211 @@
+#include "sensor_history.h"
+
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char* TAG = "SENSOR_HISTORY";
+
+#define EMPTY_SLOT UINT32_MAX
+
+typedef struct Slot
+{
+    uint32_t time;
+    float value;
+} Slot;
+
+typedef struct Accumulator
+{
+    uint32_t time;
+    float sum;
+    uint32_t count;
+} Accumulator;
+
+typedef struct TierConfig
+{
+    uint32_t period;
+    uint32_t capacity;
+} TierConfig;
+
+// 1 hour of seconds, 2 days of minutes and 30 days of hours
+static const TierConfig TIERS[SENSOR_HISTORY_TIER_COUNT] = {
+    { .period = 1, .capacity = 3600 },
+    { .period = 60, .capacity = 2 * 24 * 60 },
+    { .period = 3600, .capacity = 30 * 24 },
+};
+
+static Slot* SLOTS[SENSOR_CHANNEL_COUNT][SENSOR_HISTORY_TIER_COUNT];
+static Accumulator ACCUMULATORS[SENSOR_CHANNEL_COUNT][SENSOR_HISTORY_TIER_COUNT];
+
+bool
+sensor_history_init(void)
+{
+    size_t slots_per_channel = 0;
+    for (int tier = 0; tier < SENSOR_HISTORY_TIER_COUNT; ++tier) {
+        slots_per_channel += TIERS[tier].capacity;
+    }
+
+    const size_t total_size = SENSOR_CHANNEL_COUNT * slots_per_channel * sizeof(Slot);
+    Slot* memory = heap_caps_malloc(total_size, MALLOC_CAP_SPIRAM);
+    if (memory == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes for sensor history", (unsigned)total_size);
+        return false;
+    }
+    memset(memory, 0xff, total_size); // every slot starts as EMPTY_SLOT
+
+    for (int channel = 0; channel < SENSOR_CHANNEL_COUNT; ++channel) {
+        for (int tier = 0; tier < SENSOR_HISTORY_TIER_COUNT; ++tier) {
+            SLOTS[channel][tier] = memory;
+            ACCUMULATORS[channel][tier].time = EMPTY_SLOT;
+            memory += TIERS[tier].capacity;
+        }
+    }
+    ESP_LOGI(TAG, "Allocated %u bytes for sensor history", (unsigned)total_size);
+    return true;
+}
+
+uint32_t
+sensor_history_now(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000000);
+}
+
+uint32_t
+sensor_history_tier_period(SensorHistoryTier tier)
+{
+    return TIERS[tier].period;
+}
+
+SensorHistoryTier
+sensor_history_tier_for_step(uint32_t step)
+{
+    SensorHistoryTier tier = SENSOR_HISTORY_SECONDS;
+    while (tier + 1 < SENSOR_HISTORY_TIER_COUNT && TIERS[tier + 1].period <= step) {
+        ++tier;
+    }
+    return tier;
+}
+
+static Slot*
+slot_for(SensorChannel channel, SensorHistoryTier tier, uint32_t aligned_time)
+{
+    return &SLOTS[channel][tier][(aligned_time / TIERS[tier].period) % TIERS[tier].capacity];
+}
+
+// Readers validate a slot by reading its time before and after the value
+static void
+store_slot(Slot* slot, uint32_t time, float value)
+{
+    __atomic_store_n(&slot->time, EMPTY_SLOT, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->value = value;
+    __atomic_store_n(&slot->time, time, __ATOMIC_RELEASE);
+}
+
+static bool
+load_slot(const Slot* slot, uint32_t time, float* value)
+{
+    if (__atomic_load_n(&slot->time, __ATOMIC_ACQUIRE) != time) {
+        return false;
+    }
+    *value = slot->value;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&slot->time, __ATOMIC_RELAXED) == time;
+}
+
+void
+sensor_history_append(SensorChannel channel, uint32_t time, float value)
+{
+    if (SLOTS[channel][0] == NULL) {
+        return;
+    }
+
+    for (int tier = 0; tier < SENSOR_HISTORY_TIER_COUNT; ++tier) {
+        Accumulator* acc = &ACCUMULATORS[channel][tier];
+        const uint32_t aligned_time = time - time % TIERS[tier].period;
+        if (acc->time != aligned_time) {
+            acc->time = aligned_time;
+            acc->sum = 0.0f;
+            acc->count = 0;
+        }
+        acc->sum += value;
+        acc->count++;
+        // The running mean keeps the current (incomplete) period queryable as well
+        store_slot(slot_for(channel, tier, aligned_time), aligned_time, acc->sum / acc->count);
+    }
+}
+
+SensorHistoryTier
+sensor_history_normalize_range(uint32_t* from, uint32_t* to, uint32_t* step)
+{
+    const SensorHistoryTier tier = sensor_history_tier_for_step(*step);
+    const TierConfig* config = &TIERS[tier];
+    if (*step < config->period) {
+        *step = config->period;
+    }
+    // Up to the next period, unless that does not fit into 32 bits
+    const uint32_t remainder = *step % config->period;
+    if (remainder != 0 && *step - remainder <= UINT32_MAX - config->period) {
+        *step += config->period - remainder;
+    } else {
+        *step -= remainder;
+    }
+
+    // Nothing older than the ring capacity or newer than now can be present, which also bounds the
+    // number of steps a caller walks through to the capacity
+    const uint32_t now = sensor_history_now();
+    const uint32_t span = config->period * config->capacity;
+    if (now > span && *from < now - span) {
+        *from = now - span;
+    }
+    *from -= *from % config->period;
+    if (*to > now) {
+        *to = now;
+    }
+    return tier;
+}
+
+bool
+sensor_history_get(SensorChannel channel, SensorHistoryTier tier, uint32_t time, float* value)
+{
+    if (SLOTS[channel][0] == NULL) {
+        return false;
+    }
+    const uint32_t aligned_time = time - time % TIERS[tier].period;
+    return load_slot(slot_for(channel, tier, aligned_time), aligned_time, value);
+}
+
+size_t
+sensor_history_query(SensorChannel channel,
+                     uint32_t from,
+                     uint32_t to,
+                     uint32_t step,
+                     SensorHistoryPoint* points,
+                     size_t max_points,
+                     uint32_t* next)
+{
+    const SensorHistoryTier tier = sensor_history_normalize_range(&from, &to, &step);
+
+    size_t count = 0;
+    uint32_t time = from;
+    while (time <= to && count < max_points && SLOTS[channel][0] != NULL) {
+        float value;
+        if (load_slot(slot_for(channel, tier, time), time, &value)) {
+            points[count].time = time;
+            points[count].value = value;
+            ++count;
+        }
+        if (time > UINT32_MAX - step) {
+            time = UINT32_MAX;
+            break;
+        }
+        time += step;
+    }
+
+    if (next != NULL) {
+        *next = time;
+    }
+    return count;
+}
@@ -0,0 +1,42 @@
+#include "snapshot.h"
+
+#include <string.h>
+
+// The sequence is bumped before and after every write, so it is odd while one is in progress
+static inline size_t
+published_buffer(uint32_t sequence)
+{
+    return (sequence >> 1) & 1;
+}
+
+void
+snapshot_publish(Snapshot* snapshot, const void* value)
+{
+    const uint32_t writing = __atomic_load_n(&snapshot->sequence, __ATOMIC_RELAXED) + 1;
+    __atomic_store_n(&snapshot->sequence, writing, __ATOMIC_RELAXED);
+    // Readers must see the odd sequence before any of the data below, even on weakly ordered CPUs
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(snapshot->buffers + published_buffer(writing + 1) * snapshot->size, value, snapshot->size);
+    __atomic_store_n(&snapshot->sequence, writing + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t
+snapshot_read(const Snapshot* snapshot, void* value)
+{
+    uint32_t begin, end;
+    do {
+        begin = __atomic_load_n(&snapshot->sequence, __ATOMIC_ACQUIRE);
+        memcpy(value, snapshot->buffers + published_buffer(begin) * snapshot->size, snapshot->size);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&snapshot->sequence, __ATOMIC_RELAXED);
+        // Our buffer is only overwritten by the publish after the next one, which starts at begin + 3
+        // from an even begin and at begin + 2 from an odd one
+    } while (end - (begin & ~1u) > 2);
+    return begin >> 1;
+}
+
+uint32_t
+snapshot_sequence(const Snapshot* snapshot)
+{
+    return __atomic_load_n(&snapshot->sequence, __ATOMIC_ACQUIRE) >> 1;
+}
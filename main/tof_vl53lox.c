@@ -26,6 +26,18 @@ makeuint16(int lsb, int msb)
     return ((msb & 0xFF) << 8) | (lsb & 0xFF);
 }
 
+static uint16_t
+TofVl53lox_convert(const byte data[12])
+{
+    uint16_t dist = makeuint16(data[11], data[10]);
+    byte device_range_status_internal = ((data[0] & 0x78) >> 3);
+    if (device_range_status_internal == 11) {
+        return dist;
+    } else {
+        return 0;
+    }
+}
+
 uint16_t
 TofVl53lox_get_reading(I2CDevice_t device)
 {
@@ -62,19 +74,86 @@ TofVl53lox_get_reading(I2CDevice_t device)
         ESP_LOGW(TAG, "status read error!");
         return 0;
     }
-    uint16_t acnt = makeuint16(data[7], data[6]);
-    uint16_t scnt = makeuint16(data[9], data[8]);
-    uint16_t dist = makeuint16(data[11], data[10]);
-    byte device_range_status_internal = ((data[0] & 0x78) >> 3);
-    /* ESP_LOGI(TAG, */
-    /*          "ambient count: %u, signal count: %u, distance: %u, status: %u", */
-    /*          acnt, */
-    /*          scnt, */
-    /*          dist, */
-    /*          device_range_status_internal); */
-    if (device_range_status_internal == 11) {
-        return dist;
+    return TofVl53lox_convert(data);
+}
+
+// Single ranging takes about 33 ms with the default timing budget
+#define TOF_FIRST_POLL_MS 30
+#define TOF_POLL_MS 10
+#define TOF_MAX_POLLS 100
+
+static void tof_status_read(I2CTransaction* transaction);
+
+static void
+tof_result_read(I2CTransaction* transaction)
+{
+    TofVl53loxRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGW(TAG, "status read error!");
     } else {
-        return 0;
+        request->distance = TofVl53lox_convert(request->data);
+    }
+    request->done(request->context);
+}
+
+static void
+tof_status_read(I2CTransaction* transaction)
+{
+    TofVl53loxRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGW(TAG, "initial read error!");
+        request->done(request->context);
+        return;
+    }
+
+    if ((request->data[0] & 0x01) == 0) {
+        if (++request->polls >= TOF_MAX_POLLS) {
+            ESP_LOGW(TAG, "TOF VL53LOX is not ready");
+            request->done(request->context);
+            return;
+        }
+        i2c_queue_submit(transaction, TOF_POLL_MS);
+        return;
+    }
+
+    transaction->length = sizeof(request->data);
+    transaction->done = tof_result_read;
+    i2c_queue_submit(transaction, 0);
+}
+
+static void
+tof_range_started(I2CTransaction* transaction)
+{
+    TofVl53loxRequest* request = transaction->context;
+    if (transaction->result) {
+        ESP_LOGW(TAG, "write error!");
+        request->done(request->context);
+        return;
     }
+
+    request->data[0] = 0;
+    transaction->register_address = VL53L0X_REG_RESULT_RANGE_STATUS;
+    transaction->is_read = true;
+    transaction->done = tof_status_read;
+    i2c_queue_submit(transaction, TOF_FIRST_POLL_MS);
+}
+
+void
+TofVl53lox_start_reading(TofVl53loxRequest* request, I2CDevice_t device, I2CRequestDone done, void* context)
+{
+    request->polls = 0;
+    request->distance = 0;
+    request->done = done;
+    request->context = context;
+    request->data[0] = 0x01;
+
+    I2CTransaction* transaction = &request->transaction;
+    transaction->device = device;
+    transaction->register_address = VL53L0X_REG_SYSRANGE_START;
+    transaction->data = request->data;
+    transaction->length = 1;
+    transaction->is_read = false;
+    transaction->done = tof_range_started;
+    transaction->context = request;
+    i2c_queue_submit(transaction, 0);
 }
@@ -0,0 +1,456 @@
+#include "track_log.h"
+
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_crc.h"
+#include "esp_log.h"
+
+static const char* TAG = "TrackLog";
+
+_Static_assert(sizeof(TrackLogBlockHeader) == 20, "the header is part of the file format");
+
+// The CRC starts after the magic and the CRC itself and runs into the point data
+#define CRC_OFFSET offsetof(TrackLogBlockHeader, first_time)
+#define MAX_POINT_SIZE (5 * 5) // five fields, at most 5 varint bytes each
+#define PADDING 0xff
+
+static uint32_t
+zigzag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t
+unzigzag(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Differences wrap around in 32 bits so that any pair of values round trips
+static uint32_t
+delta(uint32_t value, uint32_t previous)
+{
+    return zigzag((int32_t)(value - previous));
+}
+
+static uint32_t
+undelta(uint32_t previous, uint32_t encoded)
+{
+    return previous + (uint32_t)unzigzag(encoded);
+}
+
+static uint8_t*
+put_varint(uint8_t* out, uint32_t value)
+{
+    while (value >= 0x80) {
+        *out++ = (uint8_t)value | 0x80;
+        value >>= 7;
+    }
+    *out++ = (uint8_t)value;
+    return out;
+}
+
+// Returns NULL when the value is truncated or longer than 32 bits
+static const uint8_t*
+get_varint(const uint8_t* in, const uint8_t* end, uint32_t* value)
+{
+    uint32_t result = 0;
+    for (unsigned shift = 0; shift < 35 && in < end; shift += 7) {
+        const uint8_t byte = *in++;
+        result |= (uint32_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return in;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t
+block_crc(const uint8_t* block, uint16_t length)
+{
+    return esp_crc32_le(0, block + CRC_OFFSET, sizeof(TrackLogBlockHeader) - CRC_OFFSET + length);
+}
+
+void
+track_log_encoder_reset(TrackLogEncoder* encoder)
+{
+    encoder->length = 0;
+    encoder->count = 0;
+    memset(&encoder->previous, 0, sizeof(encoder->previous));
+}
+
+bool
+track_log_encoder_add(TrackLogEncoder* encoder, const GpsPosition* position)
+{
+    if (encoder->length + MAX_POINT_SIZE > TRACK_LOG_DATA_SIZE) {
+        return false;
+    }
+
+    const GpsPosition* previous = &encoder->previous;
+    uint8_t* out = encoder->block + sizeof(TrackLogBlockHeader) + encoder->length;
+    uint8_t* const start = out;
+    out = put_varint(out, delta(position->unix_time, previous->unix_time));
+    out = put_varint(out, delta(position->latitude_e7, previous->latitude_e7));
+    out = put_varint(out, delta(position->longitude_e7, previous->longitude_e7));
+    out = put_varint(out, delta(position->altitude_cm, previous->altitude_cm));
+    out = put_varint(out, position->satellites);
+
+    if (encoder->count == 0) {
+        TrackLogBlockHeader* header = (TrackLogBlockHeader*)encoder->block;
+        header->first_time = position->unix_time;
+    }
+    encoder->length += out - start;
+    encoder->count++;
+    encoder->previous = *position;
+    return true;
+}
+
+void
+track_log_encoder_finish(TrackLogEncoder* encoder)
+{
+    TrackLogBlockHeader* header = (TrackLogBlockHeader*)encoder->block;
+    header->magic = TRACK_LOG_MAGIC;
+    header->last_time = encoder->previous.unix_time;
+    header->count = encoder->count;
+    header->length = encoder->length;
+    const size_t used = sizeof(TrackLogBlockHeader) + encoder->length;
+    memset(encoder->block + used, PADDING, TRACK_LOG_BLOCK_SIZE - used);
+    header->crc = block_crc(encoder->block, encoder->length);
+}
+
+bool
+track_log_decoder_init(TrackLogDecoder* decoder, const uint8_t* block)
+{
+    TrackLogBlockHeader header;
+    memcpy(&header, block, sizeof(header));
+    if (header.magic != TRACK_LOG_MAGIC || header.count == 0 || header.length > TRACK_LOG_DATA_SIZE ||
+        header.crc != block_crc(block, header.length)) {
+        return false;
+    }
+
+    decoder->data = block + sizeof(header);
+    decoder->end = decoder->data + header.length;
+    decoder->remaining = header.count;
+    memset(&decoder->previous, 0, sizeof(decoder->previous));
+    return true;
+}
+
+bool
+track_log_decoder_next(TrackLogDecoder* decoder, GpsPosition* position)
+{
+    if (decoder->remaining == 0) {
+        return false;
+    }
+
+    uint32_t fields[5];
+    const uint8_t* in = decoder->data;
+    for (int i = 0; i < 5; ++i) {
+        if ((in = get_varint(in, decoder->end, &fields[i])) == NULL) {
+            decoder->remaining = 0;
+            return false;
+        }
+    }
+    decoder->data = in;
+    decoder->remaining--;
+
+    GpsPosition* previous = &decoder->previous;
+    previous->unix_time = undelta(previous->unix_time, fields[0]);
+    previous->latitude_e7 = (int32_t)undelta(previous->latitude_e7, fields[1]);
+    previous->longitude_e7 = (int32_t)undelta(previous->longitude_e7, fields[2]);
+    previous->altitude_cm = (int32_t)undelta(previous->altitude_cm, fields[3]);
+    previous->satellites = fields[4];
+    previous->is_valid = true;
+    *position = *previous;
+    return true;
+}
+
+static bool
+read_block(FILE* file, uint32_t index, uint8_t* block)
+{
+    return fseek(file, (long)index * TRACK_LOG_BLOCK_SIZE, SEEK_SET) == 0 &&
+           fread(block, TRACK_LOG_BLOCK_SIZE, 1, file) == 1;
+}
+
+typedef enum BlockCheck
+{
+    BLOCK_DAMAGED,
+    BLOCK_VALID,
+    BLOCK_COPY, // the other copy of the block compared against
+} BlockCheck;
+
+/**
+ * Checks block `index` of the file in small reads, and whether it is another copy of `block`, a
+ * valid one or NULL: both start at the same time and the points of one begin with all those of
+ * the other. `header` gets the header of the block in the file.
+ */
+static BlockCheck
+check_block(FILE* file, uint32_t index, const uint8_t* block, TrackLogBlockHeader* header)
+{
+    if (fseek(file, (long)index * TRACK_LOG_BLOCK_SIZE, SEEK_SET) != 0 ||
+        fread(header, sizeof(*header), 1, file) != 1 || header->magic != TRACK_LOG_MAGIC ||
+        header->count == 0 || header->length > TRACK_LOG_DATA_SIZE) {
+        return BLOCK_DAMAGED;
+    }
+
+    TrackLogBlockHeader other = { 0 };
+    if (block != NULL) {
+        memcpy(&other, block, sizeof(other));
+    }
+    bool is_copy = block != NULL && other.first_time == header->first_time;
+    const uint16_t common = other.length < header->length ? other.length : header->length;
+    uint32_t crc = esp_crc32_le(0, (const uint8_t*)header + CRC_OFFSET, sizeof(*header) - CRC_OFFSET);
+    uint8_t chunk[256];
+    for (uint16_t done = 0; done < header->length;) {
+        const uint16_t size = header->length - done < sizeof(chunk) ? header->length - done : sizeof(chunk);
+        if (fread(chunk, size, 1, file) != 1) {
+            return BLOCK_DAMAGED;
+        }
+        if (is_copy && done < common) {
+            const uint16_t compared = common - done < size ? common - done : size;
+            is_copy = memcmp(chunk, block + sizeof(other) + done, compared) == 0;
+        }
+        crc = esp_crc32_le(crc, chunk, size);
+        done += size;
+    }
+    if (crc != header->crc) {
+        return BLOCK_DAMAGED;
+    }
+    return is_copy ? BLOCK_COPY : BLOCK_VALID;
+}
+
+// Writes the open block to its own slot or to the spare one
+static bool
+write_copy(TrackLog* log, int8_t slot)
+{
+    track_log_encoder_finish(&log->encoder);
+    const uint32_t index = log->block_index + slot;
+    if (fseek(log->file, (long)index * TRACK_LOG_BLOCK_SIZE, SEEK_SET) != 0 ||
+        fwrite(log->encoder.block, TRACK_LOG_BLOCK_SIZE, 1, log->file) != 1 || fflush(log->file) != 0) {
+        ESP_LOGE(TAG, "Failed to write block %u", index);
+        return false;
+    }
+    fsync(fileno(log->file));
+    log->latest_slot = slot;
+    log->unflushed = 0;
+    return true;
+}
+
+// Never over the last copy, a write torn by a power loss leaves that one intact
+static bool
+write_block(TrackLog* log)
+{
+    return write_copy(log, log->latest_slot == 0 ? 1 : 0);
+}
+
+// A full block ends up in its own slot, the spare one is taken by the next block
+static bool
+close_block(TrackLog* log)
+{
+    if ((log->unflushed > 0 && !write_block(log)) || (log->latest_slot == 1 && !write_copy(log, 0))) {
+        return false;
+    }
+    log->block_index++;
+    log->latest_slot = -1;
+    track_log_encoder_reset(&log->encoder);
+    return true;
+}
+
+/**
+ * Picks up a partially filled last block so that it keeps being filled. The last two slots may
+ * hold two copies of it, or one and a torn write to the other slot, the longest complete copy
+ * is continued. A full or missing one starts a new block in the first free slot.
+ */
+static void
+resume_block(TrackLog* log, uint32_t slots)
+{
+    uint8_t* block = log->encoder.block;
+    TrackLogDecoder decoder;
+    TrackLogBlockHeader header;
+    uint32_t own = slots - 1;
+    uint32_t latest = slots - 1;
+    log->block_index = slots;
+    if (slots == 0) {
+        return;
+    }
+    if (read_block(log->file, latest, block) && track_log_decoder_init(&decoder, block)) {
+        const BlockCheck before = own > 0 ? check_block(log->file, own - 1, block, &header) : BLOCK_VALID;
+        if (before == BLOCK_COPY && header.count >= decoder.remaining) {
+            latest = --own;
+            read_block(log->file, latest, block);
+            track_log_decoder_init(&decoder, block);
+        } else if (before != BLOCK_VALID) {
+            --own; // the other copy, or the torn write of one, in the block's own slot
+        }
+    } else if (own > 0 && read_block(log->file, own - 1, block) && track_log_decoder_init(&decoder, block)) {
+        latest = --own; // the torn write went to the spare slot
+    } else {
+        log->block_index = slots - 1;
+        return;
+    }
+
+    GpsPosition position;
+    while (track_log_decoder_next(&decoder, &position)) {
+        log->encoder.previous = position;
+        log->encoder.count++;
+    }
+    log->encoder.length = decoder.data - (block + sizeof(TrackLogBlockHeader));
+    if (log->encoder.length + MAX_POINT_SIZE <= TRACK_LOG_DATA_SIZE) {
+        log->block_index = own;
+        log->latest_slot = latest - own;
+    } else {
+        // Its spare slot holds nothing else when the full copy is in the own one
+        log->block_index = latest + 1;
+        track_log_encoder_reset(&log->encoder);
+    }
+}
+
+bool
+track_log_open(TrackLog* log, const char* path)
+{
+    log->file = fopen(path, "r+b");
+    if (log->file == NULL) {
+        log->file = fopen(path, "w+b");
+    }
+    if (log->file == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return false;
+    }
+
+    track_log_encoder_reset(&log->encoder);
+    log->latest_slot = -1;
+    log->unflushed = 0;
+    fseek(log->file, 0, SEEK_END);
+    // A block torn while the file grew counts as a slot, it is either continued over or skipped
+    resume_block(log, (ftell(log->file) + TRACK_LOG_BLOCK_SIZE - 1) / TRACK_LOG_BLOCK_SIZE);
+    ESP_LOGI(TAG, "Appending to %s at block %u", path, log->block_index);
+    return true;
+}
+
+bool
+track_log_append(TrackLog* log, const GpsPosition* position)
+{
+    if (!position->is_valid) {
+        return true;
+    }
+    if (!track_log_encoder_add(&log->encoder, position)) {
+        if (!close_block(log)) {
+            return false;
+        }
+        track_log_encoder_add(&log->encoder, position);
+    }
+    if (++log->unflushed >= TRACK_LOG_FLUSH_POINTS) {
+        return write_block(log);
+    }
+    return true;
+}
+
+bool
+track_log_flush(TrackLog* log)
+{
+    return log->unflushed == 0 || write_block(log);
+}
+
+void
+track_log_close(TrackLog* log)
+{
+    if (log->file != NULL) {
+        track_log_flush(log);
+        fclose(log->file);
+        log->file = NULL;
+    }
+}
+
+bool
+track_log_reader_open(TrackLogReader* reader, const char* path)
+{
+    reader->file = fopen(path, "rb");
+    if (reader->file == NULL) {
+        return false;
+    }
+    fseek(reader->file, 0, SEEK_END);
+    reader->block_count = ftell(reader->file) / TRACK_LOG_BLOCK_SIZE;
+    reader->block_index = 0;
+    reader->from = 0;
+    reader->decoder.remaining = 0;
+    return true;
+}
+
+static bool
+read_header(TrackLogReader* reader, uint32_t index, TrackLogBlockHeader* header)
+{
+    return fseek(reader->file, (long)index * TRACK_LOG_BLOCK_SIZE, SEEK_SET) == 0 &&
+           fread(header, sizeof(*header), 1, reader->file) == 1 && header->magic == TRACK_LOG_MAGIC;
+}
+
+void
+track_log_reader_seek(TrackLogReader* reader, uint32_t time)
+{
+    // Last block starting at or before `time`, blocks with unreadable headers are stepped over
+    uint32_t low = 0;
+    uint32_t high = reader->block_count;
+    while (high - low > 1) {
+        const uint32_t middle = low + (high - low) / 2;
+        uint32_t probe = middle;
+        TrackLogBlockHeader header;
+        while (probe < high && !read_header(reader, probe, &header)) {
+            ++probe;
+        }
+        if (probe == high || header.first_time > time) {
+            high = middle;
+        } else {
+            low = probe;
+        }
+    }
+    // Both copies of a block start at the same time, the search stops at the second
+    TrackLogBlockHeader header, before;
+    while (low > 0 && read_header(reader, low, &header) && read_header(reader, low - 1, &before) &&
+           before.first_time == header.first_time) {
+        --low;
+    }
+    reader->block_index = low;
+    reader->from = time;
+    reader->decoder.remaining = 0;
+}
+
+bool
+track_log_reader_next(TrackLogReader* reader, GpsPosition* position)
+{
+    for (;;) {
+        while (track_log_decoder_next(&reader->decoder, position)) {
+            if (position->unix_time >= reader->from) {
+                return true;
+            }
+        }
+        if (reader->block_index >= reader->block_count) {
+            return false;
+        }
+        const uint32_t index = reader->block_index++;
+        if (!read_block(reader->file, index, reader->block) ||
+            !track_log_decoder_init(&reader->decoder, reader->block)) {
+            ESP_LOGW(TAG, "Skipping damaged block %u", index);
+            reader->decoder.remaining = 0;
+            continue;
+        }
+        // Of two copies of the block a power loss left behind only the longer one is read
+        TrackLogBlockHeader next;
+        if (reader->block_index < reader->block_count &&
+            check_block(reader->file, reader->block_index, reader->block, &next) == BLOCK_COPY) {
+            if (next.count >= reader->decoder.remaining) {
+                reader->decoder.remaining = 0;
+            } else {
+                reader->block_index++;
+            }
+        }
+    }
+}
+
+void
+track_log_reader_close(TrackLogReader* reader)
+{
+    if (reader->file != NULL) {
+        fclose(reader->file);
+        reader->file = NULL;
+    }
+}
@@ -1,4 +1,8 @@
 
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "freertos/task.h"
@@ -8,15 +12,19 @@
 
 #include "core2forAWS.h"
 
+#include "cbor.h"
 #include "env3.h"
+#include "fmt.h"
+#include "geofence.h"
 #include "gps.h"
+#include "gps_track.h"
+#include "scheduler.h"
+#include "sensor_history.h"
 #include "web.h"
 #include "wifi.h"
 
 static const char* TAG = WEB_TAB_NAME;
 
-static TaskHandle_t web_task_handle;
-
 lv_obj_t* ip_addr_label = NULL;
 
 #define MIN(a, b)                                                                                            \
@@ -26,11 +34,72 @@ lv_obj_t* ip_addr_label = NULL;
         _a < _b ? _a : _b;                                                                                   \
     })
 
+#define CBOR_CONTENT_TYPE "application/cbor"
+
+// Clients asking for CBOR in the Accept header get the same payloads in binary form
+static bool
+wants_cbor(httpd_req_t* req)
+{
+    // Browsers send long Accept lists, a truncated copy could miss the type at the end
+    const size_t length = httpd_req_get_hdr_value_len(req, "Accept");
+    if (length == 0) {
+        return false;
+    }
+    char* accept = malloc(length + 1);
+    if (accept == NULL) {
+        return false;
+    }
+    const bool cbor = httpd_req_get_hdr_value_str(req, "Accept", accept, length + 1) == ESP_OK &&
+                      strstr(accept, CBOR_CONTENT_TYPE) != NULL;
+    free(accept);
+    return cbor;
+}
+
+static esp_err_t
+send_cbor(httpd_req_t* req, CborWriter* writer)
+{
+    if (writer->failed) {
+        ESP_LOGE(TAG, "CBOR response does not fit into %u bytes", (unsigned)writer->capacity);
+        return httpd_resp_send_500(req);
+    }
+    httpd_resp_set_type(req, CBOR_CONTENT_TYPE);
+    return httpd_resp_send(req, (const char*)writer->data, writer->length);
+}
+
+static bool
+send_cbor_chunk(void* context, const uint8_t* data, size_t length)
+{
+    return httpd_resp_send_chunk((httpd_req_t*)context, (const char*)data, length) == ESP_OK;
+}
+
+static esp_err_t
+finish_cbor_chunks(httpd_req_t* req, CborWriter* writer)
+{
+    if (!cbor_flush(writer)) {
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
 esp_err_t
 get_sensors_handler(httpd_req_t* req)
 {
     /* Send a simple response */
     SensorInfo sensor_info = get_sensor_info();
+    if (wants_cbor(req)) {
+        uint8_t buffer[48];
+        CborWriter writer;
+        cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+        cbor_map(&writer, 3);
+        cbor_text(&writer, "temp");
+        cbor_float(&writer, sensor_info.temperature);
+        cbor_text(&writer, "hum");
+        cbor_float(&writer, sensor_info.humidity);
+        cbor_text(&writer, "press");
+        cbor_float(&writer, sensor_info.pressure);
+        return send_cbor(req, &writer);
+    }
+
     static char response_buffer[64];
     snprintf(response_buffer,
              sizeof(response_buffer),
@@ -43,6 +112,38 @@ get_sensors_handler(httpd_req_t* req)
     return ESP_OK;
 }
 
+// Writes the lat/lng/alt/sat/ut members shared by /gps and /gps/track (without braces)
+static char*
+format_gps_fields(char* dst, char* end, const GpsPosition* pos)
+{
+    dst = fmt_str(dst, end, "\"lat\":");
+    dst = fmt_scaled(dst, end, pos->latitude_e7, GPS_COORDINATE_DECIMALS);
+    dst = fmt_str(dst, end, ",\"lng\":");
+    dst = fmt_scaled(dst, end, pos->longitude_e7, GPS_COORDINATE_DECIMALS);
+    dst = fmt_str(dst, end, ",\"alt\":");
+    dst = fmt_scaled(dst, end, pos->altitude_cm, GPS_ALTITUDE_DECIMALS);
+    dst = fmt_str(dst, end, ",\"sat\":");
+    dst = fmt_uint(dst, end, pos->satellites, 1);
+    dst = fmt_str(dst, end, ",\"ut\":");
+    return fmt_uint(dst, end, pos->unix_time, 1);
+}
+
+// CBOR counterpart of format_gps_fields(), five map entries
+static void
+cbor_gps_fields(CborWriter* writer, const GpsPosition* pos)
+{
+    cbor_text(writer, "lat");
+    cbor_decimal(writer, pos->latitude_e7, -GPS_COORDINATE_DECIMALS);
+    cbor_text(writer, "lng");
+    cbor_decimal(writer, pos->longitude_e7, -GPS_COORDINATE_DECIMALS);
+    cbor_text(writer, "alt");
+    cbor_decimal(writer, pos->altitude_cm, -GPS_ALTITUDE_DECIMALS);
+    cbor_text(writer, "sat");
+    cbor_uint(writer, pos->satellites);
+    cbor_text(writer, "ut");
+    cbor_uint(writer, pos->unix_time);
+}
+
 esp_err_t
 get_gps_handler(httpd_req_t* req)
 {
@@ -50,6 +151,21 @@ get_gps_handler(httpd_req_t* req)
 
     /* Send a simple response */
     GpsPosition gps_pos = get_latest_gps_position();
+    if (wants_cbor(req)) {
+        uint8_t buffer[64];
+        CborWriter writer;
+        cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+        if (gps_pos.is_valid) {
+            cbor_map(&writer, 5);
+            cbor_gps_fields(&writer, &gps_pos);
+        } else {
+            cbor_map(&writer, 1);
+            cbor_text(&writer, "ut");
+            cbor_uint(&writer, gps_pos.unix_time);
+        }
+        return send_cbor(req, &writer);
+    }
+
     if (!gps_pos.is_valid) {
         /* httpd_resp_set_status(req, HTTPD_204); */
         httpd_resp_set_type(req, "application/json");
@@ -58,19 +174,386 @@ get_gps_handler(httpd_req_t* req)
         return ESP_OK;
     }
 
-    snprintf(response_buffer,
-             sizeof(response_buffer),
-             "{\"lat\":%.7f,\"lng\":%.7f,\"alt\":%.3f,\"sat\":%u,\"ut\":%u}",
-             gps_pos.latitude,
-             gps_pos.longitude,
-             gps_pos.altitude,
-             gps_pos.satellites,
-             gps_pos.unix_time);
+    char* const end = response_buffer + sizeof(response_buffer);
+    char* pos = fmt_char(response_buffer, end, '{');
+    pos = format_gps_fields(pos, end, &gps_pos);
+    fmt_char(pos, end, '}');
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, response_buffer, HTTPD_RESP_USE_STRLEN);
     return ESP_OK;
 }
 
+#define CHUNK_BUFFER_SIZE 512
+
+// Collects small pieces of a response and sends them as HTTP chunks
+typedef struct ChunkWriter
+{
+    httpd_req_t* req;
+    esp_err_t err;
+    size_t length;
+    char buffer[CHUNK_BUFFER_SIZE];
+} ChunkWriter;
+
+static void
+chunk_flush(ChunkWriter* writer)
+{
+    if (writer->length > 0 && writer->err == ESP_OK) {
+        writer->err = httpd_resp_send_chunk(writer->req, writer->buffer, writer->length);
+    }
+    writer->length = 0;
+}
+
+static void
+chunk_printf(ChunkWriter* writer, const char* format, ...)
+{
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        const size_t available = sizeof(writer->buffer) - writer->length;
+        va_list args;
+        va_start(args, format);
+        const int written = vsnprintf(writer->buffer + writer->length, available, format, args);
+        va_end(args);
+        if (written < 0) {
+            return;
+        }
+        if ((size_t)written < available) {
+            writer->length += written;
+            return;
+        }
+        chunk_flush(writer);
+    }
+    ESP_LOGW(TAG, "Dropping response piece longer than %d bytes", CHUNK_BUFFER_SIZE);
+}
+
+static esp_err_t
+chunk_finish(ChunkWriter* writer)
+{
+    chunk_flush(writer);
+    if (writer->err == ESP_OK) {
+        writer->err = httpd_resp_send_chunk(writer->req, NULL, 0);
+    }
+    return writer->err;
+}
+
+static uint32_t
+query_uint(const char* query, const char* key, uint32_t default_value)
+{
+    char value[12];
+    if (query == NULL || httpd_query_key_value(query, key, value, sizeof(value)) != ESP_OK) {
+        return default_value;
+    }
+    char* end;
+    const unsigned long parsed = strtoul(value, &end, 10);
+    return end == value ? default_value : (uint32_t)parsed;
+}
+
+static const char* const CHANNEL_NAMES[SENSOR_CHANNEL_COUNT] = {
+    "temp", "hum", "press", "tof", "pir", "bat_v", "bat_a",
+};
+
+static esp_err_t
+send_sensors_history_cbor(httpd_req_t* req,
+                          uint32_t now,
+                          uint32_t from,
+                          uint32_t to,
+                          uint32_t step,
+                          SensorHistoryTier tier)
+{
+    uint8_t buffer[256];
+    CborWriter writer;
+    cbor_init(&writer, buffer, sizeof(buffer), send_cbor_chunk, req);
+    httpd_resp_set_type(req, CBOR_CONTENT_TYPE);
+
+    cbor_map(&writer, 3);
+    cbor_text(&writer, "now");
+    cbor_uint(&writer, now);
+    cbor_text(&writer, "step");
+    cbor_uint(&writer, step);
+    cbor_text(&writer, "samples");
+    cbor_array_begin(&writer);
+    for (uint32_t time = from; time <= to && !writer.failed; time += step) {
+        float values[SENSOR_CHANNEL_COUNT];
+        bool present[SENSOR_CHANNEL_COUNT];
+        size_t present_count = 0;
+        for (int channel = 0; channel < SENSOR_CHANNEL_COUNT; ++channel) {
+            present[channel] = sensor_history_get(channel, tier, time, &values[channel]);
+            present_count += present[channel];
+        }
+
+        if (present_count > 0) {
+            cbor_map(&writer, present_count + 1);
+            cbor_text(&writer, "t");
+            cbor_uint(&writer, time);
+            for (int channel = 0; channel < SENSOR_CHANNEL_COUNT; ++channel) {
+                if (present[channel]) {
+                    cbor_text(&writer, CHANNEL_NAMES[channel]);
+                    cbor_float(&writer, values[channel]);
+                }
+            }
+        }
+        if (time > UINT32_MAX - step) {
+            break;
+        }
+    }
+    cbor_break(&writer);
+    return finish_cbor_chunks(req, &writer);
+}
+
+esp_err_t
+get_sensors_history_handler(httpd_req_t* req)
+{
+    char query[64];
+    const char* q = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK ? query : NULL;
+
+    const uint32_t now = sensor_history_now();
+    uint32_t from = query_uint(q, "from", now > 300 ? now - 300 : 0);
+    uint32_t to = query_uint(q, "to", now);
+    uint32_t step = query_uint(q, "step", 1);
+    const SensorHistoryTier tier = sensor_history_normalize_range(&from, &to, &step);
+    if (wants_cbor(req)) {
+        return send_sensors_history_cbor(req, now, from, to, step, tier);
+    }
+
+    ChunkWriter writer = { .req = req, .err = ESP_OK, .length = 0 };
+    httpd_resp_set_type(req, "application/json");
+    chunk_printf(&writer, "{\"now\":%u,\"step\":%u,\"samples\":[", now, step);
+    bool first = true;
+    for (uint32_t time = from; time <= to && writer.err == ESP_OK; time += step) {
+        float values[SENSOR_CHANNEL_COUNT];
+        bool present[SENSOR_CHANNEL_COUNT];
+        bool any_present = false;
+        for (int channel = 0; channel < SENSOR_CHANNEL_COUNT; ++channel) {
+            present[channel] = sensor_history_get(channel, tier, time, &values[channel]);
+            any_present |= present[channel];
+        }
+
+        if (any_present) {
+            chunk_printf(&writer, "%s{\"t\":%u", first ? "" : ",", time);
+            for (int channel = 0; channel < SENSOR_CHANNEL_COUNT; ++channel) {
+                if (present[channel]) {
+                    chunk_printf(&writer, ",\"%s\":%.2f", CHANNEL_NAMES[channel], values[channel]);
+                }
+            }
+            chunk_printf(&writer, "}");
+            first = false;
+        }
+        if (time > UINT32_MAX - step) {
+            break;
+        }
+    }
+    chunk_printf(&writer, "]}");
+    return chunk_finish(&writer);
+}
+
+static esp_err_t
+send_gps_track_cbor(httpd_req_t* req, uint32_t now, uint32_t from, uint32_t to)
+{
+    uint8_t buffer[256];
+    CborWriter writer;
+    cbor_init(&writer, buffer, sizeof(buffer), send_cbor_chunk, req);
+    httpd_resp_set_type(req, CBOR_CONTENT_TYPE);
+
+    cbor_map(&writer, 2);
+    cbor_text(&writer, "now");
+    cbor_uint(&writer, now);
+    cbor_text(&writer, "track");
+    cbor_array_begin(&writer);
+    GpsTrackPoint points[16];
+    uint32_t cursor = 0;
+    size_t count;
+    while (!writer.failed &&
+           (count = gps_track_query(from, to, points, sizeof(points) / sizeof(points[0]), &cursor)) > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            cbor_map(&writer, 6);
+            cbor_text(&writer, "t");
+            cbor_uint(&writer, points[i].time);
+            cbor_gps_fields(&writer, &points[i].position);
+        }
+    }
+    cbor_break(&writer);
+    return finish_cbor_chunks(req, &writer);
+}
+
+esp_err_t
+get_gps_track_handler(httpd_req_t* req)
+{
+    char query[64];
+    const char* q = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK ? query : NULL;
+
+    const uint32_t now = sensor_history_now();
+    const uint32_t from = query_uint(q, "from", 0);
+    const uint32_t to = query_uint(q, "to", now);
+    if (wants_cbor(req)) {
+        return send_gps_track_cbor(req, now, from, to);
+    }
+
+    ChunkWriter writer = { .req = req, .err = ESP_OK, .length = 0 };
+    httpd_resp_set_type(req, "application/json");
+    chunk_printf(&writer, "{\"now\":%u,\"track\":[", now);
+    GpsTrackPoint points[16];
+    uint32_t cursor = 0;
+    bool first = true;
+    size_t count;
+    while (writer.err == ESP_OK &&
+           (count = gps_track_query(from, to, points, sizeof(points) / sizeof(points[0]), &cursor)) > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            char fields[96];
+            format_gps_fields(fields, fields + sizeof(fields), &points[i].position);
+            chunk_printf(&writer, "%s{\"t\":%u,%s}", first ? "" : ",", points[i].time, fields);
+            first = false;
+        }
+    }
+    chunk_printf(&writer, "]}");
+    return chunk_finish(&writer);
+}
+
+#define GEOFENCE_BODY_SIZE 2048 // about 90 polygon vertices
+#define GEOFENCE_INSIDE_MAX 32
+
+esp_err_t
+get_geofences_handler(httpd_req_t* req)
+{
+    uint32_t ids[GEOFENCE_INSIDE_MAX];
+    const size_t count = MIN(geofence_inside(ids, GEOFENCE_INSIDE_MAX), GEOFENCE_INSIDE_MAX);
+    if (wants_cbor(req)) {
+        uint8_t buffer[24 + GEOFENCE_INSIDE_MAX * 5];
+        CborWriter writer;
+        cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+        cbor_map(&writer, 2);
+        cbor_text(&writer, "count");
+        cbor_uint(&writer, geofence_count());
+        cbor_text(&writer, "inside");
+        cbor_array(&writer, count);
+        for (size_t i = 0; i < count; ++i) {
+            cbor_uint(&writer, ids[i]);
+        }
+        return send_cbor(req, &writer);
+    }
+
+    char response_buffer[32 + GEOFENCE_INSIDE_MAX * 11];
+    char* const end = response_buffer + sizeof(response_buffer);
+    char* pos = fmt_str(response_buffer, end, "{\"count\":");
+    pos = fmt_uint(pos, end, geofence_count(), 1);
+    pos = fmt_str(pos, end, ",\"inside\":[");
+    for (size_t i = 0; i < count; ++i) {
+        pos = fmt_uint(i > 0 ? fmt_char(pos, end, ',') : pos, end, ids[i], 1);
+    }
+    fmt_str(pos, end, "]}");
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response_buffer, HTTPD_RESP_USE_STRLEN);
+}
+
+// Parses whitespace or comma separated 32-bit integers, returns how many were read or -1 on garbage
+static int
+parse_integers(const char* text, int64_t* values, int max_values)
+{
+    int count = 0;
+    for (;;) {
+        while (*text == ' ' || *text == ',' || *text == '\n' || *text == '\r' || *text == '\t') {
+            ++text;
+        }
+        if (*text == '\0') {
+            return count;
+        }
+        char* end;
+        const long long value = strtoll(text, &end, 10);
+        if (end == text || count == max_values || value < INT32_MIN || value > UINT32_MAX) {
+            return -1;
+        }
+        values[count++] = value;
+        text = end;
+    }
+}
+
+// Range checks the coordinates before they are narrowed, values past 32 bits would wrap into range
+static bool
+to_geofence_point(int64_t latitude_e7, int64_t longitude_e7, GeofencePoint* point)
+{
+    if (latitude_e7 < -900000000 || latitude_e7 > 900000000 || longitude_e7 < -1800000000 ||
+        longitude_e7 > 1800000000) {
+        return false;
+    }
+    point->latitude_e7 = (int32_t)latitude_e7;
+    point->longitude_e7 = (int32_t)longitude_e7;
+    return true;
+}
+
+/**
+ * Adds one fence, the body holds integers with coordinates in 1e-7 degrees:
+ * "id lat lng radius_m" for a circle or "id lat lng lat lng lat lng ..." for a polygon.
+ * Latitudes past ±90°, longitudes past ±180° and negative ids or radii are a bad request.
+ */
+esp_err_t
+post_geofences_handler(httpd_req_t* req)
+{
+    if (req->content_len >= GEOFENCE_BODY_SIZE) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Fence too large");
+    }
+    char* body = malloc(GEOFENCE_BODY_SIZE);
+    int64_t* values = malloc(GEOFENCE_BODY_SIZE / 2 * sizeof(int64_t));
+    esp_err_t err = body != NULL && values != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+
+    size_t received = 0;
+    while (err == ESP_OK && received < req->content_len) {
+        const int length = httpd_req_recv(req, body + received, req->content_len - received);
+        if (length == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (length <= 0) {
+            err = ESP_FAIL;
+        } else {
+            received += length;
+        }
+    }
+
+    if (err == ESP_OK) {
+        body[received] = '\0';
+        const int count = parse_integers(body, values, GEOFENCE_BODY_SIZE / 2);
+        GeofencePoint center;
+        if (count > 0 && values[0] < 0) {
+            err = ESP_ERR_INVALID_ARG;
+        } else if (count == 4) {
+            err = to_geofence_point(values[1], values[2], &center) && values[3] >= 0
+                    ? geofence_add_circle(values[0], center, values[3])
+                    : ESP_ERR_INVALID_ARG;
+        } else if (count >= 7 && count % 2 == 1) {
+            // Packs the pairs in place, a GeofencePoint is not larger than the two values it replaces.
+            // The first vertex lands on the id, which is taken out before.
+            const uint32_t id = values[0];
+            GeofencePoint* vertices = (GeofencePoint*)values;
+            const size_t vertex_count = (count - 1) / 2;
+            for (size_t i = 0; i < vertex_count && err == ESP_OK; ++i) {
+                GeofencePoint vertex;
+                if (to_geofence_point(values[1 + 2 * i], values[2 + 2 * i], &vertex)) {
+                    vertices[i] = vertex;
+                } else {
+                    err = ESP_ERR_INVALID_ARG;
+                }
+            }
+            err = err == ESP_OK ? geofence_add_polygon(id, vertices, vertex_count) : err;
+        } else {
+            err = ESP_ERR_INVALID_ARG;
+        }
+    }
+    free(values);
+    free(body);
+
+    if (err == ESP_ERR_INVALID_ARG) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Expected a circle or a polygon");
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add geofence: %s", esp_err_to_name(err));
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to add geofence");
+    }
+    return get_geofences_handler(req);
+}
+
+esp_err_t
+delete_geofences_handler(httpd_req_t* req)
+{
+    geofence_clear();
+    return get_geofences_handler(req);
+}
+
 httpd_uri_t sensors_get = { .uri = "/sensors",
                             .method = HTTP_GET,
                             .handler = get_sensors_handler,
@@ -78,6 +561,31 @@ httpd_uri_t sensors_get = { .uri = "/sensors",
 
 httpd_uri_t gps_get = { .uri = "/gps", .method = HTTP_GET, .handler = get_gps_handler, .user_ctx = NULL };
 
+httpd_uri_t sensors_history_get = { .uri = "/sensors/history",
+                                    .method = HTTP_GET,
+                                    .handler = get_sensors_history_handler,
+                                    .user_ctx = NULL };
+
+httpd_uri_t gps_track_get = { .uri = "/gps/track",
+                              .method = HTTP_GET,
+                              .handler = get_gps_track_handler,
+                              .user_ctx = NULL };
+
+httpd_uri_t geofences_get = { .uri = "/geofences",
+                              .method = HTTP_GET,
+                              .handler = get_geofences_handler,
+                              .user_ctx = NULL };
+
+httpd_uri_t geofences_post = { .uri = "/geofences",
+                               .method = HTTP_POST,
+                               .handler = post_geofences_handler,
+                               .user_ctx = NULL };
+
+httpd_uri_t geofences_delete = { .uri = "/geofences",
+                                 .method = HTTP_DELETE,
+                                 .handler = delete_geofences_handler,
+                                 .user_ctx = NULL };
+
 /* Function for starting the webserver */
 httpd_handle_t
 start_webserver(void)
@@ -93,6 +601,11 @@ start_webserver(void)
         /* Register URI handlers */
         httpd_register_uri_handler(server, &sensors_get);
         httpd_register_uri_handler(server, &gps_get);
+        httpd_register_uri_handler(server, &sensors_history_get);
+        httpd_register_uri_handler(server, &gps_track_get);
+        httpd_register_uri_handler(server, &geofences_get);
+        httpd_register_uri_handler(server, &geofences_post);
+        httpd_register_uri_handler(server, &geofences_delete);
     }
     /* If server failed to start, handle will be NULL */
     return server;
@@ -108,26 +621,25 @@ stop_webserver(httpd_handle_t server)
     }
 }
 
+static uint32_t ip_address = 0;
+static char ip_address_text[32];
+
 static void
-web_update_task(void* pvParameters)
+web_update_run(void* context)
 {
-    ESP_LOGI(TAG, "Start WEB update task");
-    uint32_t ip_address = 0;
-    char ip_address_text[32];
-    while (true) {
-        const uint32_t ip = get_ip_address();
-        if (ip != ip_address) {
-            ip_address = ip;
-            struct esp_ip4_addr temp = { .addr = ip };
-            snprintf(ip_address_text, sizeof(ip_address_text), "IP address: " IPSTR, IP2STR(&temp));
-            xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
-            lv_label_set_static_text(ip_addr_label, ip_address_text);
-            xSemaphoreGive(xGuiSemaphore);
-        }
-        vTaskDelay(pdMS_TO_TICKS(1000));
+    const uint32_t ip = get_ip_address();
+    if (ip != ip_address) {
+        ip_address = ip;
+        char* const end = ip_address_text + sizeof(ip_address_text);
+        fmt_ipv4(fmt_str(ip_address_text, end, "IP address: "), end, ip);
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        lv_label_set_static_text(ip_addr_label, ip_address_text);
+        xSemaphoreGive(xGuiSemaphore);
     }
 }
 
+static SchedulerJob web_update_job = { .name = "web", .run = web_update_run, .period_ms = 1000 };
+
 void
 display_web_tab(lv_obj_t* tv)
 {
@@ -181,5 +693,5 @@ display_web_tab(lv_obj_t* tv)
     xSemaphoreGive(xGuiSemaphore);
 
     start_webserver();
-    xTaskCreate(web_update_task, "WebTask", 4096, NULL, 0, &web_task_handle);
+    scheduler_add(&web_update_job, 0);
 }
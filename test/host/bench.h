@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Timing for the benchmarks that run along with the tests. They only report, the host is
+ * neither the target nor quiet enough for a pass/fail limit.
+ */
+
+static inline double
+bench_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static inline void
+bench_report(const char* name, double seconds, double operations, const char* unit)
+{
+    printf("%-40s %10.1f ns/%s\n", name, seconds / operations * 1e9, unit);
+}
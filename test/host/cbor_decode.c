@@ -0,0 +1,194 @@
+#include "cbor_decode.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct Decoder
+{
+    const uint8_t* data;
+    size_t length;
+    size_t position;
+    char* out;
+    size_t out_size;
+    size_t out_length;
+    bool failed;
+} Decoder;
+
+static void emit(Decoder* decoder, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+static void
+emit(Decoder* decoder, const char* format, ...)
+{
+    if (decoder->failed) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    const size_t available = decoder->out_size - decoder->out_length;
+    const int written = vsnprintf(decoder->out + decoder->out_length, available, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= available) {
+        decoder->failed = true;
+        return;
+    }
+    decoder->out_length += written;
+}
+
+static bool
+read_byte(Decoder* decoder, uint8_t* value)
+{
+    if (decoder->position >= decoder->length) {
+        decoder->failed = true;
+        return false;
+    }
+    *value = decoder->data[decoder->position++];
+    return true;
+}
+
+static bool
+read_uint(Decoder* decoder, size_t bytes, uint64_t* value)
+{
+    *value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        uint8_t byte;
+        if (!read_byte(decoder, &byte)) {
+            return false;
+        }
+        *value = *value << 8 | byte;
+    }
+    return true;
+}
+
+// Shortest text that reads back as the same value, like the float printing of most languages
+static void
+emit_float(Decoder* decoder, double value, bool single)
+{
+    char text[32];
+    for (int precision = 1; precision <= 17; ++precision) {
+        snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (single ? strtof(text, NULL) == (float)value : strtod(text, NULL) == value) {
+            break;
+        }
+    }
+    // Diagnostic notation tells floats from integers by the decimal point
+    emit(decoder, strpbrk(text, ".en") != NULL ? "%s" : "%s.0", text);
+}
+
+static void decode_item(Decoder* decoder);
+
+// Items of a container up to `count`, or up to the break of an indefinite one
+static void
+decode_items(Decoder* decoder, uint64_t count, bool indefinite, bool pairs)
+{
+    for (uint64_t i = 0; indefinite || i < count; ++i) {
+        if (decoder->failed) {
+            return;
+        }
+        if (indefinite && decoder->position < decoder->length && decoder->data[decoder->position] == 0xff) {
+            ++decoder->position;
+            return;
+        }
+        emit(decoder, i == 0 ? "" : ", ");
+        decode_item(decoder);
+        if (pairs) {
+            emit(decoder, ": ");
+            decode_item(decoder);
+        }
+    }
+}
+
+static void
+decode_item(Decoder* decoder)
+{
+    uint8_t initial;
+    if (!read_byte(decoder, &initial)) {
+        return;
+    }
+    const uint8_t major = initial >> 5;
+    const uint8_t info = initial & 0x1f;
+
+    uint64_t argument = info;
+    const bool indefinite = info == 31;
+    if (info >= 24 && info <= 27) {
+        if (!read_uint(decoder, (size_t)1 << (info - 24), &argument)) {
+            return;
+        }
+    } else if (info >= 28 && (info != 31 || major == 0 || major == 1 || major == 6)) {
+        decoder->failed = true;
+        return;
+    }
+
+    switch (major) {
+        case 0:
+            emit(decoder, "%llu", (unsigned long long)argument);
+            break;
+        case 1:
+            emit(decoder, "-%llu", (unsigned long long)argument + 1);
+            break;
+        case 2:
+        case 3:
+            if (indefinite || argument > decoder->length - decoder->position) {
+                decoder->failed = true;
+                return;
+            }
+            if (major == 3) {
+                emit(decoder, "\"%.*s\"", (int)argument, (const char*)decoder->data + decoder->position);
+            } else {
+                emit(decoder, "h'");
+                for (uint64_t i = 0; i < argument; ++i) {
+                    emit(decoder, "%02x", decoder->data[decoder->position + i]);
+                }
+                emit(decoder, "'");
+            }
+            decoder->position += argument;
+            break;
+        case 4:
+            emit(decoder, indefinite ? "[_ " : "[");
+            decode_items(decoder, argument, indefinite, false);
+            emit(decoder, "]");
+            break;
+        case 5:
+            emit(decoder, indefinite ? "{_ " : "{");
+            decode_items(decoder, argument, indefinite, true);
+            emit(decoder, "}");
+            break;
+        case 6:
+            emit(decoder, "%llu(", (unsigned long long)argument);
+            decode_item(decoder);
+            emit(decoder, ")");
+            break;
+        default:
+            if (info == 20 || info == 21) {
+                emit(decoder, info == 21 ? "true" : "false");
+            } else if (info == 22) {
+                emit(decoder, "null");
+            } else if (info == 26) {
+                const uint32_t bits = (uint32_t)argument;
+                float value;
+                memcpy(&value, &bits, sizeof(value));
+                emit_float(decoder, value, true);
+            } else if (info == 27) {
+                double value;
+                memcpy(&value, &argument, sizeof(value));
+                emit_float(decoder, value, false);
+            } else {
+                decoder->failed = true; // half floats, other simple values and stray breaks
+            }
+            break;
+    }
+}
+
+size_t
+cbor_diagnostic(const uint8_t* data, size_t length, char* out, size_t out_size)
+{
+    Decoder decoder = { .data = data, .length = length, .out = out, .out_size = out_size };
+    if (out_size == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+    decode_item(&decoder);
+    return decoder.failed ? 0 : decoder.position;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Host side CBOR decoder for the round trip tests. It renders one data item in the
+ * diagnostic notation of RFC 8949 section 8, e.g. {"t": 104, "temp": 21.0}, with
+ * indefinite length containers marked [_ ...] and decimal fractions as 4([exponent, mantissa]).
+ *
+ * Returns the number of bytes the item took, 0 if it is malformed, truncated or does not
+ * fit into `out`.
+ */
+size_t cbor_diagnostic(const uint8_t* data, size_t length, char* out, size_t out_size);
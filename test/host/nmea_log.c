@@ -0,0 +1,72 @@
+#include "nmea_log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// 08:30:15 on 17 June 2023 at 31°50.7822' N 117°11.9297' E
+#define START_SECOND (8 * 3600 + 30 * 60 + 15)
+#define START_LAT_E4 (3150 * 10000 + 7822) // DDMM.MMMM without the point
+#define START_LNG_E4 (11711 * 10000 + 9297)
+
+size_t
+nmea_sentence(char* out, size_t size, const char* body)
+{
+    uint8_t checksum = 0;
+    for (const char* c = body; *c; ++c) {
+        checksum ^= (uint8_t)*c;
+    }
+    const int length = snprintf(out, size, "$%s*%02X\r\n", body, checksum);
+    return length > 0 && (size_t)length < size ? (size_t)length : 0;
+}
+
+static void
+format_degrees(char* out, size_t size, uint32_t e4, int degree_digits)
+{
+    snprintf(out, size, "%0*u%02u.%04u", degree_digits, e4 / 1000000, e4 / 10000 % 100, e4 % 10000);
+}
+
+size_t
+nmea_log(char* out, size_t size, uint32_t seconds)
+{
+    size_t length = 0;
+    for (uint32_t i = 0; i < seconds; ++i) {
+        const uint32_t second = (START_SECOND + i) % 86400;
+        char time[16];
+        snprintf(time, sizeof(time), "%02u%02u%02u.000", second / 3600, second / 60 % 60, second % 60);
+        // Walking north-east at about 1.5 m/s
+        char lat[16], lng[16];
+        format_degrees(lat, sizeof(lat), START_LAT_E4 + i % 4000 * 8, 2);
+        format_degrees(lng, sizeof(lng), START_LNG_E4 + i % 4000 * 6, 3);
+        const unsigned snr = 30 + i % 13;
+
+        char bodies[13][96];
+        snprintf(bodies[0], sizeof(bodies[0]), "GNGGA,%s,%s,N,%s,E,1,11,0.9,62.4,M,0.0,M,,", time, lat, lng);
+        snprintf(bodies[1], sizeof(bodies[1]), "GNGLL,%s,N,%s,E,%s,A,A", lat, lng, time);
+        snprintf(bodies[2], sizeof(bodies[2]), "GPGSA,A,3,02,05,13,15,20,29,,,,,,,1.6,0.9,1.3");
+        snprintf(bodies[3], sizeof(bodies[3]), "BDGSA,A,3,03,06,08,13,16,,,,,,,,1.6,0.9,1.3");
+        snprintf(bodies[4],
+                 sizeof(bodies[4]),
+                 "GPGSV,3,1,10,02,45,189,%u,05,62,037,41,13,29,302,35,15,48,222,40",
+                 snr);
+        snprintf(bodies[5], sizeof(bodies[5]), "GPGSV,3,2,10,18,11,076,,20,36,125,42,24,05,160,,26,03,040,");
+        snprintf(bodies[6], sizeof(bodies[6]), "GPGSV,3,3,10,29,71,311,44,30,08,261,22");
+        snprintf(bodies[7],
+                 sizeof(bodies[7]),
+                 "BDGSV,2,1,07,03,47,196,39,06,62,223,37,08,66,012,41,13,51,301,%u",
+                 snr + 3);
+        snprintf(bodies[8], sizeof(bodies[8]), "BDGSV,2,2,07,16,60,187,40,19,14,084,,21,22,145,28");
+        snprintf(bodies[9], sizeof(bodies[9]), "GNRMC,%s,A,%s,N,%s,E,2.91,36.87,170623,,,A", time, lat, lng);
+        snprintf(bodies[10], sizeof(bodies[10]), "GNVTG,36.87,T,,M,2.91,N,5.39,K,A");
+        snprintf(bodies[11], sizeof(bodies[11]), "GNZDA,%s,17,06,2023,00,00", time);
+        snprintf(bodies[12], sizeof(bodies[12]), "GPTXT,01,01,01,ANTENNA OK");
+
+        for (size_t b = 0; b < sizeof(bodies) / sizeof(bodies[0]); ++b) {
+            const size_t written = nmea_sentence(out + length, size - length, bodies[b]);
+            if (written == 0) {
+                return length;
+            }
+            length += written;
+        }
+    }
+    return length;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * NMEA output of an AT6558 receiver for the GPS tests, one capture of its 1 Hz burst
+     * (GN position sentences, GSA and GSV per constellation, ZDA and TXT) replayed with the
+     * time and position advanced every second.
+     */
+
+    // Writes "$<body>*<checksum>\r\n", returns its length or 0 if it does not fit
+    size_t nmea_sentence(char* out, size_t size, const char* body);
+
+    // Writes the bursts of `seconds` consecutive seconds, returns the length, truncated at a
+    // sentence boundary if they do not fit
+    size_t nmea_log(char* out, size_t size, uint32_t seconds);
+
+#ifdef __cplusplus
+}
+#endif
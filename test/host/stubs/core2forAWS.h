@@ -0,0 +1,138 @@
+#pragma once
+
+/**
+ * The parts of the board support package and of LVGL the host built modules use. The
+ * LVGL calls do nothing, objects are never created.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "bm8563.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    extern SemaphoreHandle_t xGuiSemaphore;
+
+    // Port A, served by the simulated bus of host_port_a.h
+    typedef void* I2CDevice_t;
+#define I2C_NO_REG (1 << 30)
+#define PORT_A_I2C_STANDARD_BAUD 100000
+
+    I2CDevice_t Core2ForAWS_Port_A_I2C_Begin(uint8_t device_address, uint32_t baud);
+    esp_err_t Core2ForAWS_Port_A_I2C_Read(I2CDevice_t device,
+                                          uint32_t register_address,
+                                          uint8_t* data,
+                                          uint16_t length);
+    esp_err_t Core2ForAWS_Port_A_I2C_Write(I2CDevice_t device,
+                                           uint32_t register_address,
+                                           uint8_t* data,
+                                           uint16_t length);
+    void Core2ForAWS_Port_A_I2C_Close(I2CDevice_t device);
+
+    // MPU6886, tests provide the readings
+    void MPU6886_GetAccelData(float* ax, float* ay, float* az);
+
+    typedef struct HostLvObject lv_obj_t;
+    typedef struct
+    {
+        int unused;
+    } lv_style_t;
+    typedef uint16_t lv_color_t;
+    typedef int lv_align_t;
+
+    enum
+    {
+        LV_ALIGN_IN_TOP_LEFT,
+        LV_ALIGN_IN_TOP_MID,
+        LV_ALIGN_OUT_BOTTOM_LEFT,
+        LV_STATE_DEFAULT,
+        LV_OBJ_PART_MAIN,
+        LV_LABEL_PART_MAIN,
+        LV_LABEL_LONG_BREAK,
+        LV_LABEL_ALIGN_LEFT,
+    };
+
+#define LV_COLOR_BLACK 0x0000
+#define LV_COLOR_WHITE 0xffff
+#define LV_COLOR_YELLOW 0xffe0
+#define LV_THEME_DEFAULT_FONT_TITLE NULL
+
+    static inline lv_obj_t*
+    lv_tabview_add_tab(lv_obj_t* tabview, const char* name)
+    {
+        return NULL;
+    }
+    static inline lv_obj_t*
+    lv_obj_create(lv_obj_t* parent, const lv_obj_t* copy)
+    {
+        return NULL;
+    }
+    static inline lv_obj_t*
+    lv_label_create(lv_obj_t* parent, const lv_obj_t* copy)
+    {
+        return NULL;
+    }
+    static inline void
+    lv_obj_align(lv_obj_t* obj, const lv_obj_t* base, lv_align_t align, int x, int y)
+    {
+    }
+    static inline void
+    lv_obj_set_size(lv_obj_t* obj, int width, int height)
+    {
+    }
+    static inline void
+    lv_obj_set_width(lv_obj_t* obj, int width)
+    {
+    }
+    static inline void
+    lv_obj_set_click(lv_obj_t* obj, bool enable)
+    {
+    }
+    static inline void
+    lv_obj_add_style(lv_obj_t* obj, int part, lv_style_t* style)
+    {
+    }
+    static inline void
+    lv_style_init(lv_style_t* style)
+    {
+    }
+    static inline void
+    lv_style_set_bg_color(lv_style_t* style, int state, lv_color_t color)
+    {
+    }
+    static inline void
+    lv_style_set_text_color(lv_style_t* style, int state, lv_color_t color)
+    {
+    }
+    static inline void
+    lv_style_set_text_font(lv_style_t* style, int state, const void* font)
+    {
+    }
+    static inline void
+    lv_label_set_static_text(lv_obj_t* label, const char* text)
+    {
+    }
+    static inline void
+    lv_label_set_long_mode(lv_obj_t* label, int mode)
+    {
+    }
+    static inline void
+    lv_label_set_align(lv_obj_t* label, int align)
+    {
+    }
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Port B's DAC, the output goes nowhere on the host
+typedef enum
+{
+    DAC_CHANNEL_1 = 0,
+    DAC_CHANNEL_2,
+} dac_channel_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    esp_err_t dac_output_enable(dac_channel_t channel);
+    esp_err_t dac_output_disable(dac_channel_t channel);
+    esp_err_t dac_output_voltage(dac_channel_t channel, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// The pins and calls of the expansion ports, configuring a pin does nothing on the host
+typedef enum
+{
+    GPIO_NUM_13 = 13,
+    GPIO_NUM_14 = 14,
+    GPIO_NUM_26 = 26,
+    GPIO_NUM_32 = 32,
+    GPIO_NUM_33 = 33,
+    GPIO_NUM_36 = 36,
+} gpio_num_t;
+
+typedef enum
+{
+    GPIO_MODE_INPUT = 1,
+    GPIO_MODE_OUTPUT = 2,
+} gpio_mode_t;
+
+typedef enum
+{
+    GPIO_PULLUP_DISABLE,
+    GPIO_PULLUP_ENABLE,
+} gpio_pullup_t;
+
+typedef enum
+{
+    GPIO_PULLDOWN_DISABLE,
+    GPIO_PULLDOWN_ENABLE,
+} gpio_pulldown_t;
+
+typedef enum
+{
+    GPIO_PIN_INTR_DISABLE,
+} gpio_int_type_t;
+
+typedef struct
+{
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    gpio_pullup_t pull_up_en;
+    gpio_pulldown_t pull_down_en;
+    gpio_int_type_t intr_type;
+} gpio_config_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    esp_err_t gpio_config(const gpio_config_t* config);
+    esp_err_t gpio_reset_pin(gpio_num_t pin);
+    int gpio_get_level(gpio_num_t pin);
+    esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+
+#ifdef __cplusplus
+}
+#endif
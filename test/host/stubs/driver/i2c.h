@@ -0,0 +1,9 @@
+#pragma once
+
+// Included by the Port A drivers, which only use the board support package on the host, and by
+// the real i2c_device.h when the board support package itself is built
+typedef enum
+{
+    I2C_NUM_0,
+    I2C_NUM_1,
+} i2c_port_t;
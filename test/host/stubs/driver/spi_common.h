@@ -0,0 +1,3 @@
+#pragma once
+
+// Included by the board support package, the host build has no SPI bus
@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * The IDF v4.2 UART driver calls of Port C, served by the simulated receiver of host_uart.h.
+ * Only UART_NUM_2 exists, transmitted bytes are counted and dropped.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+typedef enum
+{
+    UART_NUM_0,
+    UART_NUM_1,
+    UART_NUM_2,
+} uart_port_t;
+
+#define UART_PIN_NO_CHANGE (-1)
+
+typedef enum
+{
+    UART_DATA_8_BITS = 3,
+} uart_word_length_t;
+
+typedef enum
+{
+    UART_PARITY_DISABLE,
+} uart_parity_t;
+
+typedef enum
+{
+    UART_STOP_BITS_1 = 1,
+} uart_stop_bits_t;
+
+typedef enum
+{
+    UART_HW_FLOWCTRL_DISABLE,
+} uart_hw_flowcontrol_t;
+
+typedef struct
+{
+    int baud_rate;
+    uart_word_length_t data_bits;
+    uart_parity_t parity;
+    uart_stop_bits_t stop_bits;
+    uart_hw_flowcontrol_t flow_ctrl;
+    uint8_t rx_flow_ctrl_thresh;
+} uart_config_t;
+
+typedef enum
+{
+    UART_DATA,
+    UART_BREAK,
+    UART_BUFFER_FULL,
+    UART_FIFO_OVF,
+    UART_FRAME_ERR,
+    UART_PARITY_ERR,
+    UART_DATA_BREAK,
+    UART_PATTERN_DET,
+    UART_EVENT_MAX,
+} uart_event_type_t;
+
+typedef struct
+{
+    uart_event_type_t type;
+    size_t size;
+    bool timeout_flag;
+} uart_event_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    esp_err_t uart_driver_install(uart_port_t uart_num,
+                                  int rx_buffer_size,
+                                  int tx_buffer_size,
+                                  int queue_size,
+                                  QueueHandle_t* uart_queue,
+                                  int intr_alloc_flags);
+    esp_err_t uart_driver_delete(uart_port_t uart_num);
+    esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t* uart_config);
+    esp_err_t uart_set_pin(uart_port_t uart_num,
+                           int tx_io_num,
+                           int rx_io_num,
+                           int rts_io_num,
+                           int cts_io_num);
+    int uart_write_bytes(uart_port_t uart_num, const char* src, size_t size);
+    int uart_read_bytes(uart_port_t uart_num, uint8_t* buf, uint32_t length, TickType_t ticks_to_wait);
+    esp_err_t uart_get_buffered_data_len(uart_port_t uart_num, size_t* size);
+    esp_err_t uart_flush_input(uart_port_t uart_num);
+    esp_err_t uart_enable_pattern_det_baud_intr(uart_port_t uart_num,
+                                                char pattern_chr,
+                                                uint8_t chr_num,
+                                                int chr_tout,
+                                                int post_idle,
+                                                int pre_idle);
+    esp_err_t uart_pattern_queue_reset(uart_port_t uart_num, int queue_length);
+    int uart_pattern_pop_pos(uart_port_t uart_num);
+
+#ifdef __cplusplus
+}
+#endif
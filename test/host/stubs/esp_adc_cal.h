@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/adc.h"
+
+typedef struct
+{
+    uint32_t coeff_a;
+    uint32_t coeff_b;
+} esp_adc_cal_characteristics_t;
+
+typedef enum
+{
+    ESP_ADC_CAL_VAL_DEFAULT_VREF = 2,
+} esp_adc_cal_value_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t unit,
+                                                 adc_atten_t atten,
+                                                 adc_bits_width_t width,
+                                                 uint32_t default_vref,
+                                                 esp_adc_cal_characteristics_t* characteristics);
+    esp_err_t esp_adc_cal_get_voltage(adc_channel_t channel,
+                                      const esp_adc_cal_characteristics_t* characteristics,
+                                      uint32_t* voltage);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "esp_err.h"
+
+#define BIT1 0x00000002
+#define BIT0 0x00000001
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DEFAULT (1 << 12)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+static inline void*
+heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return malloc(size);
+}
+
+static inline void
+heap_caps_free(void* pointer)
+{
+    free(pointer);
+}
@@ -0,0 +1,184 @@
+#include "esp_http_server.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+esp_err_t
+httpd_start(httpd_handle_t* handle, const httpd_config_t* config)
+{
+    return ESP_FAIL;
+}
+
+esp_err_t
+httpd_stop(httpd_handle_t handle)
+{
+    return ESP_OK;
+}
+
+esp_err_t
+httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler)
+{
+    return ESP_OK;
+}
+
+static esp_err_t
+copy_truncated(const char* value, size_t length, char* buf, size_t buf_len)
+{
+    if (buf_len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t copied = length < buf_len - 1 ? length : buf_len - 1;
+    memcpy(buf, value, copied);
+    buf[copied] = '\0';
+    return copied < length ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t
+httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len)
+{
+    if (r->query == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return copy_truncated(r->query, strlen(r->query), buf, buf_len);
+}
+
+esp_err_t
+httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size)
+{
+    const size_t key_length = strlen(key);
+    while (*qry != '\0') {
+        const char* end = strchr(qry, '&');
+        if (end == NULL) {
+            end = qry + strlen(qry);
+        }
+        if (strncmp(qry, key, key_length) == 0 && qry[key_length] == '=') {
+            const char* value = qry + key_length + 1;
+            return copy_truncated(value, end - value, val, val_size);
+        }
+        qry = *end == '&' ? end + 1 : end;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static const char*
+find_header(httpd_req_t* r, const char* field)
+{
+    for (int i = 0; i < HTTPD_MAX_HEADERS; ++i) {
+        if (r->headers[i].name != NULL && strcasecmp(r->headers[i].name, field) == 0) {
+            return r->headers[i].value;
+        }
+    }
+    return NULL;
+}
+
+size_t
+httpd_req_get_hdr_value_len(httpd_req_t* r, const char* field)
+{
+    const char* value = find_header(r, field);
+    return value != NULL ? strlen(value) : 0;
+}
+
+esp_err_t
+httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size)
+{
+    const char* value = find_header(r, field);
+    if (value == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return copy_truncated(value, strlen(value), val, val_size);
+}
+
+int
+httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len)
+{
+    const size_t available = r->content_len - r->body_offset;
+    // Short reads, as from a socket
+    size_t length = available < buf_len ? available : buf_len;
+    length = length < 100 ? length : 100;
+    memcpy(buf, r->body + r->body_offset, length);
+    r->body_offset += length;
+    return (int)length;
+}
+
+esp_err_t
+httpd_resp_set_type(httpd_req_t* r, const char* type)
+{
+    strncpy(r->content_type, type, sizeof(r->content_type) - 1);
+    return ESP_OK;
+}
+
+static void
+append(httpd_req_t* r, const char* data, size_t length)
+{
+    if (r->response_length + length + 1 > r->response_capacity) {
+        r->response_capacity = 2 * (r->response_length + length + 1);
+        r->response = realloc(r->response, r->response_capacity);
+    }
+    memcpy(r->response + r->response_length, data, length);
+    r->response_length += length;
+    r->response[r->response_length] = '\0';
+}
+
+esp_err_t
+httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len)
+{
+    if (r->finished || r->chunked) {
+        return ESP_FAIL;
+    }
+    append(r, buf, buf_len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : (size_t)buf_len);
+    r->finished = true;
+    return ESP_OK;
+}
+
+esp_err_t
+httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len)
+{
+    if (r->finished) {
+        return ESP_FAIL;
+    }
+    r->chunked = true;
+    if (r->fail_after_chunks != 0 && r->chunks >= r->fail_after_chunks) {
+        return ESP_FAIL;
+    }
+    ++r->chunks;
+    if (buf == NULL) {
+        r->finished = true;
+        return ESP_OK;
+    }
+    append(r, buf, buf_len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : (size_t)buf_len);
+    return ESP_OK;
+}
+
+esp_err_t
+httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg)
+{
+    req->status = error == HTTPD_400_BAD_REQUEST ? 400 : error == HTTPD_404_NOT_FOUND ? 404 : 500;
+    req->finished = true;
+    if (msg != NULL) {
+        append(req, msg, strlen(msg));
+    }
+    return ESP_OK;
+}
+
+void
+host_http_request(httpd_req_t* req, const char* query, const char* accept)
+{
+    memset(req, 0, sizeof(*req));
+    req->method = HTTP_GET;
+    req->query = query;
+    req->status = 200;
+    if (accept != NULL) {
+        req->headers[0].name = "Accept";
+        req->headers[0].value = accept;
+    }
+}
+
+void
+host_http_reset(httpd_req_t* req)
+{
+    free(req->response);
+    req->response = NULL;
+    req->response_length = 0;
+    req->response_capacity = 0;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+/**
+ * Request side of esp_http_server for running the handlers on the host. A test fills in
+ * the query, headers and body of an httpd_req_t, calls a handler and checks the recorded
+ * response. See host_http_request() and host_http_reset().
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define ESP_ERR_HTTPD_BASE 0xb000
+#define ESP_ERR_HTTPD_RESULT_TRUNC (ESP_ERR_HTTPD_BASE + 4)
+#define HTTPD_RESP_USE_STRLEN -1
+#define HTTPD_SOCK_ERR_TIMEOUT -3
+#define HTTPD_MAX_HEADERS 4
+
+    typedef enum
+    {
+        HTTP_DELETE,
+        HTTP_GET,
+        HTTP_HEAD,
+        HTTP_POST,
+        HTTP_PUT,
+    } httpd_method_t;
+
+    typedef enum
+    {
+        HTTPD_500_INTERNAL_SERVER_ERROR,
+        HTTPD_400_BAD_REQUEST,
+        HTTPD_404_NOT_FOUND,
+    } httpd_err_code_t;
+
+    typedef struct HostHttpHeader
+    {
+        const char* name;
+        const char* value;
+    } HostHttpHeader;
+
+    typedef struct httpd_req
+    {
+        int method;
+        size_t content_len;
+
+        // Request, set by the test
+        const char* query;
+        HostHttpHeader headers[HTTPD_MAX_HEADERS];
+        const char* body;
+        size_t body_offset;
+
+        // Response
+        int status; // 200, 400 or 500
+        char content_type[64];
+        bool chunked;
+        bool finished; // whole response or terminating chunk sent
+        size_t chunks;
+        char* response;
+        size_t response_length;
+        size_t response_capacity;
+        size_t fail_after_chunks; // makes sends fail from this chunk on, 0 never
+    } httpd_req_t;
+
+    typedef esp_err_t (*httpd_handler_t)(httpd_req_t* req);
+
+    typedef struct httpd_uri
+    {
+        const char* uri;
+        httpd_method_t method;
+        httpd_handler_t handler;
+        void* user_ctx;
+    } httpd_uri_t;
+
+    typedef void* httpd_handle_t;
+
+    typedef struct httpd_config
+    {
+        int max_uri_handlers;
+    } httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG()                                                                               \
+    {                                                                                                        \
+        .max_uri_handlers = 8                                                                                \
+    }
+
+    esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config);
+    esp_err_t httpd_stop(httpd_handle_t handle);
+    esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler);
+
+    esp_err_t httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len);
+    esp_err_t httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size);
+    size_t httpd_req_get_hdr_value_len(httpd_req_t* r, const char* field);
+    esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size);
+    int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len);
+
+    esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type);
+    esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len);
+    esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len);
+    esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg);
+
+    static inline esp_err_t
+    httpd_resp_send_500(httpd_req_t* r)
+    {
+        return httpd_resp_send_err(r, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+
+    // A GET request with an optional query string and Accept header
+    void host_http_request(httpd_req_t* req, const char* query, const char* accept);
+    // Frees the recorded response
+    void host_http_reset(httpd_req_t* req);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdio.h> // the IDF headers make it available to everything that logs
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Prints only when HOST_LOG is set in the environment, the arguments are checked either way
+    void host_log(char level, const char* tag, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+#ifdef __cplusplus
+}
+#endif
+
+#define ESP_LOGE(tag, ...) host_log('E', tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) host_log('W', tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) host_log('I', tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) host_log('D', tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) host_log('V', tag, __VA_ARGS__)
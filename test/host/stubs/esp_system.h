@@ -0,0 +1,3 @@
+#pragma once
+
+#include <stdlib.h> // abort() and the allocation functions come with it on the target
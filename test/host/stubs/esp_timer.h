@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // The host clock only moves when a test sets it
+    extern int64_t host_time_us;
+
+    int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3 @@
+#pragma once
+
+typedef void* EventGroupHandle_t;
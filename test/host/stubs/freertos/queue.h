@@ -0,0 +1,18 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+// The only queue on the host is the event queue of the simulated UART, see host_uart.h
+typedef struct HostQueue* QueueHandle_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks);
+    BaseType_t xQueueReset(QueueHandle_t queue);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Mutexes only, backed by pthreads
+    typedef struct HostSemaphore* SemaphoreHandle_t;
+
+    SemaphoreHandle_t xSemaphoreCreateMutex(void);
+    BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+    BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+    void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* parameters);
+
+typedef struct
+{
+    TickType_t entered;
+} TimeOut_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Advances the host clock instead of sleeping
+    void vTaskDelay(TickType_t ticks);
+    // The host clock in ticks
+    TickType_t xTaskGetTickCount(void);
+    // Timeouts on the host clock, portMAX_DELAY never expires
+    void vTaskSetTimeOutState(TimeOut_t* timeout);
+    BaseType_t xTaskCheckForTimeOut(TimeOut_t* timeout, TickType_t* ticks_to_wait);
+
+    /**
+     * Tasks are threads on a simulated clock. xTaskCreate() only records them, host_tasks_run()
+     * runs them from the start until they exit, again on every call. A task waiting for a
+     * notification moves the host clock to the end of its timeout, and exits once that passes
+     * `host_task_stop_us` or the wait has no timeout. Only deterministic with one task.
+     */
+    extern int64_t host_task_stop_us;
+
+    BaseType_t xTaskCreate(TaskFunction_t function,
+                           const char* name,
+                           uint32_t stack_size,
+                           void* parameters,
+                           UBaseType_t priority,
+                           TaskHandle_t* handle);
+    TaskHandle_t xTaskGetCurrentTaskHandle(void);
+    void xTaskNotifyGive(TaskHandle_t task);
+    uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+    void host_tasks_run(void);
+
+#ifdef __cplusplus
+}
+#endif
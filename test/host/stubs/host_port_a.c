@@ -0,0 +1,99 @@
+#include "host_port_a.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+
+// The bit time at PORT_A_I2C_STANDARD_BAUD, 9 bits per byte with the acknowledge
+#define BYTE_US 90
+
+static HostI2cDevice* devices[128];
+static HostPortAStats stats;
+
+typedef struct PortAHandle
+{
+    uint8_t address;
+} PortAHandle;
+
+void
+host_port_a_attach(HostI2cDevice* device)
+{
+    devices[device->address & 0x7f] = device;
+}
+
+void
+host_port_a_detach(uint8_t address)
+{
+    devices[address & 0x7f] = NULL;
+}
+
+HostPortAStats
+host_port_a_take_stats(void)
+{
+    const HostPortAStats taken = stats;
+    memset(&stats, 0, sizeof(stats));
+    return taken;
+}
+
+I2CDevice_t
+Core2ForAWS_Port_A_I2C_Begin(uint8_t device_address, uint32_t baud)
+{
+    PortAHandle* handle = malloc(sizeof(*handle));
+    if (handle != NULL) {
+        handle->address = device_address;
+    }
+    return handle;
+}
+
+void
+Core2ForAWS_Port_A_I2C_Close(I2CDevice_t device)
+{
+    free(device);
+}
+
+static esp_err_t
+transfer(I2CDevice_t handle, uint32_t register_address, uint8_t* data, uint16_t length, bool is_read)
+{
+    HostI2cDevice* device = devices[((PortAHandle*)handle)->address & 0x7f];
+    const bool has_register = register_address != I2C_NO_REG;
+
+    // Address byte, register byte and for register reads the repeated start with the address again
+    const int64_t bytes = 1 + (has_register ? 1 + is_read : 0) + length;
+    host_time_us += bytes * BYTE_US;
+    stats.busy_us += bytes * BYTE_US;
+    ++stats.transfers;
+
+    esp_err_t err = ESP_FAIL;
+    if (device != NULL) {
+        HostI2cTransfer callback = is_read ? device->read : device->write;
+        is_read ? ++device->reads : ++device->writes;
+        if (callback != NULL) {
+            err = callback(device, register_address, data, length);
+        } else {
+            uint8_t address = has_register ? (uint8_t)register_address : 0;
+            for (uint16_t i = 0; i < length; ++i, ++address) {
+                if (is_read) {
+                    data[i] = device->registers[address];
+                } else {
+                    device->registers[address] = data[i];
+                }
+            }
+            err = ESP_OK;
+        }
+    }
+    stats.failed += err != ESP_OK;
+    return err;
+}
+
+esp_err_t
+Core2ForAWS_Port_A_I2C_Read(I2CDevice_t device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    return transfer(device, register_address, data, length, true);
+}
+
+esp_err_t
+Core2ForAWS_Port_A_I2C_Write(I2CDevice_t device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    return transfer(device, register_address, data, length, false);
+}
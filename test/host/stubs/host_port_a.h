@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * Simulated Port A bus behind Core2ForAWS_Port_A_I2C_*. Tests attach devices by address, a
+ * transfer to an address without one fails like a NACK. Every transfer advances the host clock
+ * by the time its bytes take at 100 kHz, and goes to the device's callbacks, or to its register
+ * file with auto-increment when it has none.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core2forAWS.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    struct HostI2cDevice;
+    typedef esp_err_t (*HostI2cTransfer)(struct HostI2cDevice* device,
+                                         uint32_t register_address,
+                                         uint8_t* data,
+                                         uint16_t length);
+
+    typedef struct HostI2cDevice
+    {
+        uint8_t address;
+        uint8_t registers[256];
+        HostI2cTransfer read; // optional
+        HostI2cTransfer write;
+        void* context;
+
+        // Counted by the bus
+        uint32_t reads;
+        uint32_t writes;
+    } HostI2cDevice;
+
+    // Attaching a device at an address that has one replaces it
+    void host_port_a_attach(HostI2cDevice* device);
+    void host_port_a_detach(uint8_t address);
+
+    // Transfers and bus time since the last call, then zeroed
+    typedef struct HostPortAStats
+    {
+        uint32_t transfers;
+        uint32_t failed;
+        int64_t busy_us;
+    } HostPortAStats;
+
+    HostPortAStats host_port_a_take_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,231 @@
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_crc.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+int64_t host_time_us = 0;
+
+int64_t
+esp_timer_get_time(void)
+{
+    return host_time_us;
+}
+
+void
+host_log(char level, const char* tag, const char* format, ...)
+{
+    static int enabled = -1;
+    if (enabled < 0) {
+        enabled = getenv("HOST_LOG") != NULL;
+    }
+    if (!enabled) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "%c (%s) ", level, tag);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+const char*
+esp_err_to_name(esp_err_t code)
+{
+    return code == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+uint32_t
+esp_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+{
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                value = value >> 1 ^ (value & 1 ? 0xedb88320u : 0);
+            }
+            table[i] = value;
+        }
+    }
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; ++i) {
+        crc = crc >> 8 ^ table[(crc ^ buf[i]) & 0xff];
+    }
+    return ~crc;
+}
+
+struct HostSemaphore
+{
+    pthread_mutex_t mutex;
+};
+
+SemaphoreHandle_t
+xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t semaphore = malloc(sizeof(*semaphore));
+    if (semaphore != NULL) {
+        pthread_mutex_init(&semaphore->mutex, NULL);
+    }
+    return semaphore;
+}
+
+BaseType_t
+xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    return pthread_mutex_lock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t
+xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    return pthread_mutex_unlock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+void
+vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_destroy(&semaphore->mutex);
+    free(semaphore);
+}
+
+void
+vTaskDelay(TickType_t ticks)
+{
+    host_time_us += (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
+
+TickType_t
+xTaskGetTickCount(void)
+{
+    return (TickType_t)(host_time_us / (portTICK_PERIOD_MS * 1000));
+}
+
+void
+vTaskSetTimeOutState(TimeOut_t* timeout)
+{
+    timeout->entered = xTaskGetTickCount();
+}
+
+BaseType_t
+xTaskCheckForTimeOut(TimeOut_t* timeout, TickType_t* ticks_to_wait)
+{
+    if (*ticks_to_wait == portMAX_DELAY) {
+        return pdFALSE;
+    }
+    const TickType_t now = xTaskGetTickCount();
+    const TickType_t elapsed = now - timeout->entered;
+    if (elapsed >= *ticks_to_wait) {
+        *ticks_to_wait = 0;
+        return pdTRUE;
+    }
+    *ticks_to_wait -= elapsed;
+    timeout->entered = now;
+    return pdFALSE;
+}
+
+int64_t host_task_stop_us = 0;
+
+struct HostTask
+{
+    pthread_t thread;
+    TaskFunction_t function;
+    void* parameters;
+    pthread_mutex_t lock;
+    uint32_t notifications;
+};
+
+#define HOST_MAX_TASKS 8
+
+static TaskHandle_t created_tasks[HOST_MAX_TASKS];
+static size_t created_count = 0;
+static __thread TaskHandle_t current_task = NULL;
+
+BaseType_t
+xTaskCreate(TaskFunction_t function,
+            const char* name,
+            uint32_t stack_size,
+            void* parameters,
+            UBaseType_t priority,
+            TaskHandle_t* handle)
+{
+    if (created_count == HOST_MAX_TASKS) {
+        return pdFAIL;
+    }
+    TaskHandle_t task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->function = function;
+    task->parameters = parameters;
+    pthread_mutex_init(&task->lock, NULL);
+    created_tasks[created_count++] = task;
+    if (handle != NULL) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+TaskHandle_t
+xTaskGetCurrentTaskHandle(void)
+{
+    return current_task;
+}
+
+void
+xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    ++task->notifications;
+    pthread_mutex_unlock(&task->lock);
+}
+
+uint32_t
+ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    TaskHandle_t task = current_task;
+    pthread_mutex_lock(&task->lock);
+    const uint32_t notifications = task->notifications;
+    if (notifications > 0) {
+        task->notifications = clear ? 0 : notifications - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    if (notifications > 0) {
+        return notifications;
+    }
+
+    if (ticks == portMAX_DELAY) {
+        pthread_exit(NULL);
+    }
+    host_time_us += (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+    if (host_time_us > host_task_stop_us) {
+        pthread_exit(NULL);
+    }
+    return 0;
+}
+
+static void*
+run_task(void* argument)
+{
+    current_task = argument;
+    current_task->function(current_task->parameters);
+    return NULL;
+}
+
+void
+host_tasks_run(void)
+{
+    for (size_t i = 0; i < created_count; ++i) {
+        pthread_create(&created_tasks[i]->thread, NULL, run_task, created_tasks[i]);
+    }
+    for (size_t i = 0; i < created_count; ++i) {
+        pthread_join(created_tasks[i]->thread, NULL);
+    }
+}
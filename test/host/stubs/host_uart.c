@@ -0,0 +1,483 @@
+#include "host_uart.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/adc.h"
+#include "driver/dac.h"
+#include "driver/gpio.h"
+#include "driver/uart.h"
+#include "esp_adc_cal.h"
+#include "esp_timer.h"
+#include "i2c_device.h"
+
+#define FIFO_SIZE 128
+#define FIFO_FULL_THRESHOLD 120
+#define TIMEOUT_SYMBOLS 10
+#define BITS_PER_BYTE 10 // start, 8 data and stop
+
+struct HostQueue
+{
+    uart_event_t* events;
+    int size;
+    int head;
+    int count;
+};
+
+typedef struct Arrival
+{
+    uint8_t byte;
+    int64_t us;
+} Arrival;
+
+static bool installed;
+static int baud_rate = 115200;
+static struct HostQueue queue;
+static HostUartStats stats;
+
+static uint8_t* ring;
+static int ring_size;
+static int ring_length;
+static uint8_t fifo[FIFO_SIZE];
+static int fifo_length;
+static bool buffer_full;
+static int64_t last_byte_us;
+
+static bool pattern_enabled;
+static char pattern;
+static int* positions;
+static int position_slots; // like the driver's ring of them, one slot stays free
+static int position_count;
+
+static Arrival* scheduled;
+static size_t scheduled_count;
+static size_t scheduled_size;
+static size_t next_arrival;
+static double scheduled_end_us;
+
+static int64_t
+symbol_us(int symbols)
+{
+    return llround(symbols * BITS_PER_BYTE * 1e6 / baud_rate);
+}
+
+static void
+post(uart_event_type_t type, size_t size)
+{
+    if (queue.events == NULL || queue.count == queue.size) {
+        ++stats.events_lost;
+        return;
+    }
+    uart_event_t* event = &queue.events[(queue.head + queue.count++) % queue.size];
+    event->type = type;
+    event->size = size;
+    event->timeout_flag = false;
+}
+
+static void
+enqueue_position(int position)
+{
+    if (position_count + 1 >= position_slots) {
+        ++stats.positions_lost;
+        return;
+    }
+    positions[position_count++] = position;
+}
+
+// Positions count from the read end of the ring buffer, reads move it
+static void
+update_positions(int consumed)
+{
+    int kept = 0;
+    for (int i = 0; i < position_count; ++i) {
+        if (positions[i] - consumed >= 0) {
+            positions[kept++] = positions[i] - consumed;
+        }
+    }
+    position_count = kept;
+}
+
+// The interrupt handler moving the FIFO to the ring buffer
+static void
+move_fifo(uart_event_type_t type)
+{
+    if (buffer_full || fifo_length == 0) {
+        return;
+    }
+    if (ring_length + fifo_length > ring_size) {
+        buffer_full = true;
+        post(UART_BUFFER_FULL, fifo_length);
+        return;
+    }
+    if (type == UART_PATTERN_DET) {
+        enqueue_position(ring_length + fifo_length - 1);
+    }
+    memcpy(ring + ring_length, fifo, fifo_length);
+    ring_length += fifo_length;
+    post(type, fifo_length);
+    fifo_length = 0;
+}
+
+// A read made room, the driver takes what the full buffer left in the FIFO
+static void
+take_stash(void)
+{
+    if (buffer_full && ring_length + fifo_length <= ring_size) {
+        memcpy(ring + ring_length, fifo, fifo_length);
+        ring_length += fifo_length;
+        fifo_length = 0;
+        buffer_full = false;
+    }
+}
+
+static void
+receive_byte(uint8_t byte, int64_t us)
+{
+    ++stats.received;
+    last_byte_us = us;
+    if (fifo_length == FIFO_SIZE) {
+        // The handler resets the FIFO, losing it along with the byte
+        stats.overflowed += FIFO_SIZE + 1;
+        fifo_length = 0;
+        post(UART_FIFO_OVF, 0);
+        return;
+    }
+    fifo[fifo_length++] = byte;
+    if (pattern_enabled && (char)byte == pattern) {
+        move_fifo(UART_PATTERN_DET);
+    } else if (fifo_length >= FIFO_FULL_THRESHOLD) {
+        move_fifo(UART_DATA);
+    }
+}
+
+// When the receiver does something next, INT64_MAX once the scheduled bytes are all in
+static int64_t
+next_step_us(bool* is_timeout)
+{
+    int64_t next = next_arrival < scheduled_count ? scheduled[next_arrival].us : INT64_MAX;
+    *is_timeout = false;
+    if (fifo_length > 0 && !buffer_full) {
+        const int64_t timeout_us = last_byte_us + symbol_us(TIMEOUT_SYMBOLS);
+        if (timeout_us < next) {
+            next = timeout_us;
+            *is_timeout = true;
+        }
+    }
+    return next;
+}
+
+static void
+step(bool is_timeout)
+{
+    if (is_timeout) {
+        move_fifo(UART_DATA);
+    } else {
+        receive_byte(scheduled[next_arrival].byte, scheduled[next_arrival].us);
+        ++next_arrival;
+    }
+}
+
+static bool
+has_event(int unused)
+{
+    return queue.count > 0;
+}
+
+static bool
+has_data(int length)
+{
+    return ring_length >= length;
+}
+
+/**
+ * Receives everything due by the host clock, then moves the clock along the next steps until
+ * `done` or the deadline. Without a deadline the clock stays once nothing more arrives.
+ */
+static bool
+run_until(int64_t deadline_us, bool (*done)(int), int argument)
+{
+    bool is_timeout;
+    while (next_step_us(&is_timeout) <= host_time_us) {
+        step(is_timeout);
+    }
+    while (!done(argument)) {
+        const int64_t next = next_step_us(&is_timeout);
+        if (next > deadline_us) {
+            if (deadline_us != INT64_MAX) {
+                host_time_us = deadline_us;
+            }
+            return false;
+        }
+        host_time_us = next;
+        step(is_timeout);
+    }
+    return true;
+}
+
+static int64_t
+deadline(TickType_t ticks)
+{
+    return ticks == portMAX_DELAY ? INT64_MAX : host_time_us + (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
+
+int64_t
+host_uart_receive(const uint8_t* data, size_t length, int64_t start_us)
+{
+    if (scheduled_count + length > scheduled_size) {
+        scheduled_size = 2 * (scheduled_count + length);
+        scheduled = realloc(scheduled, scheduled_size * sizeof(*scheduled));
+    }
+    if (start_us > scheduled_end_us) {
+        scheduled_end_us = start_us;
+    }
+    const double byte_us = BITS_PER_BYTE * 1e6 / baud_rate;
+    for (size_t i = 0; i < length; ++i) {
+        scheduled_end_us += byte_us;
+        scheduled[scheduled_count].byte = data[i];
+        scheduled[scheduled_count].us = llround(scheduled_end_us);
+        ++scheduled_count;
+    }
+    return llround(scheduled_end_us);
+}
+
+HostUartStats
+host_uart_take_stats(void)
+{
+    const HostUartStats taken = stats;
+    memset(&stats, 0, sizeof(stats));
+    return taken;
+}
+
+esp_err_t
+uart_driver_install(uart_port_t uart_num,
+                    int rx_buffer_size,
+                    int tx_buffer_size,
+                    int queue_size,
+                    QueueHandle_t* uart_queue,
+                    int intr_alloc_flags)
+{
+    if (uart_num != UART_NUM_2 || rx_buffer_size <= FIFO_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (installed) {
+        return ESP_FAIL;
+    }
+    ring = malloc(rx_buffer_size);
+    ring_size = rx_buffer_size;
+    if (queue_size > 0) {
+        queue.events = calloc(queue_size, sizeof(uart_event_t));
+        queue.size = queue_size;
+    }
+    if (uart_queue != NULL) {
+        *uart_queue = queue_size > 0 ? &queue : NULL;
+    }
+    installed = true;
+    return ESP_OK;
+}
+
+// Also forgets the scheduled bytes, so every test starts from an idle line
+esp_err_t
+uart_driver_delete(uart_port_t uart_num)
+{
+    free(ring);
+    free(queue.events);
+    free(positions);
+    free(scheduled);
+    ring = NULL;
+    ring_size = ring_length = fifo_length = 0;
+    buffer_full = false;
+    memset(&queue, 0, sizeof(queue));
+    positions = NULL;
+    position_slots = position_count = 0;
+    pattern_enabled = false;
+    scheduled = NULL;
+    scheduled_count = scheduled_size = next_arrival = 0;
+    scheduled_end_us = 0;
+    installed = false;
+    return ESP_OK;
+}
+
+esp_err_t
+uart_param_config(uart_port_t uart_num, const uart_config_t* uart_config)
+{
+    if (uart_num != UART_NUM_2 || uart_config->baud_rate <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    baud_rate = uart_config->baud_rate;
+    return ESP_OK;
+}
+
+esp_err_t
+uart_set_pin(uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num)
+{
+    return uart_num == UART_NUM_2 ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+int
+uart_write_bytes(uart_port_t uart_num, const char* src, size_t size)
+{
+    if (!installed) {
+        return -1;
+    }
+    stats.transmitted += size;
+    return (int)size;
+}
+
+int
+uart_read_bytes(uart_port_t uart_num, uint8_t* buf, uint32_t length, TickType_t ticks_to_wait)
+{
+    if (!installed) {
+        return -1;
+    }
+    run_until(deadline(ticks_to_wait), has_data, (int)length);
+    const int read = ring_length < (int)length ? ring_length : (int)length;
+    memcpy(buf, ring, read);
+    memmove(ring, ring + read, ring_length - read);
+    ring_length -= read;
+    update_positions(read);
+    take_stash();
+    return read;
+}
+
+esp_err_t
+uart_get_buffered_data_len(uart_port_t uart_num, size_t* size)
+{
+    if (!installed) {
+        return ESP_FAIL;
+    }
+    run_until(host_time_us, has_data, 0);
+    *size = ring_length;
+    return ESP_OK;
+}
+
+esp_err_t
+uart_flush_input(uart_port_t uart_num)
+{
+    if (!installed) {
+        return ESP_FAIL;
+    }
+    run_until(host_time_us, has_data, 0);
+    update_positions(ring_length);
+    ring_length = 0;
+    fifo_length = 0;
+    buffer_full = false;
+    return ESP_OK;
+}
+
+esp_err_t
+uart_enable_pattern_det_baud_intr(uart_port_t uart_num,
+                                  char pattern_chr,
+                                  uint8_t chr_num,
+                                  int chr_tout,
+                                  int post_idle,
+                                  int pre_idle)
+{
+    if (!installed || chr_num != 1) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pattern = pattern_chr;
+    pattern_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t
+uart_pattern_queue_reset(uart_port_t uart_num, int queue_length)
+{
+    if (!installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    free(positions);
+    positions = calloc(queue_length, sizeof(int));
+    if (positions == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    position_slots = queue_length;
+    position_count = 0;
+    return ESP_OK;
+}
+
+int
+uart_pattern_pop_pos(uart_port_t uart_num)
+{
+    if (position_count == 0) {
+        return -1;
+    }
+    const int position = positions[0];
+    memmove(positions, positions + 1, --position_count * sizeof(int));
+    return position;
+}
+
+BaseType_t
+xQueueReceive(QueueHandle_t handle, void* item, TickType_t ticks)
+{
+    if (!run_until(deadline(ticks), has_event, 0)) {
+        return pdFALSE;
+    }
+    memcpy(item, &handle->events[handle->head], sizeof(uart_event_t));
+    handle->head = (handle->head + 1) % handle->size;
+    --handle->count;
+    return pdTRUE;
+}
+
+BaseType_t
+xQueueReset(QueueHandle_t handle)
+{
+    handle->head = handle->count = 0;
+    return pdPASS;
+}
+
+// The other modes of Core2ForAWS_Port_PinMode(), they configure nothing here
+
+esp_err_t
+gpio_config(const gpio_config_t* config)
+{
+    return ESP_OK;
+}
+
+esp_err_t
+gpio_reset_pin(gpio_num_t pin)
+{
+    return ESP_OK;
+}
+
+esp_err_t
+adc1_config_width(adc_bits_width_t width)
+{
+    return ESP_OK;
+}
+
+esp_err_t
+adc1_config_channel_atten(adc1_channel_t channel, adc_atten_t atten)
+{
+    return ESP_OK;
+}
+
+esp_adc_cal_value_t
+esp_adc_cal_characterize(adc_unit_t unit,
+                         adc_atten_t atten,
+                         adc_bits_width_t width,
+                         uint32_t default_vref,
+                         esp_adc_cal_characteristics_t* characteristics)
+{
+    return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+esp_err_t
+dac_output_enable(dac_channel_t channel)
+{
+    return ESP_OK;
+}
+
+esp_err_t
+dac_output_disable(dac_channel_t channel)
+{
+    return ESP_OK;
+}
+
+BaseType_t
+i2c_free_port(i2c_port_t i2c_num)
+{
+    return pdTRUE;
+}
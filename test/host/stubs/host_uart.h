@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * Simulated receive path of the IDF v4.2 UART driver behind driver/uart.h. Bytes arrive one
+ * frame time apart at the configured baud rate into the 128 byte hardware FIFO. The FIFO moves
+ * to the ring buffer on 120 bytes, on the pattern character and after 10 idle symbols, each
+ * move posting one event. A move that does not fit leaves the data in the FIFO and posts
+ * UART_BUFFER_FULL once; until a read makes room nothing moves and no pattern is recorded, the
+ * FIFO overflows with UART_FIFO_OVF.
+ * Events are dropped when the event queue is full, pattern positions when the position queue is.
+ *
+ * Tests schedule the bytes, the driver calls first receive everything due by the host clock,
+ * and a wait in xQueueReceive() moves the clock to the next event.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Schedules bytes back to back from `start_us`, or from the end of the ones still
+     * arriving if that is later. Returns the time the last of them is received.
+     */
+    int64_t host_uart_receive(const uint8_t* data, size_t length, int64_t start_us);
+
+    // What the receiver did since the last call, then zeroed
+    typedef struct HostUartStats
+    {
+        uint32_t received;
+        uint32_t overflowed; // bytes the FIFO lost
+        uint32_t events_lost;
+        uint32_t positions_lost;
+        uint32_t transmitted;
+    } HostUartStats;
+
+    HostUartStats host_uart_take_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,117 @@
+#include "nvs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ENTRIES 32
+#define MAX_NAME 16
+
+typedef struct Entry
+{
+    char space[MAX_NAME];
+    char key[MAX_NAME];
+    void* value;
+    size_t length;
+} Entry;
+
+static Entry entries[MAX_ENTRIES];
+static size_t entry_count = 0;
+
+// A handle is the index of its namespace in `spaces` plus one
+static char spaces[MAX_ENTRIES][MAX_NAME];
+static size_t space_count = 0;
+
+static Entry*
+find(nvs_handle_t handle, const char* key)
+{
+    for (size_t i = 0; i < entry_count; ++i) {
+        if (strcmp(entries[i].space, spaces[handle - 1]) == 0 && strcmp(entries[i].key, key) == 0) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t
+nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle)
+{
+    if (strlen(name) >= MAX_NAME) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < space_count; ++i) {
+        if (strcmp(spaces[i], name) == 0) {
+            *out_handle = i + 1;
+            return ESP_OK;
+        }
+    }
+    // Like the real one, a read-only open of a namespace that was never written fails
+    if (open_mode == NVS_READONLY || space_count == MAX_ENTRIES) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    strcpy(spaces[space_count++], name);
+    *out_handle = space_count;
+    return ESP_OK;
+}
+
+void
+nvs_close(nvs_handle_t handle)
+{
+}
+
+esp_err_t
+nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length)
+{
+    const Entry* entry = find(handle, key);
+    if (entry == NULL) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (out_value == NULL) {
+        *length = entry->length;
+        return ESP_OK;
+    }
+    if (*length < entry->length) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    memcpy(out_value, entry->value, entry->length);
+    *length = entry->length;
+    return ESP_OK;
+}
+
+esp_err_t
+nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length)
+{
+    if (strlen(key) >= MAX_NAME) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    Entry* entry = find(handle, key);
+    if (entry == NULL) {
+        if (entry_count == MAX_ENTRIES) {
+            return ESP_ERR_NO_MEM;
+        }
+        entry = &entries[entry_count++];
+        strcpy(entry->space, spaces[handle - 1]);
+        strcpy(entry->key, key);
+        entry->value = NULL;
+    }
+    free(entry->value);
+    entry->value = malloc(length);
+    memcpy(entry->value, value, length);
+    entry->length = length;
+    return ESP_OK;
+}
+
+esp_err_t
+nvs_commit(nvs_handle_t handle)
+{
+    return ESP_OK;
+}
+
+void
+host_nvs_erase(void)
+{
+    for (size_t i = 0; i < entry_count; ++i) {
+        free(entries[i].value);
+    }
+    entry_count = 0;
+    space_count = 0;
+}
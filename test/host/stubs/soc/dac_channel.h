@@ -0,0 +1,3 @@
+#pragma once
+
+#define DAC_GPIO26_CHANNEL DAC_CHANNEL_2
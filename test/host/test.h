@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdio.h>
+
+/**
+ * Minimal checks for the host tests: a failed check prints where and why and the
+ * test keeps going, test_result() turns the failures into the exit status.
+ */
+
+static int test_failures = 0;
+
+#define CHECK(condition)                                                                                     \
+    do {                                                                                                     \
+        if (!(condition)) {                                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                    \
+            ++test_failures;                                                                                 \
+        }                                                                                                    \
+    } while (0)
+
+// Like CHECK, with printf style details
+#define CHECK_MSG(condition, ...)                                                                            \
+    do {                                                                                                     \
+        if (!(condition)) {                                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #condition);                    \
+            fprintf(stderr, __VA_ARGS__);                                                                    \
+            fputc('\n', stderr);                                                                             \
+            ++test_failures;                                                                                 \
+        }                                                                                                    \
+    } while (0)
+
+static inline int
+test_result(void)
+{
+    if (test_failures != 0) {
+        fprintf(stderr, "%d checks failed\n", test_failures);
+        return 1;
+    }
+    return 0;
+}
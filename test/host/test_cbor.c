@@ -0,0 +1,295 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "cbor.h"
+#include "cbor_decode.h"
+#include "test.h"
+
+/* The encoder of cbor.c against the RFC 8949 examples and the decoder of cbor_decode.c */
+
+typedef void (*Encode)(CborWriter* writer);
+
+typedef struct Collector
+{
+    uint8_t data[8192];
+    size_t length;
+    size_t flushes;
+    size_t fail_after; // flushes that succeed, 0 for all
+} Collector;
+
+static bool
+collect(void* context, const uint8_t* data, size_t length)
+{
+    Collector* collector = context;
+    if (collector->fail_after != 0 && collector->flushes == collector->fail_after) {
+        return false;
+    }
+    if (length > sizeof(collector->data) - collector->length) {
+        return false;
+    }
+    memcpy(collector->data + collector->length, data, length);
+    collector->length += length;
+    ++collector->flushes;
+    return true;
+}
+
+// Encodes into one large buffer and checks the diagnostic notation of the result
+static void
+check_diagnostic(Encode encode, const char* expected)
+{
+    uint8_t buffer[4096];
+    CborWriter writer;
+    cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+    encode(&writer);
+    CHECK(!writer.failed);
+
+    char text[8192];
+    const size_t used = cbor_diagnostic(buffer, writer.length, text, sizeof(text));
+    CHECK_MSG(used == writer.length, "decoded %zu of %zu bytes", used, writer.length);
+    CHECK_MSG(strcmp(text, expected) == 0, "%s != %s", text, expected);
+}
+
+static void
+check_bytes(Encode encode, const uint8_t* expected, size_t length)
+{
+    uint8_t buffer[64];
+    CborWriter writer;
+    cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+    encode(&writer);
+    CHECK(!writer.failed);
+    CHECK_MSG(writer.length == length && memcmp(buffer, expected, length) == 0, "%zu bytes", writer.length);
+}
+
+static void
+encode_integers(CborWriter* writer)
+{
+    static const int64_t values[] = { 0, 1, 23, 24, 255, 256, 65535, 65536, 4294967295LL, 4294967296LL,
+                                      -1, -24, -25, -256, -257, INT64_MIN };
+    cbor_array(writer, sizeof(values) / sizeof(values[0]) + 1);
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        cbor_int(writer, values[i]);
+    }
+    cbor_uint(writer, UINT64_MAX);
+}
+
+static void
+encode_floats(CborWriter* writer)
+{
+    cbor_array(writer, 4);
+    cbor_float(writer, 21.5f);
+    cbor_float(writer, -0.25f);
+    cbor_double(writer, 1.1);
+    cbor_double(writer, 1e300);
+}
+
+static void
+encode_decimals(CborWriter* writer)
+{
+    cbor_array(writer, 3);
+    cbor_decimal(writer, 473977420, -7);
+    cbor_decimal(writer, -85455940, -7);
+    cbor_decimal(writer, 27315, -2);
+}
+
+static void
+encode_nested(CborWriter* writer)
+{
+    cbor_map(writer, 3);
+    cbor_text(writer, "ok");
+    cbor_bool(writer, true);
+    cbor_text(writer, "none");
+    cbor_null(writer);
+    cbor_text(writer, "list");
+    cbor_array_begin(writer);
+    cbor_bool(writer, false);
+    cbor_map_begin(writer);
+    cbor_text(writer, "");
+    cbor_array(writer, 0);
+    cbor_break(writer);
+    cbor_break(writer);
+}
+
+static void
+encode_rfc_1000000(CborWriter* writer)
+{
+    cbor_uint(writer, 1000000);
+}
+
+static void
+encode_rfc_minus_1000(CborWriter* writer)
+{
+    cbor_int(writer, -1000);
+}
+
+static void
+encode_rfc_float(CborWriter* writer)
+{
+    cbor_float(writer, 100000.0f);
+}
+
+static void
+encode_rfc_text(CborWriter* writer)
+{
+    cbor_text(writer, "IETF");
+}
+
+static void
+test_items(void)
+{
+    check_diagnostic(encode_integers,
+                     "[0, 1, 23, 24, 255, 256, 65535, 65536, 4294967295, 4294967296, -1, -24, -25, -256, "
+                     "-257, -9223372036854775808, 18446744073709551615]");
+    check_diagnostic(encode_floats, "[21.5, -0.25, 1.1, 1e+300]");
+    check_diagnostic(encode_decimals, "[4([-7, 473977420]), 4([-7, -85455940]), 4([-2, 27315])]");
+    check_diagnostic(encode_nested, "{\"ok\": true, \"none\": null, \"list\": [_ false, {_ \"\": []}]}");
+
+    // Appendix A of RFC 8949
+    check_bytes(encode_rfc_1000000, (const uint8_t[]){ 0x1a, 0x00, 0x0f, 0x42, 0x40 }, 5);
+    check_bytes(encode_rfc_minus_1000, (const uint8_t[]){ 0x39, 0x03, 0xe7 }, 3);
+    check_bytes(encode_rfc_float, (const uint8_t[]){ 0xfa, 0x47, 0xc3, 0x50, 0x00 }, 5);
+    check_bytes(encode_rfc_text, (const uint8_t[]){ 0x64, 0x49, 0x45, 0x54, 0x46 }, 5);
+}
+
+static void
+encode_stream(CborWriter* writer)
+{
+    char text[300];
+    memset(text, 'x', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    cbor_map(writer, 2);
+    cbor_text(writer, "text");
+    cbor_text(writer, text);
+    cbor_text(writer, "values");
+    cbor_array_begin(writer);
+    for (int i = 0; i < 500; ++i) {
+        cbor_map(writer, 2);
+        cbor_text(writer, "t");
+        cbor_uint(writer, 100000 + i);
+        cbor_text(writer, "v");
+        cbor_float(writer, i * 0.5f);
+    }
+    cbor_break(writer);
+}
+
+static void
+test_flush(void)
+{
+    static uint8_t whole[8192];
+    CborWriter writer;
+    cbor_init(&writer, whole, sizeof(whole), NULL, NULL);
+    encode_stream(&writer);
+    CHECK(!writer.failed);
+    const size_t length = writer.length;
+
+    // Any buffer that fits the largest head gives the same bytes, strings are split across flushes
+    static const size_t capacities[] = { 9, 10, 16, 64, 256 };
+    for (size_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); ++i) {
+        static Collector collector;
+        memset(&collector, 0, sizeof(collector));
+        uint8_t buffer[256];
+        cbor_init(&writer, buffer, capacities[i], collect, &collector);
+        encode_stream(&writer);
+        CHECK(cbor_flush(&writer));
+        CHECK_MSG(collector.length == length && memcmp(collector.data, whole, length) == 0,
+                  "capacity %zu: %zu of %zu bytes",
+                  capacities[i],
+                  collector.length,
+                  length);
+        CHECK(collector.flushes >= length / capacities[i]);
+    }
+
+    char* text = malloc(65536);
+    CHECK(cbor_diagnostic(whole, length, text, 65536) == length);
+    CHECK(strstr(text, "{\"t\": 100499, \"v\": 249.5}]}") != NULL);
+    free(text);
+
+    // Without a callback the encoding has to fit
+    uint8_t small[64];
+    cbor_init(&writer, small, sizeof(small), NULL, NULL);
+    encode_stream(&writer);
+    CHECK(writer.failed);
+    CHECK(!cbor_flush(&writer));
+
+    // A failing callback stops the encoding and is not called again
+    static Collector failing;
+    memset(&failing, 0, sizeof(failing));
+    failing.fail_after = 3;
+    cbor_init(&writer, small, sizeof(small), collect, &failing);
+    encode_stream(&writer);
+    CHECK(writer.failed);
+    CHECK(!cbor_flush(&writer));
+    CHECK(failing.flushes == 3 && failing.length == 3 * sizeof(small));
+}
+
+static void
+test_decoder_rejects_malformed(void)
+{
+    char text[64];
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0x1a, 0x00, 0x0f }, 3, text, sizeof(text)) == 0);
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0x64, 0x49, 0x45 }, 3, text, sizeof(text)) == 0);
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0x9f, 0x01 }, 2, text, sizeof(text)) == 0);
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0xff }, 1, text, sizeof(text)) == 0);
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0x1c }, 1, text, sizeof(text)) == 0);
+    CHECK(cbor_diagnostic((const uint8_t[]){ 0x82, 0x01, 0x02 }, 3, text, 4) == 0);
+}
+
+// A history sample as the web handlers send it, once per encoding
+static void
+bench_encoding(void)
+{
+    enum { SAMPLES = 200000 };
+    static uint8_t buffer[64];
+    size_t cbor_bytes = 0;
+    size_t json_bytes = 0;
+
+    double start = bench_now();
+    for (uint32_t i = 0; i < SAMPLES; ++i) {
+        CborWriter writer;
+        cbor_init(&writer, buffer, sizeof(buffer), NULL, NULL);
+        cbor_map(&writer, 4);
+        cbor_text(&writer, "t");
+        cbor_uint(&writer, 1700000000 + i);
+        cbor_text(&writer, "temp");
+        cbor_float(&writer, 21.0f + (i % 100) * 0.01f);
+        cbor_text(&writer, "hum");
+        cbor_float(&writer, 40.0f + (i % 7));
+        cbor_text(&writer, "press");
+        cbor_float(&writer, 1013.25f - (i % 13));
+        cbor_bytes += writer.length;
+    }
+    const double cbor_seconds = bench_now() - start;
+
+    start = bench_now();
+    for (uint32_t i = 0; i < SAMPLES; ++i) {
+        char text[96];
+        json_bytes += snprintf(text,
+                               sizeof(text),
+                               "{\"t\":%u,\"temp\":%.2f,\"hum\":%.2f,\"press\":%.2f}",
+                               (unsigned)(1700000000 + i),
+                               21.0f + (i % 100) * 0.01f,
+                               40.0f + (i % 7),
+                               1013.25f - (i % 13));
+    }
+    const double json_seconds = bench_now() - start;
+
+    bench_report("CBOR sample encoding", cbor_seconds, SAMPLES, "sample");
+    bench_report("snprintf JSON sample encoding", json_seconds, SAMPLES, "sample");
+    printf("%-40s %10.1f bytes CBOR, %.1f bytes JSON\n",
+           "sample size",
+           (double)cbor_bytes / SAMPLES,
+           (double)json_bytes / SAMPLES);
+}
+
+int
+main(void)
+{
+    test_items();
+    test_flush();
+    test_decoder_rejects_malformed();
+    bench_encoding();
+    return test_result();
+}
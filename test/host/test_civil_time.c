@@ -0,0 +1,197 @@
+#define _DEFAULT_SOURCE // timegm()
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+#include "civil_time.h"
+#include "test.h"
+
+/* civil_time.c against gmtime_r() and timegm(), every hour from 1970 to the end of Unix time */
+
+#define LAST_UNIX_TIME 4294967295u // 2106-02-07 06:28:15
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static bool
+same_date(const rtc_date_t* date, const struct tm* tm)
+{
+    return date->year == tm->tm_year + 1900 && date->month == tm->tm_mon + 1 && date->day == tm->tm_mday &&
+           date->hour == tm->tm_hour && date->minute == tm->tm_min && date->second == tm->tm_sec;
+}
+
+// Both directions for one time, against the C library
+static bool
+check_time(uint32_t unix_time)
+{
+    const time_t time = unix_time;
+    struct tm tm;
+    gmtime_r(&time, &tm);
+    rtc_date_t date;
+    memset(&date, 0xff, sizeof(date));
+    civil_from_unix(unix_time, &date);
+    if (!same_date(&date, &tm)) {
+        return false;
+    }
+    const int32_t days = days_from_civil(date.year, date.month, date.day);
+    return civil_to_unix(&date) == unix_time && timegm(&tm) == (time_t)unix_time &&
+           days == (int32_t)(unix_time / 86400);
+}
+
+/**
+ * Every hour of every day, each at a random minute and second, and every second of 2100: the
+ * first year after 1970 that is divisible by 4 and no leap year, where the first guess of
+ * civil_from_unix() is a year early.
+ */
+static void
+test_against_libc(void)
+{
+    unsigned wrong = 0;
+    unsigned checked = 0;
+    for (uint64_t hour = 0; hour * 3600 <= LAST_UNIX_TIME; ++hour) {
+        const uint64_t unix_time = hour * 3600 + random_next() % 3600;
+        if (unix_time <= LAST_UNIX_TIME) {
+            wrong += !check_time((uint32_t)unix_time);
+            ++checked;
+        }
+    }
+    const uint32_t start_2100 = 4102444800u;
+    const uint32_t start_2101 = 4133980800u;
+    for (uint32_t unix_time = start_2100 - 86400; unix_time < start_2101 + 86400; ++unix_time) {
+        wrong += !check_time(unix_time);
+        ++checked;
+    }
+    wrong += !check_time(0) + !check_time(LAST_UNIX_TIME);
+    CHECK_MSG(wrong == 0, "%u of %u times converted wrong", wrong, checked);
+}
+
+// Every calendar day as a date, including the 29th of February of years that have none
+static void
+test_dates(void)
+{
+    static const uint8_t DAYS_IN_MONTH[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    uint32_t expected = 0;
+    for (uint16_t year = 1970; year <= 2106; ++year) {
+        const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        for (uint8_t month = 1; month <= 12; ++month) {
+            const uint8_t days = DAYS_IN_MONTH[month - 1] + (leap && month == 2);
+            for (uint8_t day = 1; day <= days; ++day) {
+                const rtc_date_t date = { year, month, day, 0, 0, 0 };
+                if (expected <= LAST_UNIX_TIME / 86400) {
+                    CHECK_MSG(civil_to_unix(&date) == expected * 86400u, "%04u-%02u-%02u", year, month, day);
+                }
+                ++expected;
+            }
+        }
+    }
+    CHECK(days_from_civil(2000, 3, 1) == 11017);
+}
+
+// The ends of the range, what lies beyond them and dates the RTC never reports
+static void
+test_range(void)
+{
+    const rtc_date_t last = { 2106, 2, 7, 6, 28, 15 };
+    const rtc_date_t after_last = { 2106, 2, 7, 6, 28, 16 };
+    const rtc_date_t next_day = { 2106, 2, 8, 0, 0, 0 };
+    const rtc_date_t before_1970 = { 1969, 12, 31, 23, 59, 59 };
+    const rtc_date_t month_0 = { 2023, 0, 1, 0, 0, 0 };
+    const rtc_date_t month_13 = { 2023, 13, 1, 0, 0, 0 };
+    const rtc_date_t year_2107 = { 2107, 1, 1, 0, 0, 0 };
+    CHECK(civil_to_unix(&last) == LAST_UNIX_TIME);
+    CHECK(civil_to_unix(&after_last) == 0);
+    CHECK(civil_to_unix(&next_day) == 0);
+    CHECK(civil_to_unix(&before_1970) == 0);
+    CHECK(civil_to_unix(&month_0) == 0);
+    CHECK(civil_to_unix(&month_13) == 0);
+    CHECK(civil_to_unix(&year_2107) == 0);
+
+    rtc_date_t date;
+    civil_from_unix(LAST_UNIX_TIME, &date);
+    CHECK(memcmp(&date, &last, sizeof(date)) == 0);
+}
+
+static void
+test_format(void)
+{
+    char text[32];
+    for (int i = 0; i < 100000; ++i) {
+        rtc_date_t date;
+        civil_from_unix(random_next(), &date);
+        char* end = civil_format(text, text + sizeof(text), &date);
+        *end = '\0';
+        char expected[32];
+        snprintf(expected,
+                 sizeof(expected),
+                 "%02u.%02u.%04u, %02u:%02u:%02u",
+                 date.day,
+                 date.month,
+                 date.year,
+                 date.hour,
+                 date.minute,
+                 date.second);
+        CHECK_MSG(strcmp(text, expected) == 0, "%s, expected %s", text, expected);
+    }
+}
+
+static void
+bench_civil_time(void)
+{
+    enum { TIMES = 4000000 };
+    uint32_t sink = 0;
+    rtc_date_t date;
+    double start = bench_now();
+    for (uint32_t i = 0; i < TIMES; ++i) {
+        civil_from_unix(i * 1009u, &date);
+        sink += date.day;
+    }
+    bench_report("civil_from_unix", bench_now() - start, TIMES, "call");
+    start = bench_now();
+    for (uint32_t i = 0; i < TIMES; ++i) {
+        const time_t time = i * 1009u;
+        struct tm tm;
+        gmtime_r(&time, &tm);
+        sink += tm.tm_mday;
+    }
+    bench_report("gmtime_r", bench_now() - start, TIMES, "call");
+
+    start = bench_now();
+    for (uint32_t i = 0; i < TIMES; ++i) {
+        date.second = i % 60;
+        date.day = 1 + i % 28;
+        sink += civil_to_unix(&date);
+    }
+    bench_report("civil_to_unix", bench_now() - start, TIMES, "call");
+    struct tm tm = { 0 };
+    tm.tm_year = 2023 - 1900;
+    start = bench_now();
+    for (uint32_t i = 0; i < TIMES; ++i) {
+        tm.tm_sec = i % 60;
+        tm.tm_mday = 1 + i % 28;
+        sink += (uint32_t)timegm(&tm);
+    }
+    bench_report("timegm", bench_now() - start, TIMES, "call");
+    CHECK(sink != 0);
+}
+
+int
+main(void)
+{
+    test_against_libc();
+    test_dates();
+    test_range();
+    test_format();
+    bench_civil_time();
+    return test_result();
+}
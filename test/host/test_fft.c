@@ -0,0 +1,191 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "fft.h"
+#include "test.h"
+
+/* The float FFT against a long double DFT, the generated twiddles and kernels, and throughput per size */
+
+#define MIN_LOG2_SIZE 3
+#define MAX_SIZE FFT_TWIDDLE_TABLE_SIZE
+
+// Relative RMS error over the spectrum, the float transforms stay below this at every size
+#define ERROR_BOUND 3e-7
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static float
+random_sample(void)
+{
+    return (int32_t)random_next() / 2147483648.0f;
+}
+
+static long double cos_table[MAX_SIZE], sin_table[MAX_SIZE];
+
+/**
+ * X[k] = sum x[j] e^(sign 2 pi i jk / n) of interleaved complex values, in long double. The
+ * angles come from a table of n entries, so jk is reduced exactly.
+ */
+static void
+dft(const float* x, long double* y, int n, int sign)
+{
+    for (int k = 0; k < n; ++k) {
+        const long double angle = 2 * 3.14159265358979323846264338327950288L * k / n;
+        cos_table[k] = cosl(angle);
+        sin_table[k] = sinl(angle);
+    }
+    for (int k = 0; k < n; ++k) {
+        long double re = 0, im = 0;
+        for (int j = 0; j < n; ++j) {
+            const int m = (int)((long)j * k % n);
+            const long double c = cos_table[m];
+            const long double s = sign * sin_table[m];
+            re += x[2 * j] * c - x[2 * j + 1] * s;
+            im += x[2 * j] * s + x[2 * j + 1] * c;
+        }
+        y[2 * k] = re;
+        y[2 * k + 1] = im;
+    }
+}
+
+static double
+relative_rms_error(const float* actual, const long double* expected, int count, long double scale)
+{
+    long double error = 0, energy = 0;
+    for (int i = 0; i < count; ++i) {
+        const long double difference = actual[i] - expected[i] * scale;
+        error += difference * difference;
+        energy += expected[i] * scale * expected[i] * scale;
+    }
+    return (double)sqrtl(error / energy);
+}
+
+/**
+ * Every power of two size in all four directions, on random input. The real transforms pack
+ * X[n/2] into the imaginary part of X[0], the backward ones undo the forward ones with the
+ * 1/n (complex) and 2/n (real) scaling of the component.
+ */
+static void
+test_accuracy(void)
+{
+    static FFT_ALIGNED float input[2 * MAX_SIZE], output[2 * MAX_SIZE], packed[MAX_SIZE];
+    static long double reference[2 * MAX_SIZE];
+    printf("%-40s %10s %10s %10s %10s\n", "FFT relative RMS error", "complex", "inverse", "real", "inverse");
+    for (int n = 1 << MIN_LOG2_SIZE; n <= MAX_SIZE; n *= 2) {
+        double errors[4];
+
+        for (int i = 0; i < 2 * n; ++i) {
+            input[i] = random_sample();
+        }
+        dft(input, reference, n, -1);
+        fft_plan_execute(fft_plan_get(n, FFT_COMPLEX, FFT_FORWARD), input, output);
+        errors[0] = relative_rms_error(output, reference, 2 * n, 1);
+        dft(input, reference, n, 1);
+        fft_plan_execute(fft_plan_get(n, FFT_COMPLEX, FFT_BACKWARD), input, output);
+        errors[1] = relative_rms_error(output, reference, 2 * n, 1.0L / n);
+
+        // Real input, through the complex DFT with zero imaginary parts. The backward transform
+        // above overwrote the input.
+        static float real[MAX_SIZE];
+        for (int i = 0; i < n; ++i) {
+            real[i] = random_sample();
+            input[2 * i] = real[i];
+            input[2 * i + 1] = 0;
+        }
+        dft(input, reference, n, -1);
+        reference[1] = reference[n]; // X[n/2] is real
+        fft_plan_execute(fft_plan_get(n, FFT_REAL, FFT_FORWARD), real, packed);
+        errors[2] = relative_rms_error(packed, reference, n, 1);
+
+        // Backward from the packed reference spectrum, which must give the samples again
+        long double samples[MAX_SIZE];
+        for (int i = 0; i < n; ++i) {
+            packed[i] = (float)reference[i];
+            samples[i] = real[i];
+        }
+        fft_plan_execute(fft_plan_get(n, FFT_REAL, FFT_BACKWARD), packed, output);
+        errors[3] = relative_rms_error(output, samples, n, 1);
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_MSG(errors[i] < ERROR_BOUND, "size %d, transform %d: error %.3g", n, i, errors[i]);
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "  %d points", n);
+        printf("%-40s %10.2g %10.2g %10.2g %10.2g\n", name, errors[0], errors[1], errors[2], errors[3]);
+    }
+}
+
+// The generated table is cos and sin correctly rounded to float, the kernels are DFTs
+static void
+test_generated(void)
+{
+    unsigned wrong = 0;
+    for (int k = 0; k < FFT_TWIDDLE_TABLE_SIZE; ++k) {
+        const long double angle = 2 * 3.14159265358979323846264338327950288L * k / FFT_TWIDDLE_TABLE_SIZE;
+        long double c = cosl(angle), s = sinl(angle);
+        c = fabsl(c) < 1e-12L ? 0 : c;
+        s = fabsl(s) < 1e-12L ? 0 : s;
+        wrong += fft_twiddle_table[2 * k] != (float)c || fft_twiddle_table[2 * k + 1] != (float)s;
+    }
+    CHECK_MSG(wrong == 0, "%u twiddle factors are not correctly rounded", wrong);
+
+    static float input[2 * 32], output[2 * 32];
+    static long double reference[2 * 32];
+    for (int n = 16; n <= 32; n *= 2) {
+        for (int round = 0; round < 100; ++round) {
+            for (int i = 0; i < 2 * n; ++i) {
+                input[i] = random_sample();
+            }
+            dft(input, reference, n, -1);
+            memset(output, 0, sizeof(output));
+            (n == 16 ? fft16 : fft32)(input, 2, output, 2);
+            const double error = relative_rms_error(output, reference, 2 * n, 1);
+            CHECK_MSG(error < 1e-7, "fft%d: error %.3g", n, error);
+        }
+    }
+}
+
+static void
+bench_sizes(void)
+{
+    static FFT_ALIGNED float input[2 * MAX_SIZE], output[2 * MAX_SIZE];
+    for (int i = 0; i < 2 * MAX_SIZE; ++i) {
+        input[i] = random_sample();
+    }
+    double sink = 0;
+    for (int n = 64; n <= MAX_SIZE; n *= 2) {
+        const int rounds = 20 * (MAX_SIZE / n);
+        for (int type = FFT_REAL; type <= FFT_COMPLEX; ++type) {
+            const fft_plan_t* plan = fft_plan_get(n, (fft_type_t)type, FFT_FORWARD);
+            const double start = bench_now();
+            for (int round = 0; round < rounds; ++round) {
+                fft_plan_execute(plan, input, output);
+                sink += output[round % n];
+            }
+            char name[40];
+            snprintf(name, sizeof(name), "%s FFT, %d points", type == FFT_REAL ? "real" : "complex", n);
+            bench_report(name, bench_now() - start, rounds, "transform");
+        }
+    }
+    CHECK(sink == sink);
+}
+
+int
+main(void)
+{
+    test_generated();
+    test_accuracy();
+    bench_sizes();
+    return test_result();
+}
@@ -0,0 +1,172 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "fft.h"
+#include "test.h"
+
+/* The FFT plan cache: lookups, no allocation per frame, and frames per second against fft_init() */
+
+#define NFFT 512 // the frame of microphoneTask
+
+/**
+ * malloc() of the FFT code is linked to this, so allocations can be counted while frames are
+ * transformed.
+ */
+void* __real_malloc(size_t size);
+
+static unsigned mallocs;
+
+void*
+__wrap_malloc(size_t size)
+{
+    ++mallocs;
+    return __real_malloc(size);
+}
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+// Like the microphone frames, 16 bit samples scaled to [-1, 1)
+static void
+fill_frame(float* frame, int size)
+{
+    for (int i = 0; i < size; ++i) {
+        frame[i] = (int16_t)random_next() / 32768.0f;
+    }
+}
+
+static void
+test_lookup(void)
+{
+    const fft_plan_t* forward = fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD);
+    CHECK(forward != NULL && forward->size == NFFT && forward->type == FFT_REAL &&
+          forward->direction == FFT_FORWARD);
+    CHECK(fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD) == forward);
+    const fft_plan_t* backward = fft_plan_get(NFFT, FFT_REAL, FFT_BACKWARD);
+    const fft_plan_t* complex = fft_plan_get(NFFT, FFT_COMPLEX, FFT_FORWARD);
+    CHECK(backward != NULL && backward != forward && complex != NULL && complex != forward);
+    // One twiddle table per size
+    CHECK(backward->twiddle_factors == forward->twiddle_factors &&
+          complex->twiddle_factors == forward->twiddle_factors);
+    const fft_plan_t* other = fft_plan_get(NFFT / 2, FFT_REAL, FFT_FORWARD);
+    CHECK(other != NULL && other->twiddle_factors != forward->twiddle_factors);
+
+    CHECK(fft_plan_get(0, FFT_REAL, FFT_FORWARD) == NULL);
+    CHECK(fft_plan_get(4, FFT_REAL, FFT_FORWARD) == NULL);
+    CHECK(fft_plan_get(384, FFT_REAL, FFT_FORWARD) == NULL);
+    CHECK(fft_plan_get(2 * FFT_TWIDDLE_TABLE_SIZE, FFT_REAL, FFT_FORWARD) == NULL);
+}
+
+/**
+ * A plan transforms like a configuration of fft_init(), up to the runtime twiddle factors of
+ * the latter, and a backward plan undoes a forward one. Neither allocates.
+ */
+static void
+test_execute(void)
+{
+    static FFT_ALIGNED float input[NFFT], output[NFFT], restored[NFFT];
+    const fft_plan_t* forward = fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD);
+    const fft_plan_t* backward = fft_plan_get(NFFT, FFT_REAL, FFT_BACKWARD);
+    fft_config_t* config = fft_init(NFFT, FFT_REAL, FFT_FORWARD, NULL, NULL);
+
+    double worst_difference = 0;
+    double worst_round_trip = 0;
+    mallocs = 0;
+    for (int frame = 0; frame < 100; ++frame) {
+        fill_frame(input, NFFT);
+        memcpy(config->input, input, sizeof(input));
+        fft_execute(config);
+        fft_plan_execute(forward, input, output);
+        double energy = 0;
+        for (int i = 0; i < NFFT; ++i) {
+            energy += (double)config->output[i] * config->output[i];
+        }
+        for (int i = 0; i < NFFT; ++i) {
+            const double difference = fabs(output[i] - config->output[i]) / sqrt(energy / NFFT);
+            worst_difference = difference > worst_difference ? difference : worst_difference;
+        }
+
+        fft_plan_execute(backward, output, restored);
+        for (int i = 0; i < NFFT; ++i) {
+            const double error = fabs(restored[i] - input[i]);
+            worst_round_trip = error > worst_round_trip ? error : worst_round_trip;
+        }
+    }
+    CHECK_MSG(mallocs == 0, "%u allocations in 100 frames", mallocs);
+    CHECK_MSG(worst_difference < 1e-5, "plan and fft_init() differ by %g of the RMS", worst_difference);
+    CHECK_MSG(worst_round_trip < 1e-5, "round trip off by %g", worst_round_trip);
+    fft_destroy(config);
+}
+
+// The cache holds FFT_PLAN_CACHE_SIZE plans, further ones are refused while the cached stay found
+static void
+test_cache_full(void)
+{
+    const fft_plan_t* forward = fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD);
+    int added = 0;
+    for (int size = 8; size <= FFT_TWIDDLE_TABLE_SIZE; size *= 2) {
+        added += fft_plan_get(size, FFT_COMPLEX, FFT_BACKWARD) != NULL;
+    }
+    CHECK(added < 10);
+    CHECK(fft_plan_get(FFT_TWIDDLE_TABLE_SIZE, FFT_REAL, FFT_BACKWARD) == NULL);
+    CHECK(fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD) == forward);
+}
+
+/**
+ * Frames of microphoneTask before and after plans: a configuration set up and torn down per
+ * frame, against a cached plan on static buffers.
+ */
+static void
+bench_frames(void)
+{
+    enum { FRAMES = 20000 };
+    static FFT_ALIGNED float input[NFFT], output[NFFT];
+    fill_frame(input, NFFT);
+    double sink = 0;
+
+    mallocs = 0;
+    double start = bench_now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        fft_config_t* config = fft_init(NFFT, FFT_REAL, FFT_FORWARD, NULL, NULL);
+        memcpy(config->input, input, sizeof(input));
+        fft_execute(config);
+        sink += config->output[frame % NFFT];
+        fft_destroy(config);
+    }
+    const double per_frame_seconds = bench_now() - start;
+    const unsigned per_frame_mallocs = mallocs;
+
+    const fft_plan_t* plan = fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD);
+    mallocs = 0;
+    start = bench_now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        fft_plan_execute(plan, input, output);
+        sink += output[frame % NFFT];
+    }
+    const double plan_seconds = bench_now() - start;
+    CHECK(mallocs == 0 && per_frame_mallocs == 4 * FRAMES);
+    CHECK(sink != 0);
+    printf("%-40s %10.0f frames/s\n", "512 point frames, fft_init per frame", FRAMES / per_frame_seconds);
+    printf("%-40s %10.0f frames/s\n", "512 point frames, cached plan", FRAMES / plan_seconds);
+}
+
+int
+main(void)
+{
+    test_lookup();
+    test_execute();
+    bench_frames();
+    test_cache_full();
+    return test_result();
+}
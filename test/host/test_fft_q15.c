@@ -0,0 +1,230 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "fft.h"
+#include "test.h"
+
+/* The fixed-point magnitudes against the float FFT, from quiet to clipped input, and frames per second */
+
+#define NFFT 512 // the frame of microphoneTask
+#define MAX_SIZE FFT_TWIDDLE_TABLE_SIZE
+
+// The README promises about 50 dB above the quantization noise at the frame size
+#define MIN_SNR_DB 45.0
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static int16_t
+clip(double value)
+{
+    const double rounded = floor(value + 0.5);
+    return rounded > INT16_MAX ? INT16_MAX : rounded < INT16_MIN ? INT16_MIN : (int16_t)rounded;
+}
+
+// |X[0]| .. |X[size/2-1]| of the float transform, X[0] is real
+static void
+float_magnitudes(const int16_t* samples, int size, float* magnitudes)
+{
+    static FFT_ALIGNED float input[MAX_SIZE], output[MAX_SIZE];
+    for (int i = 0; i < size; ++i) {
+        input[i] = samples[i];
+    }
+    fft_plan_execute(fft_plan_get(size, FFT_REAL, FFT_FORWARD), input, output);
+    magnitudes[0] = fabsf(output[0]);
+    for (int k = 1; k < size / 2; ++k) {
+        magnitudes[k] = sqrtf(output[2 * k] * output[2 * k] + output[2 * k + 1] * output[2 * k + 1]);
+    }
+}
+
+/**
+ * Signal to noise ratio in dB of the fixed-point magnitudes over all bins, with the float ones as
+ * the signal and the differences as the noise.
+ */
+static double
+snr_db(const int16_t* samples, int size)
+{
+    static int16_t work[MAX_SIZE], magnitudes[MAX_SIZE / 2];
+    static float expected[MAX_SIZE / 2];
+    const int exponent = fft_q15_magnitudes(fft_q15_plan_get(size), samples, work, magnitudes, size / 2);
+    float_magnitudes(samples, size, expected);
+    double signal = 0, noise = 0;
+    for (int k = 0; k < size / 2; ++k) {
+        const double difference = ldexp(magnitudes[k], exponent) - expected[k];
+        signal += (double)expected[k] * expected[k];
+        noise += difference * difference;
+    }
+    return noise == 0 ? INFINITY : 10 * log10(signal / noise);
+}
+
+static void
+fill_noise(int16_t* samples, int size, double amplitude)
+{
+    for (int i = 0; i < size; ++i) {
+        samples[i] = clip((int32_t)random_next() / 2147483648.0 * amplitude);
+    }
+}
+
+// A sinusoid between bins plus some noise, clipped to int16 when the amplitude is beyond
+static void
+fill_tone(int16_t* samples, int size, double amplitude)
+{
+    const double frequency = 37.3 / size;
+    for (int i = 0; i < size; ++i) {
+        const double noise = (int32_t)random_next() / 2147483648.0 * 16;
+        samples[i] = clip(amplitude * sin(2 * M_PI * frequency * i) + noise);
+    }
+}
+
+static void
+fill_square(int16_t* samples, int size, int period, int16_t high, int16_t low)
+{
+    for (int i = 0; i < size; ++i) {
+        samples[i] = i % period < period / 2 ? high : low;
+    }
+}
+
+// Each stage beyond the frame size can scale once more, which costs up to 3 dB
+static void
+check_snr(const char* name, const int16_t* samples, int size)
+{
+    const double snr = snr_db(samples, size);
+    const double min_snr = size <= NFFT ? MIN_SNR_DB : MIN_SNR_DB - 3 * log2((double)size / NFFT);
+    CHECK_MSG(snr >= min_snr, "%s, %d points: %.1f dB", name, size, snr);
+    if (size == NFFT) {
+        printf("%-40s %10.1f dB\n", name, snr);
+    }
+}
+
+/**
+ * Every size on noise and tones from quiet to full scale, and at the frame size the inputs at
+ * the limits of the normalization: the largest values that round up a power of two on the way
+ * down, square waves that sum four of them in the first stages, full scale and clipped input.
+ */
+static void
+test_snr(void)
+{
+    static int16_t samples[MAX_SIZE];
+    printf("%-40s %10s\n", "Q15 magnitudes against float, 512 points", "SNR");
+    for (int size = 8; size <= MAX_SIZE; size *= 2) {
+        fill_noise(samples, size, 32768);
+        check_snr("full scale noise", samples, size);
+        fill_noise(samples, size, 64);
+        check_snr("quiet noise", samples, size);
+        fill_tone(samples, size, 16000);
+        check_snr("tone", samples, size);
+        fill_tone(samples, size, 300);
+        check_snr("quiet tone", samples, size);
+        fill_tone(samples, size, 65536);
+        check_snr("clipped tone", samples, size);
+    }
+
+    static const int16_t LEVELS[] = { 16383, 16384, 8191, 4095, 32767, INT16_MIN };
+    for (unsigned i = 0; i < sizeof(LEVELS) / sizeof(LEVELS[0]); ++i) {
+        const int16_t level = LEVELS[i];
+        const int16_t opposite = level == INT16_MIN ? INT16_MAX : -level;
+        // Period 2 only has the Nyquist frequency, which is not among the bins
+        for (int period = 4; period <= NFFT; period *= 2) {
+            char name[40];
+            snprintf(name, sizeof(name), "square wave %d, period %d", level, period);
+            fill_square(samples, NFFT, period, level, opposite);
+            const double snr = snr_db(samples, NFFT);
+            CHECK_MSG(snr >= MIN_SNR_DB, "%s: %.1f dB", name, snr);
+            if (period == 64) {
+                printf("%-40s %10.1f dB\n", name, snr);
+            }
+        }
+        fill_square(samples, NFFT, NFFT, level, level);
+        check_snr("constant", samples, NFFT);
+    }
+}
+
+// Silence gives zeros and exponent 0, a single full scale sample a flat spectrum
+static void
+test_edges(void)
+{
+    static int16_t samples[NFFT], work[NFFT], magnitudes[NFFT / 2];
+    const fft_q15_plan_t* plan = fft_q15_plan_get(NFFT);
+    for (int i = 0; i < NFFT / 2; ++i) {
+        magnitudes[i] = -1;
+    }
+    CHECK(fft_q15_magnitudes(plan, samples, work, magnitudes, NFFT / 2) == 0);
+    int nonzero = 0;
+    for (int i = 0; i < NFFT / 2; ++i) {
+        nonzero += magnitudes[i] != 0;
+    }
+    CHECK(nonzero == 0);
+
+    samples[0] = INT16_MIN;
+    const int exponent = fft_q15_magnitudes(plan, samples, work, magnitudes, NFFT / 2);
+    for (int i = 0; i < NFFT / 2; ++i) {
+        CHECK_MSG(fabs(ldexp(magnitudes[i], exponent) - 32768) <= 32768 * 1e-3, "bin %d", i);
+    }
+
+    CHECK(fft_q15_plan_get(NFFT) == plan);
+    CHECK(fft_q15_plan_get(4) == NULL && fft_q15_plan_get(384) == NULL);
+}
+
+// The conversion microphoneTask did before the fixed-point path, with a 64 bit divide per sample
+static long
+map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+/**
+ * A frame of microphoneTask: samples converted with map() into the float transform and its
+ * magnitudes, against the fixed-point magnitudes straight from the samples.
+ */
+static void
+bench_frames(void)
+{
+    enum { FRAMES = 20000 };
+    static int16_t samples[NFFT], work[NFFT], magnitudes[NFFT / 2];
+    static FFT_ALIGNED float input[NFFT], output[NFFT];
+    static float float_magnitudes[NFFT / 2];
+    fill_tone(samples, NFFT, 8000);
+    const fft_plan_t* plan = fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD);
+    const fft_q15_plan_t* q15_plan = fft_q15_plan_get(NFFT);
+    double sink = 0;
+
+    double start = bench_now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (int i = 0; i < NFFT; ++i) {
+            input[i] = (float)map(samples[i], INT16_MIN, INT16_MAX, -1000, 1000);
+        }
+        fft_plan_execute(plan, input, output);
+        for (int k = 0; k < NFFT / 2; ++k) {
+            const float re = output[2 * k], im = output[2 * k + 1];
+            float_magnitudes[k] = sqrtf(re * re + im * im);
+        }
+        sink += float_magnitudes[frame % (NFFT / 2)];
+    }
+    bench_report("512 points, map() and float FFT", bench_now() - start, FRAMES, "frame");
+
+    start = bench_now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        const int exponent = fft_q15_magnitudes(q15_plan, samples, work, magnitudes, NFFT / 2);
+        sink += magnitudes[frame % (NFFT / 2)] + exponent;
+    }
+    bench_report("512 points, fft_q15_magnitudes", bench_now() - start, FRAMES, "frame");
+    CHECK(sink != 0);
+}
+
+int
+main(void)
+{
+    test_snr();
+    test_edges();
+    bench_frames();
+    return test_result();
+}
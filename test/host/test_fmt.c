@@ -0,0 +1,264 @@
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "fmt.h"
+#include "test.h"
+
+/* fmt.c against snprintf, exhaustive where the input space allows and sampled where it does not */
+
+// xorshift64*, deterministic so a failure can be reproduced
+static uint64_t random_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t
+random_u64(void)
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return random_state * 0x2545f4914f6cdd1dULL;
+}
+
+static float
+random_float(void)
+{
+    float value;
+    do {
+        const uint32_t bits = (uint32_t)random_u64();
+        memcpy(&value, &bits, sizeof(value));
+    } while (!isfinite(value));
+    return value;
+}
+
+static int
+check_equal(const char* got, const char* expected, const char* what)
+{
+    if (strcmp(got, expected) != 0) {
+        CHECK_MSG(false, "%s: \"%s\" != \"%s\"", what, got, expected);
+        return 1;
+    }
+    return 0;
+}
+
+static void
+test_uint(void)
+{
+    char got[16];
+    char expected[16];
+    int failures = 0;
+    for (uint32_t value = 0; value < 2000000 && failures < 10; ++value) {
+        const unsigned width = value % 11;
+        fmt_uint(got, got + sizeof(got), value, width);
+        snprintf(expected, sizeof(expected), "%0*" PRIu32, width, value);
+        failures += check_equal(got, expected, "fmt_uint");
+    }
+    for (int i = 0; i < 2000000 && failures < 10; ++i) {
+        const uint32_t value = (uint32_t)random_u64() >> (random_u64() % 32);
+        const unsigned width = i % 12;
+        fmt_uint(got, got + sizeof(got), value, width);
+        snprintf(expected, sizeof(expected), "%0*" PRIu32, width, value);
+        failures += check_equal(got, expected, "fmt_uint");
+    }
+    fmt_uint(got, got + sizeof(got), UINT32_MAX, 0);
+    check_equal(got, "4294967295", "fmt_uint");
+}
+
+static void
+test_int(void)
+{
+    char got[16];
+    char expected[16];
+    int failures = 0;
+    for (int32_t value = -1000000; value < 1000000 && failures < 10; ++value) {
+        const unsigned width = (unsigned)(value & 0x7fffffff) % 11;
+        fmt_int(got, got + sizeof(got), value, width);
+        snprintf(expected, sizeof(expected), "%0*" PRId32, width, value);
+        failures += check_equal(got, expected, "fmt_int");
+    }
+    static const int32_t edges[] = { INT32_MIN, INT32_MIN + 1, -1, 0, INT32_MAX };
+    for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); ++i) {
+        for (unsigned width = 0; width <= 12; ++width) {
+            fmt_int(got, got + sizeof(got), edges[i], width);
+            snprintf(expected, sizeof(expected), "%0*" PRId32, width, edges[i]);
+            check_equal(got, expected, "fmt_int");
+        }
+    }
+}
+
+static int
+check_fixed(double value, unsigned decimals)
+{
+    char got[400];
+    char expected[400];
+    fmt_fixed(got, got + sizeof(got), value, decimals);
+    snprintf(expected, sizeof(expected), "%.*f", decimals, value);
+    if (strcmp(got, expected) != 0) {
+        CHECK_MSG(false, "fmt_fixed(%a, %u): \"%s\" != \"%s\"", value, decimals, got, expected);
+        return 1;
+    }
+    return 0;
+}
+
+static void
+test_fixed(void)
+{
+    int failures = 0;
+
+    // Every float of [1, 2) and [-1024, -512) at the precision the labels use, including all ties
+    for (uint32_t bits = 0x3f800000; bits < 0x40000000 && failures < 10; ++bits) {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        failures += check_fixed(value, 2);
+    }
+    for (uint32_t bits = 0xc4000000; bits < 0xc4800000 && failures < 10; ++bits) {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        failures += check_fixed(value, 1);
+    }
+
+    // Floats of any magnitude with up to 7 decimals, the range the header promises
+    for (int i = 0; i < 1000000 && failures < 10; ++i) {
+        failures += check_fixed(random_float(), i % 8);
+    }
+
+    // Doubles, whose products with 10^decimals are rounded and can land on a midpoint
+    for (int i = 0; i < 1000000 && failures < 10; ++i) {
+        const double value = (double)(int64_t)random_u64() / (double)(1ULL << (random_u64() % 64));
+        failures += check_fixed(value, i % (FMT_MAX_DECIMALS + 1));
+    }
+
+    // Halfway cases of the decimal grid are ties only when they are exact in binary
+    for (int i = -2000; i <= 2000 && failures < 10; ++i) {
+        failures += check_fixed(i / 8.0, 2) + check_fixed(i / 8.0, 1) + check_fixed(i * 0.005, 2) +
+                    check_fixed(i * 0.005f, 2);
+    }
+
+    static const double specials[] = { 0.0, -0.0, 0.5, 1.5, 2.5, -0.5, -12.345, 0.125, 1e-30, 1e300, -1e20,
+                                       9.2233720368547758e18, INFINITY, -INFINITY };
+    for (size_t i = 0; i < sizeof(specials) / sizeof(specials[0]); ++i) {
+        for (unsigned decimals = 0; decimals <= FMT_MAX_DECIMALS; ++decimals) {
+            check_fixed(specials[i], decimals);
+        }
+    }
+    char got[16];
+    fmt_fixed(got, got + sizeof(got), NAN, 2);
+    check_equal(got, "nan", "fmt_fixed");
+}
+
+static void
+test_scaled(void)
+{
+    char got[32];
+    char expected[48];
+    int failures = 0;
+    for (int i = 0; i < 1000000 && failures < 10; ++i) {
+        const int64_t value = (int64_t)random_u64() >> (random_u64() % 64);
+        const unsigned decimals = i % (FMT_MAX_DECIMALS + 1);
+        int64_t scale = 1;
+        for (unsigned d = 0; d < decimals; ++d) {
+            scale *= 10;
+        }
+        const uint64_t magnitude = value < 0 ? -(uint64_t)value : (uint64_t)value;
+        if (decimals == 0) {
+            snprintf(expected, sizeof(expected), "%" PRId64, value);
+        } else {
+            snprintf(expected, sizeof(expected), "%s%" PRIu64 ".%0*" PRIu64, value < 0 ? "-" : "",
+                     magnitude / scale, (int)decimals, magnitude % scale);
+        }
+        fmt_scaled(got, got + sizeof(got), value, decimals);
+        failures += check_equal(got, expected, "fmt_scaled");
+    }
+    fmt_scaled(got, got + sizeof(got), -85455940, 7);
+    check_equal(got, "-8.5455940", "fmt_scaled");
+}
+
+static void
+test_ipv4(void)
+{
+    char got[16];
+    char expected[16];
+    int failures = 0;
+    // Every value of each octet, in every position
+    for (uint32_t i = 0; i < (1u << 16) && failures < 10; ++i) {
+        const uint32_t address = (uint32_t)random_u64() ^ i;
+        fmt_ipv4(got, got + sizeof(got), address);
+        snprintf(expected, sizeof(expected), "%u.%u.%u.%u", address & 0xff, (address >> 8) & 0xff,
+                 (address >> 16) & 0xff, address >> 24);
+        failures += check_equal(got, expected, "fmt_ipv4");
+    }
+    fmt_ipv4(got, got + sizeof(got), 0x0101a8c0);
+    check_equal(got, "192.168.1.1", "fmt_ipv4");
+}
+
+// Output that does not fit is the start of what snprintf would have written
+static void
+test_truncation(void)
+{
+    char expected[32];
+    snprintf(expected, sizeof(expected), "T %.2f C, %02d:%05u", -12.345, 7, 42u);
+    for (size_t size = 1; size <= strlen(expected) + 1; ++size) {
+        char got[32];
+        memset(got, 'x', sizeof(got));
+        char* end = got + size;
+        char* p = fmt_str(got, end, "T ");
+        p = fmt_fixed(p, end, -12.345, 2);
+        p = fmt_str(p, end, " C, ");
+        p = fmt_int(p, end, 7, 2);
+        p = fmt_char(p, end, ':');
+        p = fmt_uint(p, end, 42, 5);
+        CHECK(p == got + size - 1);
+        CHECK(strncmp(got, expected, size - 1) == 0 && got[size - 1] == '\0');
+        CHECK(got[size] == 'x');
+    }
+    // An empty buffer is left alone
+    char untouched = 'x';
+    CHECK(fmt_str(&untouched, &untouched, "abc") == &untouched && untouched == 'x');
+}
+
+static void
+bench_labels(void)
+{
+    enum { LABELS = 1000000 };
+    char label[64];
+    size_t length = 0;
+
+    double start = bench_now();
+    for (int i = 0; i < LABELS; ++i) {
+        char* end = label + sizeof(label);
+        char* p = fmt_fixed(label, end, 21.0f + (i % 1000) * 0.01f, 2);
+        p = fmt_str(p, end, " C  ");
+        p = fmt_int(p, end, i % 24, 2);
+        p = fmt_char(p, end, ':');
+        p = fmt_int(p, end, i % 60, 2);
+        length += p - label;
+    }
+    const double fmt_seconds = bench_now() - start;
+
+    start = bench_now();
+    for (int i = 0; i < LABELS; ++i) {
+        length += snprintf(label, sizeof(label), "%.2f C  %02d:%02d", 21.0f + (i % 1000) * 0.01f, i % 24,
+                           i % 60);
+    }
+    const double printf_seconds = bench_now() - start;
+
+    CHECK(length > 0);
+    bench_report("fmt label", fmt_seconds, LABELS, "label");
+    bench_report("snprintf label", printf_seconds, LABELS, "label");
+}
+
+int
+main(void)
+{
+    test_uint();
+    test_int();
+    test_fixed();
+    test_scaled();
+    test_ipv4();
+    test_truncation();
+    bench_labels();
+    return test_result();
+}
@@ -0,0 +1,410 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "geofence.h"
+#include "test.h"
+#include "track_synth.h"
+
+/* Geofences through the grid against a brute force check of every fence, with their events */
+
+// The reference checks every fence for every fix, builds with more fences check fewer fixes
+#define FIXES (50000 * 512 / GEOFENCE_MAX_FENCES)
+#define TRACK_FIXES 3600
+#define METERS_PER_DEGREE 111226.3 // the sphere of geofence.c
+#define MAX_VERTICES 24
+
+static uint32_t random_state = 88172645u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+// Uniform in [-range, range]
+static int32_t
+random_around(int32_t range)
+{
+    return (int32_t)(random_next() % (2 * (uint32_t)range + 1)) - range;
+}
+
+typedef struct
+{
+    uint32_t id;
+    GeofencePoint center;
+    uint32_t radius_m; // 0 for polygons
+    int32_t reach_e7;  // no point of the fence is farther from the center in latitude or longitude
+    GeofencePoint vertices[MAX_VERTICES];
+    size_t count;
+} ReferenceFence;
+
+static ReferenceFence fences[GEOFENCE_MAX_FENCES];
+static size_t fence_count;
+
+typedef enum
+{
+    OUTSIDE,
+    INSIDE,
+    ON_EDGE, // too close to the boundary for the reference to tell
+} Containment;
+
+/**
+ * The flat earth of geofence.c in double. Its longitude scale is a Q16 cos(latitude), good to 2^-16
+ * and so to 3e-5 of the radius, closer to the circle than that is an edge.
+ */
+static Containment
+circle_contains(const ReferenceFence* fence, int32_t lat, int32_t lng)
+{
+    const double scale = cos(fence->center.latitude_e7 * 1e-7 * M_PI / 180);
+    const double dlat = ((double)lat - fence->center.latitude_e7) * 1e-7 * METERS_PER_DEGREE;
+    const double dlng = ((double)lng - fence->center.longitude_e7) * 1e-7 * METERS_PER_DEGREE * scale;
+    const double distance = sqrt(dlat * dlat + dlng * dlng);
+    const double margin = 1e-3 + fence->radius_m * 3e-5;
+    if (distance < fence->radius_m - margin) {
+        return INSIDE;
+    }
+    return distance > fence->radius_m + margin ? OUTSIDE : ON_EDGE;
+}
+
+// Squared distance in 1e-7 degrees from the point to the segment a-b
+static double
+segment_distance2(double lat, double lng, const GeofencePoint* a, const GeofencePoint* b)
+{
+    const double edge_lat = (double)b->latitude_e7 - a->latitude_e7;
+    const double edge_lng = (double)b->longitude_e7 - a->longitude_e7;
+    const double length2 = edge_lat * edge_lat + edge_lng * edge_lng;
+    const double along = (lat - a->latitude_e7) * edge_lat + (lng - a->longitude_e7) * edge_lng;
+    double t = length2 > 0 ? along / length2 : 0;
+    t = t < 0 ? 0 : t > 1 ? 1 : t;
+    const double dlat = lat - (a->latitude_e7 + t * edge_lat);
+    const double dlng = lng - (a->longitude_e7 + t * edge_lng);
+    return dlat * dlat + dlng * dlng;
+}
+
+// Crossing number in double, points on an edge or a vertex are left open
+static Containment
+polygon_contains(const ReferenceFence* fence, int32_t lat, int32_t lng)
+{
+    bool inside = false;
+    for (size_t i = 0, j = fence->count - 1; i < fence->count; j = i++) {
+        const GeofencePoint* a = &fence->vertices[i];
+        const GeofencePoint* b = &fence->vertices[j];
+        if (segment_distance2(lat, lng, a, b) < 4) {
+            return ON_EDGE;
+        }
+        if ((a->latitude_e7 > lat) != (b->latitude_e7 > lat)) {
+            const double crossing = a->longitude_e7 + ((double)lat - a->latitude_e7) *
+                                                        ((double)b->longitude_e7 - a->longitude_e7) /
+                                                        ((double)b->latitude_e7 - a->latitude_e7);
+            inside ^= lng < crossing;
+        }
+    }
+    return inside ? INSIDE : OUTSIDE;
+}
+
+static Containment
+reference_contains(const ReferenceFence* fence, int32_t lat, int32_t lng)
+{
+    return fence->radius_m > 0 ? circle_contains(fence, lat, lng) : polygon_contains(fence, lat, lng);
+}
+
+// The events of the last geofence_update(), by fence index
+static int events[GEOFENCE_MAX_FENCES];
+static unsigned event_count;
+static const GpsPosition* event_position;
+
+// Only while event_position is set, the benchmark leaves it NULL
+static void
+record_event(uint32_t id, GeofenceEvent event, const GpsPosition* position)
+{
+    if (event_position == NULL) {
+        return;
+    }
+    CHECK(id >= 1000 && id < 1000 + GEOFENCE_MAX_FENCES && events[id - 1000] == 0);
+    CHECK(position == event_position);
+    events[id - 1000] = event == GEOFENCE_ENTER ? 1 : -1;
+    ++event_count;
+}
+
+static GeofencePoint
+random_point(GeofencePoint center, int32_t range)
+{
+    const GeofencePoint point = { center.latitude_e7 + random_around(range),
+                                  center.longitude_e7 + random_around(range) };
+    return point;
+}
+
+/**
+ * Circles of 20 m to 3 km and star shaped, often concave polygons of 3 to 24 vertices, around
+ * `center`. With `large`, one in eight is 20 to 50 km instead and spans more grid cells than
+ * GEOFENCE_MAX_FENCE_CELLS.
+ */
+static void
+add_fences(GeofencePoint center, size_t count, bool large_ones)
+{
+    for (size_t i = 0; i < count; ++i) {
+        ReferenceFence* fence = &fences[fence_count];
+        fence->id = 1000 + fence_count;
+        fence->center = random_point(center, 5000000);
+        const bool large = large_ones && random_next() % 8 == 0;
+        const uint32_t size_m = large ? 20000 + random_next() % 30000 : 20 + random_next() % 3000;
+        if (random_next() % 2 == 0) {
+            fence->radius_m = size_m;
+            fence->count = 0;
+            fence->reach_e7 = (int32_t)(size_m / METERS_PER_DEGREE * 1e7 / cos(47.5 * M_PI / 180));
+            CHECK(geofence_add_circle(fence->id, fence->center, size_m) == ESP_OK);
+        } else {
+            fence->radius_m = 0;
+            fence->count = 3 + random_next() % (MAX_VERTICES - 2);
+            const double size_e7 = size_m / METERS_PER_DEGREE * 1e7;
+            fence->reach_e7 = (int32_t)size_e7;
+            for (size_t v = 0; v < fence->count; ++v) {
+                const double angle = 2 * M_PI * (v + 0.8 * (random_next() % 1000) / 1000.0) / fence->count;
+                const double radius = size_e7 * (0.2 + 0.8 * (random_next() % 1000) / 1000.0);
+                fence->vertices[v].latitude_e7 = fence->center.latitude_e7 + (int32_t)(radius * sin(angle));
+                fence->vertices[v].longitude_e7 = fence->center.longitude_e7 + (int32_t)(radius * cos(angle));
+            }
+            CHECK(geofence_add_polygon(fence->id, fence->vertices, fence->count) == ESP_OK);
+        }
+        ++fence_count;
+    }
+}
+
+/**
+ * Fixes anywhere around the fences and right at their edges. Every fence the reference is sure
+ * about has to be reported as such, and each fix raises exactly the enter and exit events of
+ * the fences whose state changed.
+ */
+static void
+check_fixes(GeofencePoint center, int fixes)
+{
+    // Fences are new or cleared, none has been entered yet
+    static bool was_inside[GEOFENCE_MAX_FENCES];
+    memset(was_inside, 0, sizeof(was_inside));
+    static uint32_t ids[GEOFENCE_MAX_FENCES];
+    unsigned wrong = 0;
+    unsigned edges = 0;
+    unsigned total_inside = 0;
+    for (int fix = 0; fix < fixes; ++fix) {
+        GeofencePoint point = random_point(center, 5500000);
+        if (fix % 2 == 1 && fence_count > 0) {
+            // Around a fence, where its edges are
+            const ReferenceFence* fence = &fences[random_next() % fence_count];
+            point = random_point(fence->center, fence->reach_e7 + fence->reach_e7 / 4);
+        }
+        GpsPosition position = { .latitude_e7 = point.latitude_e7,
+                                 .longitude_e7 = point.longitude_e7,
+                                 .is_valid = true };
+        memset(events, 0, sizeof(events));
+        event_count = 0;
+        event_position = &position;
+        geofence_update(&position);
+
+        const size_t inside_count = geofence_inside(ids, GEOFENCE_MAX_FENCES);
+        bool is_inside[GEOFENCE_MAX_FENCES] = { false };
+        for (size_t i = 0; i < inside_count; ++i) {
+            is_inside[ids[i] - 1000] = true;
+        }
+        total_inside += inside_count;
+        unsigned changes = 0;
+        for (size_t f = 0; f < fence_count; ++f) {
+            const Containment expected =
+              reference_contains(&fences[f], point.latitude_e7, point.longitude_e7);
+            edges += expected == ON_EDGE;
+            if (expected != ON_EDGE && (expected == INSIDE) != is_inside[f] && wrong++ < 10) {
+                fprintf(stderr,
+                        "fence %zu %s at %d %d\n",
+                        f,
+                        is_inside[f] ? "contains a point outside" : "misses a point inside",
+                        point.latitude_e7,
+                        point.longitude_e7);
+            }
+            if (is_inside[f] != was_inside[f]) {
+                ++changes;
+                CHECK(events[f] == (is_inside[f] ? 1 : -1));
+            }
+            was_inside[f] = is_inside[f];
+        }
+        CHECK_MSG(event_count == changes, "fix %d: %u events for %u changes", fix, event_count, changes);
+    }
+    CHECK_MSG(wrong == 0, "%u fixes placed wrong", wrong);
+    CHECK(total_inside > (unsigned)fixes / 10 && edges < (unsigned)fixes * fence_count / 1000);
+}
+
+static void
+test_invalid(void)
+{
+    const GeofencePoint center = { 473977420, 85455940 };
+    CHECK(geofence_add_circle(1, center, 100) == ESP_ERR_INVALID_STATE);
+    CHECK(geofence_count() == 0);
+    CHECK(geofence_init(record_event));
+
+    const GeofencePoint outside[] = {
+        { 900000001, 0 }, { -900000001, 0 }, { 0, 1800000001 }, { 0, -1800000001 },
+    };
+    for (size_t i = 0; i < sizeof(outside) / sizeof(outside[0]); ++i) {
+        CHECK(geofence_add_circle(1, outside[i], 100) == ESP_ERR_INVALID_ARG);
+        const GeofencePoint triangle[] = { center, outside[i], { 474000000, 85500000 } };
+        CHECK(geofence_add_polygon(1, triangle, 3) == ESP_ERR_INVALID_ARG);
+    }
+    CHECK(geofence_add_circle(1, center, 0) == ESP_ERR_INVALID_ARG);
+    CHECK(geofence_add_circle(1, center, 1000001) == ESP_ERR_INVALID_ARG);
+    const GeofencePoint line[] = { center, { 474000000, 85500000 } };
+    CHECK(geofence_add_polygon(1, line, 2) == ESP_ERR_INVALID_ARG);
+    CHECK(geofence_count() == 0);
+
+    // The corners of the coordinate range are valid, and a 1000 km circle on a pole
+    const GeofencePoint pole = { 900000000, -1800000000 };
+    CHECK(geofence_add_circle(1, pole, 1000000) == ESP_OK);
+    const GeofencePoint corners[] = {
+        { -900000000, -1800000000 }, { 900000000, -1800000000 }, { 0, 1800000000 },
+    };
+    CHECK(geofence_add_polygon(2, corners, 3) == ESP_OK);
+    CHECK(geofence_count() == 2);
+    geofence_clear();
+    CHECK(geofence_count() == 0);
+}
+
+// Fences up to the store's limits, then the limits are reported instead of fences dropped
+static void
+test_capacity(void)
+{
+    const GeofencePoint center = { 473977420, 85455940 };
+    for (uint32_t i = 0; i < GEOFENCE_MAX_FENCES; ++i) {
+        CHECK(geofence_add_circle(1000 + i, center, 100) == ESP_OK);
+    }
+    CHECK(geofence_add_circle(1000 + GEOFENCE_MAX_FENCES, center, 100) == ESP_ERR_NO_MEM);
+    CHECK(geofence_count() == GEOFENCE_MAX_FENCES);
+
+    // Every fence raises its event at the point, and all of them are listed
+    GpsPosition position = {
+        .latitude_e7 = center.latitude_e7, .longitude_e7 = center.longitude_e7, .is_valid = true,
+    };
+    memset(events, 0, sizeof(events));
+    event_count = 0;
+    event_position = &position;
+    geofence_update(&position);
+    static uint32_t ids[GEOFENCE_MAX_FENCES];
+    CHECK(event_count == GEOFENCE_MAX_FENCES && events[GEOFENCE_MAX_FENCES - 1] == 1);
+    CHECK(geofence_inside(ids, GEOFENCE_MAX_FENCES) == GEOFENCE_MAX_FENCES && ids[7] == 1007);
+    CHECK(geofence_inside(ids, 2) == GEOFENCE_MAX_FENCES);
+    geofence_clear();
+
+    static GeofencePoint vertices[GEOFENCE_MAX_VERTICES];
+    for (size_t i = 0; i < GEOFENCE_MAX_VERTICES; ++i) {
+        const double angle = 2 * M_PI * i / GEOFENCE_MAX_VERTICES;
+        vertices[i].latitude_e7 = center.latitude_e7 + (int32_t)(10000 * sin(angle));
+        vertices[i].longitude_e7 = center.longitude_e7 + (int32_t)(10000 * cos(angle));
+    }
+    CHECK(geofence_add_polygon(1000, vertices, GEOFENCE_MAX_VERTICES / 2) == ESP_OK);
+    CHECK(geofence_add_polygon(1001, vertices, GEOFENCE_MAX_VERTICES / 2 + 1) == ESP_ERR_NO_MEM);
+    CHECK(geofence_add_polygon(1001, vertices, GEOFENCE_MAX_VERTICES / 2) == ESP_OK);
+    CHECK(geofence_add_polygon(1002, vertices, 3) == ESP_ERR_NO_MEM);
+    position.latitude_e7 += 100; // off the straight edge of the half circles
+    memset(events, 0, sizeof(events));
+    event_count = 0;
+    geofence_update(&position);
+    CHECK(event_count == 2 && geofence_inside(ids, 2) == 2 && ids[0] == 1000 && ids[1] == 1001);
+    geofence_clear();
+    event_position = NULL;
+}
+
+// A fence registered in cells of both signs, the grid must round coordinates down on both sides of zero
+static void
+test_across_zero(void)
+{
+    const GeofencePoint zero = { 0, 0 };
+    add_fences(zero, GEOFENCE_MAX_FENCES / 4, true);
+    check_fixes(zero, FIXES / 4);
+    geofence_clear();
+    fence_count = 0;
+}
+
+static void
+test_against_reference(void)
+{
+    const GeofencePoint center = { 473977420, 85455940 };
+    add_fences(center, GEOFENCE_MAX_FENCES, true);
+    check_fixes(center, FIXES);
+
+    // After clearing, fences that contain the last fix raise their enter events again
+    geofence_clear();
+    CHECK(geofence_count() == 0);
+    fence_count = 0;
+    add_fences(center, 64, true);
+    check_fixes(center, FIXES / 10);
+    geofence_clear();
+    fence_count = 0;
+}
+
+/**
+ * An hour of driving replayed over and over, so consecutive fixes look at the same grid cells
+ * like on the device, against the same fences checked one by one. The fences are up to 3 km and
+ * spread around the middle of the track. The test_geofence_10k build runs this with 10000.
+ */
+static void
+bench_update(void)
+{
+    enum { ROUNDS = 200000 };
+    static GpsPosition track[TRACK_FIXES];
+    TrackSynth synth;
+    track_synth_init(&synth, 7);
+    int64_t lat_sum = 0, lng_sum = 0;
+    for (int i = 0; i < TRACK_FIXES; ++i) {
+        track_synth_next(&synth, &track[i]);
+        lat_sum += track[i].latitude_e7;
+        lng_sum += track[i].longitude_e7;
+    }
+    const GeofencePoint center = { (int32_t)(lat_sum / TRACK_FIXES), (int32_t)(lng_sum / TRACK_FIXES) };
+    event_position = NULL;
+    add_fences(center, GEOFENCE_MAX_FENCES, false);
+
+    double start = bench_now();
+    for (int i = 0; i < ROUNDS; ++i) {
+        geofence_update(&track[i % TRACK_FIXES]);
+    }
+    const double grid_seconds = bench_now() - start;
+
+    size_t inside = 0;
+    for (int i = 0; i < TRACK_FIXES; ++i) {
+        geofence_update(&track[i]);
+        inside += geofence_inside(NULL, 0);
+    }
+
+    unsigned reference_inside = 0;
+    const int scan_rounds = ROUNDS / 10 * 512 / GEOFENCE_MAX_FENCES;
+    start = bench_now();
+    for (int i = 0; i < scan_rounds; ++i) {
+        const GpsPosition* position = &track[i % TRACK_FIXES];
+        for (size_t f = 0; f < fence_count; ++f) {
+            reference_inside +=
+              reference_contains(&fences[f], position->latitude_e7, position->longitude_e7) == INSIDE;
+        }
+    }
+    const double scan_seconds = bench_now() - start;
+    CHECK(inside > 0 && reference_inside > 0);
+
+    char name[48];
+    snprintf(name, sizeof(name), "geofence_update, %d fences, track", GEOFENCE_MAX_FENCES);
+    bench_report(name, grid_seconds, ROUNDS, "fix");
+    snprintf(name, sizeof(name), "checking all %d fences", GEOFENCE_MAX_FENCES);
+    bench_report(name, scan_seconds, scan_rounds, "fix");
+    printf("%-40s %10.1f fences/fix\n", "inside along the track", (double)inside / TRACK_FIXES);
+}
+
+int
+main(void)
+{
+    test_invalid();
+    test_capacity();
+    test_against_reference();
+    test_across_zero();
+    bench_update();
+    return test_result();
+}
@@ -0,0 +1,247 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "TinyGPSPlus.h"
+#include "bench.h"
+#include "test.h"
+
+/* The single precision batch distances and courses against distanceBetween and courseTo */
+
+#define PAIRS 1000000
+#define BATCH 1024
+#define MAX_DISTANCE 17500e3 // meters, the bounds hold up to here
+
+// The bounds of the header comment in TinyGPSPlus.cpp
+#if _GPS_BATCH_DIGITS > 4
+#define DISTANCE_BOUND 1e-6 // relative
+#define COURSE_BOUND 1e-4   // degrees
+#else
+#define DISTANCE_BOUND 1e-3
+#define COURSE_BOUND 0.05
+#endif
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+// Uniform in [-range, range]
+static int32_t
+random_around(int32_t range)
+{
+    return (int32_t)(random_next() % (2 * (uint32_t)range + 1)) - range;
+}
+
+static int32_t
+clamp_lat(int64_t lat)
+{
+    return (int32_t)(lat > 900000000 ? 900000000 : lat < -900000000 ? -900000000 : lat);
+}
+
+// Into [-180°, 180°)
+static int32_t
+wrap_lng(int64_t lng)
+{
+    lng = lng >= 1800000000 ? lng - 3600000000LL : lng;
+    return (int32_t)(lng < -1800000000 ? lng + 3600000000LL : lng);
+}
+
+static double
+course_difference(double a, double b)
+{
+    const double difference = fabs(a - b);
+    return difference > 180 ? 360 - difference : difference;
+}
+
+typedef struct
+{
+    double distance; // largest relative error
+    double course;   // largest error in degrees
+    unsigned points;
+} Errors;
+
+/**
+ * Batches of points around origins from `next_origin`, each at most `range` 1e-7 degrees away in
+ * latitude and longitude, measured against the double reference. Pairs too close to be antipodal
+ * for single precision are left out. Below a millimetre, as between points at a pole that only
+ * differ in longitude, the reference is rounding noise and only has to be matched absolutely.
+ */
+static void
+measure(const char* name, void (*next_origin)(int32_t* lat, int32_t* lng), int32_t range)
+{
+    static int32_t lats[BATCH], lngs[BATCH];
+    static float meters[BATCH], courses[BATCH];
+    Errors errors = { 0, 0, 0 };
+    for (int batch = 0; batch < PAIRS / BATCH; ++batch) {
+        int32_t lat, lng;
+        next_origin(&lat, &lng);
+        for (int i = 0; i < BATCH; ++i) {
+            lats[i] = clamp_lat((int64_t)lat + random_around(range));
+            lngs[i] = wrap_lng((int64_t)lng + random_around(range));
+        }
+        TinyGPSPlus::distancesFrom(lat, lng, lats, lngs, BATCH, meters);
+        TinyGPSPlus::coursesFrom(lat, lng, lats, lngs, BATCH, courses);
+        for (int i = 0; i < BATCH; ++i) {
+            const double distance =
+              TinyGPSPlus::distanceBetween(lat / 1e7, lng / 1e7, lats[i] / 1e7, lngs[i] / 1e7);
+            if (distance > MAX_DISTANCE) {
+                continue;
+            }
+            ++errors.points;
+            if (distance >= 1e-3) {
+                const double error = fabs(meters[i] - distance) / distance;
+                errors.distance = error > errors.distance ? error : errors.distance;
+                const double course =
+                  TinyGPSPlus::courseTo(lat / 1e7, lng / 1e7, lats[i] / 1e7, lngs[i] / 1e7);
+                const double course_error = course_difference(courses[i], course);
+                errors.course = course_error > errors.course ? course_error : errors.course;
+            } else {
+                CHECK(meters[i] < 1e-3);
+            }
+        }
+    }
+    CHECK_MSG(
+      errors.distance <= DISTANCE_BOUND, "%s: distances off by %.3g relative", name, errors.distance);
+    CHECK_MSG(errors.course <= COURSE_BOUND, "%s: courses off by %.3g degrees", name, errors.course);
+    CHECK(errors.points > PAIRS / 2);
+    printf("%-40s %10.2g %10.2g deg\n", name, errors.distance, errors.course);
+}
+
+static void
+anywhere(int32_t* lat, int32_t* lng)
+{
+    *lat = random_around(900000000);
+    *lng = wrap_lng(random_around(1800000000));
+}
+
+static void
+near_antimeridian(int32_t* lat, int32_t* lng)
+{
+    *lat = random_around(800000000);
+    *lng = wrap_lng(1800000000 + random_around(100000));
+}
+
+static void
+near_poles(int32_t* lat, int32_t* lng)
+{
+    *lat = clamp_lat((random_next() % 2 == 0 ? 900000000 : -900000000) + random_around(100000));
+    *lng = wrap_lng(random_around(1800000000));
+}
+
+static void
+test_accuracy(void)
+{
+    printf("%-40s %10s %10s\n", "batch error against double", "distance", "course");
+    measure("  any two points", anywhere, 1800000000);
+    measure("  within 1 km", anywhere, 90000);
+    measure("  within 1 m", anywhere, 90);
+    measure("  across the antimeridian, 1 km", near_antimeridian, 90000);
+    measure("  around the poles, 1 km", near_poles, 90000);
+}
+
+// A drive of 1 Hz fixes, each segment against distanceBetween and the whole length against their sum
+static void
+test_path(void)
+{
+    enum { POINTS = 100000 };
+    static int32_t lats[POINTS], lngs[POINTS];
+    static float meters[POINTS - 1];
+    int32_t velocity[2] = { 0, 0 };
+    lats[0] = 318463700;
+    lngs[0] = 1171988283;
+    for (int i = 1; i < POINTS; ++i) {
+        velocity[0] += random_around(40);
+        velocity[1] += random_around(40);
+        lats[i] = clamp_lat((int64_t)lats[i - 1] + velocity[0]);
+        lngs[i] = wrap_lng((int64_t)lngs[i - 1] + velocity[1]);
+    }
+
+    TinyGPSPlus::segmentDistances(lats, lngs, POINTS, meters);
+    double reference = 0;
+    double max_error = 0;
+    for (int i = 1; i < POINTS; ++i) {
+        const double segment =
+          TinyGPSPlus::distanceBetween(lats[i - 1] / 1e7, lngs[i - 1] / 1e7, lats[i] / 1e7, lngs[i] / 1e7);
+        reference += segment;
+        const double error = segment > 0 ? fabs(meters[i - 1] - segment) / segment : meters[i - 1];
+        max_error = error > max_error ? error : max_error;
+    }
+    CHECK_MSG(max_error <= DISTANCE_BOUND, "a segment is off by %.3g relative", max_error);
+    const double length = TinyGPSPlus::pathLength(lats, lngs, POINTS);
+    CHECK_MSG(fabs(length - reference) <= reference * DISTANCE_BOUND,
+              "path of %.0f m is %.3f m off",
+              reference,
+              length - reference);
+    CHECK(TinyGPSPlus::pathLength(lats, lngs, 1) == 0 && TinyGPSPlus::pathLength(lats, lngs, 0) == 0);
+    // The blocks of pathLength meet without a segment lost or counted twice
+    for (size_t count = 2; count < 100; ++count) {
+        double sum = 0;
+        for (size_t i = 0; i + 1 < count; ++i) {
+            sum += meters[i];
+        }
+        const double joined = TinyGPSPlus::pathLength(lats, lngs, count);
+        CHECK_MSG(fabs(joined - sum) <= sum * 1e-6, "%zu points", count);
+    }
+}
+
+static void
+bench_batch(void)
+{
+    enum { ROUNDS = 2000 };
+    static int32_t lats[BATCH], lngs[BATCH];
+    static float meters[BATCH];
+    for (int i = 0; i < BATCH; ++i) {
+        lats[i] = 318463700 + random_around(5000000);
+        lngs[i] = 1171988283 + random_around(5000000);
+    }
+
+    double sink = 0;
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS / 10; ++round) {
+        for (int i = 0; i < BATCH; ++i) {
+            sink += TinyGPSPlus::distanceBetween(31.84637, 117.1988283, lats[i] / 1e7, lngs[i] / 1e7);
+        }
+    }
+    bench_report("distanceBetween", bench_now() - start, (double)BATCH * ROUNDS / 10, "point");
+    start = bench_now();
+    for (int round = 0; round < ROUNDS / 10; ++round) {
+        for (int i = 0; i < BATCH; ++i) {
+            sink += TinyGPSPlus::courseTo(31.84637, 117.1988283, lats[i] / 1e7, lngs[i] / 1e7);
+        }
+    }
+    bench_report("courseTo", bench_now() - start, (double)BATCH * ROUNDS / 10, "point");
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        TinyGPSPlus::distancesFrom(318463700, 1171988283, lats, lngs, BATCH, meters);
+        sink += meters[round % BATCH];
+    }
+    bench_report("distancesFrom", bench_now() - start, (double)BATCH * ROUNDS, "point");
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        TinyGPSPlus::coursesFrom(318463700, 1171988283, lats, lngs, BATCH, meters);
+        sink += meters[round % BATCH];
+    }
+    bench_report("coursesFrom", bench_now() - start, (double)BATCH * ROUNDS, "point");
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        sink += TinyGPSPlus::pathLength(lats, lngs, BATCH);
+    }
+    bench_report("pathLength", bench_now() - start, (double)BATCH * ROUNDS, "point");
+    CHECK(sink > 0);
+}
+
+int
+main(void)
+{
+    test_accuracy();
+    test_path();
+    bench_batch();
+    return test_result();
+}
@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "TinyGPSPlus.h"
+#include "bench.h"
+#include "nmea_log.h"
+#include "test.h"
+
+/* TinyGPSCustom through the hashed dispatch table, against splitting the sentences by hand */
+
+#define MAX_FIELDS 100
+
+// The sentences of the log, and some it does not have
+static const char* names[] = {
+    "GNGGA", "GNGLL", "GPGSA", "BDGSA", "GPGSV", "BDGSV",
+    "GNRMC", "GNVTG", "GNZDA", "GPTXT", "GPGGA", "GNGSA",
+};
+#define NAME_COUNT (sizeof(names) / sizeof(names[0]))
+
+static uint32_t random_state = 521288629u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+typedef struct Field
+{
+    const char* name;
+    int term;
+    char expected[_GPS_MAX_FIELD_SIZE + 1];
+    bool is_valid;
+} Field;
+
+// The value a field gets from `sentence`, "$<name>,<term 1>,...*<checksum>", false if it has none
+static bool
+field_value(const char* sentence, const Field& field, char* value)
+{
+    const size_t name_length = strlen(field.name);
+    if (strncmp(sentence + 1, field.name, name_length) != 0 || sentence[1 + name_length] != ',') {
+        return false;
+    }
+    const char* p = sentence + 1;
+    for (int term = 0; term < field.term; ++term) {
+        p = strpbrk(p, ",*");
+        if (p == NULL || *p == '*') {
+            return false;
+        }
+        ++p;
+    }
+    const size_t length = strcspn(p, ",*");
+    // The parser keeps the first _GPS_MAX_FIELD_SIZE - 1 characters of a term
+    const size_t kept = length < _GPS_MAX_FIELD_SIZE - 1 ? length : _GPS_MAX_FIELD_SIZE - 1;
+    memcpy(value, p, kept);
+    value[kept] = '\0';
+    return true;
+}
+
+static void
+test_against_split(const char* log, size_t length)
+{
+    static TinyGPSCustom customs[MAX_FIELDS];
+    static Field fields[MAX_FIELDS];
+    TinyGPSPlus gps;
+    for (int i = 0; i < MAX_FIELDS; ++i) {
+        // Several fields on the same term, and terms past the end of their sentences
+        fields[i].name = names[random_next() % NAME_COUNT];
+        fields[i].term = 1 + random_next() % 22;
+        fields[i].is_valid = false;
+        customs[i].begin(gps, fields[i].name, fields[i].term);
+    }
+
+    unsigned differences = 0;
+    unsigned updates = 0;
+    for (const char* sentence = log; sentence < log + length;) {
+        const char* end = strstr(sentence, "\r\n") + 2;
+        // Every tenth sentence damaged, its terms must not be committed
+        char copy[128];
+        memcpy(copy, sentence, end - sentence);
+        const bool damaged = random_next() % 10 == 0;
+        if (damaged) {
+            copy[1 + random_next() % (end - sentence - 8)] ^= 0x01;
+        }
+        CHECK(gps.encode((const uint8_t*)copy, end - sentence) == !damaged);
+
+        for (int i = 0; i < MAX_FIELDS; ++i) {
+            char value[_GPS_MAX_FIELD_SIZE + 1];
+            const bool has_value = !damaged && field_value(sentence, fields[i], value);
+            if (has_value) {
+                strcpy(fields[i].expected, value);
+                fields[i].is_valid = true;
+                ++updates;
+            }
+            const bool same = customs[i].isUpdated() == has_value
+                              && customs[i].isValid() == fields[i].is_valid
+                              && strcmp(customs[i].value(), fields[i].expected) == 0;
+            if (!same && differences++ < 10) {
+                fprintf(stderr,
+                        "%.*s: %s term %d is \"%s\", expected \"%s\"\n",
+                        (int)(end - sentence - 2),
+                        sentence,
+                        fields[i].name,
+                        fields[i].term,
+                        customs[i].value(),
+                        fields[i].expected);
+            }
+        }
+        sentence = end;
+    }
+    CHECK_MSG(differences == 0, "%u field values differ", differences);
+    CHECK(updates > 1000);
+}
+
+/**
+ * Parsing cost with 1, 10 and 100 registered fields. On sentences the log does not have only the
+ * lookup costs, on its sentences the values are copied and committed as well.
+ */
+static void
+bench_dispatch(const char* log, size_t length, bool in_log)
+{
+    static const int counts[] = { 0, 1, 10, 100 };
+    static TinyGPSCustom customs[MAX_FIELDS];
+    static char absent[10][8];
+    const size_t sentences = 13 * 1000;
+
+    for (int i = 0; i < 10; ++i) {
+        snprintf(absent[i], sizeof(absent[i]), "GPXX%c", 'A' + i);
+    }
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        TinyGPSPlus gps;
+        for (int i = 0; i < counts[c]; ++i) {
+            customs[i].begin(gps, in_log ? names[i % 10] : absent[i % 10], 1 + i / 10 % 10);
+        }
+        const double start = bench_now();
+        for (int round = 0; round < 10; ++round) {
+            gps.encode((const uint8_t*)log, length);
+        }
+        const double seconds = bench_now() - start;
+        CHECK(gps.passedChecksum() == 10 * sentences);
+
+        char name[48];
+        snprintf(name, sizeof(name), "nmea encode, %d %s fields", counts[c], in_log ? "set" : "idle");
+        bench_report(name, seconds, 10.0 * sentences, "sentence");
+    }
+}
+
+int
+main(void)
+{
+    const size_t size = 800 * 1000;
+    char* log = (char*)malloc(size);
+    const size_t length = nmea_log(log, size, 1000);
+
+    test_against_split(log, length);
+    bench_dispatch(log, length, false);
+    bench_dispatch(log, length, true);
+    free(log);
+    return test_result();
+}
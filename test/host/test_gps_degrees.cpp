@@ -0,0 +1,253 @@
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "TinyGPSPlus.h"
+#include "bench.h"
+#include "nmea_log.h"
+#include "test.h"
+
+/* Differential fuzz of the single pass number parsing against the atol based one it replaced */
+
+#define FUZZ_TERMS 2000000
+
+// The parsers as they were before, from upstream TinyGPS++ 1.0.2
+static int32_t
+reference_decimal(const char* term)
+{
+    bool negative = *term == '-';
+    if (negative)
+        ++term;
+    int32_t ret = 100 * (int32_t)atol(term);
+    while (isdigit(*term))
+        ++term;
+    if (*term == '.' && isdigit(term[1])) {
+        ret += 10 * (term[1] - '0');
+        if (isdigit(term[2]))
+            ret += term[2] - '0';
+    }
+    return negative ? -ret : ret;
+}
+
+static void
+reference_degrees(const char* term, RawDegrees& deg)
+{
+    uint32_t leftOfDecimal = (uint32_t)atol(term);
+    uint16_t minutes = (uint16_t)(leftOfDecimal % 100);
+    uint32_t multiplier = 10000000UL;
+    uint32_t tenMillionthsOfMinutes = minutes * multiplier;
+
+    deg.deg = (int16_t)(leftOfDecimal / 100);
+
+    while (isdigit(*term))
+        ++term;
+
+    if (*term == '.')
+        while (isdigit(*++term)) {
+            multiplier /= 10;
+            tenMillionthsOfMinutes += (*term - '0') * multiplier;
+        }
+
+    deg.billionths = (5 * tenMillionthsOfMinutes + 1) / 3;
+    deg.negative = false;
+}
+
+static double
+reference_value(const RawDegrees& raw)
+{
+    double ret = raw.deg + raw.billionths / 1000000000.0;
+    return raw.negative ? -ret : ret;
+}
+
+static uint32_t random_state = 88172645u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static char*
+append_digits(char* p, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        *p++ = (char)('0' + random_next() % 10);
+    }
+    return p;
+}
+
+// Characters a damaged term can continue with, the atol parser stops on all of them
+static const char junk[] = "ABENSWxyz.-+*$ ";
+
+/**
+ * A term as the receiver sends it, [-]digits[.digits], then possibly junk. Leading spaces, a '+'
+ * or a sign where the format has none are left out: atol skipped or accepted them while the
+ * fraction parsing after it did not, those terms never came out consistent.
+ */
+static void
+random_term(char* term, bool is_signed, uint32_t max_whole_digits)
+{
+    char* p = term;
+    if (is_signed && random_next() % 4 == 0) {
+        *p++ = '-';
+    }
+    p = append_digits(p, random_next() % (max_whole_digits + 1));
+    if (random_next() % 8 != 0) {
+        *p++ = '.';
+        p = append_digits(p, random_next() % 13);
+    }
+    if (random_next() % 8 == 0) {
+        if (p == term || p[-1] == '-') {
+            *p++ = '0'; // junk in place of the number is a leading space or sign again
+        }
+        *p++ = junk[random_next() % (sizeof(junk) - 1)];
+        p = append_digits(p, random_next() % 3);
+    }
+    *p = '\0';
+}
+
+static void
+test_decimal_fuzz(void)
+{
+    unsigned differences = 0;
+    char term[40];
+    for (int i = 0; i < FUZZ_TERMS; ++i) {
+        // 7 whole digits keep 100 times the value in an int32, atol overflowed before that
+        random_term(term, true, 7);
+        const int32_t expected = reference_decimal(term);
+        const int32_t parsed = TinyGPSPlus::parseDecimal(term);
+        if (parsed != expected && differences++ < 10) {
+            fprintf(stderr, "parseDecimal(\"%s\") = %d, was %d\n", term, parsed, expected);
+        }
+    }
+    CHECK_MSG(differences == 0, "%u of %d decimal terms differ", differences, FUZZ_TERMS);
+}
+
+static void
+test_degrees_fuzz(void)
+{
+    unsigned differences = 0;
+    unsigned rounding = 0;
+    char term[40];
+    for (int i = 0; i < FUZZ_TERMS; ++i) {
+        random_term(term, false, 9);
+        RawDegrees expected, parsed;
+        reference_degrees(term, expected);
+        TinyGPSPlus::parseDegrees(term, parsed);
+        if ((parsed.deg != expected.deg || parsed.billionths != expected.billionths) && differences++ < 10) {
+            fprintf(stderr,
+                    "parseDegrees(\"%s\") = %u + %u, was %u + %u\n",
+                    term,
+                    parsed.deg,
+                    parsed.billionths,
+                    expected.deg,
+                    expected.billionths);
+        }
+
+        // lat() is now one division of the nano-degrees, rounded once instead of twice
+        parsed.negative = random_next() % 2 == 0;
+        const int64_t nano = (int64_t)parsed.deg * 1000000000 + parsed.billionths;
+        const double value = (parsed.negative ? -nano : nano) / 1e9;
+        const double before = reference_value(parsed);
+        if (value != before) {
+            ++rounding;
+            CHECK_MSG(fabs(value - before) <= fabs(before) * 0x1p-52,
+                      "%s: %.17g, was %.17g",
+                      term,
+                      value,
+                      before);
+        }
+    }
+    CHECK_MSG(differences == 0, "%u of %d coordinate terms differ", differences, FUZZ_TERMS);
+    printf("%-40s %10u of %d\n", "lat() differing by an ulp", rounding, FUZZ_TERMS);
+}
+
+// Coordinates through encode() and the integer accessors, against the reference parse of the same terms
+static void
+test_sentence_fuzz(void)
+{
+    TinyGPSPlus gps;
+    unsigned differences = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const uint32_t lat_e5 = random_next() % 9000000; // DDMM.MMMMM without the point, below 90°
+        const uint32_t lng_e5 = random_next() % 18000000;
+        char lat[24], lng[24];
+        snprintf(lat, sizeof(lat), "%02u%02u.%05u", lat_e5 / 100000, lat_e5 / 1000 % 60, lat_e5 % 1000 * 100);
+        snprintf(lng, sizeof(lng), "%03u%02u.%05u", lng_e5 / 100000, lng_e5 / 1000 % 60, lng_e5 % 1000 * 100);
+        const bool south = random_next() % 2 == 0;
+        const bool west = random_next() % 2 == 0;
+
+        char body[128], sentence[160];
+        snprintf(body,
+                 sizeof(body),
+                 "GNRMC,083015.000,A,%s,%c,%s,%c,0.13,254.61,170623,,,A",
+                 lat,
+                 south ? 'S' : 'N',
+                 lng,
+                 west ? 'W' : 'E');
+        const size_t length = nmea_sentence(sentence, sizeof(sentence), body);
+        CHECK(gps.encode((const uint8_t*)sentence, length) == 1);
+
+        RawDegrees expected_lat, expected_lng;
+        reference_degrees(lat, expected_lat);
+        reference_degrees(lng, expected_lng);
+        expected_lat.negative = south;
+        expected_lng.negative = west;
+        const int64_t lat_nano = gps.location.latNano();
+        const int64_t lng_nano = gps.location.lngNano();
+        const bool same = lat_nano == llround(reference_value(expected_lat) * 1e9)
+                          && lng_nano == llround(reference_value(expected_lng) * 1e9)
+                          && gps.location.lat() == lat_nano / 1e9 && gps.location.lng() == lng_nano / 1e9;
+        if (!same && differences++ < 10) {
+            fprintf(stderr, "%s: %lld %lld\n", sentence, (long long)lat_nano, (long long)lng_nano);
+        }
+    }
+    CHECK_MSG(differences == 0, "%u sentences differ", differences);
+}
+
+static void
+bench_parsing(void)
+{
+    enum { TERMS = 4096, ROUNDS = 500 };
+    static char terms[TERMS][16];
+    for (int i = 0; i < TERMS; ++i) {
+        snprintf(terms[i], sizeof(terms[i]), "%05u.%05u", random_next() % 18000, random_next() % 100000);
+    }
+
+    RawDegrees deg;
+    uint32_t sink = 0;
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (int i = 0; i < TERMS; ++i) {
+            reference_degrees(terms[i], deg);
+            sink += deg.billionths;
+        }
+    }
+    const double reference_seconds = bench_now() - start;
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (int i = 0; i < TERMS; ++i) {
+            TinyGPSPlus::parseDegrees(terms[i], deg);
+            sink -= deg.billionths;
+        }
+    }
+    const double seconds = bench_now() - start;
+    CHECK(sink == 0);
+
+    bench_report("parseDegrees, atol and re-scan", reference_seconds, (double)TERMS * ROUNDS, "term");
+    bench_report("parseDegrees, single pass", seconds, (double)TERMS * ROUNDS, "term");
+}
+
+int
+main(void)
+{
+    test_decimal_fuzz();
+    test_degrees_fuzz();
+    test_sentence_fuzz();
+    bench_parsing();
+    return test_result();
+}
@@ -0,0 +1,188 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "TinyGPSPlus.h"
+#include "bench.h"
+#include "nmea_log.h"
+#include "test.h"
+
+/* The block encode() against the per character one, on clean and damaged NMEA logs */
+
+#define LOG_SECONDS 10000 // about 7 MB
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+// Flipped, dropped and inserted bytes, runs of delimiters and terms longer than the term buffer
+static size_t
+damage(const char* log, size_t length, char* out)
+{
+    size_t written = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t r = random_next() % 2000;
+        if (r == 0) {
+            continue;
+        }
+        if (r == 1) {
+            out[written++] = (char)(random_next() & 0xff);
+        } else if (r == 2) {
+            for (int k = 0; k < 20; ++k) {
+                out[written++] = (char)('0' + k % 10);
+            }
+        } else if (r == 3) {
+            out[written++] = ",*$\r\n"[random_next() % 5];
+        }
+        out[written++] = r == 4 ? (char)(log[i] ^ (1 << (random_next() % 8))) : log[i];
+    }
+    return written;
+}
+
+static bool
+same_state(TinyGPSPlus& a, TinyGPSPlus& b)
+{
+    if (a.charsProcessed() != b.charsProcessed() || a.passedChecksum() != b.passedChecksum()
+        || a.failedChecksum() != b.failedChecksum() || a.sentencesWithFix() != b.sentencesWithFix()) {
+        return false;
+    }
+    if (a.location.isValid() != b.location.isValid() || a.location.latNano() != b.location.latNano()
+        || a.location.lngNano() != b.location.lngNano()) {
+        return false;
+    }
+    for (int s = 0; s < GPS_SYSTEM_COUNT; ++s) {
+        TinyGPSConstellation& ca = a.constellations[s];
+        TinyGPSConstellation& cb = b.constellations[s];
+        if (ca.count() != cb.count() || ca.activeCount() != cb.activeCount()) {
+            return false;
+        }
+        for (uint8_t i = 0; i < ca.count(); ++i) {
+            if (memcmp(&ca.satellite(i), &cb.satellite(i), sizeof(TinyGPSSatellite)) != 0) {
+                return false;
+            }
+        }
+    }
+    return a.time.value() == b.time.value() && a.date.value() == b.date.value()
+           && a.speed.value() == b.speed.value() && a.course.value() == b.course.value()
+           && a.altitude.value() == b.altitude.value() && a.satellites.value() == b.satellites.value()
+           && a.hdop.value() == b.hdop.value() && a.fixMode.value() == b.fixMode.value();
+}
+
+// Random block sizes, so terms, sentences and word boundaries are split everywhere
+static void
+check_equivalence(const char* name, const uint8_t* data, size_t length)
+{
+    TinyGPSPlus per_char;
+    TinyGPSPlus block;
+    unsigned per_char_sentences = 0;
+    unsigned block_sentences = 0;
+    unsigned differences = 0;
+
+    size_t offset = 0;
+    while (offset < length) {
+        size_t size = random_next() % 4 == 0 ? 1 + random_next() % 8 : 1 + random_next() % 512;
+        size = size < length - offset ? size : length - offset;
+        block_sentences += block.encode(data + offset, size);
+        for (size_t i = 0; i < size; ++i) {
+            per_char_sentences += per_char.encode((char)data[offset + i]);
+        }
+        offset += size;
+        if (!same_state(per_char, block) && differences++ < 5) {
+            fprintf(stderr, "%s: state differs after %zu bytes\n", name, offset);
+        }
+    }
+    CHECK_MSG(differences == 0, "%s: %u blocks differ", name, differences);
+    CHECK_MSG(per_char_sentences == block_sentences,
+              "%s: %u sentences per character, %u in blocks",
+              name,
+              per_char_sentences,
+              block_sentences);
+    CHECK(block.charsProcessed() == length);
+}
+
+static void
+test_equivalence(const char* log, size_t length)
+{
+    // Every alignment of the first byte against the word-at-a-time scan
+    uint8_t* aligned = (uint8_t*)malloc(length + 8);
+    for (int alignment = 0; alignment < 4; ++alignment) {
+        memcpy(aligned + alignment, log, length);
+        check_equivalence("clean log", aligned + alignment, length);
+    }
+    free(aligned);
+
+    char* damaged = (char*)malloc(2 * length);
+    const size_t damaged_length = damage(log, length, damaged);
+    check_equivalence("damaged log", (const uint8_t*)damaged, damaged_length);
+    free(damaged);
+
+    // Bytes of every value, delimiters included, mostly without a valid sentence
+    uint8_t noise[1 << 16];
+    for (size_t i = 0; i < sizeof(noise); ++i) {
+        noise[i] = random_next() % 4 == 0 ? (uint8_t)",*$\r\n"[random_next() % 5] : (uint8_t)random_next();
+    }
+    check_equivalence("noise", noise, sizeof(noise));
+}
+
+static void
+test_log_content(const char* log, size_t length)
+{
+    TinyGPSPlus gps;
+    const unsigned sentences = gps.encode((const uint8_t*)log, length);
+    CHECK_MSG(sentences == 13 * LOG_SECONDS, "%u sentences", sentences);
+    CHECK(gps.failedChecksum() == 0);
+    CHECK(gps.location.isValid());
+    // The last second, 11:16:54
+    CHECK_MSG(gps.time.value() == 11165400, "%u", gps.time.value());
+    CHECK(gps.date.value() == 170623);
+}
+
+static void
+bench_throughput(const char* log, size_t length)
+{
+    const int rounds = 5;
+    TinyGPSPlus per_char;
+    double start = bench_now();
+    for (int round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < length; ++i) {
+            per_char.encode(log[i]);
+        }
+    }
+    const double per_char_seconds = bench_now() - start;
+
+    // gps_task hands over what one UART read returned, a few hundred bytes
+    TinyGPSPlus block;
+    start = bench_now();
+    for (int round = 0; round < rounds; ++round) {
+        for (size_t offset = 0; offset < length; offset += 256) {
+            block.encode((const uint8_t*)log + offset, length - offset < 256 ? length - offset : 256);
+        }
+    }
+    const double block_seconds = bench_now() - start;
+    CHECK(per_char.passedChecksum() == block.passedChecksum());
+
+    const double megabytes = (double)length * rounds / 1e6;
+    printf("%-40s %10.1f MB/s\n", "nmea encode, per character", megabytes / per_char_seconds);
+    printf("%-40s %10.1f MB/s\n", "nmea encode, 256 byte blocks", megabytes / block_seconds);
+}
+
+int
+main(void)
+{
+    const size_t size = 800 * LOG_SECONDS;
+    char* log = (char*)malloc(size);
+    const size_t length = nmea_log(log, size, LOG_SECONDS);
+    CHECK(length > 700 * LOG_SECONDS);
+
+    test_log_content(log, length);
+    test_equivalence(log, length / 10);
+    bench_throughput(log, length);
+    free(log);
+    return test_result();
+}
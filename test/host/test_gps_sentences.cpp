@@ -0,0 +1,191 @@
+#include <string.h>
+
+#include "TinyGPSPlus.h"
+#include "nmea_log.h"
+#include "test.h"
+
+/* GSA, GSV, VTG and GLL of every talker, on a multi-GNSS capture and on hand written cases */
+
+static unsigned
+encode_body(TinyGPSPlus& gps, const char* body)
+{
+    char sentence[128];
+    const size_t length = nmea_sentence(sentence, sizeof(sentence), body);
+    return gps.encode((const uint8_t*)sentence, length);
+}
+
+static void
+check_satellite(TinyGPSConstellation& constellation,
+                uint8_t index,
+                uint16_t prn,
+                uint8_t elevation,
+                uint16_t azimuth,
+                uint8_t snr,
+                bool active)
+{
+    const TinyGPSSatellite& sat = constellation.satellite(index);
+    CHECK_MSG(sat.prn == prn && sat.elevation == elevation && sat.azimuth == azimuth && sat.snr == snr
+                && sat.active == active,
+              "satellite %u: %u %u %u %u %d",
+              index,
+              sat.prn,
+              sat.elevation,
+              sat.azimuth,
+              sat.snr,
+              sat.active);
+}
+
+// One second of the AT6558, GPS and BeiDou satellites in GP and BD sentences, the fix in GN ones
+static void
+test_capture(void)
+{
+    char log[1024];
+    const size_t length = nmea_log(log, sizeof(log), 1);
+    TinyGPSPlus gps;
+    CHECK(gps.encode((const uint8_t*)log, length) == 13);
+    CHECK(gps.failedChecksum() == 0);
+
+    TinyGPSConstellation& gp = gps.constellations[GPS_SYSTEM_GPS];
+    CHECK(gp.isValid() && gp.inView() == 10 && gp.count() == 10 && gp.activeCount() == 6);
+    check_satellite(gp, 0, 2, 45, 189, 30, true);
+    check_satellite(gp, 4, 18, 11, 76, 0, false);
+    check_satellite(gp, 7, 26, 3, 40, 0, false);
+    check_satellite(gp, 8, 29, 71, 311, 44, true);
+    check_satellite(gp, 9, 30, 8, 261, 22, false);
+
+    TinyGPSConstellation& bd = gps.constellations[GPS_SYSTEM_BEIDOU];
+    CHECK(bd.isValid() && bd.inView() == 7 && bd.count() == 7 && bd.activeCount() == 5);
+    check_satellite(bd, 3, 13, 51, 301, 33, true);
+    check_satellite(bd, 5, 19, 14, 84, 0, false);
+    check_satellite(bd, 6, 21, 22, 145, 28, false);
+
+    CHECK(!gps.constellations[GPS_SYSTEM_GLONASS].isValid());
+    CHECK(!gps.constellations[GPS_SYSTEM_GALILEO].isValid());
+    CHECK(gps.fixMode.value() == 3 && gps.pdop.value() == 160 && gps.hdop.value() == 90
+          && gps.vdop.value() == 130);
+    CHECK(gps.speed.value() == 291 && gps.course.value() == 3687);
+    CHECK(gps.location.latNano() == 31846370000LL && gps.location.lngNano() == 117198828333LL);
+}
+
+// A mixed GN receiver: the system comes from the NMEA 4.1 system ID, or from the satellite numbers
+static void
+test_combined_talker(void)
+{
+    TinyGPSPlus gps;
+    CHECK(encode_body(gps, "GNGSA,A,3,65,71,72,,,,,,,,,,1.8,1.0,1.5,2") == 1);
+    CHECK(encode_body(gps, "GNGSA,A,3,201,204,,,,,,,,,,,1.8,1.0,1.5") == 1);
+    CHECK(encode_body(gps, "GLGSV,1,1,03,65,40,100,33,71,20,200,,72,60,300,41,1") == 1);
+    CHECK(encode_body(gps, "GNGSV,1,1,02,201,50,010,35,204,30,020,29") == 1);
+
+    TinyGPSConstellation& gl = gps.constellations[GPS_SYSTEM_GLONASS];
+    CHECK(gl.count() == 3 && gl.activeCount() == 3);
+    check_satellite(gl, 0, 65, 40, 100, 33, true);
+    check_satellite(gl, 2, 72, 60, 300, 41, true);
+    TinyGPSConstellation& bd = gps.constellations[GPS_SYSTEM_BEIDOU];
+    CHECK(bd.count() == 2 && bd.activeCount() == 2);
+    check_satellite(bd, 1, 204, 30, 20, 29, true);
+    CHECK(!gps.constellations[GPS_SYSTEM_GPS].isValid());
+}
+
+// A group only replaces the satellites once all its messages arrived in order
+static void
+test_incomplete_group(void)
+{
+    TinyGPSPlus gps;
+    TinyGPSConstellation& gp = gps.constellations[GPS_SYSTEM_GPS];
+    encode_body(gps, "GPGSV,2,1,05,01,10,100,20,02,20,200,30,03,30,300,40,04,40,040,45");
+    CHECK(!gp.isValid());
+    encode_body(gps, "GPGSV,2,2,05,05,50,050,50");
+    CHECK(gp.isValid() && gp.count() == 5 && gp.inView() == 5);
+
+    // The second message is lost
+    encode_body(gps, "GPGSV,3,1,09,11,10,100,20,12,20,200,30,13,30,300,40,14,40,040,45");
+    encode_body(gps, "GPGSV,3,3,09,19,50,050,50");
+    CHECK(gp.count() == 5 && gp.satellite(0).prn == 1);
+
+    // More satellites than the table holds are dropped, the announced count stays
+    const char* group[] = {
+        "GPGSV,7,1,28,01,10,001,11,02,10,002,12,03,10,003,13,04,10,004,14",
+        "GPGSV,7,2,28,05,10,005,15,06,10,006,16,07,10,007,17,08,10,008,18",
+        "GPGSV,7,3,28,09,10,009,19,10,10,010,20,11,10,011,21,12,10,012,22",
+        "GPGSV,7,4,28,13,10,013,23,14,10,014,24,15,10,015,25,16,10,016,26",
+        "GPGSV,7,5,28,17,10,017,27,18,10,018,28,19,10,019,29,20,10,020,30",
+        "GPGSV,7,6,28,21,10,021,31,22,10,022,32,23,10,023,33,24,10,024,34",
+        "GPGSV,7,7,28,25,10,025,35,26,10,026,36,27,10,027,37,28,10,028,38",
+    };
+    for (size_t i = 0; i < sizeof(group) / sizeof(group[0]); ++i) {
+        encode_body(gps, group[i]);
+    }
+    CHECK(gp.inView() == 28 && gp.count() == _GPS_MAX_SATELLITES);
+    check_satellite(gp, _GPS_MAX_SATELLITES - 1, 24, 10, 24, 34, false);
+}
+
+static void
+test_vtg_gll(void)
+{
+    TinyGPSPlus gps;
+    // GLL alone gives a position and time, but not when its status is void
+    CHECK(encode_body(gps, "GLGLL,4717.11399,N,00833.91590,E,092321.00,A,A") == 1);
+    CHECK(gps.location.isValid() && gps.time.value() == 9232100);
+    CHECK(gps.location.latNano() == 47285233167LL && gps.location.lngNano() == 8565265000LL);
+    CHECK(encode_body(gps, "GBGLL,4800.00000,N,00900.00000,E,092322.00,V,N") == 1);
+    CHECK(!gps.location.isUpdated() && gps.location.latNano() == 47285233167LL);
+    CHECK(gps.time.value() == 9232200);
+
+    // VTG of NMEA 2.3 with its mode, and an older one without
+    CHECK(encode_body(gps, "GNVTG,77.52,T,,M,0.004,N,0.008,K,A") == 1);
+    CHECK(gps.speed.value() == 0 && gps.course.value() == 7752);
+    CHECK(encode_body(gps, "GPVTG,054.7,T,034.4,M,005.5,N,010.2,K") == 1);
+    CHECK(gps.speed.value() == 550 && gps.course.value() == 5470);
+    CHECK(encode_body(gps, "GAVTG,,T,,M,,N,,K,N") == 1);
+    CHECK(!gps.speed.isUpdated() && gps.speed.value() == 550);
+    CHECK(gps.sentencesWithFix() == 3);
+}
+
+/**
+ * Every formatter of three capital letters behind every talker. Each sentence type parsed commits
+ * at least one of these on the terms below, all others none of them, so a collision of the perfect
+ * hash would show.
+ */
+static void
+test_sentence_hash(void)
+{
+    static const char* talkers[] = { "GP", "GL", "GA", "GB", "BD", "GQ", "QZ", "GN", "XX" };
+    static const char* parsed[] = { "GGA", "RMC", "GSA", "GSV", "VTG", "GLL" };
+    unsigned wrong = 0;
+    for (size_t t = 0; t < sizeof(talkers) / sizeof(talkers[0]); ++t) {
+        for (int formatter = 0; formatter < 26 * 26 * 26; ++formatter) {
+            const char name[4] = {
+                (char)('A' + formatter / 676), (char)('A' + formatter / 26 % 26), (char)('A' + formatter % 26)
+            };
+            char body[96];
+            snprintf(body, sizeof(body), "%s%s,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1", talkers[t], name);
+
+            TinyGPSPlus gps;
+            CHECK(encode_body(gps, body) == 1);
+            bool updated = gps.time.isUpdated() || gps.fixMode.isUpdated() || gps.speed.isUpdated();
+            for (int s = 0; s < GPS_SYSTEM_COUNT; ++s) {
+                updated = updated || gps.constellations[s].isUpdated();
+            }
+            bool expected = false;
+            for (size_t p = 0; p < sizeof(parsed) / sizeof(parsed[0]); ++p) {
+                expected = expected || memcmp(name, parsed[p], 3) == 0;
+            }
+            if (updated != expected && wrong++ < 10) {
+                fprintf(stderr, "%s: parsed %d\n", body, updated);
+            }
+        }
+    }
+    CHECK_MSG(wrong == 0, "%u sentence types misidentified", wrong);
+}
+
+int
+main(void)
+{
+    test_capture();
+    test_combined_talker();
+    test_incomplete_group();
+    test_vtg_gll();
+    test_sentence_hash();
+    return test_result();
+}
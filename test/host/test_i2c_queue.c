@@ -0,0 +1,209 @@
+#include <string.h>
+
+#include "env3_sensors.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_port_a.h"
+#include "scheduler.h"
+#include "test.h"
+#include "tof_vl53lox.h"
+
+/* The ENV III and VL53L0X conversions of one env3 cycle on the simulated bus, blocking and queued */
+
+// Typical conversion times from the datasheets, the drivers wait for the maximum
+#define SHT3X_CONVERSION_US 12500
+#define VL53L0X_RANGING_US 33000
+
+static uint8_t
+sht3x_crc(const uint8_t* data)
+{
+    uint8_t crc = 0xff;
+    for (int i = 0; i < 2; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = crc & 0x80 ? (uint8_t)(crc << 1) ^ 0x31 : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+typedef struct ConvertingDevice
+{
+    int64_t ready_us; // 0 while idle
+} ConvertingDevice;
+
+static esp_err_t
+sht3x_write(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    ConvertingDevice* sht3x = device->context;
+    if (length == 2 && data[0] == 0x2c && data[1] == 0x06) {
+        sht3x->ready_us = esp_timer_get_time() + SHT3X_CONVERSION_US;
+    }
+    return ESP_OK;
+}
+
+// Without clock stretching the sensor NACKs reads until the conversion is done
+static esp_err_t
+sht3x_read(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    ConvertingDevice* sht3x = device->context;
+    if (sht3x->ready_us == 0 || esp_timer_get_time() < sht3x->ready_us || length != 6) {
+        return ESP_FAIL;
+    }
+    sht3x->ready_us = 0;
+    // 23.5 °C and 45 %RH
+    const uint16_t temperature = (uint16_t)((23.5 + 45) * 65535 / 175 + 0.5);
+    const uint16_t humidity = (uint16_t)(45.0 * 65535 / 100 + 0.5);
+    data[0] = temperature >> 8;
+    data[1] = (uint8_t)temperature;
+    data[2] = sht3x_crc(&data[0]);
+    data[3] = humidity >> 8;
+    data[4] = (uint8_t)humidity;
+    data[5] = sht3x_crc(&data[3]);
+    return ESP_OK;
+}
+
+static esp_err_t
+vl53l0x_write(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    ConvertingDevice* tof = device->context;
+    if (register_address == 0x00 && length == 1 && data[0] == 0x01) {
+        tof->ready_us = esp_timer_get_time() + VL53L0X_RANGING_US;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t
+vl53l0x_read(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    ConvertingDevice* tof = device->context;
+    memset(data, 0, length);
+    if (register_address != 0x14 || tof->ready_us == 0 || esp_timer_get_time() < tof->ready_us) {
+        return ESP_OK; // not ready, bit 0 of the status is clear
+    }
+    data[0] = 11 << 3 | 0x01; // range valid
+    if (length == 12) {
+        data[10] = 300 >> 8; // 300 mm
+        data[11] = 300 & 0xff;
+    }
+    return ESP_OK;
+}
+
+static ConvertingDevice sht3x_state;
+static ConvertingDevice tof_state;
+static HostI2cDevice sht3x = {
+    .address = 0x44, .read = sht3x_read, .write = sht3x_write, .context = &sht3x_state,
+};
+static HostI2cDevice tof = {
+    .address = 0x29, .read = vl53l0x_read, .write = vl53l0x_write, .context = &tof_state,
+};
+static HostI2cDevice qmp6988 = { .address = 0x70 };
+
+static void
+attach_devices(void)
+{
+    // An OTP block with every coefficient at its typical value, and 1013 hPa at 25 °C
+    static const uint8_t otp[25] = { [0] = 0x02, [1] = 0x6e, [18] = 0x03, [19] = 0x13 };
+    memcpy(&qmp6988.registers[0xa0], otp, sizeof(otp));
+    qmp6988.registers[0xd1] = 0x5c;
+    static const uint8_t conversion[6] = { 0x7c, 0x00, 0x00, 0x8a, 0x00, 0x00 };
+    memcpy(&qmp6988.registers[0xf7], conversion, sizeof(conversion));
+
+    host_port_a_attach(&sht3x);
+    host_port_a_attach(&tof);
+    host_port_a_attach(&qmp6988);
+}
+
+typedef struct Cycle
+{
+    SHT3xRequest sht3x;
+    QMP6988Request qmp6988;
+    TofVl53loxRequest tof;
+    int pending;
+    int64_t started_us;
+    int64_t done_us;
+} Cycle;
+
+static Cycle cycle;
+static I2CDevice_t sht3x_device;
+static I2CDevice_t qmp6988_device;
+static I2CDevice_t tof_device;
+
+static void
+request_done(void* context)
+{
+    Cycle* done = context;
+    if (--done->pending == 0) {
+        done->done_us = esp_timer_get_time();
+    }
+}
+
+static void
+cycle_run(void* context)
+{
+    cycle.pending = 3;
+    cycle.started_us = esp_timer_get_time();
+    SHT3x_start_measurement(&cycle.sht3x, sht3x_device, request_done, &cycle);
+    QMP6988_start_read(&cycle.qmp6988, qmp6988_device, request_done, &cycle);
+    TofVl53lox_start_reading(&cycle.tof, tof_device, request_done, &cycle);
+}
+
+static SchedulerJob cycle_job = { .name = "env3", .run = cycle_run };
+
+static void
+test_cycle_time(void)
+{
+    attach_devices();
+    qmp6988_device = QMP6988_deviceCheck();
+    CHECK(qmp6988_device != NULL);
+    sht3x_device = Core2ForAWS_Port_A_I2C_Begin(SHT3x_DEVICE_ADDRESS, PORT_A_I2C_STANDARD_BAUD);
+    tof_device = TofVl53lox_Init();
+    host_port_a_take_stats();
+
+    // One conversion after the other, each waiting for its sensor
+    int64_t start = esp_timer_get_time();
+    const SHT3xMeasurement blocking_sht3x = SHT3x_get_measurement(sht3x_device);
+    const float blocking_pressure = QMP6988_calcPressure(qmp6988_device);
+    const uint16_t blocking_distance = TofVl53lox_get_reading(tof_device);
+    const int64_t blocking_us = esp_timer_get_time() - start;
+    const HostPortAStats blocking_bus = host_port_a_take_stats();
+
+    // All three submitted together, their waits overlap
+    scheduler_add(&cycle_job, 0);
+    host_task_stop_us = esp_timer_get_time() + 1000000;
+    scheduler_start();
+    host_tasks_run();
+    const int64_t queued_us = cycle.done_us - cycle.started_us;
+    const HostPortAStats queued_bus = host_port_a_take_stats();
+
+    CHECK(cycle.pending == 0);
+    CHECK(cycle.sht3x.is_valid && cycle.qmp6988.is_valid && cycle.tof.distance == 300);
+    CHECK(blocking_distance == 300);
+    CHECK(cycle.sht3x.measurement.temperature == blocking_sht3x.temperature);
+    CHECK(cycle.sht3x.measurement.humidity == blocking_sht3x.humidity);
+    CHECK(cycle.qmp6988.pressure == blocking_pressure);
+    CHECK(blocking_sht3x.temperature > 23.49f && blocking_sht3x.temperature < 23.51f);
+
+    printf("%-24s %8.1f ms, %2u transfers, bus busy %.1f ms\n",
+           "blocking env3 cycle",
+           blocking_us / 1000.0,
+           blocking_bus.transfers,
+           blocking_bus.busy_us / 1000.0);
+    printf("%-24s %8.1f ms, %2u transfers, bus busy %.1f ms\n",
+           "queued env3 cycle",
+           queued_us / 1000.0,
+           queued_bus.transfers,
+           queued_bus.busy_us / 1000.0);
+
+    // The slowest conversion and its polling, instead of the sum of all waits
+    CHECK(blocking_us > 200000 + VL53L0X_RANGING_US);
+    CHECK_MSG(queued_us < VL53L0X_RANGING_US + 15000, "%lld us", (long long)queued_us);
+    CHECK(queued_bus.failed == 0);
+}
+
+int
+main(void)
+{
+    test_cycle_time();
+    return test_result();
+}
@@ -0,0 +1,526 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "esp_timer.h"
+#include "gps.h"
+#include "kalman.h"
+#include "nav.h"
+#include "scheduler.h"
+#include "test.h"
+
+/* The Kalman filter of kalman.h, and nav.cpp replaying simulated drives of GPS fixes and MPU6886 readings */
+
+#define STEP_US 20000 // the 50 Hz of the nav job
+#define GRAVITY 9.80665
+#define METERS_PER_E7 (6372795.0 * M_PI / 180.0 / 1e7)
+#define ORIGIN_LAT_E7 318463700
+#define ORIGIN_LNG_E7 1171988283
+#define GPS_HORIZONTAL_SIGMA 3.0 // as nav.cpp assumes
+#define GPS_VERTICAL_SIGMA 6.0
+#define ACCEL_NOISE 0.005 // g, white noise of each MPU6886 axis
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static double
+random_uniform(void)
+{
+    return (random_next() + 0.5) / 4294967296.0;
+}
+
+static double
+random_gaussian(void)
+{
+    return sqrt(-2 * log(random_uniform())) * cos(2 * M_PI * random_uniform());
+}
+
+// What nav.cpp reads from the rest of the firmware
+static float accel_reading[3];
+static GpsPosition latest_fix;
+static uint32_t fix_sequence; // bumped with every fix, as the GPS snapshot does
+static SchedulerJob* nav_job;
+
+// Of the fixes in the phases that have them: how many a second, and whether they carry the time
+static int fixes_per_second = 1;
+static bool fixes_have_time = true;
+
+void
+MPU6886_GetAccelData(float* ax, float* ay, float* az)
+{
+    *ax = accel_reading[0];
+    *ay = accel_reading[1];
+    *az = accel_reading[2];
+}
+
+uint32_t
+read_latest_gps_position(GpsPosition* position)
+{
+    *position = latest_fix;
+    return fix_sequence;
+}
+
+void
+scheduler_add(SchedulerJob* job, uint32_t delay_ms)
+{
+    nav_job = job;
+}
+
+/**
+ * One part of a drive: the vehicle speeds up or slows down to `speed` at up to 2 m/s^2, turns
+ * at `turn_rate` and climbs at `climb`. The device is tilted `tilt` away from its mount, as
+ * when it is picked up, and turns into the tilt within a second.
+ */
+typedef struct
+{
+    double seconds;
+    double speed;     // m/s
+    double turn_rate; // rad/s
+    double climb;     // m/s
+    double tilt;      // rad
+    bool fixes;       // fixes_per_second of them, none for an outage
+} Phase;
+
+typedef struct
+{
+    double horizontal_rms; // meters, of the estimate
+    double vertical_rms;
+    double vertical_max;
+    double fix_horizontal_rms; // of the fixes themselves
+    double fix_vertical_rms;
+    double final_speed;       // m/s, of the estimate as the phase ends
+    bool final_stationary;
+    double stationary;        // share of the steps reported stationary
+    double valid;             // share of the steps with a valid state
+} PhaseErrors;
+
+// Rotation of `v` by `angle` around `axis` (0, 1, 2 for x, y, z)
+static void
+rotate(double* v, int axis, double angle)
+{
+    const int a = (axis + 1) % 3;
+    const int b = (axis + 2) % 3;
+    const double va = v[a] * cos(angle) - v[b] * sin(angle);
+    const double vb = v[a] * sin(angle) + v[b] * cos(angle);
+    v[a] = va;
+    v[b] = vb;
+}
+
+/**
+ * Drives through the phases from rest at the origin and runs the nav job every 20 ms on what
+ * the MPU6886 and the receiver would report. The device sits in the vehicle at an angle and
+ * turns with it, so no axis of it stays north, east or up. The estimate is compared with the
+ * true position at every step once the first `settle_s` seconds are over.
+ */
+static void
+replay(const Phase* phases, size_t count, double settle_s, PhaseErrors* errors)
+{
+    static const double bias[3] = { 0.004, -0.003, 0.002 }; // g
+    double position[3] = { 0, 0, 0 }; // north, east, up in meters
+    double velocity[3] = { 0, 0, 0 };
+    double heading = 0.3;
+    double tilt = 0;
+    double elapsed = 0;
+    latest_fix.is_valid = false;
+
+    for (size_t p = 0; p < count; ++p) {
+        const Phase* phase = &phases[p];
+        PhaseErrors* e = &errors[p];
+        memset(e, 0, sizeof(*e));
+        unsigned steps = 0;
+        unsigned fixes = 0;
+        const int total_steps = (int)(phase->seconds * 1e6 / STEP_US);
+        for (int step = 0; step < total_steps; ++step) {
+            const double dt = STEP_US * 1e-6;
+            const double speed = sqrt(velocity[0] * velocity[0] + velocity[1] * velocity[1]);
+            const double speed_change = fmax(fmin(phase->speed - speed, 2 * dt), -2 * dt);
+            const double new_speed = speed + speed_change;
+            heading += phase->turn_rate * dt;
+            const double climb_change = fmax(fmin(phase->climb - velocity[2], 0.5 * dt), -0.5 * dt);
+            const double new_velocity[3] = { new_speed * cos(heading),
+                                             new_speed * sin(heading),
+                                             velocity[2] + climb_change };
+            double specific_force[3];
+            for (int i = 0; i < 3; ++i) {
+                specific_force[i] = (new_velocity[i] - velocity[i]) / dt / GRAVITY;
+                position[i] += 0.5 * (velocity[i] + new_velocity[i]) * dt;
+                velocity[i] = new_velocity[i];
+            }
+            specific_force[2] += 1.0;
+
+            // Into the device: vehicle heading, then the mount, then the tilt of the moment
+            tilt += fmax(fmin(phase->tilt - tilt, dt), -dt);
+            rotate(specific_force, 2, -heading);
+            rotate(specific_force, 0, 0.35);
+            rotate(specific_force, 1, -0.6 + tilt);
+            for (int i = 0; i < 3; ++i) {
+                accel_reading[i] = (float)(specific_force[i] + bias[i] + ACCEL_NOISE * random_gaussian());
+            }
+
+            host_time_us += STEP_US;
+            elapsed += dt;
+            if (phase->fixes && host_time_us % (1000000 / fixes_per_second) == 0) {
+                const double north = position[0] + GPS_HORIZONTAL_SIGMA * random_gaussian();
+                const double east = position[1] + GPS_HORIZONTAL_SIGMA * random_gaussian();
+                const double up = position[2] + GPS_VERTICAL_SIGMA * random_gaussian();
+                latest_fix.latitude_e7 = ORIGIN_LAT_E7 + (int32_t)lround(north / METERS_PER_E7);
+                latest_fix.longitude_e7 =
+                  ORIGIN_LNG_E7
+                  + (int32_t)lround(east / (METERS_PER_E7 * cos(latest_fix.latitude_e7 * 1e-7 * M_PI / 180)));
+                latest_fix.altitude_cm = (int32_t)lround(up * 100);
+                latest_fix.unix_time = fixes_have_time ? (uint32_t)(1686990615 + host_time_us / 1000000) : 0;
+                latest_fix.is_valid = true;
+                ++fix_sequence;
+                if (elapsed >= settle_s) {
+                    e->fix_horizontal_rms += (north - position[0]) * (north - position[0]) +
+                                             (east - position[1]) * (east - position[1]);
+                    e->fix_vertical_rms += (up - position[2]) * (up - position[2]);
+                    ++fixes;
+                }
+            }
+            nav_job->run(nav_job->context);
+
+            const NavState state = get_latest_nav_state();
+            if (elapsed < settle_s) {
+                continue;
+            }
+            ++steps;
+            e->valid += state.is_valid;
+            if (!state.is_valid) {
+                continue;
+            }
+            const double lat = ORIGIN_LAT_E7 + position[0] / METERS_PER_E7;
+            const double north_error = (state.latitude_e7 - lat) * METERS_PER_E7;
+            const double meters_per_longitude_e7 = METERS_PER_E7 * cos(lat * 1e-7 * M_PI / 180);
+            const double east_error =
+              (state.longitude_e7 - ORIGIN_LNG_E7) * meters_per_longitude_e7 - position[1];
+            const double up_error = state.altitude_cm * 0.01 - position[2];
+            e->horizontal_rms += north_error * north_error + east_error * east_error;
+            e->vertical_rms += up_error * up_error;
+            e->vertical_max = fmax(e->vertical_max, fabs(up_error));
+            e->stationary += state.is_stationary;
+            e->final_speed =
+              sqrt(state.velocity_north * state.velocity_north + state.velocity_east * state.velocity_east);
+            e->final_stationary = state.is_stationary;
+        }
+        const double valid_steps = e->valid > 0 ? e->valid : 1;
+        e->horizontal_rms = sqrt(e->horizontal_rms / valid_steps);
+        e->vertical_rms = sqrt(e->vertical_rms / valid_steps);
+        e->stationary /= valid_steps;
+        e->valid /= steps > 0 ? steps : 1;
+        e->fix_horizontal_rms = sqrt(e->fix_horizontal_rms / (fixes > 0 ? fixes : 1));
+        e->fix_vertical_rms = sqrt(e->fix_vertical_rms / (fixes > 0 ? fixes : 1));
+    }
+}
+
+// RMS over phases, weighted by their length
+static void
+overall(const Phase* phases, const PhaseErrors* errors, size_t count, PhaseErrors* total)
+{
+    double seconds = 0;
+    memset(total, 0, sizeof(*total));
+    for (size_t p = 0; p < count; ++p) {
+        const double s = phases[p].seconds;
+        total->horizontal_rms += errors[p].horizontal_rms * errors[p].horizontal_rms * s;
+        total->vertical_rms += errors[p].vertical_rms * errors[p].vertical_rms * s;
+        total->fix_horizontal_rms += errors[p].fix_horizontal_rms * errors[p].fix_horizontal_rms * s;
+        total->fix_vertical_rms += errors[p].fix_vertical_rms * errors[p].fix_vertical_rms * s;
+        total->vertical_max = fmax(total->vertical_max, errors[p].vertical_max);
+        seconds += s;
+    }
+    total->horizontal_rms = sqrt(total->horizontal_rms / seconds);
+    total->vertical_rms = sqrt(total->vertical_rms / seconds);
+    total->fix_horizontal_rms = sqrt(total->fix_horizontal_rms / seconds);
+    total->fix_vertical_rms = sqrt(total->fix_vertical_rms / seconds);
+}
+
+// Every drive starts after fixes have been missing for longer than the estimator waits for them
+static void
+start_drive(void)
+{
+    const Phase rest = { 30, 0, 0, 0, 0, false };
+    PhaseErrors errors;
+    replay(&rest, 1, 0, &errors);
+}
+
+/**
+ * 20 minutes through town and over hills, with turns, stops at lights and a stretch of highway
+ * that takes the estimate far enough from where it started to move the local frame. The
+ * estimate has to be closer to the truth than the fixes, and stand still at the end of stops.
+ */
+static void
+test_drive(void)
+{
+    static const Phase phases[] = {
+        { 30, 0, 0, 0, 0, true },       { 40, 12, 0, 0.5, 0, true },      { 6.3, 8, -0.25, 0, 0, true },
+        { 45, 14, 0, -0.6, 0, true },   { 40, 0, 0, 0, 0, true },         { 6.3, 8, 0.25, 0, 0, true },
+        { 60, 15, 0, 1.0, 0, true },    { 20, 15, 0.04, 0, 0, true },     { 40, 15, 0, -1.0, 0, true },
+        { 20, 20, 0.05, 0.3, 0, true }, { 400, 30, 0, 0.2, 0, true },     { 20, 30, 0.02, 0, 0, true },
+        { 150, 28, 0, -0.5, 0, true },  { 15, 12, -0.08, 0, 0, true },    { 40, 0, 0, 0, 0, true },
+        { 30, 13, 0, 0, 0, true },      { 6.3, 8, 0.25, 0, 0, true },     { 60, 13, 0, 0.3, 0, true },
+        { 6.3, 8, -0.25, 0, 0, true },  { 60, 10, 0, -0.3, 0, true },     { 45, 0, 0, 0, 0, true },
+    };
+    const size_t count = sizeof(phases) / sizeof(phases[0]);
+    PhaseErrors errors[count];
+    start_drive();
+    replay(phases, count, 5, errors);
+
+    PhaseErrors total;
+    overall(phases, errors, count, &total);
+    CHECK_MSG(total.horizontal_rms < 0.8 * total.fix_horizontal_rms,
+              "horizontal error %.2f m, fixes %.2f m",
+              total.horizontal_rms,
+              total.fix_horizontal_rms);
+    CHECK_MSG(total.vertical_rms < 0.5 * total.fix_vertical_rms,
+              "vertical error %.2f m, fixes %.2f m",
+              total.vertical_rms,
+              total.fix_vertical_rms);
+    for (size_t p = 0; p < count; ++p) {
+        CHECK(errors[p].valid == 1.0);
+        if (phases[p].speed == 0) {
+            CHECK_MSG(errors[p].final_stationary && errors[p].final_speed < 0.3,
+                      "stop %zu: %s at %.2f m/s",
+                      p,
+                      errors[p].final_stationary ? "stationary" : "moving",
+                      errors[p].final_speed);
+        } else {
+            CHECK(errors[p].stationary == 0);
+        }
+    }
+    printf("%-40s %10.2f m, fixes %.2f m\n", "nav horizontal error, 20 min drive", total.horizontal_rms,
+           total.fix_horizontal_rms);
+    printf("%-40s %10.2f m, fixes %.2f m\n", "nav vertical error, 20 min drive", total.vertical_rms,
+           total.fix_vertical_rms);
+}
+
+/**
+ * The device picked up and held at an angle while driving on the flat, then put back. The
+ * slowly tracked gravity lags behind the tilt, and until it caught up the projection onto it is
+ * no vertical acceleration: the altitude must stay as close as the fixes keep it.
+ */
+static void
+test_handling(void)
+{
+    static const Phase phases[] = {
+        { 60, 15, 0, 0, 0, true },
+        { 30, 15, 0.02, 0, 0.5, true },
+        { 30, 15, -0.02, 0, 0.5, true },
+        { 30, 15, 0, 0, -0.3, true },
+        { 60, 15, 0, 0, 0, true },
+    };
+    const size_t count = sizeof(phases) / sizeof(phases[0]);
+    PhaseErrors errors[count];
+    start_drive();
+    replay(phases, count, 0, errors);
+
+    for (size_t p = 1; p < count; ++p) {
+        CHECK_MSG(errors[p].vertical_rms < 0.6 * GPS_VERTICAL_SIGMA &&
+                    errors[p].vertical_max < 2 * GPS_VERTICAL_SIGMA,
+                  "phase %zu: vertical error %.2f m, up to %.2f m",
+                  p,
+                  errors[p].vertical_rms,
+                  errors[p].vertical_max);
+        CHECK(errors[p].horizontal_rms < errors[p].fix_horizontal_rms);
+    }
+    PhaseErrors total;
+    overall(phases + 1, errors + 1, count - 1, &total);
+    printf("%-40s %10.2f m, up to %.2f m\n", "nav vertical error, device handled", total.vertical_rms,
+           total.vertical_max);
+}
+
+/**
+ * Without fixes the state turns invalid after 5 seconds, the next fix starts over from it. The
+ * vehicle cruises on, which the accelerometer cannot tell from standing: the zero velocity of
+ * the restarted filter must not be taken for a stop.
+ */
+static void
+test_outage(void)
+{
+    static const Phase phases[] = {
+        { 60, 15, 0.01, 0, 0, true },  { 4, 15, 0.01, 0, 0, false }, { 10, 15, 0.01, 0, 0, false },
+        { 10, 15, 0.01, 0, 0, true },  { 30, 15, 0.01, 0, 0, true },
+    };
+    PhaseErrors errors[5];
+    start_drive();
+    replay(phases, 5, 0, errors);
+    CHECK(errors[1].valid == 1.0);
+    CHECK(errors[2].valid < 0.1);
+    CHECK(errors[3].valid > 0.9 && errors[3].stationary == 0);
+    CHECK_MSG(errors[4].horizontal_rms < errors[4].fix_horizontal_rms,
+              "after the outage: horizontal error %.2f m, fixes %.2f m",
+              errors[4].horizontal_rms,
+              errors[4].fix_horizontal_rms);
+}
+
+/**
+ * Before it has the date the receiver reports fixes with no time, and it may report several a
+ * second that share one. Each of them has to reach the filter: 5 timeless fixes a second start
+ * it after an outage and keep it valid, and with five times the fixes the estimate gets closer
+ * to the truth than it does at one.
+ */
+static void
+test_fix_rate(void)
+{
+    static const Phase phases[] = {
+        { 60, 15, 0.01, 0, 0, true },
+        { 60, 15, 0.01, 0, 0, true },
+    };
+    PhaseErrors slow[2], fast[2];
+    start_drive();
+    replay(phases, 2, 0, slow);
+
+    fixes_per_second = 5;
+    fixes_have_time = false;
+    start_drive();
+    replay(phases, 2, 0, fast);
+    fixes_per_second = 1;
+    fixes_have_time = true;
+
+    CHECK_MSG(fast[0].valid > 0.95 && fast[1].valid == 1.0,
+              "valid for %.2f, then %.2f of the steps",
+              fast[0].valid,
+              fast[1].valid);
+    CHECK_MSG(fast[1].horizontal_rms < slow[1].horizontal_rms,
+              "horizontal error %.2f m at 5 fixes a second, %.2f m at 1",
+              fast[1].horizontal_rms,
+              slow[1].horizontal_rms);
+}
+
+// Gauss-Jordan inversion against the identity, and singular matrices refused
+static void
+test_invert(void)
+{
+    double worst = 0;
+    for (int round = 0; round < 1000; ++round) {
+        // B B' + I is symmetric positive definite like the innovation covariance
+        Matrix<6, 6> b;
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                b(r, c) = (float)(random_uniform() * 4 - 2);
+            }
+        }
+        const Matrix<6, 6> a = b * b.transposed() + Matrix<6, 6>::identity();
+        Matrix<6, 6> inverse;
+        CHECK(invert(a, &inverse));
+        const Matrix<6, 6> product = a * inverse;
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                worst = fmax(worst, fabs(product(r, c) - (r == c ? 1.0 : 0.0)));
+            }
+        }
+    }
+    CHECK_MSG(worst < 1e-3, "A A^-1 is off the identity by %g", worst);
+
+    Matrix<3, 3> singular = Matrix<3, 3>::zero();
+    singular(0, 0) = 1;
+    singular(1, 1) = 2;
+    Matrix<3, 3> inverse = Matrix<3, 3>::identity();
+    CHECK(!invert(singular, &inverse) && inverse(2, 2) == 1);
+}
+
+/**
+ * A constant velocity filter on noisy positions against the textbook equations in double.
+ * The Joseph form update is equivalent, single precision must stay close to it.
+ */
+static void
+test_filter_reference(void)
+{
+    KalmanFilter<2> filter;
+    filter.x = Matrix<2, 1>::zero();
+    filter.P = Matrix<2, 2>::identity();
+    filter.P(0, 0) = filter.P(1, 1) = 100;
+    double x[2] = { 0, 0 };
+    double P[2][2] = { { 100, 0 }, { 0, 100 } };
+
+    const double dt = 0.1, q = 0.5, r = 4;
+    Matrix<2, 2> F = Matrix<2, 2>::identity();
+    F(0, 1) = (float)dt;
+    Matrix<2, 2> Q;
+    Q(0, 0) = (float)(dt * dt * dt * dt / 4 * q);
+    Q(0, 1) = Q(1, 0) = (float)(dt * dt * dt / 2 * q);
+    Q(1, 1) = (float)(dt * dt * q);
+    Matrix<1, 2> H = Matrix<1, 2>::zero();
+    H(0, 0) = 1;
+    Matrix<1, 1> R;
+    R(0, 0) = (float)r;
+
+    double worst_x = 0, worst_P = 0;
+    for (int step = 0; step < 2000; ++step) {
+        filter.predict(F, Matrix<2, 1>::zero(), Q);
+        x[0] += dt * x[1];
+        const double p00 = P[0][0] + dt * (P[0][1] + P[1][0]) + dt * dt * P[1][1] + Q(0, 0);
+        const double p01 = P[0][1] + dt * P[1][1] + Q(0, 1);
+        const double p11 = P[1][1] + Q(1, 1);
+        P[0][0] = p00;
+        P[0][1] = P[1][0] = p01;
+        P[1][1] = p11;
+
+        Matrix<1, 1> z;
+        const double measured = 3.0 * step * dt + 2 * random_gaussian();
+        z(0, 0) = (float)measured;
+        CHECK(filter.update(H, R, z));
+        const double s = P[0][0] + r;
+        const double k[2] = { P[0][0] / s, P[1][0] / s };
+        const double innovation = measured - x[0];
+        x[0] += k[0] * innovation;
+        x[1] += k[1] * innovation;
+        const double q00 = (1 - k[0]) * P[0][0];
+        const double q01 = (1 - k[0]) * P[0][1];
+        const double q11 = P[1][1] - k[1] * P[0][1];
+        P[0][0] = q00;
+        P[0][1] = P[1][0] = q01;
+        P[1][1] = q11;
+
+        worst_x = fmax(worst_x, fabs(filter.x(0, 0) - x[0]) + fabs(filter.x(1, 0) - x[1]));
+        worst_P = fmax(worst_P,
+                       fabs(filter.P(0, 0) - P[0][0]) / P[0][0] + fabs(filter.P(1, 1) - P[1][1]) / P[1][1]);
+    }
+    CHECK_MSG(
+      worst_x < 1e-2 && worst_P < 1e-3, "state off by %g, covariance by %g relative", worst_x, worst_P);
+    CHECK(fabs(filter.x(1, 0) - 3.0) < 0.5);
+}
+
+static void
+bench_nav(void)
+{
+    enum { STEPS = 100000 };
+    latest_fix.is_valid = true;
+    accel_reading[0] = 0.01f;
+    accel_reading[1] = -0.02f;
+    accel_reading[2] = 1.0f;
+    double start = bench_now();
+    for (int step = 0; step < STEPS; ++step) {
+        host_time_us += STEP_US;
+        if (step % 50 == 0) {
+            latest_fix.unix_time++;
+            ++fix_sequence;
+        }
+        nav_job->run(nav_job->context);
+    }
+    bench_report("nav job, 50 Hz step with 1 Hz fixes", bench_now() - start, STEPS, "step");
+}
+
+int
+main(void)
+{
+    test_invert();
+    test_filter_reference();
+    host_time_us = 1000000;
+    nav_start();
+    CHECK(nav_job != NULL && nav_job->period_ms == STEP_US / 1000);
+    test_drive();
+    test_handling();
+    test_outage();
+    test_fix_rate();
+    bench_nav();
+    return test_result();
+}
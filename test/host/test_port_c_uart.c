@@ -0,0 +1,292 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "core2forAWS.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_uart.h"
+#include "nmea_log.h"
+#include "test.h"
+
+/* Port C pattern reads on a simulated UART, replaying the receiver's once a second bursts */
+
+#define SECONDS 60
+#define SENTENCES (13 * SECONDS)
+#define FRAME_SIZE 128 // the buffer of gps_task
+
+// The log, split into sentences with the time their '\n' is received
+static char log_text[800 * SECONDS];
+static const char* sentence_start[SENTENCES];
+static size_t sentence_length[SENTENCES];
+static int64_t sentence_end_us[SENTENCES];
+
+static void
+split_log(void)
+{
+    const size_t length = nmea_log(log_text, sizeof(log_text), SECONDS);
+    const char* p = log_text;
+    for (int i = 0; i < SENTENCES; ++i) {
+        const char* end = strchr(p, '\n') + 1;
+        sentence_start[i] = p;
+        sentence_length[i] = end - p;
+        p = end;
+    }
+    CHECK(p == log_text + length);
+}
+
+// Like gps_init()
+static void
+open_port(void)
+{
+    host_time_us = 0;
+    CHECK(Core2ForAWS_Port_PinMode(PORT_C_UART_RX_PIN, UART) == ESP_OK);
+    CHECK(Core2ForAWS_Port_C_UART_Begin(9600) == ESP_OK);
+    CHECK(Core2ForAWS_Port_C_UART_EnablePatternDetect('\n') == ESP_OK);
+    host_uart_take_stats();
+}
+
+static void
+close_port(void)
+{
+    CHECK(Core2ForAWS_Port_PinMode(PORT_C_UART_RX_PIN, NONE) == ESP_OK);
+}
+
+// Each second's sentences start at the full second, `offset_us` after the start of the test
+static int64_t
+send_log(int64_t offset_us)
+{
+    for (int i = 0; i < SENTENCES; ++i) {
+        sentence_end_us[i] = host_uart_receive(
+          (const uint8_t*)sentence_start[i], sentence_length[i], offset_us + i / 13 * 1000000LL);
+    }
+    return sentence_end_us[SENTENCES - 1];
+}
+
+static bool
+is_sentence(const uint8_t* frame, int length, int index)
+{
+    return (size_t)length == sentence_length[index] && memcmp(frame, sentence_start[index], length) == 0;
+}
+
+static void
+test_not_open(void)
+{
+    uint8_t frame[FRAME_SIZE];
+    CHECK(Core2ForAWS_Port_C_UART_EnablePatternDetect('\n') == ESP_ERR_INVALID_STATE);
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), 0) == -1);
+    CHECK(Core2ForAWS_Port_PinMode(PORT_C_UART_RX_PIN, UART) == ESP_OK);
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), 0) == -1);
+    close_port();
+}
+
+/**
+ * A waiting reader wakes exactly once per sentence, when its '\n' is received, and reads all of
+ * it. One that is busy for `busy_ms` after every GGA gets the sentences received meanwhile late,
+ * none lost.
+ */
+static void
+test_every_sentence(uint32_t busy_ms)
+{
+    open_port();
+    const int64_t end_us = send_log(250000);
+
+    uint8_t frame[FRAME_SIZE];
+    double latency_sum_us = 0;
+    int64_t max_latency_us = 0;
+    int wrong = 0;
+    for (int i = 0; i < SENTENCES; ++i) {
+        const int length = Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(2000));
+        if (!is_sentence(frame, length, i) && wrong++ < 5) {
+            fprintf(stderr, "frame %d: %d bytes \"%.*s\"\n", i, length, length > 0 ? length : 0, frame);
+        }
+        const int64_t latency_us = host_time_us - sentence_end_us[i];
+        latency_sum_us += latency_us;
+        max_latency_us = latency_us > max_latency_us ? latency_us : max_latency_us;
+        if (length > 6 && memcmp(frame + 3, "GGA", 3) == 0) {
+            vTaskDelay(pdMS_TO_TICKS(busy_ms));
+        }
+    }
+    CHECK_MSG(wrong == 0, "%d of %d frames are not the sentence sent", wrong, SENTENCES);
+    CHECK_MSG(max_latency_us <= busy_ms * 1000LL,
+              "busy %u ms: a sentence was read %lld us after it arrived",
+              busy_ms,
+              (long long)max_latency_us);
+    CHECK(host_time_us <= end_us + busy_ms * 1000LL);
+    if (busy_ms == 0) {
+        const double mean_ms = latency_sum_us / SENTENCES / 1000;
+        printf("%-40s %10.1f ms\n", "nmea sentence latency, pattern reads", mean_ms);
+    }
+
+    // Nothing more, the wait times out
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(2000)) == 0);
+    const HostUartStats stats = host_uart_take_stats();
+    CHECK(stats.overflowed == 0 && stats.events_lost == 0 && stats.positions_lost == 0);
+    const char* log_end = sentence_start[SENTENCES - 1] + sentence_length[SENTENCES - 1];
+    CHECK(stats.received == (uint32_t)(log_end - log_text));
+    close_port();
+}
+
+/**
+ * What the 200 ms polling gps_task did before, for the latency the pattern reads save: a sentence
+ * waits for the next poll, and before that for the UART's idle timeout to move it out of the FIFO.
+ */
+static void
+test_polling(void)
+{
+    open_port();
+    send_log(250000);
+
+    static uint8_t buffer[UART_RX_BUF_SIZE];
+    static char received[sizeof(log_text)];
+    size_t received_length = 0;
+    int next = 0;
+    double latency_sum_us = 0;
+    int64_t max_latency_us = 0;
+    while (next < SENTENCES && host_time_us < 2000000LL * SECONDS) {
+        vTaskDelay(pdMS_TO_TICKS(200));
+        const int length = Core2ForAWS_Port_C_UART_Receive(buffer);
+        memcpy(received + received_length, buffer, length);
+        received_length += length;
+        // The sentences this read completed
+        while (next < SENTENCES
+               && sentence_start[next] + sentence_length[next] <= log_text + received_length) {
+            const int64_t latency_us = host_time_us - sentence_end_us[next++];
+            latency_sum_us += latency_us;
+            max_latency_us = latency_us > max_latency_us ? latency_us : max_latency_us;
+        }
+    }
+    CHECK(next == SENTENCES && memcmp(received, log_text, received_length) == 0);
+    CHECK(max_latency_us > 100000);
+    printf("%-40s %10.1f ms\n", "nmea sentence latency, 200 ms polls", latency_sum_us / SENTENCES / 1000);
+    close_port();
+}
+
+// A frame longer than the buffer is dropped whole, the next one is read as usual
+static void
+test_oversized_frame(void)
+{
+    open_port();
+    char line[301];
+    memset(line, 'x', sizeof(line) - 1);
+    line[sizeof(line) - 1] = '\n';
+    const int64_t start_us = host_uart_receive((const uint8_t*)line, sizeof(line), 0);
+    host_uart_receive((const uint8_t*)sentence_start[0], sentence_length[0], start_us);
+
+    uint8_t frame[FRAME_SIZE];
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(2000)) == 0);
+    CHECK(is_sentence(frame, Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), 2000), 0));
+    const HostUartStats stats = host_uart_take_stats();
+    CHECK(stats.overflowed == 0 && stats.events_lost == 0);
+    close_port();
+}
+
+/**
+ * Noise without a line end fills the ring buffer while the reader waits. The input is discarded,
+ * the rest of the noise makes the first sentence an oversized frame, the others come through.
+ */
+static void
+test_line_noise(void)
+{
+    open_port();
+    static char noise[3000];
+    memset(noise, 'x', sizeof(noise));
+    const int64_t start_us = host_uart_receive((const uint8_t*)noise, sizeof(noise), 0);
+    for (int i = 0; i < 13; ++i) {
+        host_uart_receive((const uint8_t*)sentence_start[i], sentence_length[i], start_us);
+    }
+
+    uint8_t frame[FRAME_SIZE];
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(5000)) == 0);
+    CHECK(host_time_us < start_us);
+    CHECK(Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(5000)) == 0);
+    for (int i = 1; i < 13; ++i) {
+        CHECK(is_sentence(frame, Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), 5000), i));
+    }
+    const HostUartStats stats = host_uart_take_stats();
+    CHECK(stats.overflowed == 0 && stats.events_lost == 0);
+    close_port();
+}
+
+/**
+ * A reader that stops for `stall_ms` during the log. Data that piled up past what the driver
+ * keeps track of is dropped and reading resumes: every frame is a sentence of the log, in order,
+ * except the tail of the one received while the input was discarded, and no sentence is lost
+ * once the reader keeps up again.
+ */
+static void
+test_stalled_reader(uint32_t stall_ms, bool expect_overflow)
+{
+    open_port();
+    const int64_t end_us = send_log(0);
+
+    uint8_t frame[FRAME_SIZE];
+    int next = 0;
+    int lost = 0;
+    int drops = 0;
+    int tails = 0;
+    int wrong = 0;
+    int last_drop = -1;
+    bool after_drop = false;
+    bool stalled = false;
+    while (next < SENTENCES && host_time_us < end_us + 1000000) {
+        const int length = Core2ForAWS_Port_C_UART_ReceivePattern(frame, sizeof(frame), pdMS_TO_TICKS(1000));
+        if (length == 0) {
+            ++drops;
+            last_drop = next;
+            after_drop = true;
+            continue;
+        }
+        int index = next;
+        while (index < SENTENCES && !is_sentence(frame, length, index)) {
+            ++index;
+        }
+        if (index < SENTENCES) {
+            lost += index - next;
+            next = index + 1;
+        } else if (after_drop && (size_t)length < sentence_length[next]
+                   && memcmp(frame, sentence_start[next] + sentence_length[next] - length, length) == 0) {
+            ++tails;
+            ++lost;
+            ++next;
+        } else if (wrong++ < 5) {
+            fprintf(stderr, "stall %u ms: unexpected frame \"%.*s\"\n", stall_ms, length, frame);
+        }
+        after_drop = false;
+
+        if (!stalled && host_time_us > 5000000) {
+            vTaskDelay(pdMS_TO_TICKS(stall_ms));
+            stalled = true;
+        }
+    }
+    const HostUartStats stats = host_uart_take_stats();
+    CHECK_MSG(wrong == 0, "stall %u ms: %d frames are not sentences of the log", stall_ms, wrong);
+    CHECK_MSG(drops > 0 && tails <= drops && lost > 0 && lost < 13 * 5,
+              "stall %u ms: %d drops, %d tails, %d sentences lost",
+              stall_ms,
+              drops,
+              tails,
+              lost);
+    // Reading caught up within two seconds of the stall, nothing was lost after that
+    CHECK_MSG(next == SENTENCES && last_drop < 13 * (8 + stall_ms / 1000),
+              "stall %u ms: last drop before sentence %d",
+              stall_ms,
+              last_drop);
+    CHECK(stats.positions_lost > 0);
+    CHECK(expect_overflow == (stats.overflowed > 0));
+    close_port();
+}
+
+int
+main(void)
+{
+    split_log();
+    test_not_open();
+    test_every_sentence(0);
+    test_every_sentence(500);
+    test_polling();
+    test_oversized_frame();
+    test_line_noise();
+    test_stalled_reader(2000, false);
+    test_stalled_reader(4000, true);
+    return test_result();
+}
@@ -0,0 +1,311 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "env3_sensors.h"
+#include "esp_timer.h"
+#include "host_port_a.h"
+#include "nvs.h"
+#include "test.h"
+
+/*
+ * The QMP6988 compensation engine selected at build time against the datasheet formula in
+ * double precision, for calibration blocks spread over the whole OTP range. Built once per engine.
+ */
+
+#ifdef CONFIG_QMP6988_COMPENSATION_INTEGER
+#define ENGINE "integer"
+// The fixed-point coefficients are linear fits of the datasheet conversion, up to 2 Pa off at the OTP
+// extremes, within the 6 Pa relative accuracy of the sensor
+#define MAX_ERROR_PA 2.0
+#else
+#define ENGINE "float"
+// Single precision rounding only
+#define MAX_ERROR_PA 0.05
+#endif
+
+#define SAMPLES_PER_CHIP 2000000
+
+typedef struct Calibration
+{
+    int32_t a0, b00; // 20 bit
+    int16_t a1, a2, bt1, bt2, bp1, b11, bp2, b12, b21, bp3;
+} Calibration;
+
+// The OTP layout of the datasheet, registers 0xA0 to 0xB8
+static void
+encode_otp(const Calibration* c, uint8_t otp[25])
+{
+    const int16_t words[] = { c->bt1, c->bt2, c->bp1, c->b11, c->bp2, c->b12, c->b21, c->bp3 };
+    otp[0] = (uint8_t)(c->b00 >> 12);
+    otp[1] = (uint8_t)(c->b00 >> 4);
+    for (int i = 0; i < 8; ++i) {
+        otp[2 + 2 * i] = (uint8_t)((uint16_t)words[i] >> 8);
+        otp[3 + 2 * i] = (uint8_t)words[i];
+    }
+    otp[18] = (uint8_t)(c->a0 >> 12);
+    otp[19] = (uint8_t)(c->a0 >> 4);
+    otp[20] = (uint8_t)((uint16_t)c->a1 >> 8);
+    otp[21] = (uint8_t)c->a1;
+    otp[22] = (uint8_t)((uint16_t)c->a2 >> 8);
+    otp[23] = (uint8_t)c->a2;
+    otp[24] = (uint8_t)((c->b00 & 0x0f) << 4 | (c->a0 & 0x0f));
+}
+
+// Tr in 1/256 °C, whole units like both engines
+static double
+reference_tr(const Calibration* c, int32_t dt)
+{
+    const double a0 = c->a0 / 16.0;
+    const double a1 = -6.30E-03 + 4.30E-04 * c->a1 / 32767.0;
+    const double a2 = -1.90E-11 + 1.20E-10 * c->a2 / 32767.0;
+    return floor(a0 + a1 * dt + a2 * (double)dt * dt);
+}
+
+// Pa at temperature `tr`
+static double
+reference_pressure(const Calibration* c, double tr, int32_t dp)
+{
+    const double b00 = c->b00 / 16.0;
+    const double bt1 = 1.00E-01 + 9.10E-02 * c->bt1 / 32767.0;
+    const double bt2 = 1.20E-08 + 1.20E-06 * c->bt2 / 32767.0;
+    const double bp1 = 3.30E-02 + 1.90E-02 * c->bp1 / 32767.0;
+    const double b11 = 2.10E-07 + 1.40E-07 * c->b11 / 32767.0;
+    const double bp2 = -6.30E-10 + 3.50E-10 * c->bp2 / 32767.0;
+    const double b12 = 2.90E-13 + 7.60E-13 * c->b12 / 32767.0;
+    const double b21 = 2.10E-15 + 1.20E-14 * c->b21 / 32767.0;
+    const double bp3 = 1.30E-16 + 7.90E-17 * c->bp3 / 32767.0;
+    return b00 + bt1 * tr + bp1 * dp + b11 * tr * dp + bt2 * tr * tr + bp2 * (double)dp * dp +
+           b12 * dp * tr * tr + b21 * (double)dp * dp * tr + bp3 * (double)dp * dp * dp;
+}
+
+static uint64_t random_state = 0x853c49e6748fea9bULL;
+
+static uint32_t
+random_u32(void)
+{
+    random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t)(random_state >> 32);
+}
+
+static int32_t
+random_signed(int bits)
+{
+    return (int32_t)(random_u32() << (32 - bits)) >> (32 - bits);
+}
+
+typedef struct OtpReads
+{
+    uint32_t full;  // the whole calibration block
+    uint32_t check; // the part compared with the cached block
+} OtpReads;
+
+static OtpReads otp_reads;
+
+// Register file reads that count the calibration reads
+static esp_err_t
+qmp6988_read(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    if (register_address == 0xa0 && length == 25) {
+        ++otp_reads.full;
+    } else if (register_address > 0xa0 && register_address < 0xb9) {
+        ++otp_reads.check;
+    }
+    memcpy(data, &device->registers[register_address], length);
+    return ESP_OK;
+}
+
+static HostI2cDevice qmp6988 = { .address = 0x70, .read = qmp6988_read };
+
+// Boots the driver with `c` in the OTP of the simulated sensor, keeping what NVS holds
+static I2CDevice_t
+warm_boot_with(const Calibration* c)
+{
+    encode_otp(c, &qmp6988.registers[0xa0]);
+    qmp6988.registers[0xd1] = 0x5c;
+    host_port_a_attach(&qmp6988);
+    return QMP6988_deviceCheck();
+}
+
+static I2CDevice_t
+boot_with(const Calibration* c)
+{
+    host_nvs_erase();
+    return warm_boot_with(c);
+}
+
+static float
+pressure_of(I2CDevice_t device, uint32_t p_read, uint32_t t_read)
+{
+    const uint8_t conversion[6] = {
+        p_read >> 16, p_read >> 8, p_read, t_read >> 16, t_read >> 8, t_read,
+    };
+    memcpy(&qmp6988.registers[0xf7], conversion, sizeof(conversion));
+    return QMP6988_calcPressure(device);
+}
+
+static void
+test_against_reference(void)
+{
+    static QMP6988RawSample samples[SAMPLES_PER_CHIP];
+    static float pressures[SAMPLES_PER_CHIP];
+
+    // Typical coefficients first, then random chips with every field over its whole range
+    for (int chip = 0; chip < 5; ++chip) {
+        Calibration c = { 0 };
+        if (chip > 0) {
+            c.a0 = random_signed(20);
+            c.b00 = random_signed(20);
+            int16_t* words = &c.a1;
+            for (int i = 0; i < 10; ++i) {
+                words[i] = (int16_t)random_signed(16);
+            }
+        }
+        I2CDevice_t device = boot_with(&c);
+        CHECK(device != NULL);
+
+        // Raw values over the full 24 bit range, most fall outside the specified conditions
+        for (size_t i = 0; i < SAMPLES_PER_CHIP; ++i) {
+            samples[i].temperature = random_signed(24);
+            samples[i].pressure = random_signed(24);
+        }
+        QMP6988_compensateBatch(samples, pressures, SAMPLES_PER_CHIP);
+
+        // Where Tr sits close to a whole unit, an engine may round it to the neighbouring one, which
+        // moves the pressure by up to 2 Pa. Each result has to match the formula at one of them.
+        double max_error = 0;
+        size_t compared = 0;
+        for (size_t i = 0; i < SAMPLES_PER_CHIP; ++i) {
+            const double tr = reference_tr(&c, samples[i].temperature);
+            const double expected = reference_pressure(&c, tr, samples[i].pressure);
+            // Only the conditions the sensor is specified for, -40 to 85 °C and 300 to 1100 hPa
+            if (tr < -40 * 256 || tr > 85 * 256 || expected < 30000 || expected > 110000) {
+                continue;
+            }
+            ++compared;
+            double error = fabs(pressures[i] - expected);
+            for (int step = -1; step <= 1; step += 2) {
+                const double neighbour = reference_pressure(&c, tr + step, samples[i].pressure);
+                error = fmin(error, fabs(pressures[i] - neighbour));
+            }
+            max_error = fmax(max_error, error);
+        }
+        printf("%-8s chip %d: %7zu samples in range, max error %.3f Pa\n", ENGINE, chip, compared, max_error);
+        CHECK(compared > 1000);
+        CHECK_MSG(max_error < MAX_ERROR_PA, "chip %d error %.3f Pa", chip, max_error);
+
+        // The single sample read over the bus uses the same engine
+        for (size_t i = 0; i < 100; ++i) {
+            const uint32_t p_read = (uint32_t)samples[i].pressure + 8388608u;
+            const uint32_t t_read = (uint32_t)samples[i].temperature + 8388608u;
+            CHECK(pressure_of(device, p_read, t_read) == pressures[i]);
+        }
+        Core2ForAWS_Port_A_I2C_Close(device);
+    }
+}
+
+static void
+report_boot(const char* name, int64_t start_us, OtpReads reads)
+{
+    const HostPortAStats bus = host_port_a_take_stats();
+    printf("%-24s %5.1f ms, %u transfers, bus busy %.2f ms, %u full and %u partial OTP reads\n",
+           name,
+           (host_time_us - start_us) / 1000.0,
+           bus.transfers,
+           bus.busy_us / 1000.0,
+           reads.full,
+           reads.check);
+}
+
+static void
+test_calibration_cache(void)
+{
+    const Calibration first = { .a0 = -7000, .a1 = 1200, .a2 = -300, .b00 = 90000, .bp1 = 400 };
+    Calibration second = first;
+    second.a1 = -2500; // another unit, its chip ID is the same
+    const uint32_t p_read = 8388608u + 2800000u;
+    const uint32_t t_read = 8388608u - 1000000u;
+
+    host_nvs_erase();
+    host_port_a_take_stats();
+    memset(&otp_reads, 0, sizeof(otp_reads));
+    int64_t start = host_time_us;
+    I2CDevice_t device = warm_boot_with(&first);
+    report_boot("cold boot", start, otp_reads);
+    CHECK(otp_reads.full == 1 && otp_reads.check == 0);
+    const float first_pressure = pressure_of(device, p_read, t_read);
+    Core2ForAWS_Port_A_I2C_Close(device);
+
+    memset(&otp_reads, 0, sizeof(otp_reads));
+    host_port_a_take_stats();
+    start = host_time_us;
+    device = warm_boot_with(&first);
+    report_boot("warm boot", start, otp_reads);
+    CHECK(otp_reads.full == 0 && otp_reads.check == 1);
+    CHECK(pressure_of(device, p_read, t_read) == first_pressure);
+    Core2ForAWS_Port_A_I2C_Close(device);
+
+    // A swapped unit must not run with the coefficients of the old one
+    memset(&otp_reads, 0, sizeof(otp_reads));
+    host_port_a_take_stats();
+    start = host_time_us;
+    device = warm_boot_with(&second);
+    report_boot("boot after a swap", start, otp_reads);
+    CHECK(otp_reads.full == 1 && otp_reads.check == 1);
+    const float second_pressure = pressure_of(device, p_read, t_read);
+    Core2ForAWS_Port_A_I2C_Close(device);
+    CHECK(second_pressure != first_pressure);
+
+    device = boot_with(&second);
+    CHECK(pressure_of(device, p_read, t_read) == second_pressure);
+    Core2ForAWS_Port_A_I2C_Close(device);
+
+    // And the next boot uses the block cached for it
+    memset(&otp_reads, 0, sizeof(otp_reads));
+    device = warm_boot_with(&second);
+    CHECK(otp_reads.full == 0 && otp_reads.check == 1);
+    CHECK(pressure_of(device, p_read, t_read) == second_pressure);
+    Core2ForAWS_Port_A_I2C_Close(device);
+    host_port_a_take_stats();
+}
+
+static void
+bench_compensation(void)
+{
+    enum { SAMPLES = 1 << 16, ROUNDS = 64 };
+    static QMP6988RawSample samples[SAMPLES];
+    static float pressures[SAMPLES];
+    const Calibration c = { 0 };
+    Core2ForAWS_Port_A_I2C_Close(boot_with(&c));
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        samples[i].temperature = -1000000 + (int32_t)(random_u32() % 100000);
+        samples[i].pressure = 2500000 + (int32_t)(random_u32() % 1000000);
+    }
+
+    double start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        QMP6988_compensateBatch(samples, pressures, SAMPLES);
+    }
+    const double batch = bench_now() - start;
+
+    start = bench_now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            QMP6988_compensateBatch(&samples[i], &pressures[i], 1);
+        }
+    }
+    const double single = bench_now() - start;
+
+    bench_report(ENGINE " compensation, batch", batch, (double)SAMPLES * ROUNDS, "sample");
+    bench_report(ENGINE " compensation, one by one", single, (double)SAMPLES * ROUNDS, "sample");
+}
+
+int
+main(void)
+{
+    test_calibration_cache();
+    test_against_reference();
+    bench_compensation();
+    return test_result();
+}
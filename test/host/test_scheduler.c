@@ -0,0 +1,160 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "scheduler.h"
+#include "test.h"
+
+/* The scheduler task on the simulated clock, jobs take time by advancing it */
+
+#define SIMULATED_US (600LL * 1000 * 1000)
+
+typedef struct SimJob
+{
+    SchedulerJob job;
+    uint32_t runtime_us;
+    uint32_t burst_every; // every nth run takes burst_us instead, 0 never
+    uint32_t burst_us;
+    uint32_t first_delay_ms;
+    int64_t last_start_us;
+    int64_t min_start_gap_us;
+    uint32_t off_phase; // runs whose deadline left the period grid
+    uint32_t starts;
+} SimJob;
+
+static void
+sim_run(void* context)
+{
+    SimJob* sim = context;
+    const int64_t period_us = (int64_t)sim->job.period_ms * 1000;
+    if ((sim->job.deadline_us - (int64_t)sim->first_delay_ms * 1000) % period_us != 0) {
+        ++sim->off_phase;
+    }
+    if (sim->starts > 0 && host_time_us - sim->last_start_us < sim->min_start_gap_us) {
+        sim->min_start_gap_us = host_time_us - sim->last_start_us;
+    }
+    sim->last_start_us = host_time_us;
+    ++sim->starts;
+
+    const bool burst = sim->burst_every != 0 && sim->starts % sim->burst_every == 0;
+    host_time_us += burst ? sim->burst_us : sim->runtime_us;
+}
+
+static void
+log_stats_run(void* context)
+{
+    scheduler_log_stats();
+}
+
+#define SIM_JOB(job_name, period, runtime, delay)                                                          \
+    {                                                                                                        \
+        .job = { .name = job_name, .run = sim_run, .period_ms = period }, .runtime_us = runtime,             \
+        .first_delay_ms = delay, .min_start_gap_us = INT64_MAX,                                              \
+    }
+
+// The firmware's jobs with rough ESP32 runtimes, plus one that now and then overruns its period
+static SimJob mix[] = {
+    SIM_JOB("clock", 1000, 300, 0),   SIM_JOB("battery", 5000, 2000, 10), SIM_JOB("env3", 2000, 6000, 20),
+    SIM_JOB("gps", 100, 1500, 0),     SIM_JOB("pir", 200, 100, 5),        SIM_JOB("web", 1000, 4000, 30),
+    SIM_JOB("burst", 50, 5000, 0),
+};
+
+static SchedulerJob stats_job = { .name = "log stats", .run = log_stats_run, .period_ms = 10000 };
+
+static void
+test_job_mix(void)
+{
+    SimJob* burst = &mix[sizeof(mix) / sizeof(mix[0]) - 1];
+    burst->burst_every = 100;
+    burst->burst_us = 180000;
+
+    host_time_us = 0;
+    for (size_t i = 0; i < sizeof(mix) / sizeof(mix[0]); ++i) {
+        mix[i].job.context = &mix[i];
+        scheduler_add(&mix[i].job, mix[i].first_delay_ms);
+    }
+    scheduler_add(&stats_job, 10000);
+    host_task_stop_us = SIMULATED_US;
+    scheduler_start();
+    host_tasks_run();
+
+    printf("%-10s %8s %14s %14s %8s\n", "job", "runs", "max jitter us", "max runtime us", "cpu %");
+    double cpu_total = 0;
+    for (size_t i = 0; i < sizeof(mix) / sizeof(mix[0]); ++i) {
+        const SimJob* sim = &mix[i];
+        const double cpu = 100.0 * sim->job.total_runtime_us / SIMULATED_US;
+        cpu_total += cpu;
+        printf("%-10s %8u %14u %14u %8.2f\n",
+               sim->job.name,
+               sim->job.runs,
+               sim->job.max_jitter_us,
+               sim->job.max_runtime_us,
+               cpu);
+
+        CHECK_MSG(sim->off_phase == 0, "%s ran off its period grid %u times", sim->job.name, sim->off_phase);
+        CHECK(sim->job.runs == sim->starts);
+        if (sim == burst) {
+            continue;
+        }
+        // Runs at first_delay + n * period up to the end, jobs with a shorter period than a burst
+        // skip the periods it covers
+        const int64_t period_us = sim->job.period_ms * 1000LL;
+        const int64_t expected = (SIMULATED_US - sim->first_delay_ms * 1000LL) / period_us + 1;
+        const int64_t bursts = burst->starts / burst->burst_every;
+        const int64_t skipped = period_us < burst->burst_us ? 2 * bursts : 0;
+        CHECK_MSG(sim->job.runs >= expected - skipped - 1 && sim->job.runs <= expected + 1,
+                  "%s runs %u, expected %lld",
+                  sim->job.name,
+                  sim->job.runs,
+                  (long long)expected);
+        // Jobs only ever wait for one burst and the jobs due with it
+        CHECK_MSG(sim->job.max_jitter_us <= 200000, "%s jitter %u us", sim->job.name, sim->job.max_jitter_us);
+        const double expected_cpu = 100.0 * sim->job.runs * sim->runtime_us / SIMULATED_US;
+        CHECK_MSG(fabs(cpu - expected_cpu) < 0.01, "%s cpu %.3f%%", sim->job.name, cpu);
+    }
+    printf("%-10s %8s %14s %14s %8.2f\n", "total", "", "", "", cpu_total);
+
+    // Missed periods are skipped, not caught up back to back
+    const uint32_t bursts = burst->starts / burst->burst_every;
+    CHECK(bursts > 0);
+    CHECK_MSG(burst->min_start_gap_us >= 40000, "burst restarted after %lld us",
+              (long long)burst->min_start_gap_us);
+    CHECK(burst->job.max_runtime_us == burst->burst_us);
+    CHECK(burst->job.runs <= SIMULATED_US / 50000 + 1 - bursts * 3);
+    CHECK(stats_job.runs == SIMULATED_US / 10000000 - 1 || stats_job.runs == SIMULATED_US / 10000000);
+}
+
+// Adding a job that is still queued moves it. Linking it in a second time used to drop the jobs
+// queued between its old and its new place.
+static void
+test_add_while_queued(void)
+{
+    static SimJob again = SIM_JOB("again", 100, 100, 0);
+    static SimJob between = SIM_JOB("between", 100, 100, 0);
+    again.job.context = &again;
+    between.job.context = &between;
+    host_time_us = (host_time_us / 1000 + 1) * 1000;
+    const int64_t start_us = host_time_us;
+    again.first_delay_ms = start_us / 1000 + 50;
+    between.first_delay_ms = start_us / 1000 + 40;
+
+    scheduler_add(&again.job, 30);
+    scheduler_add(&between.job, 40);
+    scheduler_add(&again.job, 50);
+    host_task_stop_us = start_us + 2000000;
+    host_tasks_run();
+
+    CHECK(again.off_phase == 0 && between.off_phase == 0);
+    CHECK_MSG(again.job.runs >= 10 && again.job.runs <= 20, "%u runs", again.job.runs);
+    CHECK_MSG(between.job.runs >= 10 && between.job.runs <= 20, "%u runs", between.job.runs);
+}
+
+int
+main(void)
+{
+    test_job_mix();
+    test_add_while_queued();
+    return test_result();
+}
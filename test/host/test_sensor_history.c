@@ -0,0 +1,131 @@
+#include <math.h>
+
+#include "bench.h"
+#include "esp_timer.h"
+#include "sensor_history.h"
+#include "test.h"
+
+static void
+set_now(uint32_t seconds)
+{
+    host_time_us = (int64_t)seconds * 1000000;
+}
+
+static bool
+close_to(float a, float b)
+{
+    return fabsf(a - b) < 1e-3f;
+}
+
+static void
+test_tiers(void)
+{
+    // Temperature t at every second t of the first two hours
+    for (uint32_t t = 0; t < 7200; ++t) {
+        sensor_history_append(SENSOR_CHANNEL_TEMPERATURE, t, (float)t);
+    }
+    set_now(7199);
+
+    float value;
+    CHECK(sensor_history_get(SENSOR_CHANNEL_TEMPERATURE, SENSOR_HISTORY_SECONDS, 7000, &value));
+    CHECK(close_to(value, 7000.0f));
+    // The second tier keeps one hour, the first hour is overwritten
+    CHECK(!sensor_history_get(SENSOR_CHANNEL_TEMPERATURE, SENSOR_HISTORY_SECONDS, 3000, &value));
+    CHECK(sensor_history_get(SENSOR_CHANNEL_TEMPERATURE, SENSOR_HISTORY_MINUTES, 3000, &value));
+    CHECK_MSG(close_to(value, 3029.5f), "minute mean %f", value);
+    CHECK(sensor_history_get(SENSOR_CHANNEL_TEMPERATURE, SENSOR_HISTORY_HOURS, 10, &value));
+    CHECK_MSG(close_to(value, 1799.5f), "hour mean %f", value);
+    // The incomplete current period reads as the mean so far
+    sensor_history_append(SENSOR_CHANNEL_TEMPERATURE, 7200, 10.0f);
+    sensor_history_append(SENSOR_CHANNEL_TEMPERATURE, 7201, 20.0f);
+    CHECK(sensor_history_get(SENSOR_CHANNEL_TEMPERATURE, SENSOR_HISTORY_MINUTES, 7230, &value));
+    CHECK(close_to(value, 15.0f));
+    // Other channels are independent
+    CHECK(!sensor_history_get(SENSOR_CHANNEL_HUMIDITY, SENSOR_HISTORY_SECONDS, 7000, &value));
+}
+
+static void
+test_query(void)
+{
+    set_now(7201);
+    SensorHistoryPoint points[8];
+    uint32_t next;
+    size_t count = sensor_history_query(SENSOR_CHANNEL_TEMPERATURE, 7100, 7201, 10, points, 8, &next);
+    CHECK(count == 8);
+    CHECK(points[0].time == 7100 && close_to(points[0].value, 7100.0f));
+    CHECK(points[7].time == 7170 && close_to(points[7].value, 7170.0f));
+    CHECK(next == 7180);
+
+    // Paging on from `next` ends at `to`
+    count = sensor_history_query(SENSOR_CHANNEL_TEMPERATURE, next, 7201, 10, points, 8, &next);
+    CHECK(count == 3);
+    CHECK(points[2].time == 7200 && close_to(points[2].value, 10.0f));
+    CHECK(next == 7210);
+
+    // Steps round up to a multiple of the tier period
+    count = sensor_history_query(SENSOR_CHANNEL_TEMPERATURE, 0, 7201, 90, points, 8, &next);
+    CHECK(count == 8);
+    CHECK(points[1].time == 120);
+    CHECK(close_to(points[1].value, 149.5f));
+    CHECK(next == 8 * 120);
+
+    // Ranges older than the tier capacity start at its oldest slot and none go past now
+    uint32_t from = 0, to = UINT32_MAX, step = 1;
+    CHECK(sensor_history_normalize_range(&from, &to, &step) == SENSOR_HISTORY_SECONDS);
+    CHECK(from == 7201 - 3600 && to == 7201 && step == 1);
+    from = 0, to = UINT32_MAX, step = 7200;
+    CHECK(sensor_history_normalize_range(&from, &to, &step) == SENSOR_HISTORY_HOURS);
+    CHECK(from == 0 && to == 7201 && step == 7200);
+    from = 0, to = UINT32_MAX, step = 90;
+    CHECK(sensor_history_normalize_range(&from, &to, &step) == SENSOR_HISTORY_MINUTES);
+    CHECK(step == 120);
+    step = 7201;
+    CHECK(sensor_history_normalize_range(&from, &to, &step) == SENSOR_HISTORY_HOURS);
+    CHECK(step == 10800);
+    // Where the next multiple would overflow, the step rounds down
+    step = UINT32_MAX;
+    CHECK(sensor_history_normalize_range(&from, &to, &step) == SENSOR_HISTORY_HOURS);
+    CHECK(step == UINT32_MAX - UINT32_MAX % 3600);
+
+    count = sensor_history_query(SENSOR_CHANNEL_TEMPERATURE, 7190, UINT32_MAX, 1, points, 8, &next);
+    CHECK(count == 8);
+    count = sensor_history_query(SENSOR_CHANNEL_TEMPERATURE, next, UINT32_MAX, 1, points, 8, &next);
+    CHECK(count == 4 && next == 7202);
+}
+
+static void
+bench(void)
+{
+    const uint32_t samples = 2000000;
+    double start = bench_now();
+    for (uint32_t t = 0; t < samples; ++t) {
+        sensor_history_append(SENSOR_CHANNEL_PRESSURE, 10000 + t, 1013.25f);
+    }
+    bench_report("sensor_history_append", bench_now() - start, samples, "sample");
+
+    set_now(10000 + samples);
+    SensorHistoryPoint points[64];
+    size_t total = 0;
+    start = bench_now();
+    for (int i = 0; i < 2000; ++i) {
+        const uint32_t to = 10000 + samples;
+        uint32_t next = to - 3600;
+        size_t count;
+        while ((count = sensor_history_query(SENSOR_CHANNEL_PRESSURE, next, to, 1, points, 64, &next)) > 0) {
+            total += count;
+        }
+    }
+    bench_report("sensor_history_query, 1 s step", bench_now() - start, total, "point");
+    // The last sample is one second before now
+    CHECK(total == 2000 * 3600);
+}
+
+int
+main(void)
+{
+    CHECK(sensor_history_init());
+    test_tiers();
+    test_query();
+    bench();
+    return test_result();
+}
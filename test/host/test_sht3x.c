@@ -0,0 +1,302 @@
+#include <string.h>
+
+#include "bench.h"
+#include "env3_sensors.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_port_a.h"
+#include "scheduler.h"
+#include "test.h"
+
+/* The SHT3x periodic acquisition driver against byte streams of the sensor's answers to FETCH DATA */
+
+#define TEMPERATURE_TOLERANCE 0.005f
+#define HUMIDITY_TOLERANCE 0.005f
+
+// Bitwise CRC-8 of the datasheet, section 4.12, to check the driver's table against
+static uint8_t
+reference_crc(const uint8_t* data)
+{
+    uint8_t crc = 0xff;
+    for (int i = 0; i < 2; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = crc & 0x80 ? (uint8_t)(crc << 1) ^ 0x31 : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+typedef struct Frame
+{
+    uint8_t bytes[6];
+    bool is_nack; // no new result since the previous fetch
+    bool is_valid;
+    float temperature;
+    float humidity;
+} Frame;
+
+// Answers of a sensor at 2 mps fetched every 250 ms, plus edge cases
+static const Frame recorded[] = {
+    { { 0x63, 0xc2, 0xdc, 0x4d, 0x9b, 0x9b }, false, true, 23.1949f, 30.3151f },
+    { .is_nack = true },
+    { { 0x63, 0xc3, 0xed, 0x4d, 0x9c, 0x0c }, false, true, 23.1975f, 30.3166f },
+    { .is_nack = true },
+    { { 0x66, 0x66, 0x93, 0x66, 0x66, 0x93 }, false, true, 25.0f, 40.0f },
+    // The CRC example of the datasheet, 0xBEEF gives 0x92
+    { { 0xbe, 0xef, 0x92, 0x80, 0x00, 0xa2 }, false, true, 85.5230f, 50.0008f },
+    { { 0xbe, 0xef, 0x93, 0x80, 0x00, 0xa2 }, false, false },
+    // One bit flipped in the temperature word, then in the humidity CRC
+    { { 0x63, 0xc3, 0xdc, 0x4d, 0x9b, 0x9b }, false, false },
+    { { 0x63, 0xc2, 0xdc, 0x4d, 0x9b, 0x9a }, false, false },
+    // The ends of both ranges
+    { { 0x00, 0x00, 0x81, 0x00, 0x00, 0x81 }, false, true, -45.0f, 0.0f },
+    { { 0xff, 0xff, 0xac, 0xff, 0xff, 0xac }, false, true, 130.0f, 100.0f },
+    // A stuck bus reads all ones or all zeros, neither has a matching CRC
+    { { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, false, false },
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, false, false },
+};
+
+#define RECORDED_COUNT (sizeof(recorded) / sizeof(recorded[0]))
+// After the recorded frames every temperature word once with a valid CRC and once with one bit flipped
+#define EXHAUSTIVE_COUNT (2 * 65536)
+#define FRAME_COUNT (RECORDED_COUNT + EXHAUSTIVE_COUNT)
+
+static void
+word_frame(uint32_t index, Frame* frame)
+{
+    const uint16_t temperature = (uint16_t)(index / 2);
+    const uint16_t humidity = (uint16_t)~temperature;
+    memset(frame, 0, sizeof(*frame));
+    frame->bytes[0] = temperature >> 8;
+    frame->bytes[1] = (uint8_t)temperature;
+    frame->bytes[2] = reference_crc(&frame->bytes[0]);
+    frame->bytes[3] = humidity >> 8;
+    frame->bytes[4] = (uint8_t)humidity;
+    frame->bytes[5] = reference_crc(&frame->bytes[3]);
+    if (index % 2 == 1) {
+        // A CRC detects every single bit error, in the data and in itself
+        const int bit = temperature % 48;
+        frame->bytes[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        return;
+    }
+    // The driver's conversion, in double like it
+    frame->is_valid = true;
+    frame->temperature = (float)(temperature * 175 / 65535.0 - 45);
+    frame->humidity = (float)(humidity * 100 / 65535.0);
+}
+
+static void
+frame_at(uint32_t index, Frame* frame)
+{
+    if (index < RECORDED_COUNT) {
+        *frame = recorded[index];
+    } else {
+        word_frame(index - RECORDED_COUNT, frame);
+    }
+}
+
+typedef struct StreamSensor
+{
+    uint8_t command[2]; // the last one written
+    uint32_t served;
+} StreamSensor;
+
+static esp_err_t
+sensor_write(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    StreamSensor* sensor = device->context;
+    if (register_address != I2C_NO_REG || length != 2) {
+        return ESP_FAIL;
+    }
+    memcpy(sensor->command, data, 2);
+    return ESP_OK;
+}
+
+static esp_err_t
+sensor_read(HostI2cDevice* device, uint32_t register_address, uint8_t* data, uint16_t length)
+{
+    StreamSensor* sensor = device->context;
+    if (sensor->command[0] != 0xe0 || sensor->command[1] != 0x00 || length != 6
+        || sensor->served == FRAME_COUNT) {
+        return ESP_FAIL;
+    }
+    Frame frame;
+    frame_at(sensor->served++, &frame);
+    if (frame.is_nack) {
+        return ESP_FAIL;
+    }
+    memcpy(data, frame.bytes, 6);
+    return ESP_OK;
+}
+
+static StreamSensor sensor_state;
+static HostI2cDevice sensor = {
+    .address = 0x44, .read = sensor_read, .write = sensor_write, .context = &sensor_state,
+};
+static I2CDevice_t sensor_device;
+
+static void
+test_periodic_commands(void)
+{
+    static const struct
+    {
+        uint32_t measurements_per_second;
+        uint8_t command[2];
+    } rates[] = {
+        { 1, { 0x21, 0x30 } },
+        { 2, { 0x22, 0x36 } },
+        { 4, { 0x23, 0x34 } },
+        { 10, { 0x27, 0x37 } },
+    };
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); ++i) {
+        CHECK(SHT3x_start_periodic(sensor_device, rates[i].measurements_per_second) == ESP_OK);
+        CHECK(memcmp(sensor_state.command, rates[i].command, 2) == 0);
+    }
+
+    // Unsupported rates never reach the bus
+    const uint32_t writes = sensor.writes;
+    CHECK(SHT3x_start_periodic(sensor_device, 0) == ESP_ERR_INVALID_ARG);
+    CHECK(SHT3x_start_periodic(sensor_device, 3) == ESP_ERR_INVALID_ARG);
+    CHECK(sensor.writes == writes);
+
+    host_port_a_detach(sensor.address);
+    CHECK(SHT3x_start_periodic(sensor_device, 1) != ESP_OK);
+    host_port_a_attach(&sensor);
+}
+
+typedef struct Stream
+{
+    SHT3xRequest request;
+    SHT3xDecimator decimator;
+    uint32_t fetched;
+    uint32_t mismatches;
+    uint32_t valid;
+    double started;
+    double seconds;
+} Stream;
+
+static Stream stream;
+
+static bool
+near(float value, float expected, float tolerance)
+{
+    return value > expected - tolerance && value < expected + tolerance;
+}
+
+static void
+fetched(void* context)
+{
+    Frame frame;
+    frame_at(stream.fetched, &frame);
+    const SHT3xRequest* request = &stream.request;
+    bool matches = request->is_valid == frame.is_valid;
+    if (matches && frame.is_valid) {
+        if (stream.fetched < RECORDED_COUNT) {
+            matches = near(request->measurement.temperature, frame.temperature, TEMPERATURE_TOLERANCE)
+                      && near(request->measurement.humidity, frame.humidity, HUMIDITY_TOLERANCE);
+            SHT3x_decimator_add(&stream.decimator, request->measurement);
+        } else {
+            matches = request->measurement.temperature == frame.temperature
+                      && request->measurement.humidity == frame.humidity;
+        }
+        ++stream.valid;
+    }
+    if (!matches && stream.mismatches++ < 10) {
+        fprintf(stderr,
+                "frame %u: valid %d, %.4f °C, %.4f %%RH\n",
+                stream.fetched,
+                request->is_valid,
+                request->measurement.temperature,
+                request->measurement.humidity);
+    }
+
+    if (++stream.fetched < FRAME_COUNT) {
+        SHT3x_start_fetch(&stream.request, sensor_device, fetched, NULL);
+    } else {
+        stream.seconds = bench_now() - stream.started;
+    }
+}
+
+static void
+stream_start(void* context)
+{
+    stream.started = bench_now();
+    SHT3x_start_fetch(&stream.request, sensor_device, fetched, NULL);
+}
+
+static SchedulerJob stream_job = { .name = "sht3x", .run = stream_start };
+
+static void
+test_fetch_stream(void)
+{
+    sensor_state.served = 0;
+    CHECK(SHT3x_start_periodic(sensor_device, 2) == ESP_OK);
+    host_port_a_take_stats();
+
+    scheduler_add(&stream_job, 0);
+    host_task_stop_us = esp_timer_get_time() + 3600 * 1000000LL;
+    scheduler_start();
+    host_tasks_run();
+    const HostPortAStats bus = host_port_a_take_stats();
+
+    CHECK_MSG(stream.fetched == FRAME_COUNT, "%u of %u frames", stream.fetched, (unsigned)FRAME_COUNT);
+    CHECK(sensor_state.served == FRAME_COUNT);
+    CHECK_MSG(stream.mismatches == 0, "%u frames decoded wrongly", stream.mismatches);
+    CHECK(stream.valid == 6 + EXHAUSTIVE_COUNT / 2);
+    // A write and a read per fetch, the NACKs and no other failures
+    CHECK(bus.transfers == 2 * FRAME_COUNT);
+    CHECK(bus.failed == 2);
+
+    // The mean of the six recorded results
+    SHT3xMeasurement mean;
+    CHECK(SHT3x_decimator_take(&stream.decimator, &mean));
+    const float temperature = (23.1949f + 23.1975f + 25.0f + 85.5230f - 45.0f + 130.0f) / 6;
+    const float humidity = (30.3151f + 30.3166f + 40.0f + 50.0008f + 0.0f + 100.0f) / 6;
+    CHECK_MSG(near(mean.temperature, temperature, TEMPERATURE_TOLERANCE), "%.4f °C", mean.temperature);
+    CHECK_MSG(near(mean.humidity, humidity, HUMIDITY_TOLERANCE), "%.4f %%RH", mean.humidity);
+    CHECK(!SHT3x_decimator_take(&stream.decimator, &mean));
+
+    bench_report("sht3x fetch, queued and checked", stream.seconds, FRAME_COUNT, "fetch");
+}
+
+static void
+test_decimator(void)
+{
+    SHT3xDecimator decimator = { 0 };
+    SHT3xMeasurement mean = { .temperature = -1.0f, .humidity = -1.0f };
+    CHECK(!SHT3x_decimator_take(&decimator, &mean));
+    CHECK(mean.temperature == -1.0f && mean.humidity == -1.0f);
+
+    // 10 mps into a 1 s window, then a window with a single result
+    for (int i = 0; i < 10; ++i) {
+        const SHT3xMeasurement measurement = { .temperature = 20.0f + i, .humidity = 40.0f - i };
+        SHT3x_decimator_add(&decimator, measurement);
+    }
+    CHECK(SHT3x_decimator_take(&decimator, &mean));
+    CHECK(mean.temperature == 24.5f && mean.humidity == 35.5f);
+    SHT3x_decimator_add(&decimator, (SHT3xMeasurement){ .temperature = -3.0f, .humidity = 99.0f });
+    CHECK(SHT3x_decimator_take(&decimator, &mean));
+    CHECK(mean.temperature == -3.0f && mean.humidity == 99.0f);
+    CHECK(!SHT3x_decimator_take(&decimator, &mean));
+}
+
+int
+main(void)
+{
+    // The recorded frames match the reference CRC, or are meant not to
+    CHECK(reference_crc((const uint8_t[]){ 0xbe, 0xef }) == 0x92);
+    for (size_t i = 0; i < RECORDED_COUNT; ++i) {
+        const uint8_t* bytes = recorded[i].bytes;
+        const bool crc_matches =
+          reference_crc(&bytes[0]) == bytes[2] && reference_crc(&bytes[3]) == bytes[5];
+        CHECK_MSG(recorded[i].is_nack || crc_matches == recorded[i].is_valid, "recorded frame %zu", i);
+    }
+
+    host_port_a_attach(&sensor);
+    sensor_device = Core2ForAWS_Port_A_I2C_Begin(SHT3x_DEVICE_ADDRESS, PORT_A_I2C_STANDARD_BAUD);
+    test_periodic_commands();
+    test_decimator();
+    test_fetch_stream();
+    return test_result();
+}
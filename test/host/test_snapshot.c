@@ -0,0 +1,92 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "snapshot.h"
+#include "test.h"
+
+#define PUBLISHES 2000000
+#define READERS 3
+
+// Every word of a value holds the number of its publish, so a torn copy shows as a mix
+typedef struct
+{
+    uint32_t words[61];
+} Value;
+
+SNAPSHOT_DEFINE(VALUES, Value);
+
+static bool writer_done = false;
+
+static void*
+writer(void* arg)
+{
+    Value value;
+    for (uint32_t n = 1; n <= PUBLISHES; ++n) {
+        for (size_t i = 0; i < sizeof(value.words) / sizeof(value.words[0]); ++i) {
+            value.words[i] = n;
+        }
+        snapshot_publish(&VALUES, &value);
+    }
+    __atomic_store_n(&writer_done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void*
+reader(void* arg)
+{
+    long* torn = (long*)arg;
+    uint32_t last = 0;
+    Value value;
+    while (!__atomic_load_n(&writer_done, __ATOMIC_ACQUIRE)) {
+        const uint32_t publishes = snapshot_read(&VALUES, &value);
+        bool consistent = value.words[0] == publishes && publishes >= last;
+        for (size_t i = 1; i < sizeof(value.words) / sizeof(value.words[0]); ++i) {
+            consistent = consistent && value.words[i] == value.words[0];
+        }
+        if (!consistent) {
+            ++*torn;
+        }
+        last = publishes;
+    }
+    return NULL;
+}
+
+static void
+test_sequential(void)
+{
+    Value value;
+    memset(&value, 0xff, sizeof(value));
+    CHECK(snapshot_read(&VALUES, &value) == 0);
+    CHECK(value.words[0] == 0 && value.words[60] == 0);
+    CHECK(snapshot_sequence(&VALUES) == 0);
+}
+
+static void
+test_torn_reads(void)
+{
+    pthread_t writer_thread, reader_threads[READERS];
+    long torn[READERS] = { 0 };
+    for (int i = 0; i < READERS; ++i) {
+        pthread_create(&reader_threads[i], NULL, reader, &torn[i]);
+    }
+    pthread_create(&writer_thread, NULL, writer, NULL);
+    pthread_join(writer_thread, NULL);
+    for (int i = 0; i < READERS; ++i) {
+        pthread_join(reader_threads[i], NULL);
+        CHECK_MSG(torn[i] == 0, "reader %d accepted %ld torn or stale values", i, torn[i]);
+    }
+
+    Value value;
+    CHECK(snapshot_read(&VALUES, &value) == PUBLISHES);
+    CHECK(value.words[0] == PUBLISHES);
+    CHECK(snapshot_sequence(&VALUES) == PUBLISHES);
+}
+
+int
+main(void)
+{
+    test_sequential();
+    test_torn_reads();
+    return test_result();
+}
@@ -0,0 +1,243 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "spectrum_map.h"
+#include "test.h"
+
+/* spectrum_log2() and the colour indices against libm, the row bands, and columns per second */
+
+#define BINS 256 // of the 512 point frames of microphoneTask
+#define ROWS 60  // CANVAS_HEIGHT
+#define DB_LOW 40.0f
+#define DB_HIGH 100.0f
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+// A random positive normal float, uniform in the exponent
+static float
+random_power(void)
+{
+    uint32_t bits = random_next() & 0x7fffffff;
+    bits = bits < 0x00800000 ? bits | 0x00800000 : bits;
+    bits = bits >= 0x7f800000 ? bits - 0x00800000 : bits;
+    float power;
+    memcpy(&power, &bits, sizeof(power));
+    return power;
+}
+
+/**
+ * Every mantissa at one exponent, where the error is that of the cubic alone, and random floats
+ * of all exponents, where the sum with the exponent rounds as well. The header promises 0.0009,
+ * which is 0.003 dB.
+ */
+static void
+test_log2(void)
+{
+    double worst = 0;
+    for (uint32_t mantissa = 0; mantissa < (1u << 23); ++mantissa) {
+        const uint32_t bits = 0x3f800000 | mantissa;
+        float x;
+        memcpy(&x, &bits, sizeof(x));
+        const double error = fabs(spectrum_log2(x) - log2((double)x));
+        worst = error > worst ? error : worst;
+    }
+    for (int i = 0; i < 10000000; ++i) {
+        const float x = random_power();
+        const double error = fabs(spectrum_log2(x) - log2((double)x));
+        worst = error > worst ? error : worst;
+    }
+    CHECK_MSG(worst < 0.0009, "log2 off by %g", worst);
+    CHECK(spectrum_log2(1.0f) == 0.0f && spectrum_log2(2.0f) == 1.0f && spectrum_log2(0.25f) == -2.0f);
+    CHECK(spectrum_log2(0.0f) <= -126.0f);
+    printf("%-40s %10.6f (%.4f dB)\n", "spectrum_log2 worst error", worst, worst * 10 * log10(2.0));
+}
+
+static uint8_t
+reference_index(double value, double low, double high)
+{
+    const double index = (value - low) * 255 / (high - low);
+    return index <= 0 ? 0 : index >= 255 ? 255 : (uint8_t)index;
+}
+
+/**
+ * One row per bin, so every index can be compared with one from 10 log10() or sqrt() in double:
+ * they differ by at most one, and only near the index boundaries.
+ */
+static void
+test_indices(void)
+{
+    static float power[BINS];
+    static uint8_t indices[BINS];
+    spectrum_map_t* log_map =
+      spectrum_map_init(BINS, SPECTRUM_BANDS_LINEAR, 31.25f, 0, BINS, SPECTRUM_SCALE_LOG, DB_LOW, DB_HIGH);
+    spectrum_map_t* linear_map =
+      spectrum_map_init(BINS, SPECTRUM_BANDS_LINEAR, 31.25f, 0, BINS, SPECTRUM_SCALE_LINEAR, 0.0f, 1e5f);
+    unsigned log_off_by_one = 0, linear_off_by_one = 0, total = 0;
+    for (int column = 0; column < 20000; ++column) {
+        // From below the low level to above the high one, and some exact zeros
+        for (int k = 0; k < BINS; ++k) {
+            const double db = DB_LOW - 10 + (random_next() >> 8) / 16777216.0 * (DB_HIGH - DB_LOW + 20);
+            power[k] = random_next() % 64 == 0 ? 0.0f : (float)pow(10, db / 10);
+        }
+        spectrum_map_execute(log_map, power, indices);
+        for (int k = 0; k < BINS; ++k) {
+            const uint8_t expected =
+              power[k] == 0 ? 0 : reference_index(10 * log10((double)power[k]), DB_LOW, DB_HIGH);
+            const int difference = abs(indices[k] - expected);
+            CHECK_MSG(difference <= 1, "%g: index %u, log10 gives %u", power[k], indices[k], expected);
+            log_off_by_one += difference != 0;
+        }
+
+        for (int k = 0; k < BINS; ++k) {
+            power[k] = (random_next() >> 8) / 16777216.0f * 1.2e10f;
+        }
+        spectrum_map_execute(linear_map, power, indices);
+        for (int k = 0; k < BINS; ++k) {
+            const int difference = abs(indices[k] - reference_index(sqrt((double)power[k]), 0, 1e5));
+            CHECK_MSG(difference <= 1, "%g: index %u", power[k], indices[k]);
+            linear_off_by_one += difference != 0;
+        }
+        total += BINS;
+    }
+    // log2 is within 0.003 dB, a 60 dB range has 0.24 dB per index
+    CHECK_MSG(log_off_by_one < total / 40, "%u of %u log indices off by one", log_off_by_one, total);
+    CHECK_MSG(linear_off_by_one < total / 10000, "%u of %u linear indices off", linear_off_by_one, total);
+    printf("%-40s %10.4f %%\n", "log indices off by one", 100.0 * log_off_by_one / total);
+    spectrum_map_destroy(log_map);
+    spectrum_map_destroy(linear_map);
+}
+
+/**
+ * The rows of a mel map cover the bins in increasing order without gaps, a row shares a bin with
+ * the one below when their edge falls inside it, and each row shows its strongest bin.
+ */
+static void
+test_bands(void)
+{
+    static float power[BINS];
+    static uint8_t indices[ROWS];
+    spectrum_map_t* map =
+      spectrum_map_init(ROWS, SPECTRUM_BANDS_MEL, 31.25f, 1, BINS, SPECTRUM_SCALE_LOG, DB_LOW, DB_HIGH);
+    CHECK(map->bands[0] == 1 && map->bands[2 * ROWS - 1] == BINS);
+    for (int k = 0; k < ROWS; ++k) {
+        const int first = map->bands[2 * k], end = map->bands[2 * k + 1];
+        CHECK_MSG(first < end, "row %d: %d .. %d", k, first, end);
+        if (k > 0) {
+            const int previous_first = map->bands[2 * k - 2], previous_end = map->bands[2 * k - 1];
+            CHECK_MSG(first >= previous_first && first <= previous_end && first >= previous_end - 1 &&
+                        end >= previous_end,
+                      "row %d: %d .. %d after %d .. %d",
+                      k,
+                      first,
+                      end,
+                      previous_first,
+                      previous_end);
+        }
+    }
+    // The top rows span several bins
+    CHECK(map->bands[2 * ROWS - 1] - map->bands[2 * ROWS - 2] > 5);
+
+    for (int k = 0; k < BINS; ++k) {
+        power[k] = 1e4f;
+    }
+    const int loud = 200;
+    power[loud] = 1e9f;
+    spectrum_map_execute(map, power, indices);
+    for (int k = 0; k < ROWS; ++k) {
+        const int contains = map->bands[2 * k] <= loud && loud < map->bands[2 * k + 1];
+        CHECK_MSG(indices[k] == (contains ? 212 : 0), "row %d: index %u", k, indices[k]);
+    }
+    spectrum_map_destroy(map);
+
+    CHECK(spectrum_map_init(0, SPECTRUM_BANDS_MEL, 31.25f, 1, BINS, SPECTRUM_SCALE_LOG, 0, 1) == NULL);
+    CHECK(spectrum_map_init(ROWS, SPECTRUM_BANDS_MEL, 31.25f, 10, 10, SPECTRUM_SCALE_LOG, 0, 1) == NULL);
+    CHECK(spectrum_map_init(ROWS, SPECTRUM_BANDS_MEL, 0.0f, 1, BINS, SPECTRUM_SCALE_LOG, 0, 1) == NULL);
+    CHECK(spectrum_map_init(ROWS, SPECTRUM_BANDS_MEL, 31.25f, 1, BINS, SPECTRUM_SCALE_LOG, 1, 1) == NULL);
+}
+
+/**
+ * The column of the old spectrogram, double sqrt() and a long divide per row, against the mel
+ * rows in dB, and spectrum_log2() against log10f() alone.
+ */
+static void
+bench_columns(void)
+{
+    enum { COLUMNS = 200000 };
+    static float spectrum[2 * BINS], power[BINS];
+    static uint8_t indices[ROWS];
+    for (int k = 0; k < 2 * BINS; ++k) {
+        spectrum[k] = (int32_t)random_next() / 2147483648.0f * 1000;
+    }
+    for (int k = 0; k < BINS; ++k) {
+        power[k] = spectrum[2 * k] * spectrum[2 * k] + spectrum[2 * k + 1] * spectrum[2 * k + 1];
+    }
+    spectrum_map_t* map =
+      spectrum_map_init(ROWS, SPECTRUM_BANDS_MEL, 31.25f, 1, BINS, SPECTRUM_SCALE_LOG, DB_LOW, DB_HIGH);
+    unsigned sink = 0;
+
+    double start = bench_now();
+    for (int column = 0; column < COLUMNS; ++column) {
+        for (int k = 0; k < ROWS; ++k) {
+            const float* bin = spectrum + 2 * (k + column % 4);
+            const long data = (long)sqrt(bin[0] * bin[0] + bin[1] * bin[1]);
+            indices[k] = (uint8_t)(data * 256 / 2000);
+        }
+        sink += indices[column % ROWS];
+    }
+    bench_report("60 rows, double sqrt and divide", bench_now() - start, COLUMNS, "column");
+
+    start = bench_now();
+    for (int column = 0; column < COLUMNS; ++column) {
+        power[column % BINS] += 1;
+        spectrum_map_execute(map, power, indices);
+        sink += indices[column % ROWS];
+    }
+    bench_report("60 mel rows in dB, spectrum_map", bench_now() - start, COLUMNS, "column");
+    spectrum_map_destroy(map);
+
+    // Like for like, the first 60 bins in magnitude
+    map = spectrum_map_init(ROWS, SPECTRUM_BANDS_LINEAR, 31.25f, 0, ROWS, SPECTRUM_SCALE_LINEAR, 0.0f, 2e3f);
+    start = bench_now();
+    for (int column = 0; column < COLUMNS; ++column) {
+        power[column % ROWS] += 1;
+        spectrum_map_execute(map, power, indices);
+        sink += indices[column % ROWS];
+    }
+    bench_report("60 bins in magnitude, spectrum_map", bench_now() - start, COLUMNS, "column");
+
+    enum { VALUES = 10000000 };
+    float sum = 0;
+    start = bench_now();
+    for (int i = 0; i < VALUES; ++i) {
+        sum += spectrum_log2(power[i % BINS]);
+    }
+    bench_report("spectrum_log2", bench_now() - start, VALUES, "value");
+    start = bench_now();
+    for (int i = 0; i < VALUES; ++i) {
+        sum += log10f(power[i % BINS]);
+    }
+    bench_report("log10f", bench_now() - start, VALUES, "value");
+    CHECK(sink != 0 && sum != 0);
+    spectrum_map_destroy(map);
+}
+
+int
+main(void)
+{
+    test_log2();
+    test_indices();
+    test_bands();
+    bench_columns();
+    return test_result();
+}
@@ -0,0 +1,315 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "stft.h"
+#include "test.h"
+
+/* The STFT on synthetic tones: bin levels, leakage, Welch averaging, streaming, and samples per second */
+
+#define NFFT 512 // the frame of microphoneTask
+#define BINS (NFFT / 2)
+#define STREAM_SIZE (64 * NFFT)
+
+static uint32_t random_state = 2463534242u;
+
+static uint32_t
+random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static int16_t stream[STREAM_SIZE];
+
+// amplitude sin(2 pi bin t / NFFT + phase), bin may be fractional
+static void
+fill_tone(double bin, double amplitude, double phase)
+{
+    for (int i = 0; i < STREAM_SIZE; ++i) {
+        stream[i] = (int16_t)floor(amplitude * sin(2 * M_PI * bin * i / NFFT + phase) + 0.5);
+    }
+}
+
+/**
+ * Writes the stream in chunks of chunk samples, like the i2s reads of microphoneTask, and keeps
+ * the last complete column. Returns the number of columns.
+ */
+static int
+run(stft_t* stft, int chunk, float* column)
+{
+    int columns = 0;
+    for (int offset = 0; offset < STREAM_SIZE; offset += chunk) {
+        const int16_t* samples = stream + offset;
+        int count = offset + chunk <= STREAM_SIZE ? chunk : STREAM_SIZE - offset;
+        while (count > 0) {
+            const int used = stft_write(stft, samples, count);
+            samples += used;
+            count -= used;
+            columns += stft_read(stft, column);
+        }
+    }
+    return columns;
+}
+
+static double
+db(double power_ratio)
+{
+    return 10 * log10(power_ratio);
+}
+
+static int
+peak_bin(const float* column)
+{
+    int peak = 0;
+    for (int k = 1; k < BINS; ++k) {
+        peak = column[k] > column[peak] ? k : peak;
+    }
+    return peak;
+}
+
+/**
+ * A tone centred on a bin reads (A size / 2)^2 there with either window, any overlap and
+ * averaging, and a tone between two bins peaks at the nearer one, down by no more than the
+ * scalloping loss of the window (1.42 dB Hann, 1.10 dB Blackman).
+ */
+static void
+test_bins(void)
+{
+    static float column[BINS];
+    static const stft_window_t WINDOWS[] = { STFT_WINDOW_HANN, STFT_WINDOW_BLACKMAN };
+    static const double SCALLOPING_DB[] = { 1.42, 1.10 };
+    static const int HOPS[] = { NFFT / 2, NFFT / 4 };
+    const double amplitude = 8000;
+    const double expected = (amplitude * NFFT / 2) * (amplitude * NFFT / 2);
+    double worst_centred = 0, worst_between = 0;
+
+    for (int w = 0; w < 2; ++w) {
+        for (int h = 0; h < 2; ++h) {
+            for (int averages = 1; averages <= 4; averages *= 2) {
+                for (int bin = 3; bin < BINS - 3; bin += 31) {
+                    stft_t* stft = stft_init(NFFT, HOPS[h], WINDOWS[w], BINS, averages);
+                    fill_tone(bin, amplitude, 0.3 * bin);
+                    CHECK(run(stft, 100, column) > 0);
+                    const double centred = fabs(db(column[bin] / expected));
+                    CHECK_MSG(peak_bin(column) == bin && centred < 0.05,
+                              "window %d, hop %d, bin %d: peak %d, %.3f dB off",
+                              w,
+                              HOPS[h],
+                              bin,
+                              peak_bin(column),
+                              centred);
+                    worst_centred = centred > worst_centred ? centred : worst_centred;
+
+                    fill_tone(bin + 0.4, amplitude, 0);
+                    stft_destroy(stft);
+                    stft = stft_init(NFFT, HOPS[h], WINDOWS[w], BINS, averages);
+                    run(stft, 100, column);
+                    const double loss = -db(column[bin] / expected);
+                    CHECK_MSG(peak_bin(column) == bin && loss < SCALLOPING_DB[w],
+                              "window %d, bin %d.4: peak %d, %.2f dB down",
+                              w,
+                              bin,
+                              peak_bin(column),
+                              loss);
+                    worst_between = loss > worst_between ? loss : worst_between;
+                    stft_destroy(stft);
+                }
+            }
+        }
+    }
+    printf("%-40s %10.3f dB\n", "centred tone, worst level error", worst_centred);
+    printf("%-40s %10.3f dB\n", "tone 0.4 bins off, worst loss", worst_between);
+}
+
+// Strongest bin at least distance bins away from the tone, relative to the tone bin, in dB
+static double
+leakage_db(const float* column, int bin, int distance)
+{
+    double strongest = 0;
+    for (int k = 0; k < BINS; ++k) {
+        if (abs(k - bin) >= distance && column[k] > strongest) {
+            strongest = column[k];
+        }
+    }
+    return db(strongest / column[bin]);
+}
+
+/**
+ * A loud tone between two bins, the worst case for leakage, next to what the unwindowed snapshot
+ * of the old spectrogram did with it: 1/(pi d) falls off so slowly that bins far away still get
+ * a share, where the sidelobes of Hann and Blackman are far below.
+ */
+static void
+test_leakage(void)
+{
+    static float column[BINS];
+    const int bin = 60;
+    fill_tone(bin + 0.5, 16000, 0);
+
+    static FFT_ALIGNED float input[NFFT], output[NFFT];
+    for (int i = 0; i < NFFT; ++i) {
+        input[i] = stream[i];
+    }
+    fft_plan_execute(fft_plan_get(NFFT, FFT_REAL, FFT_FORWARD), input, output);
+    for (int k = 1; k < BINS; ++k) {
+        column[k] = output[2 * k] * output[2 * k] + output[2 * k + 1] * output[2 * k + 1];
+    }
+    column[0] = output[0] * output[0];
+    const double rectangular = leakage_db(column, bin, 10);
+
+    stft_t* stft = stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, BINS, 2);
+    run(stft, 256, column);
+    const double hann = leakage_db(column, bin, 10);
+    stft_destroy(stft);
+    stft = stft_init(NFFT, NFFT / 2, STFT_WINDOW_BLACKMAN, BINS, 2);
+    run(stft, 256, column);
+    const double blackman = leakage_db(column, bin, 10);
+    const double blackman_near = leakage_db(column, bin, 4);
+    stft_destroy(stft);
+
+    CHECK_MSG(rectangular > -30, "unwindowed %.1f dB", rectangular);
+    CHECK_MSG(hann < -60, "Hann %.1f dB", hann);
+    CHECK_MSG(blackman < -60 && blackman_near < -55,
+              "Blackman %.1f dB, %.1f dB from 4 bins",
+              blackman,
+              blackman_near);
+    printf("%-40s %10.1f dB\n", "leakage 10 bins off, unwindowed", rectangular);
+    printf("%-40s %10.1f dB\n", "leakage 10 bins off, Hann", hann);
+    printf("%-40s %10.1f dB\n", "leakage 10 bins off, Blackman", blackman);
+}
+
+// Relative standard deviation of the bins of a column
+static double
+spread(const float* column)
+{
+    double sum = 0, squares = 0;
+    for (int k = 1; k < BINS; ++k) {
+        sum += column[k];
+        squares += (double)column[k] * column[k];
+    }
+    const double mean = sum / (BINS - 1);
+    return sqrt(squares / (BINS - 1) - mean * mean) / mean;
+}
+
+/**
+ * White noise: single frames scatter their bins about as much as their mean (the spread of an
+ * exponential distribution), Welch averaging of half overlapping Hann frames brings that down by
+ * nearly the square root of the frames, while the mean level stays.
+ */
+static void
+test_welch(void)
+{
+    static float single[BINS], averaged[BINS];
+    for (int i = 0; i < STREAM_SIZE; ++i) {
+        stream[i] = (int16_t)((int32_t)random_next() >> 20);
+    }
+    stft_t* stft = stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, BINS, 1);
+    run(stft, 256, single);
+    stft_destroy(stft);
+    stft = stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, BINS, 16);
+    run(stft, 256, averaged);
+    stft_destroy(stft);
+
+    double single_mean = 0, averaged_mean = 0;
+    for (int k = 1; k < BINS; ++k) {
+        single_mean += single[k];
+        averaged_mean += averaged[k];
+    }
+    const double difference = db(averaged_mean / single_mean);
+    CHECK_MSG(spread(single) > 0.8 && spread(averaged) < 0.35,
+              "spread %.2f and %.2f",
+              spread(single),
+              spread(averaged));
+    CHECK_MSG(fabs(difference) < 1, "levels %.2f dB apart", difference);
+    printf("%-40s %10.2f\n", "noise spread, 1 frame", spread(single));
+    printf("%-40s %10.2f\n", "noise spread, Welch over 16 frames", spread(averaged));
+}
+
+/**
+ * Columns come every averages hops once the first frame is complete, whatever the chunks the
+ * samples arrive in, and the chunking does not change them. A complete column blocks writing.
+ */
+static void
+test_stream(void)
+{
+    static float column[BINS], expected[BINS];
+    fill_tone(20.25, 3000, 1);
+    static const int HOPS[] = { NFFT, NFFT / 2, NFFT / 4, 100 };
+    for (int h = 0; h < 4; ++h) {
+        for (int averages = 1; averages <= 3; ++averages) {
+            const int hop = HOPS[h];
+            const int frames = (STREAM_SIZE - NFFT) / hop + 1;
+            stft_t* stft = stft_init(NFFT, hop, STFT_WINDOW_BLACKMAN, BINS, averages);
+            CHECK(run(stft, STREAM_SIZE, expected) == frames / averages);
+            stft_destroy(stft);
+
+            static const int CHUNKS[] = { 1, 7, 256, 1000 };
+            for (int c = 0; c < 4; ++c) {
+                stft = stft_init(NFFT, hop, STFT_WINDOW_BLACKMAN, BINS, averages);
+                const int columns = run(stft, CHUNKS[c], column);
+                CHECK_MSG(columns == frames / averages && memcmp(column, expected, sizeof(column)) == 0,
+                          "hop %d, averages %d, chunks of %d: %d columns",
+                          hop,
+                          averages,
+                          CHUNKS[c],
+                          columns);
+                stft_destroy(stft);
+            }
+        }
+    }
+
+    stft_t* stft = stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, 8, 1);
+    CHECK(stft_read(stft, column) == 0);
+    CHECK(stft_write(stft, stream, STREAM_SIZE) == NFFT);
+    CHECK(stft_write(stft, stream, STREAM_SIZE) == 0);
+    CHECK(stft_read(stft, column) == 1 && stft_read(stft, column) == 0);
+    CHECK(stft_write(stft, stream, STREAM_SIZE) == NFFT / 2);
+    stft_destroy(stft);
+
+    CHECK(stft_init(384, 128, STFT_WINDOW_HANN, 8, 1) == NULL);
+    CHECK(stft_init(NFFT, 0, STFT_WINDOW_HANN, 8, 1) == NULL);
+    CHECK(stft_init(NFFT, NFFT + 1, STFT_WINDOW_HANN, 8, 1) == NULL);
+    CHECK(stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, 0, 1) == NULL);
+    CHECK(stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, BINS + 1, 1) == NULL);
+    CHECK(stft_init(NFFT, NFFT / 2, STFT_WINDOW_HANN, 8, 0) == NULL);
+}
+
+// Samples per second through 512 point frames at 50% and 75% overlap, in the chunks of microphoneTask
+static void
+bench_stream(void)
+{
+    static float column[BINS];
+    fill_tone(37.3, 8000, 0);
+    static const int HOPS[] = { NFFT / 2, NFFT / 4 };
+    for (int h = 0; h < 2; ++h) {
+        stft_t* stft = stft_init(NFFT, HOPS[h], STFT_WINDOW_HANN, BINS, 2);
+        enum { ROUNDS = 20 };
+        int columns = 0;
+        const double start = bench_now();
+        for (int round = 0; round < ROUNDS; ++round) {
+            columns += run(stft, HOPS[h], column);
+        }
+        const double seconds = bench_now() - start;
+        CHECK(columns > 0);
+        char name[40];
+        snprintf(name, sizeof(name), "512 point Hann frames, hop %d", HOPS[h]);
+        printf("%-40s %10.0f samples/s\n", name, (double)ROUNDS * STREAM_SIZE / seconds);
+        stft_destroy(stft);
+    }
+}
+
+int
+main(void)
+{
+    test_bins();
+    test_leakage();
+    test_welch();
+    test_stream();
+    bench_stream();
+    return test_result();
+}
@@ -0,0 +1,268 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "test.h"
+#include "track_log.h"
+#include "track_synth.h"
+
+/* The track log through its file API, on a multi-million point track and across power losses */
+
+#define BENCH_POINTS 2000000
+#define CRASH_TRIALS 400
+#define CRASH_POINTS 6000
+
+/**
+ * Storage that loses power: fwrite() and fsync() of the log are linked to these. Once
+ * `power_budget` bytes are written a write stops part way, and from then on nothing reaches the
+ * file while the log still sees its writes succeed.
+ */
+size_t __real_fwrite(const void* data, size_t size, size_t count, FILE* file);
+
+static long power_budget = -1; // bytes until the power loss, -1 for none
+static bool powered_off;
+static uint32_t syncs;
+
+size_t
+__wrap_fwrite(const void* data, size_t size, size_t count, FILE* file)
+{
+    if (powered_off) {
+        return count;
+    }
+    const long bytes = (long)(size * count);
+    if (power_budget >= 0 && bytes > power_budget) {
+        __real_fwrite(data, 1, power_budget, file);
+        powered_off = true;
+        return count;
+    }
+    if (power_budget >= 0) {
+        power_budget -= bytes;
+    }
+    return __real_fwrite(data, size, count, file);
+}
+
+// The host disk is not the SD card, syncing it would only measure the disk
+int
+__wrap_fsync(int fd)
+{
+    ++syncs;
+    return 0;
+}
+
+static bool
+same_position(const GpsPosition* a, const GpsPosition* b)
+{
+    return a->unix_time == b->unix_time && a->latitude_e7 == b->latitude_e7 &&
+           a->longitude_e7 == b->longitude_e7 && a->altitude_cm == b->altitude_cm &&
+           a->satellites == b->satellites;
+}
+
+static GpsPosition*
+make_track(size_t count, uint32_t seed)
+{
+    GpsPosition* track = malloc(count * sizeof(*track));
+    TrackSynth synth;
+    track_synth_init(&synth, seed);
+    for (size_t i = 0; i < count; ++i) {
+        track_synth_next(&synth, &track[i]);
+    }
+    return track;
+}
+
+static void
+temp_path(char* path, size_t size)
+{
+    const char* dir = getenv("TMPDIR");
+    snprintf(path, size, "%s/track_log_XXXXXX", dir != NULL ? dir : "/tmp");
+    close(mkstemp(path));
+}
+
+// Reads the whole log, returns the number of points or -1 once one is not `expected[i]`
+static long
+read_all(const char* path, const GpsPosition* const* expected, size_t count)
+{
+    TrackLogReader reader;
+    if (!track_log_reader_open(&reader, path)) {
+        return -1;
+    }
+    long read = 0;
+    GpsPosition position;
+    while (track_log_reader_next(&reader, &position)) {
+        if ((size_t)read >= count || !same_position(&position, expected[read])) {
+            read = -1;
+            break;
+        }
+        ++read;
+    }
+    track_log_reader_close(&reader);
+    return read;
+}
+
+// The first point at or after `time` through seek, against a binary search of the points
+static bool
+check_seek(TrackLogReader* reader, const GpsPosition* const* points, size_t count, uint32_t time)
+{
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (points[middle]->unix_time < time) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    GpsPosition position;
+    track_log_reader_seek(reader, time);
+    const bool found = track_log_reader_next(reader, &position);
+    return low == count ? !found : found && same_position(&position, points[low]);
+}
+
+/**
+ * Writes the track with the log closed and reopened every 100k points, reads it back and seeks
+ * into it. Reports the cost per point with fsync left out, and the size.
+ */
+static void
+bench_track(void)
+{
+    GpsPosition* track = make_track(BENCH_POINTS, 12345);
+    const GpsPosition** points = malloc(BENCH_POINTS * sizeof(*points));
+    for (size_t i = 0; i < BENCH_POINTS; ++i) {
+        points[i] = &track[i];
+    }
+    char path[256];
+    temp_path(path, sizeof(path));
+
+    static TrackLog log;
+    syncs = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < BENCH_POINTS; ++i) {
+        if (i % 100000 == 0) {
+            if (i > 0) {
+                track_log_close(&log);
+            }
+            CHECK(track_log_open(&log, path));
+        }
+        CHECK(track_log_append(&log, &track[i]));
+    }
+    track_log_close(&log);
+    const double write_seconds = bench_now() - start;
+
+    start = bench_now();
+    CHECK(read_all(path, points, BENCH_POINTS) == BENCH_POINTS);
+    const double read_seconds = bench_now() - start;
+
+    static TrackLogReader reader;
+    CHECK(track_log_reader_open(&reader, path));
+    const uint32_t first = track[0].unix_time;
+    const uint32_t span = track[BENCH_POINTS - 1].unix_time - first + 2;
+    unsigned wrong = 0;
+    start = bench_now();
+    for (uint32_t i = 0; i < 10000; ++i) {
+        const uint32_t time = first - 1 + (uint32_t)((uint64_t)i * 7919 % span);
+        wrong += !check_seek(&reader, points, BENCH_POINTS, time);
+    }
+    const double seek_seconds = bench_now() - start;
+    CHECK_MSG(wrong == 0, "%u seeks went wrong", wrong);
+    const uint32_t blocks = reader.block_count;
+    track_log_reader_close(&reader);
+
+    // One write per flush, up to two more as a block fills and one as the log is closed
+    CHECK(syncs <= BENCH_POINTS / TRACK_LOG_FLUSH_POINTS + 2 * blocks + BENCH_POINTS / 100000);
+    printf("%-40s %10.2f B/point\n", "track log size", (double)blocks * TRACK_LOG_BLOCK_SIZE / BENCH_POINTS);
+    bench_report("track log append, fsync not timed", write_seconds, BENCH_POINTS, "point");
+    bench_report("track log read", read_seconds, BENCH_POINTS, "point");
+    bench_report("track log seek and first point", seek_seconds, 10000, "seek");
+    remove(path);
+    free(points);
+    free(track);
+}
+
+/**
+ * Appends the track with power lost at random bytes of the writes, then reopens the log the way
+ * the device does after a restart. What is readable must be the points before the loss with
+ * at most those since the last flush missing and none twice, appending has to continue right
+ * after them, and seek must find them.
+ */
+static void
+test_power_loss(void)
+{
+    GpsPosition* track = make_track(3 * CRASH_POINTS, 777);
+    const GpsPosition** expected = malloc(3 * CRASH_POINTS * sizeof(*expected));
+    char path[256];
+    temp_path(path, sizeof(path));
+    uint32_t random = 2463534242u;
+
+    unsigned losses = 0;
+    unsigned max_lost = 0;
+    for (int trial = 0; trial < CRASH_TRIALS; ++trial) {
+        remove(path);
+        size_t durable = 0; // points in `expected`, the log has to return exactly these
+        size_t next = 0;    // next point of the track to append
+        for (int round = 0; round < 3; ++round) {
+            static TrackLog log;
+            CHECK(track_log_open(&log, path));
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            power_budget = random % (120 * TRACK_LOG_BLOCK_SIZE);
+            powered_off = false;
+            const size_t first = next;
+            while (next < first + CRASH_POINTS && !powered_off) {
+                track_log_append(&log, &track[next++]);
+            }
+            if (powered_off) {
+                ++losses;
+                fclose(log.file); // the file as the power loss left it
+            } else {
+                power_budget = -1;
+                track_log_close(&log);
+            }
+            power_budget = -1;
+            powered_off = false;
+
+            // The points of this round that came through, the first ones of it in order
+            for (size_t i = first; i < next; ++i) {
+                expected[durable + i - first] = &track[i];
+            }
+            const long read = read_all(path, expected, durable + next - first);
+            CHECK_MSG(read >= (long)durable,
+                      "trial %d round %d: %ld points read, %zu expected",
+                      trial,
+                      round,
+                      read,
+                      durable);
+            if (read < (long)durable) {
+                break;
+            }
+            const unsigned lost = (unsigned)(durable + next - first - read);
+            max_lost = lost > max_lost ? lost : max_lost;
+            CHECK_MSG(
+              lost <= TRACK_LOG_FLUSH_POINTS, "trial %d round %d: %u points lost", trial, round, lost);
+            durable = read;
+        }
+
+        static TrackLogReader reader;
+        CHECK(track_log_reader_open(&reader, path));
+        unsigned wrong = 0;
+        for (size_t i = 0; i < durable; i += 97) {
+            wrong += !check_seek(&reader, expected, durable, expected[i]->unix_time);
+        }
+        track_log_reader_close(&reader);
+        CHECK_MSG(wrong == 0, "trial %d: %u seeks went wrong", trial, wrong);
+    }
+    CHECK(losses > CRASH_TRIALS);
+    printf("%-40s %10u points\n", "track log, most lost at a power loss", max_lost);
+    remove(path);
+    free(expected);
+    free(track);
+}
+
+int
+main(void)
+{
+    test_power_loss();
+    bench_track();
+    return test_result();
+}
@@ -0,0 +1,266 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "cbor_decode.h"
+#include "env3.h"
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "geofence.h"
+#include "gps_track.h"
+#include "scheduler.h"
+#include "sensor_history.h"
+#include "test.h"
+
+/* The handlers of web.c, served from fake requests instead of a socket */
+
+esp_err_t get_sensors_history_handler(httpd_req_t* req);
+esp_err_t get_gps_track_handler(httpd_req_t* req);
+esp_err_t get_geofences_handler(httpd_req_t* req);
+esp_err_t post_geofences_handler(httpd_req_t* req);
+esp_err_t delete_geofences_handler(httpd_req_t* req);
+
+// What web.c needs from the rest of the firmware
+SemaphoreHandle_t xGuiSemaphore = NULL;
+
+SensorInfo
+get_sensor_info(void)
+{
+    const SensorInfo info = { .temperature = 21.5f, .humidity = 40.0f, .pressure = 1013.25f };
+    return info;
+}
+
+GpsPosition
+get_latest_gps_position(void)
+{
+    const GpsPosition position = { .latitude_e7 = 473977420, .longitude_e7 = 85455940, .is_valid = true };
+    return position;
+}
+
+uint32_t
+get_ip_address(void)
+{
+    return 0;
+}
+
+void
+scheduler_add(SchedulerJob* job, uint32_t delay_ms)
+{
+}
+
+static size_t
+count_substrings(const char* text, const char* pattern)
+{
+    size_t count = 0;
+    while (text != NULL && (text = strstr(text, pattern)) != NULL) {
+        ++count;
+        text += strlen(pattern);
+    }
+    return count;
+}
+
+static void
+set_now(uint32_t seconds)
+{
+    host_time_us = (int64_t)seconds * 1000000;
+}
+
+static void
+test_sensors_history(void)
+{
+    for (uint32_t t = 100; t < 110; ++t) {
+        sensor_history_append(SENSOR_CHANNEL_TEMPERATURE, t, 20.0f + (t - 100) * 0.25f);
+        if (t % 2 == 0) {
+            sensor_history_append(SENSOR_CHANNEL_BATTERY_VOLTAGE, t, 4.1f);
+        }
+    }
+    set_now(110);
+
+    httpd_req_t req;
+    host_http_request(&req, "from=104&to=107&step=1", NULL);
+    CHECK(get_sensors_history_handler(&req) == ESP_OK);
+    CHECK(req.chunked && req.finished);
+    CHECK(strcmp(req.content_type, "application/json") == 0);
+    CHECK_MSG(strcmp(req.response,
+                     "{\"now\":110,\"step\":1,\"samples\":["
+                     "{\"t\":104,\"temp\":21.00,\"bat_v\":4.10},{\"t\":105,\"temp\":21.25},"
+                     "{\"t\":106,\"temp\":21.50,\"bat_v\":4.10},{\"t\":107,\"temp\":21.75}]}")
+                == 0,
+              "%s",
+              req.response);
+    host_http_reset(&req);
+
+    // The same samples in CBOR, asked for at the end of an Accept list longer than any fixed buffer
+    host_http_request(&req,
+                      "from=104&to=107&step=1",
+                      "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,"
+                      "application/json;q=0.5,application/cbor");
+    CHECK(get_sensors_history_handler(&req) == ESP_OK);
+    CHECK(req.chunked && req.finished);
+    CHECK(strcmp(req.content_type, "application/cbor") == 0);
+    char text[512];
+    CHECK(cbor_diagnostic((const uint8_t*)req.response, req.response_length, text, sizeof(text))
+          == req.response_length);
+    CHECK_MSG(strcmp(text,
+                     "{\"now\": 110, \"step\": 1, \"samples\": [_ "
+                     "{\"t\": 104, \"temp\": 21.0, \"bat_v\": 4.1}, {\"t\": 105, \"temp\": 21.25}, "
+                     "{\"t\": 106, \"temp\": 21.5, \"bat_v\": 4.1}, {\"t\": 107, \"temp\": 21.75}]}")
+                == 0,
+              "%s",
+              text);
+    host_http_reset(&req);
+
+    // A send error stops the response instead of formatting the rest of it
+    host_http_request(&req, "from=0&step=1", NULL);
+    req.fail_after_chunks = 1;
+    CHECK(get_sensors_history_handler(&req) != ESP_OK);
+    host_http_reset(&req);
+}
+
+static void
+test_sensors_history_range_is_bounded(void)
+{
+    for (uint32_t t = 1000; t < 9000; ++t) {
+        sensor_history_append(SENSOR_CHANNEL_PRESSURE, t, 1000.0f);
+    }
+    set_now(9000);
+
+    // `to` far in the future must not make the handler walk through 2^32 seconds
+    httpd_req_t req;
+    host_http_request(&req, "from=0&to=4294967295&step=1", NULL);
+    const double start = bench_now();
+    CHECK(get_sensors_history_handler(&req) == ESP_OK);
+    const double elapsed = bench_now() - start;
+    CHECK(req.finished);
+    const size_t samples = count_substrings(req.response, "{\"t\":");
+    CHECK_MSG(samples == 3600, "%zu samples", samples);
+    bench_report("GET /sensors/history, 1 h of seconds", elapsed, samples, "sample");
+    printf("%-40s %10.1f MB/s\n", "GET /sensors/history throughput", req.response_length / elapsed / 1e6);
+    const size_t json_length = req.response_length;
+    host_http_reset(&req);
+
+    host_http_request(&req, "from=0&to=4294967295&step=1", "application/cbor");
+    const double cbor_start = bench_now();
+    CHECK(get_sensors_history_handler(&req) == ESP_OK);
+    const double cbor_elapsed = bench_now() - cbor_start;
+    CHECK(req.finished);
+    char* text = malloc(req.response_length * 4);
+    CHECK(cbor_diagnostic((const uint8_t*)req.response, req.response_length, text, req.response_length * 4)
+          == req.response_length);
+    const size_t cbor_samples = count_substrings(text, "{\"t\": ");
+    CHECK_MSG(cbor_samples == 3600, "%zu samples", cbor_samples);
+    free(text);
+    bench_report("GET /sensors/history CBOR, 1 h", cbor_elapsed, cbor_samples, "sample");
+    printf("%-40s %10zu bytes CBOR, %zu bytes JSON\n", "GET /sensors/history size", req.response_length,
+           json_length);
+    host_http_reset(&req);
+
+    host_http_request(&req, "from=4294967000&to=4294967295&step=1", NULL);
+    CHECK(get_sensors_history_handler(&req) == ESP_OK);
+    CHECK(strcmp(req.response, "{\"now\":9000,\"step\":1,\"samples\":[]}") == 0);
+    host_http_reset(&req);
+}
+
+static void
+test_gps_track(void)
+{
+    for (uint32_t t = 0; t < 5; ++t) {
+        const GpsPosition position = {
+            .latitude_e7 = 473977420 + (int32_t)t, .longitude_e7 = -85455940, .altitude_cm = 41000,
+            .satellites = 9, .unix_time = 1700000000 + t, .is_valid = true,
+        };
+        gps_track_append(200 + t, &position);
+    }
+    set_now(205);
+
+    httpd_req_t req;
+    host_http_request(&req, "from=202&to=203", NULL);
+    CHECK(get_gps_track_handler(&req) == ESP_OK);
+    CHECK(req.chunked && req.finished);
+    CHECK_MSG(strcmp(req.response,
+                     "{\"now\":205,\"track\":["
+                     "{\"t\":202,\"lat\":47.3977422,\"lng\":-8.5455940,\"alt\":410.00,"
+                     "\"sat\":9,\"ut\":1700000002},"
+                     "{\"t\":203,\"lat\":47.3977423,\"lng\":-8.5455940,\"alt\":410.00,"
+                     "\"sat\":9,\"ut\":1700000003}]}")
+                == 0,
+              "%s",
+              req.response);
+    host_http_reset(&req);
+}
+
+static int
+post_geofence(const char* body)
+{
+    httpd_req_t req;
+    host_http_request(&req, NULL, NULL);
+    req.method = HTTP_POST;
+    req.body = body;
+    req.content_len = strlen(body);
+    CHECK(post_geofences_handler(&req) == ESP_OK);
+    const int status = req.status;
+    host_http_reset(&req);
+    return status;
+}
+
+/**
+ * Fences through POST /geofences. Coordinates out of range are a bad request, also those past
+ * 32 bits that would wrap around to a valid coordinate once narrowed.
+ */
+static void
+test_post_geofences(void)
+{
+    CHECK(geofence_init(NULL));
+    CHECK(post_geofence("1 473977420 85455940 500") == 200);
+    CHECK(post_geofence("2,473900000,85400000, 474000000,85400000, 474000000,85500000") == 200);
+    CHECK(post_geofence("3 900000000 -1800000000 1000") == 200);
+    CHECK(post_geofence("4 -900000000 1800000000 1000") == 200);
+    CHECK(geofence_count() == 4);
+
+    static const char* const invalid[] = {
+        "5 900000001 85455940 500",
+        "5 -900000001 85455940 500",
+        "5 473977420 1800000001 500",
+        "5 473977420 -1800000001 500",
+        "5 4000000000 85455940 500", // -29.5° after narrowing
+        "5 473977420 4294967295 500",
+        "5 473900000 85400000 474000000 85400000 4294967000 85500000",
+        "5 473900000 85400000 474000000 2000000000 474000000 85500000",
+        "-5 473977420 85455940 500",
+        "5 473977420 85455940 -500",
+        "5 473977420 85455940 0",
+        "5 473977420 85455940 1000001",
+        "5 473977420 85455940",
+        "5 473977420 85455940 474000000 85400000",
+        "5 473977420 85455940 x",
+        "5 473977420 85455940 9999999999",
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        CHECK_MSG(post_geofence(invalid[i]) == 400, "\"%s\" was accepted", invalid[i]);
+    }
+    CHECK(geofence_count() == 4);
+
+    // The fix of get_latest_gps_position() is inside of fence 1 and 2
+    const GpsPosition position = get_latest_gps_position();
+    geofence_update(&position);
+    httpd_req_t req;
+    host_http_request(&req, NULL, NULL);
+    CHECK(get_geofences_handler(&req) == ESP_OK);
+    CHECK_MSG(strcmp(req.response, "{\"count\":4,\"inside\":[1,2]}") == 0, "%s", req.response);
+    host_http_reset(&req);
+    host_http_request(&req, NULL, NULL);
+    CHECK(delete_geofences_handler(&req) == ESP_OK);
+    CHECK_MSG(strcmp(req.response, "{\"count\":0,\"inside\":[]}") == 0, "%s", req.response);
+    host_http_reset(&req);
+}
+
+int
+main(void)
+{
+    CHECK(sensor_history_init());
+    test_sensors_history();
+    test_sensors_history_range_is_bounded();
+    test_gps_track();
+    test_post_geofences();
+    return test_result();
+}
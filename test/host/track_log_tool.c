@@ -0,0 +1,132 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "track_log.h"
+#include "track_synth.h"
+
+/**
+ * The track log on the host, for logs copied off the SD card and for trying the format:
+ *
+ *   track_log_tool synth <log> <points> [seed]  writes a new log with a synthetic 1 Hz track
+ *   track_log_tool dump <log> [from]            prints the points as CSV, from a unix time on
+ *   track_log_tool stats <log>                  counts blocks, copies and points
+ */
+
+static int
+usage(void)
+{
+    fprintf(stderr,
+            "usage: track_log_tool synth <log> <points> [seed]\n"
+            "       track_log_tool dump <log> [from]\n"
+            "       track_log_tool stats <log>\n");
+    return 2;
+}
+
+static int
+synth(const char* path, unsigned long points, uint32_t seed)
+{
+    static TrackLog log;
+    remove(path);
+    if (!track_log_open(&log, path)) {
+        return 1;
+    }
+    TrackSynth synth;
+    track_synth_init(&synth, seed);
+    GpsPosition position;
+    for (unsigned long i = 0; i < points; ++i) {
+        track_synth_next(&synth, &position);
+        if (!track_log_append(&log, &position)) {
+            track_log_close(&log);
+            return 1;
+        }
+    }
+    track_log_close(&log);
+    return 0;
+}
+
+static int
+dump(const char* path, uint32_t from)
+{
+    static TrackLogReader reader;
+    if (!track_log_reader_open(&reader, path)) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    if (from > 0) {
+        track_log_reader_seek(&reader, from);
+    }
+    printf("time,lat_e7,lon_e7,alt_cm,sats\n");
+    GpsPosition position;
+    while (track_log_reader_next(&reader, &position)) {
+        printf("%u,%d,%d,%d,%u\n",
+               position.unix_time,
+               position.latitude_e7,
+               position.longitude_e7,
+               position.altitude_cm,
+               position.satellites);
+    }
+    track_log_reader_close(&reader);
+    return 0;
+}
+
+static int
+stats(const char* path)
+{
+    static TrackLogReader reader;
+    if (!track_log_reader_open(&reader, path)) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    unsigned long damaged = 0;
+    unsigned long copies = 0;
+    uint32_t previous_first = 0;
+    bool previous_valid = false;
+    for (uint32_t i = 0; i < reader.block_count; ++i) {
+        TrackLogDecoder decoder;
+        fseek(reader.file, (long)i * TRACK_LOG_BLOCK_SIZE, SEEK_SET);
+        if (fread(reader.block, TRACK_LOG_BLOCK_SIZE, 1, reader.file) != 1 ||
+            !track_log_decoder_init(&decoder, reader.block)) {
+            ++damaged;
+            previous_valid = false;
+            continue;
+        }
+        const TrackLogBlockHeader* header = (const TrackLogBlockHeader*)reader.block;
+        copies += previous_valid && header->first_time == previous_first;
+        previous_first = header->first_time;
+        previous_valid = true;
+    }
+
+    unsigned long points = 0;
+    uint32_t first = 0;
+    uint32_t last = 0;
+    GpsPosition position;
+    while (track_log_reader_next(&reader, &position)) {
+        first = points++ == 0 ? position.unix_time : first;
+        last = position.unix_time;
+    }
+    const uint32_t blocks = reader.block_count;
+    track_log_reader_close(&reader);
+
+    printf("blocks    %u (%lu damaged, %lu second copies)\n", blocks, damaged, copies);
+    printf("points    %lu\n", points);
+    printf("time      %u - %u\n", first, last);
+    if (points > 0) {
+        printf("per point %.2f bytes\n", (double)blocks * TRACK_LOG_BLOCK_SIZE / points);
+    }
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc >= 4 && strcmp(argv[1], "synth") == 0) {
+        return synth(argv[2], strtoul(argv[3], NULL, 10), argc >= 5 ? strtoul(argv[4], NULL, 10) : 1);
+    }
+    if (argc >= 3 && strcmp(argv[1], "dump") == 0) {
+        return dump(argv[2], argc >= 4 ? strtoul(argv[3], NULL, 10) : 0);
+    }
+    if (argc == 3 && strcmp(argv[1], "stats") == 0) {
+        return stats(argv[2]);
+    }
+    return usage();
+}
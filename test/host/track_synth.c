@@ -0,0 +1,59 @@
+#include "track_synth.h"
+
+#include <string.h>
+
+// 08:30:15 on 17 June 2023 at 31.84637° N 117.1988283° E, like the NMEA log
+#define START_TIME 1686990615u
+#define START_LAT_E7 318463700
+#define START_LNG_E7 1171988283
+#define MAX_VELOCITY_E7 3000 // about 33 m/s
+
+static uint32_t
+random_next(TrackSynth* synth)
+{
+    synth->random ^= synth->random << 13;
+    synth->random ^= synth->random >> 17;
+    synth->random ^= synth->random << 5;
+    return synth->random;
+}
+
+static int32_t
+random_step(TrackSynth* synth, int32_t range)
+{
+    return (int32_t)(random_next(synth) % (2 * range + 1)) - range;
+}
+
+void
+track_synth_init(TrackSynth* synth, uint32_t seed)
+{
+    memset(synth, 0, sizeof(*synth));
+    synth->random = seed != 0 ? seed : 1;
+    synth->position.latitude_e7 = START_LAT_E7;
+    synth->position.longitude_e7 = START_LNG_E7;
+    synth->position.altitude_cm = 4200;
+    synth->position.satellites = 9;
+    synth->position.unix_time = START_TIME;
+    synth->position.is_valid = true;
+}
+
+void
+track_synth_next(TrackSynth* synth, GpsPosition* position)
+{
+    *position = synth->position;
+
+    GpsPosition* next = &synth->position;
+    next->unix_time += random_next(synth) % 500 == 0 ? 1 + random_next(synth) % 600 : 1;
+    for (int axis = 0; axis < 2; ++axis) {
+        int32_t* velocity = &synth->velocity_e7[axis];
+        *velocity += random_step(synth, 40);
+        *velocity = *velocity > MAX_VELOCITY_E7 ? MAX_VELOCITY_E7 : *velocity;
+        *velocity = *velocity < -MAX_VELOCITY_E7 ? -MAX_VELOCITY_E7 : *velocity;
+    }
+    // Receiver noise of a few centimetres on top
+    next->latitude_e7 += synth->velocity_e7[0] + random_step(synth, 5);
+    next->longitude_e7 += synth->velocity_e7[1] + random_step(synth, 5);
+    next->altitude_cm += random_step(synth, 30);
+    if (random_next(synth) % 60 == 0) {
+        next->satellites = 6 + random_next(synth) % 9;
+    }
+}
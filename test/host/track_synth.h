@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "gps.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * A synthetic 1 Hz track for the track log tests and tool: a drive that keeps changing speed
+     * and direction, with the altitude and satellite count drifting, and now and then a gap in
+     * the fixes as under a bridge or indoors. The same seed gives the same track.
+     */
+    typedef struct TrackSynth
+    {
+        uint32_t random;
+        int32_t velocity_e7[2]; // latitude and longitude change per second
+        GpsPosition position;
+    } TrackSynth;
+
+    void track_synth_init(TrackSynth* synth, uint32_t seed);
+
+    void track_synth_next(TrackSynth* synth, GpsPosition* position);
+
+#ifdef __cplusplus
+}
+#endif